@@ -0,0 +1,179 @@
+#include "../Project1/atlas_layout.h"
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Offline packer producing the game's single texture atlas.
+ *
+ * Usage: AtlasBuilder <atlas.png> <atlas.layout> <image files...>
+ *
+ * Every standalone texture the game loads is one more bind and one
+ * more batch break per frame, so this tool packs all game images into
+ * one atlas ahead of time and writes the UV table (see atlas_layout.h)
+ * the runtime resolves sprite rectangles from. Packing is a shelf
+ * algorithm over the images sorted by height: simple, deterministic,
+ * and within a few percent of optimal for the handful of sprite sheets
+ * and overlays the game ships. A one-pixel gutter separates entries so
+ * linear filtering never bleeds a neighbour's edge into a sprite.
+ */
+
+namespace {
+
+/// One image queued for packing, with its eventual atlas placement.
+struct Input {
+    std::string name; ///< Base file name; the lookup key in the table.
+    sf::Image pixels; ///< Decoded source image.
+    unsigned x = 0; ///< Assigned left edge in the atlas.
+    unsigned y = 0; ///< Assigned top edge in the atlas.
+};
+
+/**
+ * @brief Extracts the base file name from a path.
+ *
+ * @param path The input path.
+ * @return std::string The path component after the last separator.
+ */
+std::string baseName(const std::string& path)
+{
+    const std::size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? path : path.substr(separator + 1);
+}
+
+/**
+ * @brief Places every image on shelves within the given atlas width.
+ *
+ * Images arrive sorted by height, so each shelf is as short as its
+ * first occupant and later, shorter images fill it densely.
+ *
+ * @param inputs The images, heights descending; placements are written back.
+ * @param atlasWidth The fixed atlas width to pack into.
+ * @param gutter Pixels of empty space kept around every image.
+ * @return unsigned The total height the packing needs, in pixels.
+ */
+unsigned shelfPack(std::vector<Input>& inputs, unsigned atlasWidth, unsigned gutter)
+{
+    unsigned shelfTop = gutter;
+    unsigned shelfHeight = 0;
+    unsigned cursorX = gutter;
+    for (Input& input : inputs)
+    {
+        const unsigned width = input.pixels.getSize().x;
+        const unsigned height = input.pixels.getSize().y;
+        if (cursorX + width + gutter > atlasWidth)
+        {
+            shelfTop += shelfHeight + gutter;
+            shelfHeight = 0;
+            cursorX = gutter;
+        }
+        input.x = cursorX;
+        input.y = shelfTop;
+        cursorX += width + gutter;
+        shelfHeight = std::max(shelfHeight, height);
+    }
+    return shelfTop + shelfHeight + gutter;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 4)
+    {
+        std::fprintf(stderr, "usage: %s <atlas.png> <atlas.layout> <image files...>\n", argv[0]);
+        return 1;
+    }
+
+    const unsigned gutter = 1;
+    std::vector<Input> inputs;
+    for (int i = 3; i < argc; ++i)
+    {
+        Input input;
+        input.name = baseName(argv[i]);
+        if (input.name.size() >= sizeof(atlas::Entry{}.name))
+        {
+            std::fprintf(stderr, "name too long: %s\n", input.name.c_str());
+            return 1;
+        }
+        if (!input.pixels.loadFromFile(argv[i]))
+        {
+            std::fprintf(stderr, "cannot decode %s\n", argv[i]);
+            return 1;
+        }
+        inputs.push_back(std::move(input));
+    }
+
+    // Tall images first makes every shelf as short as possible; ties
+    // break on name so the same inputs always pack identically
+    std::sort(inputs.begin(), inputs.end(), [](const Input& a, const Input& b) {
+        if (a.pixels.getSize().y != b.pixels.getSize().y)
+            return a.pixels.getSize().y > b.pixels.getSize().y;
+        return a.name < b.name;
+    });
+
+    // Grow the power-of-two width until the packing comes out roughly
+    // square; GPUs have no trouble with tall atlases, but square ones
+    // waste the least space against the next power-of-two height
+    unsigned atlasWidth = 128;
+    unsigned usedHeight = 0;
+    for (;;)
+    {
+        bool fits = true;
+        for (const Input& input : inputs)
+            if (input.pixels.getSize().x + 2 * gutter > atlasWidth)
+                fits = false;
+        if (fits)
+        {
+            usedHeight = shelfPack(inputs, atlasWidth, gutter);
+            if (usedHeight <= atlasWidth)
+                break;
+        }
+        atlasWidth *= 2;
+    }
+    unsigned atlasHeight = 1;
+    while (atlasHeight < usedHeight)
+        atlasHeight *= 2;
+
+    sf::Image atlasImage;
+    atlasImage.create(atlasWidth, atlasHeight, sf::Color::Transparent);
+    for (const Input& input : inputs)
+        atlasImage.copy(input.pixels, input.x, input.y);
+
+    if (!atlasImage.saveToFile(argv[1]))
+    {
+        std::fprintf(stderr, "cannot write %s\n", argv[1]);
+        return 1;
+    }
+
+    std::FILE* layout = std::fopen(argv[2], "wb");
+    if (!layout)
+    {
+        std::fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 1;
+    }
+    atlas::Header header{};
+    std::memcpy(header.magic, "ATLS", 4);
+    header.version = atlas::layoutVersion;
+    header.entryCount = static_cast<std::uint32_t>(inputs.size());
+    header.atlasWidth = atlasWidth;
+    header.atlasHeight = atlasHeight;
+    std::fwrite(&header, sizeof(header), 1, layout);
+    for (const Input& input : inputs)
+    {
+        atlas::Entry entry{};
+        std::strncpy(entry.name, input.name.c_str(), sizeof(entry.name) - 1);
+        entry.x = input.x;
+        entry.y = input.y;
+        entry.width = input.pixels.getSize().x;
+        entry.height = input.pixels.getSize().y;
+        std::fwrite(&entry, sizeof(entry), 1, layout);
+    }
+    std::fclose(layout);
+
+    std::printf("packed %zu images into %ux%u (%u rows used)\n",
+                inputs.size(), atlasWidth, atlasHeight, usedHeight);
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include "../Project1/asset_bundle.h"
+#include "font_subset.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Offline packer producing the game's memory-mapped asset bundle.
+ *
+ * Usage: BundlePacker <output.bundle> [--subset-font <characters>] <asset files...>
+ *
+ * Each input file is stored under its base file name. The output layout
+ * (header, fixed-size entry table, raw bytes) matches asset_bundle.h so
+ * the game can map the file once and read assets in place.
+ *
+ * With --subset-font, every .ttf input is stripped to the given
+ * character set before packing (see font_subset.h): the game renders
+ * only the HUD strings, so shipping the full glyph repertoire wastes
+ * bundle bytes and sf::Font parse time on every boot.
+ */
+
+/**
+ * @brief Extracts the base file name from a path.
+ *
+ * @param path The input path.
+ * @return std::string The path component after the last separator.
+ */
+static std::string baseName(const std::string& path)
+{
+    const std::size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? path : path.substr(separator + 1);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::fprintf(stderr, "usage: %s <output.bundle> <asset files...>\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<bundle::Entry> entries;
+    std::vector<std::vector<unsigned char>> blobs;
+
+    std::string subsetCharacters;
+    int firstAsset = 2;
+    if (argc > 3 && std::strcmp(argv[2], "--subset-font") == 0)
+    {
+        subsetCharacters = argv[3];
+        firstAsset = 4;
+    }
+
+    for (int i = firstAsset; i < argc; ++i)
+    {
+        std::FILE* input = std::fopen(argv[i], "rb");
+        if (!input)
+        {
+            std::fprintf(stderr, "cannot open %s\n", argv[i]);
+            return 1;
+        }
+        std::fseek(input, 0, SEEK_END);
+        const long size = std::ftell(input);
+        std::fseek(input, 0, SEEK_SET);
+
+        std::vector<unsigned char> blob(static_cast<std::size_t>(size));
+        if (size > 0 && std::fread(blob.data(), 1, blob.size(), input) != blob.size())
+        {
+            std::fprintf(stderr, "cannot read %s\n", argv[i]);
+            std::fclose(input);
+            return 1;
+        }
+        std::fclose(input);
+
+        bundle::Entry entry = {};
+        const std::string name = baseName(argv[i]);
+
+        if (!subsetCharacters.empty() && name.size() > 4 && name.compare(name.size() - 4, 4, ".ttf") == 0)
+        {
+            std::vector<unsigned char> subset = subsetFont(blob, subsetCharacters);
+            if (subset.empty())
+            {
+                std::fprintf(stderr, "warning: %s is not subsettable, packing as-is\n", name.c_str());
+            }
+            else
+            {
+                std::printf("subset %s: %zu -> %zu bytes\n", name.c_str(), blob.size(), subset.size());
+                blob = std::move(subset);
+            }
+        }
+
+        if (name.size() >= sizeof(entry.name))
+        {
+            std::fprintf(stderr, "asset name too long: %s\n", name.c_str());
+            return 1;
+        }
+        std::strncpy(entry.name, name.c_str(), sizeof(entry.name) - 1);
+        entry.size = blob.size();
+        entries.push_back(entry);
+        blobs.push_back(std::move(blob));
+    }
+
+    // Data starts right after the header and the fixed-size entry table
+    std::uint64_t offset = sizeof(bundle::Header) + entries.size() * sizeof(bundle::Entry);
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        entries[i].offset = offset;
+        offset += entries[i].size;
+    }
+
+    bundle::Header header = {};
+    std::memcpy(header.magic, "BNDL", 4);
+    header.version = bundle::bundleVersion;
+    header.entryCount = static_cast<std::uint32_t>(entries.size());
+
+    std::FILE* output = std::fopen(argv[1], "wb");
+    if (!output)
+    {
+        std::fprintf(stderr, "cannot open %s for writing\n", argv[1]);
+        return 1;
+    }
+    std::fwrite(&header, sizeof(header), 1, output);
+    std::fwrite(entries.data(), sizeof(bundle::Entry), entries.size(), output);
+    for (const auto& blob : blobs)
+        std::fwrite(blob.data(), 1, blob.size(), output);
+    std::fclose(output);
+
+    std::printf("packed %zu assets into %s\n", entries.size(), argv[1]);
+    return 0;
+}
@@ -0,0 +1,304 @@
+#include "font_subset.h"
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief TrueType subsetting internals.
+ *
+ * All multi-byte values in a TrueType file are big-endian; these helpers
+ * read and write them from plain byte vectors with bounds checks that
+ * turn a malformed font into a clean failure instead of an overrun.
+ */
+namespace {
+
+/**
+ * @brief Reads a big-endian 16-bit value.
+ *
+ * @param data The font bytes.
+ * @param offset Byte offset of the value.
+ * @return std::uint16_t The value, or 0 if out of bounds.
+ */
+std::uint16_t readU16(const std::vector<unsigned char>& data, std::size_t offset)
+{
+    if (offset + 2 > data.size())
+        return 0;
+    return static_cast<std::uint16_t>(data[offset] << 8 | data[offset + 1]);
+}
+
+/**
+ * @brief Reads a big-endian 32-bit value.
+ *
+ * @param data The font bytes.
+ * @param offset Byte offset of the value.
+ * @return std::uint32_t The value, or 0 if out of bounds.
+ */
+std::uint32_t readU32(const std::vector<unsigned char>& data, std::size_t offset)
+{
+    if (offset + 4 > data.size())
+        return 0;
+    return static_cast<std::uint32_t>(data[offset]) << 24 | static_cast<std::uint32_t>(data[offset + 1]) << 16
+         | static_cast<std::uint32_t>(data[offset + 2]) << 8 | static_cast<std::uint32_t>(data[offset + 3]);
+}
+
+/**
+ * @brief Writes a big-endian 16-bit value in place.
+ *
+ * @param data The font bytes.
+ * @param offset Byte offset of the value.
+ * @param value The value to store.
+ */
+void writeU16(std::vector<unsigned char>& data, std::size_t offset, std::uint16_t value)
+{
+    data[offset] = static_cast<unsigned char>(value >> 8);
+    data[offset + 1] = static_cast<unsigned char>(value);
+}
+
+/**
+ * @brief Writes a big-endian 32-bit value in place.
+ *
+ * @param data The font bytes.
+ * @param offset Byte offset of the value.
+ * @param value The value to store.
+ */
+void writeU32(std::vector<unsigned char>& data, std::size_t offset, std::uint32_t value)
+{
+    data[offset] = static_cast<unsigned char>(value >> 24);
+    data[offset + 1] = static_cast<unsigned char>(value >> 16);
+    data[offset + 2] = static_cast<unsigned char>(value >> 8);
+    data[offset + 3] = static_cast<unsigned char>(value);
+}
+
+/**
+ * @brief One table of the font, located in the original file.
+ */
+struct Table {
+    char tag[5]; ///< Four-character table tag, NUL-terminated.
+    std::uint32_t offset; ///< Byte offset in the original file.
+    std::uint32_t length; ///< Byte length in the original file.
+};
+
+/**
+ * @brief Computes a TrueType table checksum.
+ *
+ * The sum of the data read as big-endian 32-bit words, with the table
+ * conceptually zero-padded to a word boundary.
+ *
+ * @param data The bytes to sum.
+ * @param offset First byte of the table.
+ * @param length Table length in bytes.
+ * @return std::uint32_t The checksum.
+ */
+std::uint32_t tableChecksum(const std::vector<unsigned char>& data, std::size_t offset, std::size_t length)
+{
+    std::uint32_t sum = 0;
+    for (std::size_t i = 0; i < length; i += 4)
+    {
+        std::uint32_t word = 0;
+        for (std::size_t b = 0; b < 4; ++b)
+            word = word << 8 | (i + b < length ? data[offset + i + b] : 0);
+        sum += word;
+    }
+    return sum;
+}
+
+/**
+ * @brief Maps a character to its glyph id through a format 4 cmap subtable.
+ *
+ * @param font The font bytes.
+ * @param subtable Offset of the format 4 subtable.
+ * @param character The character code to map.
+ * @return std::uint16_t The glyph id, or 0 (.notdef) if unmapped.
+ */
+std::uint16_t mapCharFormat4(const std::vector<unsigned char>& font, std::size_t subtable, std::uint16_t character)
+{
+    const std::uint16_t segCountX2 = readU16(font, subtable + 6);
+    const std::size_t endCodes = subtable + 14;
+    const std::size_t startCodes = endCodes + segCountX2 + 2;
+    const std::size_t idDeltas = startCodes + segCountX2;
+    const std::size_t idRangeOffsets = idDeltas + segCountX2;
+
+    for (std::uint16_t seg = 0; seg * 2 < segCountX2; ++seg)
+    {
+        if (character > readU16(font, endCodes + seg * 2))
+            continue;
+        const std::uint16_t start = readU16(font, startCodes + seg * 2);
+        if (character < start)
+            return 0;
+
+        const std::uint16_t rangeOffset = readU16(font, idRangeOffsets + seg * 2);
+        if (rangeOffset == 0)
+            return static_cast<std::uint16_t>(character + readU16(font, idDeltas + seg * 2));
+
+        // The range offset points into the glyph id array relative to
+        // its own position, per the format 4 definition
+        const std::size_t glyphIdAt = idRangeOffsets + seg * 2 + rangeOffset + (character - start) * 2;
+        const std::uint16_t glyph = readU16(font, glyphIdAt);
+        return glyph == 0 ? 0 : static_cast<std::uint16_t>(glyph + readU16(font, idDeltas + seg * 2));
+    }
+    return 0;
+}
+
+} // namespace
+
+/**
+ * @brief Strips a TrueType font down to a declared character set.
+ *
+ * @param ttf The original font file bytes.
+ * @param characters The characters whose outlines must be kept.
+ * @return std::vector<unsigned char> The subset font, or empty on failure.
+ */
+std::vector<unsigned char> subsetFont(const std::vector<unsigned char>& ttf, const std::string& characters)
+{
+    if (readU32(ttf, 0) != 0x00010000)
+        return {};  // Not a TrueType-outline font (e.g. CFF); leave it alone
+
+    const std::uint16_t numTables = readU16(ttf, 4);
+    std::vector<Table> tables;
+    Table head = {}, maxp = {}, loca = {}, glyf = {}, cmap = {};
+    for (std::uint16_t i = 0; i < numTables; ++i)
+    {
+        const std::size_t record = 12 + i * 16;
+        Table table;
+        std::memcpy(table.tag, ttf.data() + record, 4);
+        table.tag[4] = '\0';
+        table.offset = readU32(ttf, record + 8);
+        table.length = readU32(ttf, record + 12);
+        if (table.offset + table.length > ttf.size())
+            return {};
+        tables.push_back(table);
+
+        if (std::memcmp(table.tag, "head", 4) == 0) head = table;
+        if (std::memcmp(table.tag, "maxp", 4) == 0) maxp = table;
+        if (std::memcmp(table.tag, "loca", 4) == 0) loca = table;
+        if (std::memcmp(table.tag, "glyf", 4) == 0) glyf = table;
+        if (std::memcmp(table.tag, "cmap", 4) == 0) cmap = table;
+    }
+    if (head.length == 0 || maxp.length == 0 || loca.length == 0 || glyf.length == 0 || cmap.length == 0)
+        return {};
+
+    const std::uint16_t numGlyphs = readU16(ttf, maxp.offset + 4);
+    const bool longLoca = readU16(ttf, head.offset + 50) != 0;
+
+    // Original per-glyph offsets into glyf
+    std::vector<std::uint32_t> offsets(numGlyphs + 1);
+    for (std::size_t g = 0; g <= numGlyphs; ++g)
+        offsets[g] = longLoca ? readU32(ttf, loca.offset + g * 4)
+                              : readU16(ttf, loca.offset + g * 2) * 2u;
+
+    // Prefer the Windows Unicode BMP subtable, the one SFML's FreeType
+    // path uses; fall back to any Unicode subtable
+    std::size_t subtable = 0;
+    const std::uint16_t cmapCount = readU16(ttf, cmap.offset + 2);
+    for (std::uint16_t i = 0; i < cmapCount; ++i)
+    {
+        const std::size_t record = cmap.offset + 4 + i * 8;
+        const std::uint16_t platform = readU16(ttf, record);
+        const std::uint16_t encoding = readU16(ttf, record + 2);
+        if ((platform == 3 && encoding == 1) || (subtable == 0 && platform == 0))
+            subtable = cmap.offset + readU32(ttf, record + 4);
+    }
+    if (subtable == 0 || readU16(ttf, subtable) != 4)
+        return {};
+
+    // Mark the declared characters' glyphs, then close over composite
+    // components so an accented or built-up glyph keeps its parts
+    std::vector<bool> keep(numGlyphs, false);
+    keep[0] = true;  // .notdef renders for everything stripped
+    std::vector<std::uint16_t> worklist;
+    for (unsigned char character : characters)
+    {
+        const std::uint16_t glyph = mapCharFormat4(ttf, subtable, character);
+        if (glyph < numGlyphs && !keep[glyph])
+        {
+            keep[glyph] = true;
+            worklist.push_back(glyph);
+        }
+    }
+    while (!worklist.empty())
+    {
+        const std::uint16_t glyph = worklist.back();
+        worklist.pop_back();
+        if (offsets[glyph + 1] <= offsets[glyph])
+            continue;  // Empty glyph, nothing to scan
+
+        const std::size_t data = glyf.offset + offsets[glyph];
+        if (static_cast<std::int16_t>(readU16(ttf, data)) >= 0)
+            continue;  // Simple glyph, no components
+
+        std::size_t component = data + 10;
+        std::uint16_t flags;
+        do
+        {
+            flags = readU16(ttf, component);
+            const std::uint16_t part = readU16(ttf, component + 2);
+            if (part < numGlyphs && !keep[part])
+            {
+                keep[part] = true;
+                worklist.push_back(part);
+            }
+            component += 4 + ((flags & 0x0001) ? 4 : 2);  // Arguments
+            if (flags & 0x0008) component += 2;           // Single scale
+            else if (flags & 0x0040) component += 4;      // X and Y scale
+            else if (flags & 0x0080) component += 8;      // 2x2 transform
+        } while (flags & 0x0020);  // More components follow
+    }
+
+    // Rebuild glyf with only the kept outlines and loca to match; a
+    // stripped glyph becomes zero-length, which renders as empty
+    std::vector<unsigned char> newGlyf;
+    std::vector<std::uint32_t> newOffsets(numGlyphs + 1);
+    for (std::size_t g = 0; g < numGlyphs; ++g)
+    {
+        newOffsets[g] = static_cast<std::uint32_t>(newGlyf.size());
+        if (keep[g] && offsets[g + 1] > offsets[g])
+        {
+            newGlyf.insert(newGlyf.end(), ttf.begin() + glyf.offset + offsets[g], ttf.begin() + glyf.offset + offsets[g + 1]);
+            while (newGlyf.size() % 4 != 0)
+                newGlyf.push_back(0);  // Keep every outline word-aligned
+        }
+    }
+    newOffsets[numGlyphs] = static_cast<std::uint32_t>(newGlyf.size());
+
+    std::vector<unsigned char> newLoca(longLoca ? (numGlyphs + 1) * 4 : (numGlyphs + 1) * 2);
+    for (std::size_t g = 0; g <= numGlyphs; ++g)
+    {
+        if (longLoca)
+            writeU32(newLoca, g * 4, newOffsets[g]);
+        else
+            writeU16(newLoca, g * 2, static_cast<std::uint16_t>(newOffsets[g] / 2));
+    }
+
+    // Reassemble the file: same tables in the same order, with glyf and
+    // loca replaced and every offset, length and checksum recomputed
+    std::vector<unsigned char> out(12 + tables.size() * 16, 0);
+    std::memcpy(out.data(), ttf.data(), out.size());
+
+    std::size_t headOffsetOut = 0;
+    for (std::size_t i = 0; i < tables.size(); ++i)
+    {
+        const bool isGlyf = std::memcmp(tables[i].tag, "glyf", 4) == 0;
+        const bool isLoca = std::memcmp(tables[i].tag, "loca", 4) == 0;
+        const unsigned char* src = isGlyf ? newGlyf.data() : isLoca ? newLoca.data() : ttf.data() + tables[i].offset;
+        const std::size_t length = isGlyf ? newGlyf.size() : isLoca ? newLoca.size() : tables[i].length;
+
+        const std::size_t offset = out.size();
+        out.insert(out.end(), src, src + length);
+        while (out.size() % 4 != 0)
+            out.push_back(0);
+
+        if (std::memcmp(tables[i].tag, "head", 4) == 0)
+        {
+            headOffsetOut = offset;
+            writeU32(out, offset + 8, 0);  // checkSumAdjustment participates as zero
+        }
+
+        const std::size_t record = 12 + i * 16;
+        writeU32(out, record + 4, tableChecksum(out, offset, length));
+        writeU32(out, record + 8, static_cast<std::uint32_t>(offset));
+        writeU32(out, record + 12, static_cast<std::uint32_t>(length));
+    }
+
+    // Whole-file checksum closes the format's integrity equation
+    writeU32(out, headOffsetOut + 8, 0xB1B0AFBAu - tableChecksum(out, 0, out.size()));
+    return out;
+}
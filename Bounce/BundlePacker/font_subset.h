@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+#include <vector>
+
+/**
+ * @brief Strips a TrueType font down to a declared character set.
+ *
+ * Every glyph outline not reachable from the given characters (including
+ * components of kept composite glyphs and the .notdef glyph) is removed
+ * from the glyf table and the loca table is rebuilt, which is where
+ * nearly all of a font's bytes live. Glyph ids, the character map and
+ * the metrics tables are left untouched, so the subset font renders the
+ * declared characters identically to the original and any other
+ * character as an empty glyph.
+ *
+ * @param ttf The original font file bytes.
+ * @param characters The characters whose outlines must be kept.
+ * @return std::vector<unsigned char> The subset font, or empty if the
+ * font is not a TrueType-outline file this subsetter understands (the
+ * caller should then pack the original bytes unchanged).
+ */
+std::vector<unsigned char> subsetFont(const std::vector<unsigned char>& ttf, const std::string& characters);
@@ -0,0 +1,135 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+/**
+ * @brief Finds the index of the lowest set bit of a non-zero 64-bit word.
+ *
+ * @param word The word to scan; must not be zero.
+ * @return unsigned The zero-based index of the lowest set bit.
+ */
+inline unsigned lowestSetBit(std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+}
+
+/**
+ * @brief Hints the cache to pull one line for reading.
+ *
+ * Mask iteration knows its future: the next word names the next 64
+ * entity slots before their records are touched, so a walk can pull
+ * the upcoming lines while the current word's bits are peeled.
+ *
+ * @param address Any address within the line to pull.
+ */
+inline void prefetchRead(const void* address)
+{
+#if defined(_MSC_VER)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    __builtin_prefetch(address, 0, 3);
+#endif
+}
+
+/**
+ * @brief Packed alive bitmask over a stable entity array.
+ *
+ * Entities stay at fixed indices; this mask records which of them are
+ * still live. Clearing an entity is an O(1) bit clear, reviving the
+ * whole set is a handful of word stores, and iteration visits only the
+ * set bits by peeling the lowest bit of each word, so sparse arrays are
+ * skipped without per-entity branching.
+ */
+class AliveMask {
+public:
+    /**
+     * @brief Sizes the mask for a given entity count with all bits set.
+     *
+     * @param count Number of entities tracked by the mask.
+     */
+    void resetAll(std::size_t count)
+    {
+        entityCount = count;
+        words.assign((count + 63) / 64, ~std::uint64_t(0));
+        if (count % 64 != 0 && !words.empty())
+            words.back() = (std::uint64_t(1) << (count % 64)) - 1;
+    }
+
+    /**
+     * @brief Marks one entity as dead.
+     *
+     * @param index Index of the entity to clear.
+     */
+    void clear(std::size_t index)
+    {
+        words[index / 64] &= ~(std::uint64_t(1) << (index % 64));
+    }
+
+    /**
+     * @brief Tests whether one entity is still alive.
+     *
+     * @param index Index of the entity to test.
+     * @return true If the entity is alive.
+     * @return false If the entity is dead.
+     */
+    bool test(std::size_t index) const
+    {
+        return (words[index / 64] >> (index % 64)) & 1;
+    }
+
+    /**
+     * @brief Invokes a callable for every live entity index.
+     *
+     * Each word is copied before peeling, so the callable may clear bits
+     * (e.g. on pickup) while the iteration is in progress.
+     *
+     * @param callable Invoked as callable(std::size_t index).
+     */
+    template <typename Callable>
+    void forEachSet(Callable&& callable) const
+    {
+        for (std::size_t w = 0; w < words.size(); ++w)
+        {
+            std::uint64_t word = words[w];
+            while (word != 0)
+            {
+                const unsigned bit = lowestSetBit(word);
+                callable(w * 64 + bit);
+                word &= word - 1;  // Clear the lowest set bit
+            }
+        }
+    }
+
+    /**
+     * @brief Number of 64-bit words backing the mask.
+     *
+     * @return std::size_t The word count; fixed by resetAll.
+     */
+    std::size_t wordCount() const { return words.size(); }
+
+    /**
+     * @brief Raw word storage, for bulk snapshot and restore.
+     *
+     * The savestate path memcpys the words in and out of its POD block;
+     * the mask's entity count is never changed that way, only the bits.
+     *
+     * @return std::uint64_t* The word array, wordCount() entries.
+     */
+    std::uint64_t* wordData() { return words.data(); }
+    const std::uint64_t* wordData() const { return words.data(); }
+
+private:
+    std::vector<std::uint64_t> words; ///< Bit storage, 64 entities per word.
+    std::size_t entityCount = 0; ///< Number of entities tracked.
+};
@@ -0,0 +1,199 @@
+#include "alloc_tracker.h"
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+namespace alloctrack {
+
+/**
+ * @brief The calling thread's counters.
+ *
+ * @return ThreadCounters& The thread-local counter block.
+ */
+ThreadCounters& counters()
+{
+    // Plain POD: construction allocates nothing, so the hooks below
+    // can call this safely from inside an allocation
+    thread_local ThreadCounters block;
+    return block;
+}
+
+namespace {
+
+/**
+ * @brief Counts one allocation against the calling thread.
+ *
+ * @param bytes The requested size.
+ */
+void note(std::size_t bytes)
+{
+    ThreadCounters& block = counters();
+    block.count++;
+    block.bytes += bytes;
+    if (block.forbidDepth > 0)
+    {
+        block.violations++;
+        assert(!"heap allocation inside a forbidden hot scope");
+    }
+}
+
+/**
+ * @brief Prefix stamped in front of every tracked allocation.
+ *
+ * Records the size and the owning subsystem so the matching delete —
+ * on whatever thread, however much later — charges the exact bytes
+ * back to the right gauge. Sixteen bytes keeps the returned pointer
+ * at max_align_t alignment.
+ */
+struct Header {
+    std::uint64_t bytes; ///< Requested size of the allocation.
+    std::uint32_t tag; ///< Subsystem the bytes were charged to.
+    std::uint32_t magic; ///< Stamp distinguishing tracked blocks.
+};
+
+constexpr std::uint32_t headerMagic = 0xA110CA7Eu; ///< "alloc ate".
+static_assert(sizeof(Header) == 16, "returned pointers must stay max-aligned");
+
+/**
+ * @brief One subsystem's gauges; atomics since any thread may free.
+ */
+struct AtomicFootprint {
+    std::atomic<std::uint64_t> liveBytes{ 0 }; ///< Bytes currently held.
+    std::atomic<std::uint64_t> peakBytes{ 0 }; ///< Highest liveBytes seen.
+    std::atomic<std::uint64_t> liveCount{ 0 }; ///< Allocations currently held.
+};
+
+AtomicFootprint g_footprint[SubsystemCount]; ///< Per-subsystem gauges.
+
+/**
+ * @brief Charges an allocation to a subsystem's gauges.
+ *
+ * @param tag The owning subsystem.
+ * @param bytes The requested size.
+ */
+void charge(std::uint32_t tag, std::uint64_t bytes)
+{
+    AtomicFootprint& gauge = g_footprint[tag];
+    const std::uint64_t live = gauge.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    gauge.liveCount.fetch_add(1, std::memory_order_relaxed);
+    // Racy-but-monotonic peak: a lost race only re-runs the loop
+    std::uint64_t peak = gauge.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !gauge.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Returns an allocation's bytes to its subsystem's gauges.
+ *
+ * @param tag The subsystem the bytes were charged to.
+ * @param bytes The size recorded at allocation.
+ */
+void discharge(std::uint32_t tag, std::uint64_t bytes)
+{
+    AtomicFootprint& gauge = g_footprint[tag];
+    gauge.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    gauge.liveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+/**
+ * @brief A consistent snapshot of one subsystem's footprint.
+ *
+ * @param tag The subsystem to read.
+ * @return SubsystemCounters Copy of the live/peak gauges.
+ */
+SubsystemCounters subsystemFootprint(Subsystem tag)
+{
+    const AtomicFootprint& gauge = g_footprint[tag];
+    SubsystemCounters out;
+    out.liveBytes = gauge.liveBytes.load(std::memory_order_relaxed);
+    out.peakBytes = gauge.peakBytes.load(std::memory_order_relaxed);
+    out.liveCount = gauge.liveCount.load(std::memory_order_relaxed);
+    return out;
+}
+
+} // namespace alloctrack
+
+/**
+ * @brief Counting replacements for the global allocation functions.
+ *
+ * Forward to malloc/free through a size-and-tag header, so each free
+ * charges its bytes back to the subsystem that allocated them. Sized
+ * deletes forward to the same helpers so every path stays in one
+ * place.
+ */
+namespace {
+
+/**
+ * @brief Allocates, stamps the header and charges the gauges.
+ *
+ * @param bytes The requested size.
+ * @return void* The caller's pointer, just past the header.
+ */
+void* allocateTracked(std::size_t bytes)
+{
+    alloctrack::note(bytes);
+    auto* header = static_cast<alloctrack::Header*>(std::malloc(sizeof(alloctrack::Header) + (bytes == 0 ? 1 : bytes)));
+    if (!header)
+        throw std::bad_alloc();
+    header->bytes = bytes;
+    header->tag = static_cast<std::uint32_t>(alloctrack::counters().tag);
+    header->magic = alloctrack::headerMagic;
+    alloctrack::charge(header->tag, bytes);
+    return header + 1;
+}
+
+/**
+ * @brief Discharges the gauges and frees a tracked block.
+ *
+ * @param p The caller's pointer; null is a no-op.
+ */
+void freeTracked(void* p) noexcept
+{
+    if (!p)
+        return;
+    auto* header = static_cast<alloctrack::Header*>(p) - 1;
+    if (header->magic != alloctrack::headerMagic)
+    {
+        std::free(p);  // Not ours (e.g. handed over from a C library)
+        return;
+    }
+    header->magic = 0;  // A double delete now misses the magic check
+    alloctrack::discharge(header->tag, header->bytes);
+    std::free(header);
+}
+
+} // namespace
+
+void* operator new(std::size_t bytes)
+{
+    return allocateTracked(bytes);
+}
+
+void* operator new[](std::size_t bytes)
+{
+    return allocateTracked(bytes);
+}
+
+void operator delete(void* p) noexcept
+{
+    freeTracked(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    freeTracked(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    freeTracked(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    freeTracked(p);
+}
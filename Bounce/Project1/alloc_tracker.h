@@ -0,0 +1,144 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Heap-allocation tracking for the hot loops.
+ *
+ * Global operator new/delete are replaced (alloc_tracker.cpp) with
+ * forwarding hooks that bump thread-local counters — two plain
+ * increments per allocation, no atomics, no locks — so "no allocations
+ * on the hot path" is measurable instead of hoped. The frame profiler
+ * reads this thread's counter at each phase marker and attributes the
+ * diff to the phase, putting an allocs-per-phase line on the overlay.
+ *
+ * Designated hot scopes go further: a ForbidScope makes any allocation
+ * on this thread a violation — counted always, and an assert in debug
+ * builds, so a reintroduced hidden allocation fails loudly in CI
+ * rather than showing up as a field hitch. Scopes take an `armed` flag
+ * because first-pass work (vector warm-up, lazy GL state) legitimately
+ * allocates; callers arm them once the steady state is reached.
+ */
+namespace alloctrack {
+
+/**
+ * @brief Subsystems the footprint accounting attributes bytes to.
+ *
+ * Every allocation is charged to the tag its thread currently carries
+ * (see TagScope); Untagged catches whatever runs outside a scope.
+ */
+enum Subsystem {
+    Untagged = 0, ///< Allocations outside any tag scope.
+    Entities, ///< Entity store, broadphases, chunk streaming.
+    Render, ///< Render-thread working set: batches, queues, text.
+    Assets, ///< Decoded images, fonts, bundle bookkeeping.
+    Audio, ///< Sound buffers and the music stream.
+    Net, ///< Sockets, datagram queues, snapshot buffers.
+    SubsystemCount ///< Number of tags.
+};
+
+/**
+ * @brief Live and peak footprint of one subsystem.
+ *
+ * Live bytes move on every new/delete (the allocation header records
+ * size and tag, so a free is charged back to the right gauge no matter
+ * which thread runs it); the peak is the high-water mark since start.
+ * Kiosk boxes swap when anything leaks, so this is the gauge watched
+ * before the leak, not the crash dump read after it.
+ */
+struct SubsystemCounters {
+    std::uint64_t liveBytes = 0; ///< Bytes currently held.
+    std::uint64_t peakBytes = 0; ///< Highest liveBytes ever seen.
+    std::uint64_t liveCount = 0; ///< Allocations currently held.
+};
+
+/**
+ * @brief A consistent snapshot of one subsystem's footprint.
+ *
+ * @param tag The subsystem to read.
+ * @return SubsystemCounters Copy of the live/peak gauges.
+ */
+SubsystemCounters subsystemFootprint(Subsystem tag);
+
+/**
+ * @brief This thread's allocation counters.
+ */
+struct ThreadCounters {
+    std::uint64_t count = 0; ///< Allocations on this thread.
+    std::uint64_t bytes = 0; ///< Bytes requested on this thread.
+    std::uint64_t violations = 0; ///< Allocations inside a forbid scope.
+    int forbidDepth = 0; ///< Nested forbid scopes currently open.
+    int tag = Untagged; ///< Subsystem charged for this thread's allocations.
+};
+
+/**
+ * @brief The calling thread's counters.
+ *
+ * @return ThreadCounters& The thread-local counter block.
+ */
+ThreadCounters& counters();
+
+/**
+ * @brief Marks a scope where allocating is a bug.
+ *
+ * Violations are counted; debug builds additionally assert so the
+ * offending callstack is in the debugger.
+ */
+class ForbidScope {
+public:
+    /**
+     * @brief Opens the scope.
+     *
+     * @param armed False disables enforcement (e.g. during warm-up).
+     */
+    explicit ForbidScope(bool armed = true) : active(armed)
+    {
+        if (active)
+            ++counters().forbidDepth;
+    }
+
+    ~ForbidScope()
+    {
+        if (active)
+            --counters().forbidDepth;
+    }
+
+    ForbidScope(const ForbidScope&) = delete;
+    ForbidScope& operator=(const ForbidScope&) = delete;
+
+private:
+    bool active; ///< Whether this scope enforces.
+};
+
+/**
+ * @brief Charges this thread's allocations to a subsystem for a scope.
+ *
+ * Scopes nest; the previous tag is restored on exit. A thread whose
+ * whole life belongs to one subsystem (the render thread, an asset
+ * worker) opens one scope at its entry point and leaves it there.
+ */
+class TagScope {
+public:
+    /**
+     * @brief Opens the scope.
+     *
+     * @param tag The subsystem to charge while the scope is open.
+     */
+    explicit TagScope(Subsystem tag) : previous(counters().tag)
+    {
+        counters().tag = tag;
+    }
+
+    ~TagScope()
+    {
+        counters().tag = previous;
+    }
+
+    TagScope(const TagScope&) = delete;
+    TagScope& operator=(const TagScope&) = delete;
+
+private:
+    int previous; ///< Tag restored when the scope closes.
+};
+
+} // namespace alloctrack
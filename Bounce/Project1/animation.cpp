@@ -0,0 +1,83 @@
+#include "animation.h"
+
+/**
+ * @brief Registers a clip and precomputes its frame table.
+ *
+ * @param x Atlas x of the first frame.
+ * @param y Atlas y of the frame row.
+ * @param frameWidth Width of each frame in pixels.
+ * @param frameHeight Height of each frame in pixels.
+ * @param frameCount Number of frames in the clip.
+ * @param fps Playback rate in frames per second.
+ * @return AnimationSystem::ClipId Id to assign to entities with setClip.
+ */
+AnimationSystem::ClipId AnimationSystem::addClip(float x, float y, float frameWidth, float frameHeight,
+                                                 std::size_t frameCount, float fps)
+{
+    Clip clip;
+    clip.frames.reserve(frameCount);
+    for (std::size_t i = 0; i < frameCount; ++i)
+        clip.frames.emplace_back(x + frameWidth * i, y, frameWidth, frameHeight);
+    clip.frameDuration = 1.0f / fps;
+    clip.length = clip.frameDuration * frameCount;
+
+    clips.push_back(std::move(clip));
+    return clips.size() - 1;
+}
+
+/**
+ * @brief Sizes the cursor arrays for the level's animated entities.
+ *
+ * @param count Number of animated entities.
+ */
+void AnimationSystem::setEntityCount(std::size_t count)
+{
+    cursor.assign(count, 0.0f);
+    clipOf.assign(count, 0);
+}
+
+/**
+ * @brief Assigns a clip to one entity.
+ *
+ * @param entity Entity index in [0, entity count).
+ * @param clip Clip from addClip.
+ * @param phase Starting offset in seconds.
+ */
+void AnimationSystem::setClip(std::size_t entity, ClipId clip, float phase)
+{
+    clipOf[entity] = clip;
+    cursor[entity] = phase - static_cast<int>(phase / clips[clip].length) * clips[clip].length;
+}
+
+/**
+ * @brief Advances every cursor by a frame.
+ *
+ * @param dt Frame duration in seconds.
+ */
+void AnimationSystem::advance(float dt)
+{
+    // One straight pass over the cursor array; the wrap is a subtract,
+    // not a divide, because dt is always far smaller than a clip
+    for (std::size_t i = 0; i < cursor.size(); ++i)
+    {
+        cursor[i] += dt;
+        const float length = clips[clipOf[i]].length;
+        if (cursor[i] >= length)
+            cursor[i] -= length;
+    }
+}
+
+/**
+ * @brief The atlas rectangle of an entity's current frame.
+ *
+ * @param entity Entity index in [0, entity count).
+ * @return const sf::FloatRect& The frame's atlas rectangle.
+ */
+const sf::FloatRect& AnimationSystem::frameRect(std::size_t entity) const
+{
+    const Clip& clip = clips[clipOf[entity]];
+    std::size_t frame = static_cast<std::size_t>(cursor[entity] / clip.frameDuration);
+    if (frame >= clip.frames.size())
+        frame = clip.frames.size() - 1; // Float edge at the exact clip end
+    return clip.frames[frame];
+}
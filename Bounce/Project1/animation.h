@@ -0,0 +1,88 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Sprite-sheet animation with precomputed frame tables.
+ *
+ * A clip is a run of equally sized frames in the texture atlas; its
+ * frame rectangles are computed once when the clip is registered, so
+ * playback never does per-frame rectangle math. Each animated entity
+ * is a cursor into one clip, stored in parallel arrays and advanced
+ * for all entities in a single pass per frame. The current frame is
+ * exposed as an atlas rectangle for the batch renderer's textured
+ * path, so any number of animated entities still bind one texture
+ * and cost zero individual draw calls. Purely cosmetic — the system
+ * lives on the render thread and never touches simulation state.
+ */
+class AnimationSystem {
+public:
+    /**
+     * @brief Identifies one registered clip; see addClip.
+     */
+    using ClipId = std::size_t;
+
+    /**
+     * @brief Registers a clip and precomputes its frame table.
+     *
+     * Frames are laid out left to right in one row of the atlas.
+     *
+     * @param x Atlas x of the first frame.
+     * @param y Atlas y of the frame row.
+     * @param frameWidth Width of each frame in pixels.
+     * @param frameHeight Height of each frame in pixels.
+     * @param frameCount Number of frames in the clip.
+     * @param fps Playback rate in frames per second.
+     * @return ClipId Id to assign to entities with setClip.
+     */
+    ClipId addClip(float x, float y, float frameWidth, float frameHeight,
+                   std::size_t frameCount, float fps);
+
+    /**
+     * @brief Sizes the cursor arrays for the level's animated entities.
+     *
+     * @param count Number of animated entities.
+     */
+    void setEntityCount(std::size_t count);
+
+    /**
+     * @brief Assigns a clip to one entity.
+     *
+     * @param entity Entity index in [0, entity count).
+     * @param clip Clip from addClip.
+     * @param phase Starting offset in seconds, so a field of identical
+     * entities does not tick through frames in lockstep.
+     */
+    void setClip(std::size_t entity, ClipId clip, float phase = 0.0f);
+
+    /**
+     * @brief Advances every cursor by a frame; one pass, no branches
+     * beyond the loop wrap.
+     *
+     * @param dt Frame duration in seconds.
+     */
+    void advance(float dt);
+
+    /**
+     * @brief The atlas rectangle of an entity's current frame.
+     *
+     * @param entity Entity index in [0, entity count).
+     * @return const sf::FloatRect& The frame's atlas rectangle.
+     */
+    const sf::FloatRect& frameRect(std::size_t entity) const;
+
+private:
+    /**
+     * @brief One clip: its precomputed frames and timing.
+     */
+    struct Clip {
+        std::vector<sf::FloatRect> frames; ///< Atlas rectangle per frame.
+        float frameDuration = 0.0f; ///< Seconds per frame.
+        float length = 0.0f; ///< Clip duration in seconds.
+    };
+
+    std::vector<Clip> clips; ///< All registered clips.
+    std::vector<float> cursor; ///< Per-entity playback position in seconds.
+    std::vector<ClipId> clipOf; ///< Per-entity clip assignment.
+};
@@ -0,0 +1,55 @@
+#include "asset_bundle.h"
+#include <cstring>
+
+/**
+ * @brief Memory-maps a bundle file and validates its header.
+ *
+ * The mapping is read-only and shared: several game instances opening
+ * the same bundle reference one copy of its pages in the page cache.
+ *
+ * @param path Path to the bundle file.
+ * @return true If the bundle was mapped and its header is valid.
+ * @return false If the file is missing, unmappable or malformed.
+ */
+bool AssetBundle::open(const std::string& path)
+{
+    if (!mapping.open(path) || mapping.size() < sizeof(bundle::Header))
+        return false;
+
+    const bundle::Header* header = reinterpret_cast<const bundle::Header*>(mapping.data());
+    if (std::memcmp(header->magic, "BNDL", 4) != 0 || header->version != bundle::bundleVersion)
+        return false;
+    if (sizeof(bundle::Header) + header->entryCount * sizeof(bundle::Entry) > mapping.size())
+        return false;
+
+    return true;
+}
+
+/**
+ * @brief Looks up an asset by name.
+ *
+ * @param name The asset name as written by the packer.
+ * @param outSize Receives the asset size in bytes on success.
+ * @return const void* Pointer into the mapping, or nullptr if not found.
+ */
+const void* AssetBundle::find(const char* name, std::size_t& outSize) const
+{
+    const unsigned char* data = mapping.data();
+    if (!data)
+        return nullptr;
+
+    const bundle::Header* header = reinterpret_cast<const bundle::Header*>(data);
+    const bundle::Entry* entries = reinterpret_cast<const bundle::Entry*>(data + sizeof(bundle::Header));
+
+    for (std::uint32_t i = 0; i < header->entryCount; ++i)
+    {
+        if (std::strncmp(entries[i].name, name, sizeof(entries[i].name)) == 0)
+        {
+            if (entries[i].offset + entries[i].size > mapping.size())
+                return nullptr;
+            outSize = static_cast<std::size_t>(entries[i].size);
+            return data + entries[i].offset;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "mapped_file.h"
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief On-disk layout of the packed asset bundle.
+ *
+ * The bundle is a header, a fixed-size entry table and the raw asset
+ * bytes, all POD, so the whole file can be memory-mapped once and handed
+ * to sf::Font/sf::Texture::loadFromMemory without any per-file open or
+ * read syscalls. Multiple game instances mapping the same bundle share
+ * one copy in the OS page cache. The companion BundlePacker tool in the
+ * solution produces these files.
+ */
+namespace bundle {
+
+constexpr std::uint32_t bundleVersion = 1; ///< Bumped on any layout change.
+
+/**
+ * @brief Fixed header at the start of every bundle file.
+ */
+struct Header {
+    char magic[4]; ///< "BNDL".
+    std::uint32_t version; ///< Must equal bundleVersion.
+    std::uint32_t entryCount; ///< Number of entries in the table that follows.
+    std::uint32_t reserved; ///< Padding; keeps the entry table 8-byte aligned.
+};
+
+/**
+ * @brief One entry in the bundle's asset table.
+ */
+struct Entry {
+    char name[48]; ///< Zero-terminated asset name (the original file name).
+    std::uint64_t offset; ///< Byte offset of the asset data from the start of the file.
+    std::uint64_t size; ///< Size of the asset data in bytes.
+};
+
+} // namespace bundle
+
+/**
+ * @brief Memory-mapped view of a packed asset bundle.
+ *
+ * open() maps the whole file once; find() returns a pointer straight
+ * into the mapping, valid for the lifetime of the bundle object, so
+ * loadFromMemory consumers never copy the asset bytes.
+ */
+class AssetBundle {
+public:
+    /**
+     * @brief Memory-maps a bundle file and validates its header.
+     *
+     * @param path Path to the bundle file.
+     * @return true If the bundle was mapped and its header is valid.
+     * @return false If the file is missing, unmappable or malformed.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Looks up an asset by name.
+     *
+     * @param name The asset name as written by the packer.
+     * @param outSize Receives the asset size in bytes on success.
+     * @return const void* Pointer into the mapping, or nullptr if not found.
+     */
+    const void* find(const char* name, std::size_t& outSize) const;
+
+private:
+    MappedFile mapping; ///< The whole bundle file, mapped read-only shared.
+};
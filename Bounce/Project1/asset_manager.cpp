@@ -0,0 +1,255 @@
+#include "asset_manager.h"
+#include "file_watch.h"
+#include "alloc_tracker.h"
+#include "thread_control.h"
+#include <chrono>
+
+/**
+ * @brief Joins any outstanding worker threads.
+ */
+AssetManager::~AssetManager()
+{
+    reloadWatching.store(false, std::memory_order_release);
+    if (reloadWatcher.joinable())
+        reloadWatcher.join();
+    for (auto& worker : workers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+/**
+ * @brief Memory-maps the packed asset bundle.
+ *
+ * @param path Path to the bundle file.
+ * @return true If the bundle was mapped successfully.
+ * @return false If the bundle is missing or malformed.
+ */
+bool AssetManager::openBundle(const std::string& path)
+{
+    bundleMapped = bundle.open(path);
+    return bundleMapped;
+}
+
+/**
+ * @brief Starts loading the HUD font on a worker thread.
+ *
+ * @param name Asset name inside the bundle.
+ * @param fallbackPath Loose-file path used when the bundle is absent.
+ */
+void AssetManager::requestFont(const std::string& name, const std::string& fallbackPath)
+{
+    fontLoosePath = fallbackPath;
+    fontModifiedTime = fileModifiedTime(fallbackPath);
+    workers.emplace_back([this, name, fallbackPath]() {
+        alloctrack::TagScope assetsTag(alloctrack::Assets);
+        sf::Font& slot = fonts[0];
+        std::size_t size = 0;
+        const void* bytes = bundleMapped ? bundle.find(name.c_str(), size) : nullptr;
+        const bool loaded = bytes ? slot.loadFromMemory(bytes, size)
+                                  : slot.loadFromFile(fallbackPath);
+        if (loaded)
+        {
+            // Pre-rasterize the declared glyph sets into the atlas here
+            // on the worker, so no first-use rasterization or texture
+            // upload ever lands on a rendered frame
+            for (const auto& set : prewarmSets)
+                for (char character : set.first)
+                    slot.getGlyph(static_cast<sf::Uint32>(character), set.second, false);
+            fontLoaded.store(true, std::memory_order_release);
+        }
+    });
+}
+
+/**
+ * @brief Declares glyphs to pre-rasterize when the font loads.
+ *
+ * @param characters The characters to pre-rasterize.
+ * @param characterSize The text size they will be drawn at.
+ */
+void AssetManager::declareGlyphs(const std::string& characters, unsigned int characterSize)
+{
+    prewarmSets.emplace_back(characters, characterSize);
+}
+
+/**
+ * @brief Requests a texture through the decode pipeline.
+ *
+ * @param name Asset name inside the bundle.
+ * @param fallbackPath Loose-file path used when the bundle is absent.
+ * @return TextureHandle Handle to poll with textureReady().
+ */
+TextureHandle AssetManager::requestTexture(const std::string& name, const std::string& fallbackPath)
+{
+    TextureRequest* request;
+    TextureHandle handle;
+    {
+        std::lock_guard<std::mutex> lock(texturesMutex);
+        textures.push_back(std::unique_ptr<TextureRequest>(new TextureRequest()));
+        request = textures.back().get();
+        request->loosePath = fallbackPath;
+        request->modifiedTime = fileModifiedTime(fallbackPath);
+        handle = textures.size() - 1;
+    }
+
+    workers.emplace_back([this, request, name, fallbackPath]() {
+        alloctrack::TagScope assetsTag(alloctrack::Assets);
+        // The decode (inflate + unfilter) is the expensive part and runs
+        // here; the GPU upload waits for uploadDecoded() on the render
+        // thread
+        std::size_t size = 0;
+        const void* bytes = bundleMapped ? bundle.find(name.c_str(), size) : nullptr;
+        const bool decoded = bytes ? request->image.loadFromMemory(bytes, size)
+                                   : request->image.loadFromFile(fallbackPath);
+        request->state.store(decoded ? 1 : -1, std::memory_order_release);
+    });
+    return handle;
+}
+
+/**
+ * @brief Uploads decoded images to the GPU; render thread only.
+ *
+ * @return true If a texture was (re)uploaded this call.
+ */
+bool AssetManager::uploadDecoded()
+{
+    std::lock_guard<std::mutex> lock(texturesMutex);
+    for (auto& request : textures)
+    {
+        const int state = request->state.load(std::memory_order_acquire);
+        if (state != 1 && state != 3)  // 3: a hot reload staged fresh pixels
+            continue;
+        if (request->gpuTexture.loadFromImage(request->image))
+        {
+            request->image = sf::Image();  // Free the CPU-side pixels
+            request->state.store(2, std::memory_order_release);
+            return true;
+        }
+        // Keep the old pixels on a bad reload; an initial decode that
+        // fails to upload is a hard failure
+        request->state.store(state == 1 ? -1 : 2, std::memory_order_release);
+        return false;  // At most one upload per frame
+    }
+    return false;
+}
+
+/**
+ * @brief Whether a requested texture is decoded and uploaded.
+ *
+ * @param handle Handle from requestTexture.
+ * @return true If texture(handle) is ready to draw.
+ * @return false If the request is still in flight or failed.
+ */
+bool AssetManager::textureReady(TextureHandle handle) const
+{
+    std::lock_guard<std::mutex> lock(texturesMutex);
+    const int state = textures[handle]->state.load(std::memory_order_acquire);
+    return state == 2 || state == 3;  // A staged reload still draws the current upload
+}
+
+/**
+ * @brief A requested texture. Only valid once textureReady() is true.
+ *
+ * @param handle Handle from requestTexture.
+ * @return const sf::Texture& The uploaded texture.
+ */
+const sf::Texture& AssetManager::texture(TextureHandle handle) const
+{
+    std::lock_guard<std::mutex> lock(texturesMutex);
+    return textures[handle]->gpuTexture;
+}
+
+/**
+ * @brief Starts loading the victory texture through the pipeline.
+ *
+ * @param name Asset name inside the bundle.
+ * @param fallbackPath Loose-file path used when the bundle is absent.
+ */
+void AssetManager::requestVictoryTexture(const std::string& name, const std::string& fallbackPath)
+{
+    victoryHandle.store(requestTexture(name, fallbackPath), std::memory_order_release);
+}
+
+/**
+ * @brief Starts watching the loose files behind every request.
+ */
+void AssetManager::enableHotReload()
+{
+    if (bundleMapped || reloadWatching.load(std::memory_order_relaxed))
+        return;  // Bundled assets cannot be edited in place
+    reloadWatching.store(true, std::memory_order_release);
+    reloadWatcher = std::thread([this]() {
+        threadControl::registerCurrentThread("asset-watch");
+        threadControl::lowerCurrentThreadPriority();  // A decode must never preempt a tick
+        alloctrack::TagScope assetsTag(alloctrack::Assets);
+        while (reloadWatching.load(std::memory_order_acquire))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+            /**
+             * @brief Textures: re-decode an edited file into its
+             * request's staging image; the render thread re-uploads it
+             * at the next frame boundary, exactly like a first load.
+             * Requests still decoding or with a reload already staged
+             * are left for the next poll.
+             */
+            std::vector<TextureRequest*> watched;
+            {
+                std::lock_guard<std::mutex> lock(texturesMutex);
+                for (auto& request : textures)
+                    if (!request->loosePath.empty())
+                        watched.push_back(request.get());
+            }
+            for (TextureRequest* request : watched)
+            {
+                if (request->state.load(std::memory_order_acquire) != 2)
+                    continue;
+                const std::int64_t modified = fileModifiedTime(request->loosePath);
+                if (modified == 0 || modified == request->modifiedTime)
+                    continue;
+                request->modifiedTime = modified;
+                if (request->image.loadFromFile(request->loosePath))
+                    request->state.store(3, std::memory_order_release);
+            }
+
+            /**
+             * @brief Font: load an edited file into the inactive slot,
+             * pre-rasterize the declared glyphs there, then flip. The
+             * next flip waits until the render thread has consumed
+             * this one, so the slot a text still points at is never
+             * overwritten.
+             */
+            if (fontLoosePath.empty() || !fontLoaded.load(std::memory_order_acquire))
+                continue;
+            if (fontVersion.load(std::memory_order_acquire) != fontVersionSeen.load(std::memory_order_acquire))
+                continue;
+            const std::int64_t modified = fileModifiedTime(fontLoosePath);
+            if (modified == 0 || modified == fontModifiedTime)
+                continue;
+            fontModifiedTime = modified;
+            const int staging = liveFont.load(std::memory_order_relaxed) ^ 1;
+            if (!fonts[staging].loadFromFile(fontLoosePath))
+                continue;
+            for (const auto& set : prewarmSets)
+                for (char character : set.first)
+                    fonts[staging].getGlyph(static_cast<sf::Uint32>(character), set.second, false);
+            liveFont.store(staging, std::memory_order_release);
+            fontVersion.fetch_add(1, std::memory_order_release);
+        }
+    });
+}
+
+/**
+ * @brief Whether the font was hot-swapped since the last call.
+ *
+ * @return true Once per completed font reload.
+ */
+bool AssetManager::fontReloaded()
+{
+    const std::uint32_t version = fontVersion.load(std::memory_order_acquire);
+    if (version == fontVersionSeen.load(std::memory_order_relaxed))
+        return false;
+    fontVersionSeen.store(version, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,217 @@
+#pragma once
+#include "asset_bundle.h"
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Asynchronous loader for the game's font and textures.
+ *
+ * Startup used to block on loadFromFile before the window could show a
+ * single frame. The manager instead kicks each load off on a worker
+ * thread and exposes a ready flag; the game renders immediately with
+ * placeholder visuals (plain shapes, no HUD text) and swaps the real
+ * assets in on the frame their load completes.
+ *
+ * In developer checkouts (no bundle, loose files) enableHotReload()
+ * watches the requested files: an edited texture is re-decoded on the
+ * watcher thread into its request's staging image and re-uploaded at
+ * the next frame boundary through the same deferred-upload path as
+ * the initial load; an edited font loads into the inactive slot of a
+ * font double buffer and the render thread re-points its texts when
+ * it polls fontReloaded(). No frame ever decodes, and the live asset
+ * is never written while the render thread can be reading it.
+ */
+/**
+ * @brief Identifies one texture request; see AssetManager::requestTexture.
+ */
+using TextureHandle = std::size_t;
+
+class AssetManager {
+public:
+    /**
+     * @brief Joins any outstanding worker threads.
+     */
+    ~AssetManager();
+
+    /**
+     * @brief Memory-maps the packed asset bundle.
+     *
+     * Later requests read their bytes straight out of the mapping via
+     * loadFromMemory; when the bundle is missing (developer checkouts with
+     * loose assets) requests fall back to their per-file paths.
+     *
+     * @param path Path to the bundle file.
+     * @return true If the bundle was mapped successfully.
+     * @return false If the bundle is missing or malformed.
+     */
+    bool openBundle(const std::string& path);
+
+    /**
+     * @brief Declares glyphs to pre-rasterize when the font loads.
+     *
+     * sf::Text rasterizes a glyph into the font's atlas texture the
+     * first time it is drawn, which lands a rasterize-plus-texture
+     * upload hitch on whatever frame first shows that character. Each
+     * declared set is walked through Font::getGlyph on the font's
+     * worker thread before the ready flag is set, so every declared
+     * character is already in the atlas when the HUD first draws.
+     * Call before requestFont; may be called once per text size.
+     *
+     * @param characters The characters to pre-rasterize.
+     * @param characterSize The text size they will be drawn at.
+     */
+    void declareGlyphs(const std::string& characters, unsigned int characterSize);
+
+    /**
+     * @brief Starts loading the HUD font on a worker thread.
+     *
+     * @param name Asset name inside the bundle.
+     * @param fallbackPath Loose-file path used when the bundle is absent.
+     */
+    void requestFont(const std::string& name, const std::string& fallbackPath);
+
+    /**
+     * @brief Requests a texture through the decode pipeline.
+     *
+     * A worker thread decodes the PNG into an sf::Image (the expensive
+     * part — inflate plus unfilter); the GPU upload is deferred until
+     * the render thread calls uploadDecoded() at a frame boundary, so
+     * no frame ever contains a file read or a decode, only the cheap
+     * loadFromImage. Any number of textures can be in flight; each
+     * request gets its own worker.
+     *
+     * @param name Asset name inside the bundle.
+     * @param fallbackPath Loose-file path used when the bundle is absent.
+     * @return TextureHandle Handle to poll with textureReady().
+     */
+    TextureHandle requestTexture(const std::string& name, const std::string& fallbackPath);
+
+    /**
+     * @brief Uploads decoded images to the GPU; render thread only.
+     *
+     * Call once per frame at a frame boundary. Uploads at most one
+     * texture per call so a burst of finished decodes cannot stack
+     * several uploads into a single frame.
+     *
+     * @return true If a texture was (re)uploaded this call.
+     */
+    bool uploadDecoded();
+
+    /**
+     * @brief Whether a requested texture is decoded and uploaded.
+     *
+     * @param handle Handle from requestTexture.
+     * @return true If texture(handle) is ready to draw.
+     * @return false If the request is still in flight or failed.
+     */
+    bool textureReady(TextureHandle handle) const;
+
+    /**
+     * @brief A requested texture. Only valid once textureReady() is true.
+     *
+     * @param handle Handle from requestTexture.
+     * @return const sf::Texture& The uploaded texture.
+     */
+    const sf::Texture& texture(TextureHandle handle) const;
+
+    /**
+     * @brief Starts loading the victory texture through the pipeline.
+     *
+     * Kept as a named wrapper over requestTexture for the game's one
+     * fixed texture; victoryTextureReady()/victoryTexture() poll it.
+     *
+     * @param name Asset name inside the bundle.
+     * @param fallbackPath Loose-file path used when the bundle is absent.
+     */
+    void requestVictoryTexture(const std::string& name, const std::string& fallbackPath);
+
+    /**
+     * @brief Starts watching the loose files behind every request.
+     *
+     * Developer builds only: a no-op when the asset bundle is mapped,
+     * since bundled assets cannot be edited in place. Polls each
+     * file's modification time twice a second on one watcher thread.
+     */
+    void enableHotReload();
+
+    /**
+     * @brief Whether the font was hot-swapped since the last call.
+     *
+     * Render thread only. When true, re-apply font() to every sf::Text
+     * — the new font lives in the other slot of the double buffer.
+     *
+     * @return true Once per completed font reload.
+     */
+    bool fontReloaded();
+
+    /**
+     * @brief Whether the font has finished loading successfully.
+     *
+     * @return true If the font is ready to use.
+     * @return false If the font is still loading or failed.
+     */
+    bool fontReady() const { return fontLoaded.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Whether the victory texture has finished loading successfully.
+     *
+     * @return true If the texture is ready to use.
+     * @return false If the texture is still loading or failed.
+     */
+    bool victoryTextureReady() const
+    {
+        const TextureHandle handle = victoryHandle.load(std::memory_order_acquire);
+        return handle != invalidTexture && textureReady(handle);
+    }
+
+    /**
+     * @brief The loaded HUD font. Only valid once fontReady() is true.
+     *
+     * @return const sf::Font& The font.
+     */
+    const sf::Font& font() const { return fonts[liveFont.load(std::memory_order_acquire)]; }
+
+    /**
+     * @brief The loaded victory texture. Only valid once victoryTextureReady() is true.
+     *
+     * @return const sf::Texture& The texture.
+     */
+    const sf::Texture& victoryTexture() const { return texture(victoryHandle.load(std::memory_order_acquire)); }
+
+private:
+    /**
+     * @brief One in-flight texture: decoded image, final texture, state.
+     */
+    struct TextureRequest {
+        sf::Image image; ///< Decoded pixels; freed after the upload.
+        sf::Texture gpuTexture; ///< The uploaded texture; valid in state Ready.
+        std::atomic<int> state{ 0 }; ///< 0 decoding, 1 decoded, 2 ready, 3 ready with a reload staged, -1 failed.
+        std::string loosePath; ///< The loose file behind the request; what hot reload watches.
+        std::int64_t modifiedTime = 0; ///< The file's mtime at the last decode.
+    };
+
+    static constexpr TextureHandle invalidTexture = static_cast<TextureHandle>(-1); ///< No request made.
+
+    sf::Font fonts[2]; ///< HUD font double buffer; reloads land in the inactive slot.
+    std::atomic<int> liveFont{ 0 }; ///< Which slot font() hands out.
+    std::atomic<bool> fontLoaded{false}; ///< Set (release) after the font load completes.
+    std::atomic<std::uint32_t> fontVersion{ 0 }; ///< Bumped when a reload flips the live slot.
+    std::atomic<std::uint32_t> fontVersionSeen{ 0 }; ///< Last version the render thread consumed; gates the next reload.
+    std::string fontLoosePath; ///< The font's loose file; what hot reload watches.
+    std::int64_t fontModifiedTime = 0; ///< The font file's mtime at the last load.
+    std::thread reloadWatcher; ///< Polls the loose files twice a second.
+    std::atomic<bool> reloadWatching{ false }; ///< Cleared to stop the watcher.
+    std::vector<std::unique_ptr<TextureRequest>> textures; ///< In-flight and completed texture requests.
+    mutable std::mutex texturesMutex; ///< Guards the textures vector (not the entries' states).
+    std::atomic<TextureHandle> victoryHandle{ invalidTexture }; ///< The victory texture's request; set by the game thread, read by the render thread.
+    std::vector<std::pair<std::string, unsigned int>> prewarmSets; ///< Glyph sets to pre-rasterize on the font worker.
+    std::vector<std::thread> workers; ///< Outstanding load threads, joined in the destructor.
+    AssetBundle bundle; ///< Memory-mapped asset bundle; outlives all loadFromMemory consumers.
+    bool bundleMapped = false; ///< Whether openBundle succeeded.
+};
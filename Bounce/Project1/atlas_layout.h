@@ -0,0 +1,103 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @brief On-disk layout of the packed texture atlas UV table.
+ *
+ * Every standalone texture is a GL bind and a batch break, so the
+ * AtlasBuilder tool in the solution packs the game's images into one
+ * atlas offline and writes this table beside it: a header and a
+ * fixed-size entry array mapping each source image's base file name to
+ * its pixel rectangle inside the atlas. All POD, same shape as the
+ * asset bundle format, so the table loads with one read and resolves
+ * names with a linear scan over a handful of entries. The batch
+ * renderer's textured stream takes the rectangles as-is.
+ */
+namespace atlas {
+
+constexpr std::uint32_t layoutVersion = 1; ///< Bumped on any layout change.
+
+/**
+ * @brief Fixed header at the start of every layout file.
+ */
+struct Header {
+    char magic[4]; ///< "ATLS".
+    std::uint32_t version; ///< Must equal layoutVersion.
+    std::uint32_t entryCount; ///< Number of entries in the table that follows.
+    std::uint32_t atlasWidth; ///< Packed atlas width in pixels.
+    std::uint32_t atlasHeight; ///< Packed atlas height in pixels.
+    std::uint32_t reserved; ///< Padding; keeps the entry table 8-byte aligned.
+};
+
+/**
+ * @brief One packed image's placement in the atlas.
+ */
+struct Entry {
+    char name[48]; ///< Zero-terminated source image base file name.
+    std::uint32_t x; ///< Left edge in the atlas, pixels.
+    std::uint32_t y; ///< Top edge in the atlas, pixels.
+    std::uint32_t width; ///< Width in pixels.
+    std::uint32_t height; ///< Height in pixels.
+};
+
+} // namespace atlas
+
+/**
+ * @brief Loaded atlas UV table with name lookup.
+ *
+ * Reads the whole table once at startup; find() is a scan over the
+ * in-memory entries and runs only during setup (clip registration,
+ * sprite rect assignment), never per frame.
+ */
+class AtlasLayout {
+public:
+    /**
+     * @brief Loads and validates a layout file written by AtlasBuilder.
+     *
+     * @param path Path to the .layout file.
+     * @return true If the table was read and its header is valid.
+     * @return false If the file is missing or malformed; entries stay empty.
+     */
+    bool loadFromFile(const std::string& path)
+    {
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file)
+            return false;
+        atlas::Header header{};
+        bool valid = std::fread(&header, sizeof(header), 1, file) == 1
+            && std::memcmp(header.magic, "ATLS", 4) == 0
+            && header.version == atlas::layoutVersion;
+        if (valid)
+        {
+            entries.resize(header.entryCount);
+            valid = header.entryCount == 0
+                || std::fread(entries.data(), sizeof(atlas::Entry), entries.size(), file) == entries.size();
+        }
+        std::fclose(file);
+        if (!valid)
+            entries.clear();
+        return valid;
+    }
+
+    /**
+     * @brief Looks up a packed image by its base file name.
+     *
+     * @param name The source image name as written by the builder.
+     * @return const atlas::Entry* The placement, or nullptr if not packed.
+     */
+    const atlas::Entry* find(const char* name) const
+    {
+        for (const atlas::Entry& entry : entries)
+            if (std::strncmp(entry.name, name, sizeof(entry.name)) == 0)
+                return &entry;
+        return nullptr;
+    }
+
+private:
+    std::vector<atlas::Entry> entries; ///< The table, in file order.
+};
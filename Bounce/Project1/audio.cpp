@@ -0,0 +1,146 @@
+#include "audio.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr unsigned int sampleRate = 44100; ///< Synthesized fallback sample rate.
+
+/**
+ * @brief Synthesizes a fallback tone into a buffer.
+ *
+ * A sine sweep with a linear fade-out; enough to make each effect
+ * audible and distinct when the loose .wav files are absent.
+ *
+ * @param buffer The buffer to fill.
+ * @param startHz Frequency at the start of the tone.
+ * @param endHz Frequency at the end of the tone.
+ * @param seconds Tone length.
+ */
+void synthesizeTone(sf::SoundBuffer& buffer, float startHz, float endHz, float seconds)
+{
+    const std::size_t count = static_cast<std::size_t>(sampleRate * seconds);
+    std::vector<sf::Int16> samples(count);
+    float phase = 0.0f;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float t = static_cast<float>(i) / count;
+        const float hz = startHz + (endHz - startHz) * t;
+        phase += hz * (2.0f * 3.141592654f / sampleRate);
+        const float fade = 1.0f - t;
+        samples[i] = static_cast<sf::Int16>(std::sin(phase) * fade * 12000.0f);
+    }
+    buffer.loadFromSamples(samples.data(), count, 1, sampleRate);
+}
+
+} // namespace
+
+/**
+ * @brief Preloads every effect buffer.
+ *
+ * @param assetDir Directory holding the loose effect files.
+ */
+void AudioSystem::init(const char* assetDir)
+{
+    const char* fileNames[static_cast<std::size_t>(SoundEffect::Count)] = { "coin.wav", "bounce.wav", "death.wav" };
+    const std::string dir(assetDir);
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(SoundEffect::Count); ++i)
+    {
+        if (buffers[i].loadFromFile(dir + "/" + fileNames[i]))
+            continue;
+        switch (static_cast<SoundEffect>(i))
+        {
+        case SoundEffect::Coin:   synthesizeTone(buffers[i], 880.0f, 1320.0f, 0.12f); break;
+        case SoundEffect::Bounce: synthesizeTone(buffers[i], 220.0f, 180.0f, 0.08f); break;
+        default:                  synthesizeTone(buffers[i], 440.0f, 110.0f, 0.35f); break;
+        }
+    }
+}
+
+/**
+ * @brief Queues an effect; tick thread only, wait-free.
+ *
+ * @param effect The effect to play.
+ * @param count How many simultaneous events this trigger stands for.
+ */
+void AudioSystem::trigger(SoundEffect effect, std::uint32_t count)
+{
+    if (count == 0)
+        return;
+    const std::uint32_t writeAt = head.load(std::memory_order_relaxed);
+    if (writeAt - tail.load(std::memory_order_acquire) >= queueCapacity)
+        return;  // Full: dropping a sound beats stalling a tick
+    const std::uint32_t packed = std::min<std::uint32_t>(count, 0xFFFFFF);
+    queue[writeAt % queueCapacity] = static_cast<std::uint32_t>(effect) | (packed << 8);
+    head.store(writeAt + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Drains queued triggers into the voice pool.
+ */
+void AudioSystem::update()
+{
+    // Fold the drain into one count per effect first: a frame that
+    // covers several ticks of the same effect still costs one voice
+    std::uint32_t batch[static_cast<std::size_t>(SoundEffect::Count)] = {};
+
+    std::uint32_t readAt = tail.load(std::memory_order_relaxed);
+    const std::uint32_t readEnd = head.load(std::memory_order_acquire);
+    while (readAt != readEnd)
+    {
+        const std::uint32_t entry = queue[readAt % queueCapacity];
+        batch[entry & 0xFF] += entry >> 8;
+        ++readAt;
+    }
+    tail.store(readAt, std::memory_order_release);
+
+    const float now = limiterClock.getElapsedTime().asSeconds();
+    for (std::size_t i = 0; i < static_cast<std::size_t>(SoundEffect::Count); ++i)
+    {
+        if (batch[i] == 0)
+            continue;
+        if (now - lastStartSeconds[i] < restartGapSeconds)
+            continue;  // Rate-limited; the batch is covered by the voice still ringing
+        lastStartSeconds[i] = now;
+
+        // Coincident identical samples sum in phase, so one voice at
+        // sqrt(count) gain stands in for the pile; OpenAL takes gain
+        // above 1, capped here before it turns into clipping
+        const float gain = std::min(std::sqrt(static_cast<float>(batch[i])), maxBatchGain);
+        playOnVoice(static_cast<SoundEffect>(i), 100.0f * gain);
+    }
+}
+
+/**
+ * @brief Starts an effect on a free voice, stealing the oldest playing
+ * voice when the pool is saturated.
+ *
+ * @param effect The effect to play.
+ * @param volume Voice volume; 100 is nominal.
+ */
+void AudioSystem::playOnVoice(SoundEffect effect, float volume)
+{
+    std::size_t chosen = 0;
+    std::uint64_t oldest = ~static_cast<std::uint64_t>(0);
+    for (std::size_t i = 0; i < voiceCount; ++i)
+    {
+        if (voices[i].getStatus() == sf::Sound::Stopped)
+        {
+            chosen = i;
+            break;
+        }
+        if (voiceStarted[i] < oldest)
+        {
+            oldest = voiceStarted[i];
+            chosen = i;  // All busy so far: remember the longest-playing voice
+        }
+    }
+
+    voices[chosen].setBuffer(buffers[static_cast<std::size_t>(effect)]);
+    voices[chosen].setVolume(volume);
+    voices[chosen].play();
+    voiceStarted[chosen] = ++playSequence;
+}
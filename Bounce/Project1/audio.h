@@ -0,0 +1,95 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Identifies one preloaded sound effect.
+ */
+enum class SoundEffect : std::uint8_t {
+    Coin,   ///< Coin pickup chime.
+    Bounce, ///< Platform landing thump.
+    Death,  ///< Obstacle hit.
+    Count   ///< Number of effects; not a playable id.
+};
+
+/**
+ * @brief Sound effects with a preloaded buffer pool and a wait-free
+ * trigger queue.
+ *
+ * Every effect is decoded into an sf::SoundBuffer once at init, and
+ * playback runs through a fixed pool of sf::Sound voices with oldest-
+ * voice stealing, so triggering a sound never loads, allocates or
+ * blocks. The tick loop is the single producer: trigger() pushes an
+ * effect id into a fixed ring guarded by two atomics (the same single-
+ * writer/single-reader discipline as the snapshot channel) and never
+ * touches the audio device; the render thread is the single consumer,
+ * draining the ring once per frame in update(). A full ring drops
+ * triggers rather than blocking the tick.
+ *
+ * Mixer cost stays bounded no matter what the simulation does: a
+ * trigger carries an event COUNT, so a many-ball tick where every
+ * ball thumps the floor is one ring entry, and the drain collapses it
+ * (plus any same-effect entries from other ticks in the same frame)
+ * into ONE voice whose gain scales with sqrt(count) — coincident
+ * identical samples sum in phase, so one boosted voice is the cheap
+ * stand-in for the pile. A per-effect restart limiter then caps how
+ * often any one effect can claim a voice at all.
+ */
+class AudioSystem {
+public:
+    /**
+     * @brief Preloads every effect buffer; the only loading the system does.
+     *
+     * Each effect tries its loose .wav under the asset directory and
+     * falls back to a synthesized tone, so a checkout without audio
+     * files still gets distinct, if plain, effects.
+     *
+     * @param assetDir Directory holding the loose effect files.
+     */
+    void init(const char* assetDir);
+
+    /**
+     * @brief Queues an effect; tick thread only, wait-free, never blocks.
+     *
+     * @param effect The effect to play.
+     * @param count How many simultaneous events this trigger stands
+     * for; the drain folds the count into one voice's gain.
+     */
+    void trigger(SoundEffect effect, std::uint32_t count = 1);
+
+    /**
+     * @brief Drains queued triggers into the voice pool; render thread
+     * only, call once per frame.
+     */
+    void update();
+
+private:
+    /**
+     * @brief Starts an effect on a free voice, stealing the oldest
+     * playing voice when the pool is saturated.
+     *
+     * @param effect The effect to play.
+     * @param volume Voice volume; 100 is nominal, above it boosts gain
+     * for a collapsed batch.
+     */
+    void playOnVoice(SoundEffect effect, float volume);
+
+    static constexpr std::size_t queueCapacity = 256; ///< Trigger ring size; power of two.
+    static constexpr std::size_t voiceCount = 16; ///< Simultaneous playing effects.
+    static constexpr float restartGapSeconds = 0.03f; ///< Per-effect voice-start floor; ~30 starts a second.
+    static constexpr float maxBatchGain = 2.0f; ///< Gain cap for a collapsed batch (4+ coincident events).
+
+    sf::SoundBuffer buffers[static_cast<std::size_t>(SoundEffect::Count)]; ///< Preloaded effect samples.
+    sf::Sound voices[voiceCount]; ///< The fixed voice pool.
+    std::uint64_t voiceStarted[voiceCount] = {}; ///< Start order per voice, for oldest-voice stealing.
+    std::uint64_t playSequence = 0; ///< Monotonic play counter; consumer side only.
+
+    std::uint32_t queue[queueCapacity] = {}; ///< The trigger ring; effect id in the low byte, event count above.
+    std::atomic<std::uint32_t> head{ 0 }; ///< Next slot to write; producer-owned.
+    std::atomic<std::uint32_t> tail{ 0 }; ///< Next slot to read; consumer-owned.
+
+    sf::Clock limiterClock; ///< Timebase for the per-effect restart limiter; consumer side only.
+    float lastStartSeconds[static_cast<std::size_t>(SoundEffect::Count)]
+        = { -1.0f, -1.0f, -1.0f }; ///< When each effect last claimed a voice.
+};
@@ -0,0 +1,158 @@
+#include "batch_renderer.h"
+#include "vertex_stream.h"
+#include <cmath>
+
+/**
+ * @brief Constructs an empty batch using the triangles primitive.
+ */
+BatchRenderer::BatchRenderer()
+    : vertices(sf::Triangles)
+    , texturedVertices(sf::Triangles)
+{
+}
+
+/**
+ * @brief Removes all queued geometry, keeping the vertex storage.
+ */
+void BatchRenderer::clear()
+{
+    vertices.clear();
+    texturedVertices.clear();
+}
+
+/**
+ * @brief Queues an axis-aligned rectangle as two triangles.
+ *
+ * @param x X-coordinate of the rectangle.
+ * @param y Y-coordinate of the rectangle.
+ * @param width Width of the rectangle.
+ * @param height Height of the rectangle.
+ * @param color Fill color of the rectangle.
+ */
+void BatchRenderer::addRect(float x, float y, float width, float height, const sf::Color& color)
+{
+    const sf::Vector2f topLeft(x, y);
+    const sf::Vector2f topRight(x + width, y);
+    const sf::Vector2f bottomLeft(x, y + height);
+    const sf::Vector2f bottomRight(x + width, y + height);
+
+    vertices.append(sf::Vertex(topLeft, color));
+    vertices.append(sf::Vertex(topRight, color));
+    vertices.append(sf::Vertex(bottomRight, color));
+    vertices.append(sf::Vertex(topLeft, color));
+    vertices.append(sf::Vertex(bottomRight, color));
+    vertices.append(sf::Vertex(bottomLeft, color));
+}
+
+/**
+ * @brief Queues a circle as a triangle fan around its center.
+ *
+ * @param x X-coordinate of the circle's bounding-box top-left corner.
+ * @param y Y-coordinate of the circle's bounding-box top-left corner.
+ * @param radius Radius of the circle.
+ * @param color Fill color of the circle.
+ * @param pointCount Number of points on the circle outline.
+ */
+void BatchRenderer::addCircle(float x, float y, float radius, const sf::Color& color, std::size_t pointCount)
+{
+    const float pi = 3.141592654f;
+    const sf::Vector2f center(x + radius, y + radius);
+
+    for (std::size_t i = 0; i < pointCount; ++i)
+    {
+        const float angle0 = static_cast<float>(i) / pointCount * 2.0f * pi;
+        const float angle1 = static_cast<float>(i + 1) / pointCount * 2.0f * pi;
+
+        vertices.append(sf::Vertex(center, color));
+        vertices.append(sf::Vertex(center + sf::Vector2f(std::cos(angle0), std::sin(angle0)) * radius, color));
+        vertices.append(sf::Vertex(center + sf::Vector2f(std::cos(angle1), std::sin(angle1)) * radius, color));
+    }
+}
+
+/**
+ * @brief Queues an atlas-textured rectangle as two triangles.
+ *
+ * @param x X-coordinate of the rectangle.
+ * @param y Y-coordinate of the rectangle.
+ * @param width Width of the rectangle.
+ * @param height Height of the rectangle.
+ * @param texRect The sprite's rectangle inside the atlas, in pixels.
+ * @param tint Color multiplied into the texture.
+ */
+void BatchRenderer::addTexturedRect(float x, float y, float width, float height,
+                                    const sf::FloatRect& texRect, const sf::Color& tint)
+{
+    const sf::Vector2f topLeft(x, y);
+    const sf::Vector2f topRight(x + width, y);
+    const sf::Vector2f bottomLeft(x, y + height);
+    const sf::Vector2f bottomRight(x + width, y + height);
+    const sf::Vector2f uvTopLeft(texRect.left, texRect.top);
+    const sf::Vector2f uvTopRight(texRect.left + texRect.width, texRect.top);
+    const sf::Vector2f uvBottomLeft(texRect.left, texRect.top + texRect.height);
+    const sf::Vector2f uvBottomRight(texRect.left + texRect.width, texRect.top + texRect.height);
+
+    texturedVertices.append(sf::Vertex(topLeft, tint, uvTopLeft));
+    texturedVertices.append(sf::Vertex(topRight, tint, uvTopRight));
+    texturedVertices.append(sf::Vertex(bottomRight, tint, uvBottomRight));
+    texturedVertices.append(sf::Vertex(topLeft, tint, uvTopLeft));
+    texturedVertices.append(sf::Vertex(bottomRight, tint, uvBottomRight));
+    texturedVertices.append(sf::Vertex(bottomLeft, tint, uvBottomLeft));
+}
+
+/**
+ * @brief Maps a write region for up to @p quadCount textured quads.
+ *
+ * @param quadCount Upper bound on quads to be written.
+ * @return sf::Vertex* Start of the mapped region.
+ */
+sf::Vertex* BatchRenderer::mapTexturedQuads(std::size_t quadCount)
+{
+    mapStart = texturedVertices.getVertexCount();
+    texturedVertices.resize(mapStart + quadCount * 6);
+    return &texturedVertices[mapStart];
+}
+
+/**
+ * @brief Shrinks the mapped region to the quads actually written.
+ *
+ * @param quadCount Quads written since mapTexturedQuads.
+ */
+void BatchRenderer::commitTexturedQuads(std::size_t quadCount)
+{
+    texturedVertices.resize(mapStart + quadCount * 6);
+}
+
+/**
+ * @brief Submits the whole batch to the target in one draw call.
+ *
+ * Textured geometry, when present, adds a second call with the atlas bound.
+ *
+ * @param target The render target to draw to.
+ */
+void BatchRenderer::draw(sf::RenderTarget& target) const
+{
+    if (stream != nullptr)
+    {
+        // Both runs go through the multi-buffered upload ring; the
+        // stream falls back to the client-array path by itself when
+        // vertex buffers are unavailable
+        stream->draw(target, vertices);
+        if (texturedVertices.getVertexCount() > 0 && atlas != nullptr)
+            stream->draw(target, texturedVertices, sf::RenderStates(atlas));
+        return;
+    }
+
+    target.draw(vertices);
+    if (texturedVertices.getVertexCount() > 0 && atlas != nullptr)
+        target.draw(texturedVertices, sf::RenderStates(atlas));
+}
+
+/**
+ * @brief Read-only access to the packed vertices.
+ *
+ * @return const sf::VertexArray& The batched triangles.
+ */
+const sf::VertexArray& BatchRenderer::data() const
+{
+    return vertices;
+}
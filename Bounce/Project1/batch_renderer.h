@@ -0,0 +1,154 @@
+#pragma once
+#include "atlas_layout.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+class DynamicVertexStream;
+
+/**
+ * @brief Batches untextured shapes into a single draw call.
+ *
+ * The render loop used to issue one window.draw() per rectangle and coin,
+ * which made big community levels draw-call bound. The batch renderer
+ * packs every rectangle (two triangles) and circle (a triangle fan) into
+ * one sf::VertexArray that is submitted with a single draw call per frame.
+ */
+class BatchRenderer {
+public:
+    /**
+     * @brief Constructs an empty batch using the triangles primitive.
+     */
+    BatchRenderer();
+
+    /**
+     * @brief Removes all queued geometry, keeping the vertex storage.
+     */
+    void clear();
+
+    /**
+     * @brief Queues an axis-aligned rectangle.
+     *
+     * @param x X-coordinate of the rectangle.
+     * @param y Y-coordinate of the rectangle.
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @param color Fill color of the rectangle.
+     */
+    void addRect(float x, float y, float width, float height, const sf::Color& color);
+
+    /**
+     * @brief Queues a circle as a triangle fan.
+     *
+     * @param x X-coordinate of the circle's bounding-box top-left corner.
+     * @param y Y-coordinate of the circle's bounding-box top-left corner.
+     * @param radius Radius of the circle.
+     * @param color Fill color of the circle.
+     * @param pointCount Number of points on the circle outline (default matches sf::CircleShape).
+     */
+    void addCircle(float x, float y, float radius, const sf::Color& color, std::size_t pointCount = 30);
+
+    /**
+     * @brief Queues an atlas-textured rectangle.
+     *
+     * Textured quads go into their own vertex stream drawn with the
+     * atlas set by setTexture, so a frame costs at most two draw calls
+     * and one texture bind no matter how many sprites it queues.
+     *
+     * @param x X-coordinate of the rectangle.
+     * @param y Y-coordinate of the rectangle.
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @param texRect The sprite's rectangle inside the atlas, in pixels.
+     * @param tint Color multiplied into the texture (white leaves it unchanged).
+     */
+    void addTexturedRect(float x, float y, float width, float height,
+                         const sf::FloatRect& texRect, const sf::Color& tint = sf::Color::White);
+
+    /**
+     * @brief Queues a rectangle textured by a packed atlas entry.
+     *
+     * Convenience over addTexturedRect for images placed by the
+     * AtlasBuilder tool: the entry from the generated UV table names
+     * the sprite's pixels directly.
+     *
+     * @param x X-coordinate of the rectangle.
+     * @param y Y-coordinate of the rectangle.
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @param entry The image's placement from the atlas layout table.
+     * @param tint Color multiplied into the texture (white leaves it unchanged).
+     */
+    void addAtlasRect(float x, float y, float width, float height,
+                      const atlas::Entry& entry, const sf::Color& tint = sf::Color::White)
+    {
+        addTexturedRect(x, y, width, height,
+                        sf::FloatRect(static_cast<float>(entry.x), static_cast<float>(entry.y),
+                                      static_cast<float>(entry.width), static_cast<float>(entry.height)),
+                        tint);
+    }
+
+    /**
+     * @brief Maps a write region for up to @p quadCount textured quads.
+     *
+     * The bulk draw-list pass writes vertices straight into the
+     * textured stream instead of paying an addTexturedRect call per
+     * sprite: map the worst case, write the quads that survive
+     * culling and commit the number actually written. Six vertices
+     * per quad, in the same two-triangle order addTexturedRect emits.
+     *
+     * @param quadCount Upper bound on quads to be written.
+     * @return sf::Vertex* Start of the mapped region.
+     */
+    sf::Vertex* mapTexturedQuads(std::size_t quadCount);
+
+    /**
+     * @brief Shrinks the mapped region to the quads actually written.
+     *
+     * @param quadCount Quads written since mapTexturedQuads.
+     */
+    void commitTexturedQuads(std::size_t quadCount);
+
+    /**
+     * @brief Sets the atlas used by all textured rectangles.
+     *
+     * @param texture The atlas texture, or nullptr while it is still loading.
+     */
+    void setTexture(const sf::Texture* texture) { atlas = texture; }
+
+    /**
+     * @brief Routes submission through a dynamic vertex stream.
+     *
+     * With a stream set, draw() uploads both vertex runs into the
+     * stream's multi-buffered GPU ring and draws the sub-ranges,
+     * instead of submitting client-side arrays. Null restores the
+     * direct path.
+     *
+     * @param vertexStream The render thread's stream, or nullptr.
+     */
+    void setStream(DynamicVertexStream* vertexStream) { stream = vertexStream; }
+
+    /**
+     * @brief Submits the whole batch to the target in one draw call.
+     *
+     * Textured geometry, when present, adds a second call with the atlas bound.
+     *
+     * @param target The render target to draw to.
+     */
+    void draw(sf::RenderTarget& target) const;
+
+    /**
+     * @brief Read-only access to the packed vertices.
+     *
+     * Used by the static level bake to upload a batch built at load time.
+     *
+     * @return const sf::VertexArray& The batched triangles.
+     */
+    const sf::VertexArray& data() const;
+
+private:
+    sf::VertexArray vertices; ///< All batched untextured triangles for the current frame.
+    sf::VertexArray texturedVertices; ///< All batched atlas-textured triangles for the current frame.
+    const sf::Texture* atlas = nullptr; ///< Atlas bound for the textured stream.
+    std::size_t mapStart = 0; ///< First vertex of the mapped quad region.
+    DynamicVertexStream* stream = nullptr; ///< Upload ring for draw(), when streaming is on.
+};
@@ -0,0 +1,109 @@
+#pragma once
+#include <SFML/System/Clock.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+/**
+ * @brief Named-phase startup timing with a per-launch boot report.
+ *
+ * The nightly-reboot kiosks have a hard park-opens boot deadline, and
+ * startup work (window, config, simulation build, asset requests,
+ * audio) runs serially and was unmeasured. main() brackets each phase
+ * with phase(), and finish() appends one block per launch to a text
+ * boot log: per-phase milliseconds plus the cumulative timeline, so a
+ * regression names its phase instead of just fattening one total.
+ *
+ * CI-style soak runs set BOUNCE_BOOT_BUDGET_MS; finish() then marks
+ * the report over-budget and the caller fails the launch, turning the
+ * boot deadline into a checked invariant instead of a hope. Unset (the
+ * kiosks themselves), the budget is a no-op and the report is purely
+ * informational.
+ */
+class BootReport {
+public:
+    /**
+     * @brief Closes the phase running since the previous mark.
+     *
+     * The first call covers everything since construction; construct
+     * the report as the first thing in main.
+     *
+     * @param name Phase label for the report; must outlive the report.
+     */
+    void phase(const char* name)
+    {
+        const float now = clock.getElapsedTime().asSeconds() * 1000.0f;
+        if (count < maxPhases)
+        {
+            phases[count].name = name;
+            phases[count].ms = now - lastMark;
+            ++count;
+        }
+        lastMark = now;
+    }
+
+    /**
+     * @brief Totals the boot and appends the report to the boot log.
+     *
+     * @param logPath Text log the report block is appended to.
+     */
+    void finish(const char* logPath)
+    {
+        totalMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+        if (const char* env = std::getenv("BOUNCE_BOOT_BUDGET_MS"))
+            budgetMs = static_cast<float>(std::atof(env));
+
+        std::FILE* file = std::fopen(logPath, "a");
+        if (!file)
+            return;
+
+        std::time_t now = std::time(nullptr);
+        char stamp[32] = "";
+        if (std::tm* local = std::localtime(&now))
+            std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", local);
+
+        std::fprintf(file, "boot %s\n", stamp);
+        float cumulative = 0.0f;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            cumulative += phases[i].ms;
+            std::fprintf(file, "  %-16s %8.2f ms   at %8.2f ms\n", phases[i].name, phases[i].ms, cumulative);
+        }
+        if (budgetMs > 0.0f)
+            std::fprintf(file, "  total %.2f ms, budget %.2f ms%s\n",
+                         totalMs, budgetMs, overBudget() ? "  ** OVER BUDGET **" : "");
+        else
+            std::fprintf(file, "  total %.2f ms\n", totalMs);
+        std::fclose(file);
+    }
+
+    /**
+     * @brief Whether the boot exceeded the configured budget.
+     *
+     * @return true If a budget was set and finish() measured past it.
+     */
+    bool overBudget() const { return budgetMs > 0.0f && totalMs > budgetMs; }
+
+    /// Total boot milliseconds; valid after finish().
+    float totalMilliseconds() const { return totalMs; }
+
+    /// The configured budget; zero when unset.
+    float budgetMilliseconds() const { return budgetMs; }
+
+private:
+    static constexpr std::size_t maxPhases = 16; ///< Phases one boot can record.
+
+    /// One closed phase.
+    struct Phase {
+        const char* name; ///< Label from the phase() call.
+        float ms; ///< Phase length in milliseconds.
+    };
+
+    sf::Clock clock; ///< Runs from construction; the boot timebase.
+    Phase phases[maxPhases] = {}; ///< Closed phases in boot order.
+    std::size_t count = 0; ///< Phases recorded.
+    float lastMark = 0.0f; ///< When the open phase started, in ms.
+    float totalMs = 0.0f; ///< Total boot time; set by finish().
+    float budgetMs = 0.0f; ///< BOUNCE_BOOT_BUDGET_MS, or zero when unset.
+};
@@ -1,434 +1,1679 @@
-#include "game.h"
+#include "simulation.h"
+#include "job_system.h"
+#include "batch_renderer.h"
+#include "atlas_layout.h"
+#include "level_bake.h"
+#include "asset_manager.h"
+#include "frame_profiler.h"
+#include "frame_pacer.h"
+#include "frame_governor.h"
+#include "trace_export.h"
+#include "telemetry.h"
+#include "hitch_detector.h"
+#include "watchdog.h"
+#include "alloc_tracker.h"
+#include "replay.h"
+#include "ghost.h"
+#include "level_loader.h"
+#include "render_snapshot.h"
+#include "render_queue.h"
+#include "vertex_stream.h"
+#include "alive_mask.h"
+#include "hud_text.h"
+#include "session_stats.h"
+#include "particle_system.h"
+#include "animation.h"
+#include "parallax.h"
+#include "audio.h"
+#include "music_stream.h"
+#include "frame_arena.h"
+#include "fixed_vector.h"
+#include "boot_report.h"
+#include "savestate.h"
+#include "savegame.h"
+#include "timer_wheel.h"
+#include "input_sampler.h"
+#include "event_pump.h"
+#include "campaign.h"
+#include "level_gen.h"
+#include "editor.h"
+#include "cpu_dispatch.h"
+#include "gpu_timer.h"
+#include "config.h"
+#include "palette.h"
+#include "thread_control.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <string>
-#include <sstream>
 #include <algorithm>
-
-// Implementations of the constructors and functions
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <ctime>
 
 /**
- * @brief Constructs a platform with given dimensions and color.
+ * @brief Cold-to-hot split of the per-obstacle render data.
  *
- * @param width Width of the platform.
- * @param height Height of the platform.
- * @param x X-coordinate position.
- * @param y Y-coordinate position.
- * @param color Color of the platform (default is green).
+ * Everything the frame loop needs to queue one obstacle, 16 bytes
+ * instead of the ~300-byte sf::RectangleShape it used to read a color
+ * out of. The shapes themselves are construction-time-only cold data.
  */
-Platform::Platform(float width, float height, float x, float y, sf::Color color) {
-    shape.setSize(sf::Vector2f(width, height));
-    shape.setPosition(x, y);
-    shape.setFillColor(color);
-}
+struct ObstacleDraw {
+    float y; ///< Top edge; obstacles only move horizontally.
+    float w; ///< Width.
+    float h; ///< Height.
+    std::uint8_t colorIndex; ///< Palette slot, resolved at submission time.
+};
 
 /**
- * @brief Constructs a wall with given dimensions and color.
+ * @brief Cold-to-hot split of the per-coin render data.
  *
- * @param width Width of the wall.
- * @param height Height of the wall.
- * @param x X-coordinate position.
- * @param y Y-coordinate position.
- * @param color Color of the wall (default is blue).
+ * Position, extent and color for culling and batching; coins never
+ * move, so this is fixed at load.
  */
-Wall::Wall(float width, float height, float x, float y, sf::Color color) {
-    shape.setSize(sf::Vector2f(width, height));
-    shape.setPosition(x, y);
-    shape.setFillColor(color);
-}
+struct CoinDraw {
+    float x; ///< Shape position x (left edge).
+    float y; ///< Shape position y (top edge).
+    float radius; ///< Circle radius.
+    std::uint8_t colorIndex; ///< Palette slot, resolved at submission time.
+};
 
 /**
- * @brief Constructs a moving obstacle with specified dimensions and movement limits.
+ * @brief Render thread body: draws published simulation snapshots.
+ *
+ * Owns the window's GL context, the view, every shape, the HUD and the
+ * frame profiler. Each frame it takes the newest snapshot from the
+ * channel, interpolates moving entities on its own clock and draws; the
+ * display/vsync wait therefore never stalls the tick loop, and a long
+ * tick never stalls presentation. Event polling stays on the main
+ * thread (the window's creator); profiler toggle and trace capture
+ * requests arrive through atomic flags.
  *
- * @param width Width of the obstacle.
- * @param height Height of the obstacle.
- * @param x X-coordinate starting position.
- * @param y Y-coordinate starting position.
- * @param leftLimit Left boundary for movement.
- * @param rightLimit Right boundary for movement.
- * @param color Color of the obstacle (default is red).
+ * @param window The window to draw into; activated on this thread.
+ * @param level The loaded level, for render-side geometry and colors.
+ * @param assets Async asset loads, swapped in as they become ready.
+ * @param audio Sound system; its trigger queue drains on this thread.
+ * @param music Background music stream, for the decode-load overlay line.
+ * @param channel Snapshot channel fed by the tick loop.
+ * @param running Cleared by the main thread to stop the loop.
+ * @param profilerToggle Set by the main thread on F1.
+ * @param traceRequest Set by the main thread on F2.
+ * @param focused Cleared by the main thread while the window is unfocused.
+ * @param editorActive Set by the main thread while the editor is open.
+ * @param editorCommands Editor inputs, translated from window events.
+ * @param splitViews Viewport count for local split-screen; F3 cycles it.
+ * @param themeIndex Active color theme; F4 cycles it.
+ * @param watchdog Stall watchdog; armed here and fed once per frame.
+ * @param playerRadius The player circle radius.
+ * @param pacerTargetFps Frame pacer target from config, used when vsync is off.
  */
-Obstacle::Obstacle(float width, float height, float x, float y, float leftLimit, float rightLimit, sf::Color color)
-    : velocityX(2.0f), leftLimit(leftLimit), rightLimit(rightLimit) {
-    shape.setSize(sf::Vector2f(width, height));
-    shape.setPosition(x, y);
-    shape.setFillColor(color);
-}
+static void renderLoop(sf::RenderWindow& window, const LevelData& level, AssetManager& assets,
+                       AudioSystem& audio, MusicStream& music, SnapshotChannel& channel, std::atomic<bool>& running,
+                       std::atomic<bool>& profilerToggle, std::atomic<bool>& traceRequest, std::atomic<bool>& focused,
+                       std::atomic<bool>& editorActive, EditorCommandQueue& editorCommands,
+                       std::atomic<int>& splitViews, std::atomic<int>& themeIndex, Watchdog& watchdog,
+                       float playerRadius, float pacerTargetFps)
+{
+    threadControl::registerCurrentThread("render");
+    if (std::thread::hardware_concurrency() >= 4)
+        threadControl::pinCurrentThread(1);  // Core 0 belongs to the simulation thread
 
-/**
- * @brief Moves the obstacle horizontally and reverses direction when boundaries are reached.
- */
-void Obstacle::move() {
-    shape.move(velocityX, 0);
-    if (shape.getPosition().x <= leftLimit || shape.getPosition().x + shape.getSize().x >= rightLimit) {
-        velocityX = -velocityX;
-    }
-}
+    window.setActive(true);
+    alloctrack::TagScope renderTag(alloctrack::Render);  // This thread's footprint, for its whole life
+    sf::View view(sf::FloatRect(0, 0, 800, 600));
 
-/**
- * @brief Reverses obstacle direction upon colliding with a wall.
- *
- * @param wall The wall with which the obstacle collides.
- */
-void Obstacle::handleWallCollision(const Wall& wall) {
-    if (shape.getGlobalBounds().intersects(wall.shape.getGlobalBounds())) {
-        velocityX = -velocityX;
-    }
-}
+    GpuTimer gpuTimer;
+    gpuTimer.init();  // Needs this thread's live GL context
 
-/**
- * @brief Constructs a coin at a specified position.
- *
- * @param radius Radius of the coin.
- * @param x X-coordinate position.
- * @param y Y-coordinate position.
- */
-Coin::Coin(float radius, float x, float y) {
-    shape.setRadius(radius);
-    shape.setPosition(x, y);
-    shape.setFillColor(sf::Color::Yellow);
-}
+    /**
+     * @brief The active color theme. Entity draw records carry palette
+     * slot indices, so the per-category color constants that used to
+     * live here are now rows of this table and a theme switch never
+     * touches a record: the dynamic entities pick up the new palette at
+     * the next submission, and only the static bake needs its one-pass
+     * re-pack (done through the level rebuild below).
+     */
+    int activeTheme = themeIndex.load(std::memory_order_relaxed);
+    Palette pal = palette::theme(static_cast<std::size_t>(activeTheme));
 
-/**
- * @brief Checks if the player has collected the coin.
- *
- * @param player The player object.
- * @return true If the coin is collected.
- * @return false If the coin is not collected.
- */
-bool Coin::isCollected(const sf::CircleShape& player) {
-    return player.getGlobalBounds().intersects(shape.getGlobalBounds());
-}
+    /**
+     * @brief Compact hot render data for the frame loop: one small draw
+     * record per moving entity, sized from the binary level header, all
+     * built straight from the level records. No shape objects exist
+     * anywhere anymore — the simulation iterates the SoA store and the
+     * renderer iterates these records and the static bake. Built by the
+     * rebuild lambda below, once at start and again per campaign
+     * transition.
+     */
+    FixedVector<ObstacleDraw> obstacleDraw;
+    FixedVector<CoinDraw> coinDraw;
 
-/**
- * @brief Resets the game state to the initial values.
- *
- * @param player The player (ball) object.
- * @param velocity Player's velocity vector.
- * @param isOnGround Boolean indicating if the player is on the ground.
- * @param levelCompleted Boolean indicating if the level is completed.
- * @param view The view (camera) of the game.
- * @param coinCount The number of coins collected.
- * @param coins The list of all coin objects.
- * @param defaultCoinPositions The default positions of coins in the game.
- */
-void resetGame(sf::CircleShape& player, sf::Vector2f& velocity, bool& isOnGround, bool& levelCompleted, sf::View& view, int& coinCount, std::vector<Coin>& coins, const std::vector<sf::Vector2f>& defaultCoinPositions) {
-    player.setPosition(400, 300);
-    velocity = sf::Vector2f(0.0f, 0.0f);
-    isOnGround = false;
-    levelCompleted = false;
-    coinCount = 0;
-    view.setCenter(400, 300);
-    coins.clear();
-    for (const auto& pos : defaultCoinPositions) {
-        coins.emplace_back(10.0f, pos.x, pos.y);
+    /**
+     * @brief The static geometry (platforms, floor, walls, goal) baked
+     * into a GPU-resident vertex buffer at load. It is drawn with a
+     * single call per frame and never re-packed or re-submitted from
+     * the CPU between level transitions.
+     */
+    StaticLevelBake staticBake;
+
+    /**
+     * @brief Sprite-sheet animation: spinning coins and walking
+     * obstacles, all drawn from one atlas through the batch renderer's
+     * textured stream. Frame tables are precomputed per clip and every
+     * cursor advances in one pass per frame; until the atlas finishes
+     * its async decode, entities fall back to the flat shapes below.
+     *
+     * When the AtlasBuilder tool has produced a packed atlas next to
+     * the loose assets, it supersedes the standalone sprite sheet: the
+     * UV table gives the sheet's placement inside the packed image and
+     * the clip origins shift by it, so one texture serves the whole
+     * scene. Without the packed files the loose sheet loads as before.
+     */
+    AtlasLayout atlasLayout;
+    atlasLayout.loadFromFile("C:/C++ Jatkokurssi/Bounce/Bounce/assets/atlas.layout");
+    const atlas::Entry* packedSheet = atlasLayout.find("sprites.png");
+    const TextureHandle atlasHandle = packedSheet
+        ? assets.requestTexture("atlas.png", "C:/C++ Jatkokurssi/Bounce/Bounce/assets/atlas.png")
+        : assets.requestTexture("sprites.png", "C:/C++ Jatkokurssi/Bounce/Bounce/assets/sprites.png");
+    bool atlasApplied = false;  // Set once the async atlas load lands
+    const float sheetX = packedSheet ? static_cast<float>(packedSheet->x) : 0.0f;
+    const float sheetY = packedSheet ? static_cast<float>(packedSheet->y) : 0.0f;
+    AnimationSystem animation;
+    const AnimationSystem::ClipId coinSpin = animation.addClip(sheetX, sheetY, 32, 32, 8, 12.0f);
+    const AnimationSystem::ClipId obstacleWalk = animation.addClip(sheetX, sheetY + 32, 32, 32, 4, 8.0f);
+
+    /**
+     * @brief Builds everything derived from the level: the draw
+     * records, the static bake and the animation assignments. One pass
+     * over the entity records plus one vertex-buffer upload, so a
+     * campaign transition rebuild fits inside its frame.
+     */
+    std::uint32_t levelGeneration = 0;
+    const LevelData* activeLevel = &level;  // The level the render data was last built from
+    auto buildLevelRenderData = [&](const LevelData& levelData) {
+        activeLevel = &levelData;
+        obstacleDraw.setCapacity(levelData.obstacles.size());
+        for (const auto& record : levelData.obstacles)
+            obstacleDraw.emplace_back(ObstacleDraw{ record.y, record.w, record.h, palette::Obstacle });
+
+        coinDraw.setCapacity(levelData.coins.size());
+        for (const auto& record : levelData.coins)
+            coinDraw.emplace_back(CoinDraw{ record.x, record.y, 10.0f, palette::Coin });
+
+        BatchRenderer staticGeometry;
+        for (const auto& record : levelData.platforms)
+            staticGeometry.addRect(record.x, record.y, record.w, record.h, pal[palette::Platform]);
+        staticGeometry.addRect(levelData.floor.x, levelData.floor.y, levelData.floor.w, levelData.floor.h, pal[palette::Platform]);
+        for (const auto& record : levelData.walls)
+            staticGeometry.addRect(record.x, record.y, record.w, record.h, pal[palette::Wall]);
+        staticGeometry.addRect(levelData.goal.x, levelData.goal.y, levelData.goal.w, levelData.goal.h, pal[palette::Goal]);
+        staticBake.bake(staticGeometry.data());
+
+        animation.setEntityCount(coinDraw.size() + obstacleDraw.size());
+        for (std::size_t i = 0; i < coinDraw.size(); ++i)
+            animation.setClip(i, coinSpin, 0.13f * i);  // Stagger phases so the field shimmers
+        for (std::size_t i = 0; i < obstacleDraw.size(); ++i)
+            animation.setClip(coinDraw.size() + i, obstacleWalk, 0.21f * i);
+    };
+    buildLevelRenderData(level);
+
+    HudTextSystem hudLines;
+    const HudTextSystem::LineId coinLine = hudLines.addLine(10, 10, 24);  // Anchored in HUD (screen) space; never recomputed per frame
+    bool fontApplied = false;      // Set once the async font load lands
+
+    sf::Sprite victorySprite;
+    victorySprite.setPosition(200, 150);  // Centered in the fixed 800x600 HUD view; set once
+    bool victoryTextureApplied = false;  // Set once the async texture load lands
+
+    SessionStats sessionStats;  // Fed per frame off the snapshot counters; O(1) whatever the session length
+    const HudTextSystem::LineId summaryLine = hudLines.addLine(260, 380, 18);  // Under the victory image
+    bool summaryFormatted = false;  // The summary formats once per victory, at the transition
+
+    /**
+     * @brief Parallax sky, baked once into render textures. Per frame
+     * the whole background is three textured quads scrolling at
+     * fractions of the camera, however much scenery is painted into
+     * the layers. If the render textures cannot be created the quads
+     * are skipped and the plain clear color shows, as before.
+     */
+    ParallaxBackground parallax;
+    parallax.init(800, 600);
+
+    /**
+     * @brief Per-phase frame profiler; F1 toggles its percentile overlay.
+     * Markers cost one clock read each, so it stays on in all builds.
+     */
+    FrameProfiler profiler;
+    watchdog.start(&profiler);  // Armed once the profiler it dumps from exists
+    const HudTextSystem::LineId profilerLine = hudLines.addLine(10, 44, 14);  // Below the coin counter, HUD space
+
+    /**
+     * @brief Dirty tracking for the whole-frame short-circuit. The
+     * last simulated tick drawn, plus a flag raised by one-off content
+     * changes (asset swaps, HUD reformat, level rebuild) that must hit
+     * the screen even when the simulation holds still.
+     */
+    std::uint64_t lastDrawnTick = ~0ull;
+    bool contentDirty = true;
+    int lastViewCount = 1;
+
+    /**
+     * @brief Trace exporter; F2 writes the profiler's last two seconds as
+     * chrome://tracing JSON on a background thread.
+     */
+    TraceExporter traceExporter;
+
+    /**
+     * @brief Frame pacer. Vsync paces this thread today, so the pacer
+     * runs in measure-only mode and puts the achieved cadence jitter
+     * on the profiler overlay; flip the window to vsync-off and it
+     * takes over with its sleep-then-spin deadline. Adaptive: the
+     * cadence to judge against comes from the measured presentation
+     * interval snapped to common refresh rates.
+     */
+    FramePacer pacer;
+    pacer.init(pacerTargetFps, true);
+
+    /**
+     * @brief Frame-budget governor: sheds particles, then parallax,
+     * then half the animation rate when the frame's work time stays
+     * over budget (thermal throttling in the cabinet enclosures), and
+     * restores them when headroom returns. Fed the busy time below —
+     * never the vsync wait, which would hide all headroom.
+     */
+    FrameGovernor governor;
+    governor.init(1000.0f / pacerTargetFps);
+    sf::Clock busyClock;  // Restarted at frame start; read just before display()
+    float animationCarry = 0.0f;  // dt carried across frames tier 3 skips
+    bool animationBeat = false;  // Alternate-frame toggle for tier 3
+    pacer.setVsyncActive(true);  // Matches the setVerticalSyncEnabled call in main
+
+    /**
+     * @brief Telemetry for fleet monitoring: every ten seconds of
+     * frames, the profiler window and the gameplay counters go to a
+     * background flusher that writes the local ring file (and ships a
+     * datagram when an endpoint is configured). The push is plain
+     * stores; this thread never touches the file.
+     */
+    TelemetryExporter telemetry;
+    telemetry.openFile("bounce_telemetry.btl");
+    int telemetryCountdown = 600;
+    int warmupFrames = 240;  // Frames before the no-allocation scopes arm
+
+    /**
+     * @brief Hitch detector: a frame beyond four times the rolling
+     * median dumps the preceding two seconds of phase timings (plus
+     * alloc and entity counts) as a numbered trace file on a
+     * background thread. Steady cost is one comparison per frame.
+     */
+    HitchDetector hitchDetector;
+    hitchDetector.init();
+    sf::Clock hitchClock;
+
+    /**
+     * @brief The level editor. Lives on this thread because its
+     * incremental structures end in the vertex buffer this thread
+     * owns; inputs arrive through the command ring.
+     */
+    LevelEditor editor;
+
+    /**
+     * @brief Batch renderer that collects every untextured shape into a
+     * single draw call per frame instead of one per shape.
+     */
+    BatchRenderer batch;
+    RenderQueue queue;  // Sorted submission; refilled and flushed every frame
+
+    /**
+     * @brief Upload ring for the dynamic batch. Every frame's vertices
+     * land in a fresh region of one Stream-usage GPU buffer, so the
+     * driver never stalls the upload against the frame still reading
+     * the previous one; its stall and regrow counters sit on the
+     * profiler overlay beside the GPU phase times.
+     */
+    DynamicVertexStream dynamicStream;
+    batch.setStream(&dynamicStream);
+
+    /**
+     * @brief Arena for data that lives exactly one frame. Reset rewinds
+     * it wholesale at the top of each frame, so transient containers in
+     * the frame loop never touch the global heap.
+     */
+    FrameArena frameArena;
+
+    /**
+     * @brief Pooled cosmetic particles: sparkle bursts on coin pickups,
+     * dust on bounces. Effects are detected by diffing successive
+     * snapshots (coin alive bits, bounce counter), so skipped snapshots
+     * between frames never lose a pickup burst. All state is render-
+     * thread local and never feeds back into the simulation.
+     */
+    ParticleSystem particles;
+    particles.init(65536);
+    AliveMask prevCoinAlive;
+    std::uint32_t prevBounceCount = 0;
+    bool effectsPrimed = false;  // Set once the first snapshot seeds the diffs
+    sf::Clock frameClock;  // Render-side clock; particles advance on frame time
+
+    while (running.load(std::memory_order_acquire))
+    {
+        watchdog.beat(Watchdog::RenderLoop, FrameProfiler::PhaseAcquire);  // One store; a mid-frame freeze leaves this frame's marker
+
+        /**
+         * @brief Unfocused: park instead of drawing. The main thread is
+         * blocked in waitEvent, so nothing new will be published; a
+         * coarse sleep keeps this thread near zero until focus returns.
+         */
+        if (!focused.load(std::memory_order_acquire))
+        {
+            sf::sleep(sf::milliseconds(50));
+            frameClock.restart();  // Resume without replaying the idle gap
+            hitchClock.restart();  // The parked "frame" is not a hitch
+            continue;
+        }
+
+        /**
+         * @brief Editor mode: drain the command ring into the editor
+         * and draw it instead of the game. Entering opens the editor
+         * on the snapshot's level; the tick loop is paused meanwhile,
+         * so the snapshot (and its level pointer) hold still. The
+         * profiler sits out — editor frames would poison the gameplay
+         * percentiles.
+         */
+        if (editorActive.load(std::memory_order_acquire) || editor.active())
+        {
+            const RenderSnapshot* editorSnap = channel.acquire();
+            EditorCommand command;
+            while (editorCommands.pop(command))
+            {
+                if (command.type == EditorCommand::Enter)
+                    editor.open(editorSnap && editorSnap->level ? *editorSnap->level : level,
+                                "C:/C++ Jatkokurssi/Bounce/Bounce/assets/level_edit.lvl");
+                else if (command.type == EditorCommand::Exit)
+                    editor.close();
+                else
+                    editor.apply(command);
+            }
+            if (editor.active())
+            {
+                window.clear(sf::Color(30, 30, 40));
+                editor.draw(window);
+                window.display();  // Vsync paces editing like gameplay
+                frameClock.restart();
+                hitchClock.restart();
+                continue;
+            }
+        }
+
+        profiler.beginFrame();
+        busyClock.restart();
+        frameArena.reset();  // Reclaim last frame's transient allocations in one move
+
+        if (profilerToggle.exchange(false, std::memory_order_acq_rel))
+            profiler.toggle();
+        if (traceRequest.exchange(false, std::memory_order_acq_rel))
+            traceExporter.capture(profiler, "bounce_trace.json");
+
+        /**
+         * @brief Theme switch: swap the palette table and re-pack the
+         * static bake from the current level's records. The dynamic
+         * entities need nothing — their records hold slot indices that
+         * resolve through the new table on this frame's submissions.
+         */
+        const int wantedTheme = themeIndex.load(std::memory_order_relaxed);
+        if (wantedTheme != activeTheme)
+        {
+            activeTheme = wantedTheme;
+            pal = palette::theme(static_cast<std::size_t>(activeTheme));
+            buildLevelRenderData(*activeLevel);
+            contentDirty = true;
+        }
+
+        /**
+         * @brief Take the newest published snapshot; between publishes
+         * the channel keeps handing back the held one, so rendering
+         * always has a complete consistent state to draw.
+         */
+        const RenderSnapshot* snap = channel.acquire();
+        if (!snap)
+        {
+            sf::sleep(sf::milliseconds(1));  // Nothing published yet
+            continue;
+        }
+        profiler.endPhase(FrameProfiler::PhaseAcquire);
+
+        /**
+         * @brief Campaign transition: the snapshot plays in a newer
+         * level, so rebuild the level-derived render data from its
+         * records and restart the effect diffs — the old level's coin
+         * bits mean nothing against the new field.
+         */
+        if (snap->level && snap->levelGeneration != levelGeneration)
+        {
+            levelGeneration = snap->levelGeneration;
+            buildLevelRenderData(*snap->level);
+            effectsPrimed = false;
+            contentDirty = true;
+        }
+
+        /**
+         * @brief Spawn effects from what changed since the last frame's
+         * snapshot, then advance the pool on this frame's wall time.
+         */
+        const float frameDt = std::min(frameClock.restart().asSeconds(), 0.1f);
+        const int shedTier = governor.tier();  // One read; every shed point below checks against it
+        if (effectsPrimed && shedTier < 1)
+        {
+            prevCoinAlive.forEachSet([&](std::size_t i) {
+                if (!snap->coinAlive.test(i))
+                {
+                    const float coinX = snap->coinX.empty() ? coinDraw[i].x : snap->coinX[i];
+                    const float coinY = snap->coinY.empty() ? coinDraw[i].y : snap->coinY[i];
+                    particles.emitBurst(coinX + coinDraw[i].radius, coinY + coinDraw[i].radius,
+                                        24, pal[coinDraw[i].colorIndex], 60.0f, 220.0f, 0.6f);  // Pickup sparkle
+                }
+            });
+            if (snap->bounceCount > prevBounceCount)
+                particles.emitBurst(snap->bounceX, snap->bounceY, 12, pal[palette::Dust], 30.0f, 120.0f, 0.4f);  // Landing dust
+        }
+        prevCoinAlive = snap->coinAlive;
+        prevBounceCount = snap->bounceCount;
+        effectsPrimed = true;
+        if (shedTier < 1)
+            particles.update(frameDt);
+        if (!snap->levelCompleted)
+        {
+            // One pass over every animation cursor; holds on the victory
+            // screen. Tier 3 runs the pass on alternate frames with the
+            // skipped frame's dt carried over, so the apparent speed
+            // holds and only the update rate halves.
+            animationCarry += frameDt;
+            animationBeat = !animationBeat;
+            if (shedTier < 3 || animationBeat)
+            {
+                animation.advance(animationCarry);
+                animationCarry = 0.0f;
+            }
+        }
+        sessionStats.update(frameDt, snap->deathCount, snap->resetCount,
+                            static_cast<std::uint32_t>(snap->coinCount), snap->bounceCount, snap->levelCompleted);
+
+        /**
+         * @brief Blend factor between the previous and current tick,
+         * from this thread's clock against the snapshot's publish time,
+         * so interpolation stays smooth whatever the tick/frame phase.
+         */
+        const float sinceTick = std::chrono::duration<float>(std::chrono::steady_clock::now() - snap->tickTime).count();
+        const float alpha = snap->tickDt > 0.0f ? std::min(sinceTick / snap->tickDt, 1.0f) : 1.0f;
+
+        /**
+         * @brief Swap in async-loaded assets the frame they become ready.
+         * Decoded textures get their deferred GPU upload here, at the
+         * frame boundary, never mid-draw.
+         */
+        if (assets.uploadDecoded())
+            contentDirty = true;  // A hot-reloaded texture shows this frame
+        audio.update();  // Drain the tick loop's sound triggers into the voice pool
+        if (!fontApplied && assets.fontReady())
+        {
+            hudLines.applyFont(assets.font());
+            fontApplied = true;
+            contentDirty = true;
+        }
+        else if (fontApplied && assets.fontReloaded())
+        {
+            // Hot reload flipped the font double buffer; re-point the
+            // texts at the fresh slot so the old one is free to stage
+            // the next edit
+            hudLines.applyFont(assets.font());
+            contentDirty = true;
+        }
+        if (!victoryTextureApplied && assets.victoryTextureReady())
+        {
+            victorySprite.setTexture(assets.victoryTexture());
+            victoryTextureApplied = true;
+            contentDirty = true;
+        }
+        if (!atlasApplied && assets.textureReady(atlasHandle))
+        {
+            batch.setTexture(&assets.texture(atlasHandle));  // One bind serves every sprite
+            atlasApplied = true;
+            contentDirty = true;
+        }
+
+        /**
+         * @brief Format the coin counter into its preallocated line
+         * buffer; commit() compares against what the text already shows,
+         * so the 60Hz path performs no heap allocation and a
+         * glyph-geometry rebuild happens only on a pickup.
+         */
+        {
+            char* buffer = hudLines.scratch(coinLine);
+            std::memcpy(buffer, "Coins: ", 7);
+            const auto result = std::to_chars(buffer + 7, buffer + 32, snap->coinCount);
+            *result.ptr = '\0';
+            if (hudLines.commit(coinLine))
+                contentDirty = true;
+        }
+
+        /**
+         * @brief Whole-frame short-circuit: when the simulation has not
+         * advanced past the last drawn tick, nothing interpolates
+         * within it, no particles live, the sprite clips are frozen
+         * (the atlas idle or the victory screen holding them) and no
+         * one-off content landed, the presented frame is already this
+         * frame. Sleep one frame interval and re-present nothing —
+         * an idle victory screen costs microseconds, not a full
+         * record-and-submit.
+         */
+        int viewCount = splitViews.load(std::memory_order_relaxed);
+        if (viewCount != 2 && viewCount != 4)
+            viewCount = 1;
+        if (viewCount != lastViewCount)
+        {
+            lastViewCount = viewCount;
+            contentDirty = true;  // Present the new viewport arrangement immediately
+        }
+
+        const bool simulationQuiet = snap->tickIndex == lastDrawnTick
+            && snap->playerPrevX == snap->playerX && snap->playerPrevY == snap->playerY
+            && snap->obstaclePrevX == snap->obstacleX
+            && snap->ballPrevX == snap->ballX && snap->ballPrevY == snap->ballY
+            && snap->ghostPrevX == snap->ghostX && snap->ghostPrevY == snap->ghostY;
+        const bool effectsQuiet = particles.liveCount() == 0
+            && (!atlasApplied || snap->levelCompleted);
+        if (simulationQuiet && effectsQuiet && !contentDirty && !profiler.visible())
+        {
+            profiler.endPhase(FrameProfiler::PhaseBuild);
+            sf::sleep(sf::seconds(pacer.targetIntervalMs() / 1000.0f));  // Hold the cadence without the display wait
+            pacer.frameComplete();
+            profiler.endFrame();
+            hitchClock.restart();
+            continue;
+        }
+        lastDrawnTick = snap->tickIndex;
+        contentDirty = false;
+
+        profiler.endPhase(FrameProfiler::PhaseBuild);
+
+        /**
+         * @brief Render the game elements on the screen.
+         *
+         * Moving entities are drawn at positions interpolated between the
+         * previous and current tick, read straight from the snapshot.
+         * Interpolated positions are this-frame-only data shared by every
+         * viewport, so they are gathered once through the frame arena.
+         */
+        gpuTimer.beginFrame();
+        dynamicStream.beginFrame();  // Advance the upload ring; regrows happen only here
+        window.clear(pal[palette::Background]);
+
+        std::vector<float, ArenaAllocator<float>> obstacleDrawX{ ArenaAllocator<float>(frameArena) };
+        obstacleDrawX.resize(obstacleDraw.size());
+        for (std::size_t i = 0; i < obstacleDraw.size(); ++i)
+            obstacleDrawX[i] = snap->obstaclePrevX[i] + (snap->obstacleX[i] - snap->obstaclePrevX[i]) * alpha;
+
+        std::vector<float, ArenaAllocator<float>> ballDrawX{ ArenaAllocator<float>(frameArena) };
+        std::vector<float, ArenaAllocator<float>> ballDrawY{ ArenaAllocator<float>(frameArena) };
+        ballDrawX.resize(snap->ballX.size());
+        ballDrawY.resize(snap->ballX.size());
+        for (std::size_t i = 0; i < snap->ballX.size(); ++i)
+        {
+            // A spawn can land between snapshots, so balls beyond the
+            // prev arrays draw at their current position for one frame
+            const bool hasPrev = i < snap->ballPrevX.size();
+            ballDrawX[i] = hasPrev ? snap->ballPrevX[i] + (snap->ballX[i] - snap->ballPrevX[i]) * alpha : snap->ballX[i];
+            ballDrawY[i] = hasPrev ? snap->ballPrevY[i] + (snap->ballY[i] - snap->ballPrevY[i]) * alpha : snap->ballY[i];
+        }
+
+        std::vector<float, ArenaAllocator<float>> ghostDrawX{ ArenaAllocator<float>(frameArena) };
+        std::vector<float, ArenaAllocator<float>> ghostDrawY{ ArenaAllocator<float>(frameArena) };
+        ghostDrawX.resize(snap->ghostX.size());
+        ghostDrawY.resize(snap->ghostX.size());
+        for (std::size_t i = 0; i < snap->ghostX.size(); ++i)
+        {
+            const bool hasPrev = i < snap->ghostPrevX.size();
+            ghostDrawX[i] = hasPrev ? snap->ghostPrevX[i] + (snap->ghostX[i] - snap->ghostPrevX[i]) * alpha : snap->ghostX[i];
+            ghostDrawY[i] = hasPrev ? snap->ghostPrevY[i] + (snap->ghostY[i] - snap->ghostPrevY[i]) * alpha : snap->ghostY[i];
+        }
+
+        const float playerDrawX = snap->playerPrevX + (snap->playerX - snap->playerPrevX) * alpha;
+        const float playerDrawY = snap->playerPrevY + (snap->playerY - snap->playerPrevY) * alpha;
+
+        /**
+         * @brief Fills the dynamic batch with the entities visible in
+         * one viewport's world extent. Called once per viewport; the
+         * gathered interpolated positions above are shared, so an extra
+         * viewport costs its culled walk and submissions, not a second
+         * interpolation pass.
+         */
+        auto buildWorldBatch = [&](float viewLeft, float viewRight) {
+            batch.clear();
+
+            for (std::size_t i = 0; i < obstacleDraw.size(); ++i)
+            {
+                if (obstacleDrawX[i] + obstacleDraw[i].w < viewLeft || obstacleDrawX[i] > viewRight)
+                    continue;
+                if (atlasApplied)
+                    batch.addTexturedRect(obstacleDrawX[i], obstacleDraw[i].y, obstacleDraw[i].w, obstacleDraw[i].h,
+                                          animation.frameRect(coinDraw.size() + i));
+                else
+                    batch.addRect(obstacleDrawX[i], obstacleDraw[i].y, obstacleDraw[i].w, obstacleDraw[i].h, pal[obstacleDraw[i].colorIndex]);
+            }
+            if (atlasApplied)
+            {
+                /**
+                 * @brief Coin draw-list pass: the only per-coin work
+                 * left each frame. The alive words are peeled with the
+                 * bit scan, the next word's coin records are prefetched
+                 * while the current word's bits resolve, and surviving
+                 * quads are written straight into the mapped region of
+                 * the textured stream — no per-sprite append calls. The
+                 * quad write is pure arithmetic and stores, so the
+                 * optimizer is free to vectorize it.
+                 */
+                const std::uint64_t* words = snap->coinAlive.wordData();
+                const std::size_t wordCount = snap->coinAlive.wordCount();
+                sf::Vertex* quad = batch.mapTexturedQuads(coinDraw.size());
+                std::size_t written = 0;
+                for (std::size_t w = 0; w < wordCount; ++w)
+                {
+                    std::uint64_t word = words[w];
+                    if (w + 1 < wordCount && words[w + 1] != 0)
+                    {
+                        const std::size_t aheadFirst = (w + 1) * 64;
+                        const std::size_t aheadCount = std::min<std::size_t>(64, coinDraw.size() - aheadFirst);
+                        const char* ahead = reinterpret_cast<const char*>(coinDraw.data() + aheadFirst);
+                        for (std::size_t line = 0; line < aheadCount * sizeof(CoinDraw); line += 64)
+                            prefetchRead(ahead + line);
+                    }
+                    while (word != 0)
+                    {
+                        const std::size_t i = w * 64 + lowestSetBit(word);
+                        word &= word - 1;
+                        const CoinDraw& coin = coinDraw[i];
+                        const float side = coin.radius * 2.0f;
+                        const float coinX = snap->coinX.empty() ? coin.x : snap->coinX[i];  // Magnet drift, when present
+                        const float coinY = snap->coinY.empty() ? coin.y : snap->coinY[i];
+                        if (coinX + side < viewLeft || coinX > viewRight)
+                            continue;
+                        const sf::FloatRect& uv = animation.frameRect(i);
+                        quad[0] = sf::Vertex({ coinX, coinY }, { uv.left, uv.top });
+                        quad[1] = sf::Vertex({ coinX + side, coinY }, { uv.left + uv.width, uv.top });
+                        quad[2] = sf::Vertex({ coinX + side, coinY + side }, { uv.left + uv.width, uv.top + uv.height });
+                        quad[3] = quad[0];
+                        quad[4] = quad[2];
+                        quad[5] = sf::Vertex({ coinX, coinY + side }, { uv.left, uv.top + uv.height });
+                        quad += 6;
+                        ++written;
+                    }
+                }
+                batch.commitTexturedQuads(written);
+            }
+            else
+            {
+                snap->coinAlive.forEachSet([&](std::size_t i) {
+                    const CoinDraw& coin = coinDraw[i];
+                    const float coinX = snap->coinX.empty() ? coin.x : snap->coinX[i];
+                    const float coinY = snap->coinY.empty() ? coin.y : snap->coinY[i];
+                    if (coinX + coin.radius * 2 < viewLeft || coinX > viewRight)
+                        return;
+                    batch.addCircle(coinX, coinY, coin.radius, pal[coin.colorIndex]);  // Queue on-screen live coins
+                });
+            }
+
+            for (std::size_t i = 0; i < ballDrawX.size(); ++i)
+                if (ballDrawX[i] + playerRadius >= viewLeft && ballDrawX[i] <= viewRight)
+                    batch.addCircle(ballDrawX[i], ballDrawY[i], playerRadius * 0.5f, pal[palette::Ball], 12);
+
+            // Ghosts draw translucent, under the live player
+            for (std::size_t i = 0; i < ghostDrawX.size(); ++i)
+                if (ghostDrawX[i] + playerRadius >= viewLeft && ghostDrawX[i] <= viewRight)
+                    batch.addCircle(ghostDrawX[i], ghostDrawY[i], playerRadius, pal[palette::Ghost]);
+
+            batch.addCircle(playerDrawX, playerDrawY, playerRadius, pal[palette::Player]);
+
+            if (shedTier < 1)
+                particles.appendTo(batch);  // All live particles ride the same single draw
+        };
+
+        /**
+         * @brief Draw each viewport of the shared world: the lead view
+         * follows the simulation camera, extra views chase the ghost
+         * racers (falling back to the lead camera without one). Every
+         * view binds the same GPU-resident static bake — uploaded once,
+         * drawn per view — and flushes its own sorted submission.
+         */
+        static const sf::FloatRect layoutOne[] = { { 0.0f, 0.0f, 1.0f, 1.0f } };
+        static const sf::FloatRect layoutTwo[] = { { 0.0f, 0.0f, 0.5f, 1.0f }, { 0.5f, 0.0f, 0.5f, 1.0f } };
+        static const sf::FloatRect layoutFour[] = { { 0.0f, 0.0f, 0.5f, 0.5f }, { 0.5f, 0.0f, 0.5f, 0.5f },
+                                                    { 0.0f, 0.5f, 0.5f, 0.5f }, { 0.5f, 0.5f, 0.5f, 0.5f } };
+        const sf::FloatRect* ports = viewCount == 4 ? layoutFour : viewCount == 2 ? layoutTwo : layoutOne;
+
+        for (int v = 0; v < viewCount; ++v)
+        {
+            const sf::FloatRect& port = ports[v];
+            const float worldWidth = 800.0f * port.width;
+            const float worldHeight = 600.0f * port.height;
+            float centerX = snap->cameraX;
+            if (v > 0 && static_cast<std::size_t>(v - 1) < ghostDrawX.size())
+                centerX = ghostDrawX[v - 1] + 200.0f;  // Lead the ghost like the camera leads the player
+            // Touch the view only where it differs; an unmoved camera
+            // keeps its cached transform (the whole-frame case is the
+            // short-circuit above, this trims the steady-scroll case)
+            if (view.getViewport() != port)
+                view.setViewport(port);
+            if (view.getSize() != sf::Vector2f(worldWidth, worldHeight))
+                view.setSize(worldWidth, worldHeight);
+            if (view.getCenter() != sf::Vector2f(centerX, snap->cameraY))
+                view.setCenter(centerX, snap->cameraY);
+            window.setView(view);
+
+            if (shedTier < 2)
+                parallax.draw(window, view);  // Three quads, whatever the skyline holds
+            buildWorldBatch(centerX - worldWidth / 2.0f, centerX + worldWidth / 2.0f);
+
+            queue.push(RenderQueue::makeKey(drawlayer::Level, nullptr), staticBake);
+            queue.push(RenderQueue::makeKey(drawlayer::Entities, atlasApplied ? static_cast<const void*>(&assets.texture(atlasHandle)) : nullptr), batch);
+            {
+                // Render submission is designated allocation-free once the
+                // vertex buffers have grown to steady-state capacity
+                alloctrack::ForbidScope noAllocs(warmupFrames == 0);
+                queue.flush(window);
+            }
+        }
+        gpuTimer.endPhase(GpuTimer::PhaseWorld);
+
+        /**
+         * @brief Draw the HUD and overlays in screen space. Text and the
+         * victory image are anchored at fixed positions in the default
+         * view, set once at startup, so they follow the camera without
+         * any per-frame position recomputation — and stay rock-steady
+         * during fast pans instead of lagging the interpolated camera.
+         */
+        window.setView(window.getDefaultView());
+        if (snap->levelCompleted && victoryTextureApplied)
+            queue.push(RenderQueue::makeKey(drawlayer::Overlay, victorySprite.getTexture()), victorySprite);
+        if (snap->levelCompleted && fontApplied)
+        {
+            // The run summary formats once at the victory transition —
+            // the accumulators it reads are frozen for the rest of the
+            // victory screen, so later frames just re-draw the line
+            if (!summaryFormatted)
+            {
+                sessionStats.formatSummary(hudLines.scratch(summaryLine), HudTextSystem::lineCapacity);
+                hudLines.commit(summaryLine);
+                summaryFormatted = true;
+            }
+            queue.push(RenderQueue::makeKey(drawlayer::Hud, hudLines.text(summaryLine).getFont()), hudLines.text(summaryLine));
+        }
+        else
+        {
+            summaryFormatted = false;
+        }
+        if (fontApplied)
+            queue.push(RenderQueue::makeKey(drawlayer::Hud, hudLines.text(coinLine).getFont()), hudLines.text(coinLine));
+        if (profiler.visible() && fontApplied)
+        {
+            if (profiler.consumeHudUpdate())
+            {
+                // Every section formats straight into the line's
+                // preallocated buffer; their worst cases sum well under
+                // lineCapacity, so no append can truncate
+                char* buf = hudLines.scratch(profilerLine);
+                const std::size_t cap = HudTextSystem::lineCapacity;
+                std::size_t used = static_cast<std::size_t>(std::snprintf(buf, cap, "%s", profiler.hudText()));
+                if (music.getStatus() == sf::Music::Playing)
+                {
+                    used += std::snprintf(buf + used, cap - used, "\nmusic decode: %.1f%% of realtime",
+                                          music.decodeLoad() * 100.0f);  // Decode-thread headroom, same cadence as the rest
+                }
+                used += std::snprintf(buf + used, cap - used, "\npacing: %.2fms avg / %.2fms worst vs %.2fms",
+                                      pacer.averageJitterMs(), pacer.worstJitterMs(),
+                                      pacer.targetIntervalMs());  // Cadence jitter: the judder complaints, quantified
+                used += std::snprintf(buf + used, cap - used, "\nsimd: %s",
+                                      simdTierName(activeSimdTier()));  // What the kernel table resolved to
+                used += std::snprintf(buf + used, cap - used, "\nstream: %u late chunks",
+                                      snap->lateChunks);  // Restreams the prefetch missed; zero in normal play
+                if (gpuTimer.supported())
+                {
+                    used += std::snprintf(buf + used, cap - used, "\ngpu: world %.2fms hud %.2fms present %.2fms",
+                                          gpuTimer.phaseMs(GpuTimer::PhaseWorld), gpuTimer.phaseMs(GpuTimer::PhaseHud),
+                                          gpuTimer.phaseMs(GpuTimer::PhasePresent));  // CPU or GPU bound, answered side by side
+                }
+                used += std::snprintf(buf + used, cap - used, "\nupload: %.2fms stalls %u regrows %u",
+                                      dynamicStream.uploadMsAvg(), dynamicStream.stallCount(),
+                                      dynamicStream.regrowCount());  // Nonzero stalls mean the ring is not covering the driver's read-back window
+                {
+                    // Footprint gauges: live megabytes per subsystem plus
+                    // the process-wide high-water mark, so a leak shows
+                    // as a climbing gauge long before the kiosk swaps
+                    auto mb = [](std::uint64_t bytes) { return bytes / (1024.0 * 1024.0); };
+                    const auto ent = alloctrack::subsystemFootprint(alloctrack::Entities);
+                    const auto rnd = alloctrack::subsystemFootprint(alloctrack::Render);
+                    const auto ast = alloctrack::subsystemFootprint(alloctrack::Assets);
+                    const auto aud = alloctrack::subsystemFootprint(alloctrack::Audio);
+                    const auto net = alloctrack::subsystemFootprint(alloctrack::Net);
+                    const auto other = alloctrack::subsystemFootprint(alloctrack::Untagged);
+                    const double peak = mb(ent.peakBytes + rnd.peakBytes + ast.peakBytes + aud.peakBytes + net.peakBytes + other.peakBytes);
+                    used += std::snprintf(buf + used, cap - used,
+                                          "\nmem: ent %.1f rnd %.1f ast %.1f aud %.1f net %.1f other %.1f mb (peak %.1f)",
+                                          mb(ent.liveBytes), mb(rnd.liveBytes), mb(ast.liveBytes),
+                                          mb(aud.liveBytes), mb(net.liveBytes), mb(other.liveBytes), peak);
+                }
+                // Per-thread CPU gauge, sampled on the report cadence so
+                // the deltas span enough wall time to be stable
+                used += std::snprintf(buf + used, cap - used, "\n");
+                threadControl::formatCpuUsage(buf + used, cap - used);
+                hudLines.commit(profilerLine);
+            }
+            queue.push(RenderQueue::makeKey(drawlayer::Hud, hudLines.text(profilerLine).getFont()), hudLines.text(profilerLine));
+        }
+        queue.flush(window);  // Both text items share the font texture: one bind
+        gpuTimer.endPhase(GpuTimer::PhaseHud);
+        profiler.endPhase(FrameProfiler::PhaseRender);
+
+        governor.frameMeasured(busyClock.getElapsedTime().asSeconds() * 1000.0f);  // Work time only
+        window.display();  // Display everything drawn to the window
+        gpuTimer.endPhase(GpuTimer::PhasePresent);
+        gpuTimer.endFrame();
+        pacer.frameComplete();  // Measure the cadence; paces too, when vsync is off
+        profiler.endPhase(FrameProfiler::PhaseDisplay);
+        profiler.endFrame();
+
+        if (warmupFrames > 0)
+            --warmupFrames;
+        if (--telemetryCountdown <= 0)
+        {
+            telemetry.push(profiler, *snap, sessionStats,
+                           static_cast<std::uint32_t>(governor.tier()), governor.shiftCount());
+            telemetryCountdown = 600;
+        }
+
+        HitchContext hitchContext;
+        hitchContext.obstacles = static_cast<std::uint32_t>(snap->obstacleX.size());
+        hitchContext.coins = static_cast<std::uint32_t>(coinDraw.size());
+        hitchContext.balls = static_cast<std::uint32_t>(snap->ballX.size());
+        hitchContext.ghosts = static_cast<std::uint32_t>(snap->ghostX.size());
+        hitchContext.allocs = alloctrack::counters().count;
+        hitchContext.violations = alloctrack::counters().violations;
+        hitchDetector.frameCompleted(hitchClock.getElapsedTime().asMicroseconds(), profiler, hitchContext);
+        hitchClock.restart();
     }
+
+    window.setActive(false);
 }
 
 /**
- * @brief The main game loop and logic for the Bounce Game.
+ * @brief The simulation loop for the Bounce Game.
+ *
+ * All gameplay rules live in the Simulation class, which is free of
+ * rendering types; this thread samples the keyboard into an InputState,
+ * steps the simulation on the fixed tick and publishes a snapshot of
+ * the drawable state after every tick. A dedicated render thread (see
+ * renderLoop) consumes the snapshots, so the display's vsync wait is
+ * fully hidden from the simulation. Headless builds drive the same
+ * Simulation without any of this.
  *
  * @return int Exit status of the game.
  */
 int main() {
+    /**
+     * @brief Startup phase timing. Every launch appends a per-phase
+     * boot report to bounce_boot.log; soak runs set
+     * BOUNCE_BOOT_BUDGET_MS and a boot past it fails the launch, so
+     * the kiosks' reboot deadline is a checked number, not a hope.
+     */
+    BootReport boot;
+
+    initCpuDispatch();  // Bind the SIMD kernel table before any thread can call through it
+
+    /**
+     * @brief Thread placement: the simulation and render threads each
+     * get a dedicated core on boxes with enough of them (the 4-core
+     * kiosks), so the scheduler never migrates a frame-critical thread
+     * mid-frame; background threads drop to below-normal priority at
+     * their own startup. Best-effort — on refusal the threads float.
+     */
+    threadControl::registerCurrentThread("simulation");
+    if (std::thread::hardware_concurrency() >= 4)
+        threadControl::pinCurrentThread(0);
+
     sf::RenderWindow window(sf::VideoMode(800, 600), "Bounce Game");
-    window.setFramerateLimit(60);
+    window.setVerticalSyncEnabled(true);  // Paces the render thread from the display; simulation speed comes from the fixed tick below
+    boot.phase("window");
 
-    sf::View view(sf::FloatRect(0, 0, 800, 600));
+    /**
+     * @brief The campaign: an ordered manifest of level files with an
+     * LRU cache of decoded levels, so returning to a level touches no
+     * file. With no manifest it is the single shipped level, which
+     * itself falls back to the built-in default when absent — exactly
+     * the old single-level load.
+     */
+    /**
+     * @brief Gameplay tuning from bounce.cfg, with live reload: save
+     * the file and the watcher publishes a fresh struct the tick loop
+     * picks up at the next tick boundary. Missing file keeps the
+     * built-in defaults (the old compile-time constants).
+     */
+    ConfigSystem config;
+    config.load("C:/C++ Jatkokurssi/Bounce/Bounce/assets/bounce.cfg");
+    config.startWatch();
 
-    sf::CircleShape player(20.0f);
-    player.setFillColor(sf::Color::Red);
-    player.setPosition(400, 300);
-
-    float gravity = 0.5f;
-    float jumpStrength = -12.0f;
-    float groundFriction = 0.9f;
-    sf::Vector2f velocity(0.0f, 0.0f);
-    bool isOnGround = false;
-    bool levelCompleted = false;
-
-    std::vector<Platform> platforms = {
-        Platform(200.0f, 20.0f, 100.0f, 550.0f),
-        Platform(150.0f, 20.0f, 350.0f, 500.0f),
-        Platform(200.0f, 20.0f, 600.0f, 400.0f),
-        Platform(150.0f, 20.0f, 900.0f, 350.0f),
-        Platform(250.0f, 20.0f, 1250.0f, 300.0f),
-        Platform(200.0f, 20.0f, 1700.0f, 450.0f),
-        Platform(200.0f, 20.0f, 2100.0f, 380.0f),
-        Platform(150.0f, 20.0f, 2600.0f, 550.0f),
-        Platform(200.0f, 20.0f, 3100.0f, 400.0f),
-        Platform(150.0f, 20.0f, 3700.0f, 350.0f),
-        Platform(200.0f, 20.0f, 4200.0f, 300.0f)
-    };
+    Campaign campaign;
+    if (!campaign.loadManifest("C:/C++ Jatkokurssi/Bounce/Bounce/assets/campaign.txt"))
+        campaign.addLevel("C:/C++ Jatkokurssi/Bounce/Bounce/assets/level1.lvl");
+    const LevelData* currentLevel = &campaign.current();
+    std::uint32_t levelGeneration = 0;
+    boot.phase("config+level");
 
-    Platform goal(100.0f, 20.0f, 4700.0f, 250.0f, sf::Color::Yellow);
-    Platform floor(9000.0f, 20.0f, 0.0f, 580.0f);
+    /**
+     * @brief The daily-challenge level, generated from today's date on
+     * F10. Two slots flip-flop so the render thread can finish drawing
+     * the previous generated level while the new one goes live.
+     */
+    std::unique_ptr<LevelData> dailyLevel[2];
+    int dailySlot = 0;
+    bool dailyRequested = false;
 
-    std::vector<Wall> walls = {
-        Wall(20.0f, 180.0f, 600.0f, 420.0f),
-        Wall(20.0f, 200.0f, 1600.0f, 450.0f),
-        Wall(20.0f, 200.0f, 3100.0f, 400.0f),
-        Wall(20.0f, 200.0f, 3700.0f, 350.0f)
-    };
+    /**
+     * @brief The simulation holds all gameplay state (player, camera,
+     * entity store, broadphase, chunk stream, coins). Everything the
+     * render thread needs is published through the snapshot channel.
+     */
+    Simulation sim;
+    sim.tuning = config.current();  // Before init so level spawns read the configured values
+    {
+        alloctrack::TagScope entitiesTag(alloctrack::Entities);  // Store, chunks and coin state all build here
+        sim.init(*currentLevel);
+    }
 
-    std::vector<Obstacle> obstacles = {
-        Obstacle(50.0f, 50.0f, 800.0f, 530.0f, 700.0f, 1100.0f),
-        Obstacle(50.0f, 50.0f, 1500.0f, 530.0f, 1400.0f, 1800.0f),
-        Obstacle(50.0f, 50.0f, 2300.0f, 530.0f, 2200.0f, 2500.0f),
-        Obstacle(50.0f, 50.0f, 3200.0f, 530.0f, 3100.0f, 3400.0f),
-        Obstacle(50.0f, 50.0f, 4000.0f, 530.0f, 3900.0f, 4200.0f)
-    };
+    /**
+     * @brief Worker pool for parallel entity updates. The simulation only
+     * dispatches to it once entity counts are large enough to pay for the
+     * fan-out, so the shipped level still ticks serially.
+     */
+    JobSystem jobSystem;
+    sim.setJobSystem(&jobSystem);
+    boot.phase("simulation");
 
-    std::vector<sf::Vector2f> defaultCoinPositions = {
-        sf::Vector2f(500.0f, 500.0f),
-        sf::Vector2f(1200.0f, 400.0f),
-        sf::Vector2f(2000.0f, 450.0f)
-    };
+    /**
+     * @brief Kick asset loads off on worker threads so the first gameplay
+     * frame renders immediately; the render thread swaps each one in on
+     * the frame its load completes.
+     */
+    AssetManager assets;
+    assets.openBundle("C:/C++ Jatkokurssi/Bounce/Bounce/assets/bounce.bundle");  // Falls back to loose files when absent
+    assets.declareGlyphs("Coins: 0123456789", 24);  // Everything the coin counter can show
+    assets.declareGlyphs("abcdefghijklmnopqrstuvwxyz0123456789.%/:() ", 14);  // Profiler overlay character set
+    assets.requestFont("Roboto-Black.ttf", "C:/C++ Jatkokurssi/Bounce/Bounce/assets/Roboto-Black.ttf");
+    assets.enableHotReload();  // Dev builds only: a no-op once the bundle is mapped
+    boot.phase("asset requests");
 
-    std::vector<Coin> coins;
-    for (const auto& pos : defaultCoinPositions) {
-        coins.emplace_back(10.0f, pos.x, pos.y);
+    /**
+     * @brief Sound effects: every buffer preloads here, and the tick
+     * loop below fires triggers through the wait-free queue by diffing
+     * the simulation's event counters after each tick. Playback itself
+     * happens on the render thread, so a slow audio driver can never
+     * stall a tick.
+     */
+    AudioSystem audio;
+    {
+        alloctrack::TagScope audioTag(alloctrack::Audio);
+        audio.init("C:/C++ Jatkokurssi/Bounce/Bounce/assets");
     }
+    boot.phase("audio");
 
-    int coinCount = 0;
-    sf::Font font;
-    if (!font.loadFromFile("C:/C++ Jatkokurssi/Bounce/Bounce/assets/Roboto-Black.ttf")) {
-        return -1;
+    /**
+     * @brief Looping background music, streamed by sf::Music's own
+     * decode thread. Quarter-second chunks keep that thread's wake-ups
+     * rare (it parks itself below normal priority besides), and its
+     * measured decode load shows up on the profiler overlay — on the
+     * kiosk Atoms, OGG decode is a real line item we want visible.
+     */
+    MusicStream music;
+    music.configure(sf::milliseconds(250));
+    if (music.openFromFile("C:/C++ Jatkokurssi/Bounce/Bounce/assets/music.ogg"))
+    {
+        music.setLoop(true);
+        music.setVolume(35.0f);
+        music.play();  // Absent file: the game simply stays without music
     }
-    sf::Text coinText;
-    coinText.setFont(font);
-    coinText.setCharacterSize(24);
-    coinText.setFillColor(sf::Color::White);
-    coinText.setPosition(700, 10);
-
-    sf::Texture victoryTexture;
-    if (!victoryTexture.loadFromFile("C:/C++ Jatkokurssi/Bounce/Bounce/assets/Viktory.png")) {
-        return -1;
+    boot.phase("music");
+    int audioPrevCoins = sim.coinCount;
+    std::uint32_t audioPrevBounces = sim.bounceCount;
+    std::uint32_t audioPrevDeaths = sim.deathCount;
+
+    /**
+     * @brief The victory image is a one-shot asset most sessions never
+     * see, so it is not loaded at startup. The request fires on its
+     * background thread the moment the run first becomes winnable (all
+     * coins collected) — comfortably before the goal can be reached, so
+     * the win screen still appears without a hitch.
+     */
+    bool victoryRequested = false;
+
+    /**
+     * @brief Replay recording and playback. F5 starts/stops recording
+     * (stopping writes the file); F6 plays the last recording back by
+     * feeding its input stream into the simulation instead of the
+     * keyboard. Both start from a reset so runs reproduce exactly.
+     */
+    ReplayRecorder replayRecorder;
+    ReplayPlayer replayPlayer;
+
+    /**
+     * @brief Keyboard snapshots, one per tick. Movement, the
+     * edge-triggered restart and the replay capture all consume the
+     * same sample, so each key is one OS query per tick.
+     */
+    InputSampler sampler;
+
+    /**
+     * @brief Window event pump; drains the OS queue into a fixed
+     * buffer once per frame, coalescing key-repeat and resize storms.
+     */
+    EventPump events;
+
+    /**
+     * @brief Ghost racing. F9 loads the last recording as another
+     * translucent ghost retracing its run beside the live player; each
+     * ghost streams its file through a fixed window and ticks its own
+     * headless simulation.
+     */
+    GhostSystem ghosts;
+
+    /**
+     * @brief Two seconds of per-tick savestates for practice mode. F7
+     * rewinds; the ring is cleared around full resets so a rewind can
+     * never cross back over one.
+     */
+    SavestateRing savestates;
+    savestates.init(sim, 241);  // The current state plus 240 ticks (two seconds) of history
+
+    /**
+     * @brief Deferred game events, keyed on the simulation tick. The
+     * wheel's advance walks one slot per tick, so pending events cost
+     * nothing until they fire. First customer: the victory screen
+     * auto-resets after five seconds, so an abandoned kiosk cabinet
+     * returns to gameplay without anyone pressing R.
+     */
+    enum : std::uint32_t { eventVictoryReset = 0 };
+    TimerWheel timers;
+    timers.init(64);
+    bool victoryResetScheduled = false;
+
+    /**
+     * @brief Fixed-timestep driver state.
+     *
+     * The simulation advances in fixed ticks of tickDt accumulated from a
+     * wall clock, so gameplay speed is identical on 60Hz and 144Hz displays.
+     * Positions from the previous tick ride along in each snapshot so the
+     * render thread can interpolate between the last two simulation states.
+     */
+    const float tickRate = 120.0f;
+    const sf::Time tickDt = sf::seconds(1.0f / tickRate);
+    const sf::Time maxFrameTime = sf::seconds(0.25f);  // Clamp to avoid a spiral of death after a stall
+    sf::Clock tickClock;
+    sf::Time accumulator = sf::Time::Zero;
+
+    /**
+     * @brief Resume from the last autosave, if a valid one exists. The
+     * writer autosaves once a second from the tick loop and on exit,
+     * each time atomically on a background thread.
+     */
+    SavegameWriter savegame;
+    loadSavegame("bounce_save.sav", sim, tickDt.asSeconds());
+    boot.phase("savegame");
+
+    sf::Vector2f playerPrevPos(sim.playerX, sim.playerY);
+    std::vector<float> obstaclePrevX(sim.store.obstacleX.begin(), sim.store.obstacleX.end());
+    std::vector<float> ballPrevX(sim.store.ballX.begin(), sim.store.ballX.end());
+    std::vector<float> ballPrevY(sim.store.ballY.begin(), sim.store.ballY.end());
+    std::vector<float> ghostPrevX;
+    std::vector<float> ghostPrevY;
+
+    /**
+     * @brief Cross-thread plumbing: the snapshot channel carries drawable
+     * state to the render thread; the flags carry shutdown and the
+     * profiler/trace hotkeys, whose owners live on the render thread.
+     */
+    SnapshotChannel channel;
+    std::atomic<bool> running{ true };
+    std::atomic<bool> profilerToggle{ false };
+    std::atomic<bool> traceRequest{ false };
+    std::atomic<bool> focused{ true };
+    std::atomic<bool> editorActive{ false };
+    std::atomic<int> splitViews{ 1 };  // Split-screen viewport count; the render thread reads it per frame
+    std::atomic<int> themeIndex{ static_cast<int>(config.current()->theme) };  // Color theme; F4 cycles, config seeds
+    EditorCommandQueue editorCommands;
+    bool editorMode = false;  // Main-thread view of the toggle; gates input translation and ticking
+
+    /**
+     * @brief Opt-out for the idle throttle. A live netplay session must
+     * keep ticking while unfocused — a parked peer stalls its opponent —
+     * so the session mode sets this when a connection opens. The local
+     * cabinet build has no session, so the throttle is always eligible.
+     */
+    const bool netplayActive = false;
+
+    /**
+     * @brief Publishes the drawable state after a tick. The snapshot
+     * vectors keep their capacity across publishes, so the steady-state
+     * copy allocates nothing.
+     */
+    auto publishSnapshot = [&]() {
+        RenderSnapshot& snap = channel.beginWrite();
+        snap.playerPrevX = playerPrevPos.x;
+        snap.playerPrevY = playerPrevPos.y;
+        snap.playerX = sim.playerX;
+        snap.playerY = sim.playerY;
+        snap.cameraX = sim.camera.x;
+        snap.cameraY = sim.camera.y;
+        snap.cameraRect = sim.camera.worldRect();  // The one visible-set rect every consumer shares
+        snap.coinCount = sim.coinCount;
+        snap.bounceCount = sim.bounceCount;
+        snap.bounceX = sim.lastBounceX;
+        snap.bounceY = sim.lastBounceY;
+        snap.deathCount = sim.deathCount;
+        snap.resetCount = sim.resetCount;
+        snap.lateChunks = sim.lateChunkCount;
+        snap.tickIndex = sim.tickIndex;
+        snap.levelCompleted = sim.levelCompleted;
+        snap.obstaclePrevX = obstaclePrevX;
+        snap.obstacleX.assign(sim.store.obstacleX.begin(), sim.store.obstacleX.end());
+        snap.ballPrevX = ballPrevX;
+        snap.ballPrevY = ballPrevY;
+        snap.ballX.assign(sim.store.ballX.begin(), sim.store.ballX.end());
+        snap.ballY.assign(sim.store.ballY.begin(), sim.store.ballY.end());
+        snap.ghostPrevX = ghostPrevX;
+        snap.ghostPrevY = ghostPrevY;
+        snap.ghostX.resize(ghosts.count());
+        snap.ghostY.resize(ghosts.count());
+        for (std::size_t i = 0; i < ghosts.count(); ++i)
+        {
+            snap.ghostX[i] = ghosts.x(i);
+            snap.ghostY[i] = ghosts.y(i);
+        }
+        snap.coinAlive = sim.coinAlive;
+        if (sim.coinsDrifted)
+        {
+            // Magnet-drifted coins: ship the live positions; while every
+            // coin sits home the render side draws its static records
+            snap.coinX.resize(sim.coinBounds.size());
+            snap.coinY.resize(sim.coinBounds.size());
+            for (std::size_t i = 0; i < sim.coinBounds.size(); ++i)
+            {
+                snap.coinX[i] = sim.coinBounds[i].x;
+                snap.coinY[i] = sim.coinBounds[i].y;
+            }
+        }
+        else
+        {
+            snap.coinX.clear();
+            snap.coinY.clear();
+        }
+        snap.level = currentLevel;
+        snap.levelGeneration = levelGeneration;
+        snap.tickTime = std::chrono::steady_clock::now();
+        snap.tickDt = tickDt.asSeconds();
+        channel.publish();
+    };
+    publishSnapshot();  // First frame has something to draw before the first tick
+
+    /**
+     * @brief Hand the GL context to the render thread. The window stays
+     * owned by this thread for event polling (its creator must poll it);
+     * only drawing moves.
+     */
+    /**
+     * @brief Stall watchdog: both loops feed it one heartbeat store per
+     * iteration, and a cabinet freeze leaves a report plus a trace on
+     * disk instead of a black screen and nothing. It arms inside the
+     * render thread once the profiler exists.
+     */
+    Watchdog watchdog;
+
+    // Boot ends where the loops begin: everything past here is steady
+    // state. A soak run over budget fails the launch right away
+    boot.phase("loop setup");
+    boot.finish("bounce_boot.log");
+    if (boot.overBudget())
+    {
+        std::fprintf(stderr, "boot %.2f ms over the %.2f ms budget; see bounce_boot.log\n",
+                     boot.totalMilliseconds(), boot.budgetMilliseconds());
+        return 1;
     }
-    sf::Sprite victorySprite;
-    victorySprite.setTexture(victoryTexture);
-    victorySprite.setPosition(400, 200);
+
+    window.setActive(false);
+    std::thread renderThread(renderLoop, std::ref(window), std::cref(*currentLevel), std::ref(assets),
+                             std::ref(audio), std::ref(music), std::ref(channel), std::ref(running), std::ref(profilerToggle),
+                             std::ref(traceRequest), std::ref(focused), std::ref(editorActive), std::ref(editorCommands),
+                             std::ref(splitViews), std::ref(themeIndex), std::ref(watchdog),
+                             sim.playerRadius, config.current()->targetFps);
 
     /**
-     * @brief Main game loop that runs while the window is open.
-     * Handles player movement, collision detection, and updates game state.
+     * @brief Simulation loop: polls events, runs fixed ticks and
+     * publishes snapshots. It paces itself with a short sleep — the
+     * render thread paces off vsync independently.
      */
-    while (window.isOpen())
+    while (running.load(std::memory_order_acquire))
     {
-        // Poll events from the window (such as closing or key presses)
-        sf::Event event;
-        while (window.pollEvent(event))
+        watchdog.beat(Watchdog::TickLoop, 0);
+
+        /**
+         * @brief Drain the OS event queue in one bounded pass, then
+         * handle from the pump's buffer — no further OS calls, and
+         * bursts (key mashing, window drags) arrive coalesced.
+         */
+        events.pump(window);
+        for (std::size_t i = 0; i < events.count(); ++i)
         {
+            const sf::Event& event = events.at(i);
+
             /**
-             * @brief Close the window if the user clicks the close button.
+             * @brief Stop both loops if the user clicks the close button.
              */
             if (event.type == sf::Event::Closed)
-                window.close();
+                running.store(false, std::memory_order_release);
 
             /**
-             * @brief Restart the game if the level is completed or the player dies.
-             * Triggered by pressing the 'R' key.
+             * @brief Toggle the level editor with F11. The simulation
+             * pauses while editing; leaving drops the idle wall time
+             * so play resumes where it stopped.
              */
-            if (levelCompleted || event.type == sf::Event::KeyPressed)
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F11)
             {
-                if (event.key.code == sf::Keyboard::R)
+                editorMode = !editorMode;
+                EditorCommand command;
+                command.type = editorMode ? EditorCommand::Enter : EditorCommand::Exit;
+                editorCommands.push(command);
+                editorActive.store(editorMode, std::memory_order_release);
+                if (!editorMode)
                 {
-                    resetGame(player, velocity, isOnGround, levelCompleted, view, coinCount, coins, defaultCoinPositions);  // Reset the game and coins
+                    tickClock.restart();
+                    accumulator = sf::Time::Zero;
                 }
+                continue;
             }
-        }
 
-        /**
-         * @brief Allow player movement and game progression if the level is not completed.
-         */
-        if (!levelCompleted)
-        {
             /**
-             * @brief Handle player movement input for left and right directions.
-             * Applies friction if no movement key is pressed.
+             * @brief Editor input translation. Mouse and keys become
+             * commands for the render thread's editor: drag to move,
+             * click empty space to place, 1-4 choose the kind, Delete
+             * removes, S saves, arrows pan. Everything else the editor
+             * swallows so game hotkeys cannot fire mid-edit; focus
+             * events fall through to the idle throttle.
              */
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
-                velocity.x = -5.0f;
-            else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
-                velocity.x = 5.0f;
-            else
-                velocity.x *= groundFriction;
+            if (editorMode && event.type != sf::Event::LostFocus && event.type != sf::Event::GainedFocus)
+            {
+                EditorCommand command;
+                bool translated = true;
+                if (event.type == sf::Event::MouseMoved)
+                {
+                    command.type = EditorCommand::Cursor;
+                    command.x = static_cast<float>(event.mouseMove.x);
+                    command.y = static_cast<float>(event.mouseMove.y);
+                }
+                else if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left)
+                {
+                    command.type = EditorCommand::Press;
+                }
+                else if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left)
+                {
+                    command.type = EditorCommand::Release;
+                }
+                else if (event.type == sf::Event::KeyPressed)
+                {
+                    translated = false;
+                    if (event.key.code >= sf::Keyboard::Num1 && event.key.code <= sf::Keyboard::Num4)
+                    {
+                        command.type = EditorCommand::SetKind;
+                        command.kind = event.key.code - sf::Keyboard::Num1;
+                        translated = true;
+                    }
+                    else if (event.key.code == sf::Keyboard::Delete)
+                    {
+                        command.type = EditorCommand::Remove;
+                        translated = true;
+                    }
+                    else if (event.key.code == sf::Keyboard::S)
+                    {
+                        command.type = EditorCommand::Save;
+                        translated = true;
+                    }
+                    else if (event.key.code == sf::Keyboard::Left || event.key.code == sf::Keyboard::Right
+                             || event.key.code == sf::Keyboard::Up || event.key.code == sf::Keyboard::Down)
+                    {
+                        command.type = EditorCommand::Pan;
+                        command.x = event.key.code == sf::Keyboard::Left ? -64.0f : event.key.code == sf::Keyboard::Right ? 64.0f : 0.0f;
+                        command.y = event.key.code == sf::Keyboard::Up ? -64.0f : event.key.code == sf::Keyboard::Down ? 64.0f : 0.0f;
+                        translated = true;
+                    }
+                }
+                else
+                {
+                    translated = false;
+                }
+                if (translated)
+                    editorCommands.push(command);
+                continue;
+            }
 
             /**
-             * @brief Handle jumping if the player is on the ground.
+             * @brief Toggle the frame profiler overlay with F1.
              */
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) && isOnGround)
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F1)
+                profilerToggle.store(true, std::memory_order_release);
+
+            /**
+             * @brief Capture the recent frame timeline to a trace file with F2.
+             */
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F2)
+                traceRequest.store(true, std::memory_order_release);
+
+            /**
+             * @brief Cycle split-screen with F3: one, two or four
+             * viewports over the shared simulation.
+             */
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3)
             {
-                velocity.y = jumpStrength;
-                isOnGround = false;
+                const int current = splitViews.load(std::memory_order_relaxed);
+                splitViews.store(current == 1 ? 2 : current == 2 ? 4 : 1, std::memory_order_relaxed);
             }
 
             /**
-             * @brief Apply gravity to pull the player down constantly.
+             * @brief Cycle the color theme with F4: classic, night,
+             * high contrast. Applied by the render thread as one
+             * palette swap plus a static-bake re-pack.
              */
-            velocity.y += gravity;
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4)
+            {
+                const int current = themeIndex.load(std::memory_order_relaxed);
+                themeIndex.store((current + 1) % static_cast<int>(palette::themeCount), std::memory_order_relaxed);
+            }
 
             /**
-             * @brief Update player position by applying velocity.
+             * @brief Spawn a thousand party-mode balls with F8.
              */
-            player.move(velocity);
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F8)
+            {
+                // Seeding with the current count makes repeated presses
+                // deterministic as a sequence, not just individually
+                sim.spawnBalls(1000, static_cast<std::uint32_t>(sim.store.ballX.size()));
+                ballPrevX.assign(sim.store.ballX.begin(), sim.store.ballX.end());
+                ballPrevY.assign(sim.store.ballY.begin(), sim.store.ballY.end());
+            }
 
             /**
-             * @brief Check for collision with platforms using a lambda function.
-             * If the player collides with a platform, the player's position and velocity are adjusted.
+             * @brief Rewind two seconds with F7 (practice mode).
              */
-            auto platformCollision = [&player, &velocity, &isOnGround](Platform& platform) {
-                if (player.getGlobalBounds().intersects(platform.shape.getGlobalBounds()))
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F7)
+            {
+                if (savestates.rewind(240, sim, tickDt.asSeconds()))
                 {
-                    if (velocity.y > 0)  // Ball is falling
-                    {
-                        player.setPosition(player.getPosition().x, platform.shape.getPosition().y - player.getRadius() * 2);  // Correct position
-                        velocity.y = -velocity.y * 0.7f;  // Bounce with 70% energy retained
-                        isOnGround = true;
-                    }
+                    // Snap interpolation and presentation to the restored state
+                    playerPrevPos = sf::Vector2f(sim.playerX, sim.playerY);
+                    obstaclePrevX.assign(sim.store.obstacleX.begin(), sim.store.obstacleX.end());
+                    publishSnapshot();
                 }
-                };
-            std::for_each(platforms.begin(), platforms.end(), platformCollision);
+            }
 
             /**
-             * @brief Check for collision with the floor.
-             * If the player lands on the floor, the player's velocity and position are adjusted.
+             * @brief Toggle replay recording with F5, playback with F6.
              */
-            if (player.getGlobalBounds().intersects(floor.shape.getGlobalBounds()))
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5)
             {
-                if (velocity.y > 0)  // Ball is falling
+                if (replayRecorder.recording())
+                {
+                    replayRecorder.stop("bounce_replay.rpl");
+                }
+                else
                 {
-                    player.setPosition(player.getPosition().x, floor.shape.getPosition().y - player.getRadius() * 2);  // Correct position
-                    velocity.y = -velocity.y * 0.7f;  // Bounce with 70% energy retained
-                    isOnGround = true;
+                    sim.reset();
+                    savestates.clear();
+                    replayRecorder.start();
                 }
             }
-
-            /**
-             * @brief Check for collision with walls (for player) using a lambda function.
-             * Adjusts the player's position and velocity if they collide with a wall.
-             */
-            auto wallCollision = [&player, &velocity](Wall& wall) {
-                sf::FloatRect playerBounds = player.getGlobalBounds();
-                sf::FloatRect wallBounds = wall.shape.getGlobalBounds();
-
-                if (player.getGlobalBounds().intersects(wall.shape.getGlobalBounds()))
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F6)
+            {
+                if (replayPlayer.load("bounce_replay.rpl"))
                 {
-                    if (velocity.x > 0 && playerBounds.left + playerBounds.width > wallBounds.left && playerBounds.left < wallBounds.left)
-                    {
-                        // Player hitting from the left
-                        player.setPosition(wallBounds.left - playerBounds.width, player.getPosition().y);
-                        velocity.x = 0;  // Stop horizontal movement
-                    }
-                    else if (velocity.x < 0 && playerBounds.left < wallBounds.left + wallBounds.width && playerBounds.left + playerBounds.width > wallBounds.left + wallBounds.width)
-                    {
-                        // Player hitting from the right
-                        player.setPosition(wallBounds.left + wallBounds.width, player.getPosition().y);
-                        velocity.x = 0;  // Stop horizontal movement
-                    }
+                    sim.reset();
+                    savestates.clear();
                 }
-                };
-            std::for_each(walls.begin(), walls.end(), wallCollision);
+            }
 
             /**
-             * @brief Move the obstacles and check for collisions.
-             * If an obstacle collides with a wall, it reverses direction.
-             * If the player collides with an obstacle, the game is reset.
+             * @brief Add a ghost of the last recording with F9. Each
+             * press races one more copy; the live run is untouched.
              */
-            for (auto& obstacle : obstacles)
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F9)
             {
-                obstacle.move();  // Move the obstacle left and right
+                ghosts.add("bounce_replay.rpl", *currentLevel);
+            }
 
-                // Handle wall collisions for enemies
-                for (auto& wall : walls) {
-                    obstacle.handleWallCollision(wall);  // Reverse direction if enemies hit a wall
-                }
+            /**
+             * @brief Start the daily challenge with F10: a procedural
+             * level seeded from today's date, so every cabinet plays
+             * the same layout and replays line up. Handled at the next
+             * tick boundary, where level switches live.
+             */
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F10)
+                dailyRequested = true;
 
-                // Handle collisions with obstacles (red blocks)
-                sf::FloatRect playerBounds = player.getGlobalBounds();
-                sf::FloatRect obstacleBounds = obstacle.shape.getGlobalBounds();
+            /**
+             * @brief Focus tracking for the idle throttle below.
+             */
+            if (event.type == sf::Event::LostFocus)
+                focused.store(false, std::memory_order_release);
+            if (event.type == sf::Event::GainedFocus)
+                focused.store(true, std::memory_order_release);
+        }
 
-                if (playerBounds.intersects(obstacleBounds))
+        /**
+         * @brief Idle throttle: while unfocused (and no netplay session
+         * needs the ticks), block in waitEvent instead of spinning the
+         * loop. The render thread sees the cleared flag and parks, the
+         * simulation pauses where it stands, and both cores drop to
+         * idle until the window regains focus or closes.
+         */
+        if (!focused.load(std::memory_order_acquire) && !netplayActive)
+        {
+            sf::Event event;
+            while (running.load(std::memory_order_acquire) && window.waitEvent(event))
+            {
+                if (event.type == sf::Event::Closed)
+                    running.store(false, std::memory_order_release);
+                if (event.type == sf::Event::GainedFocus)
                 {
-                    resetGame(player, velocity, isOnGround, levelCompleted, view, coinCount, coins, defaultCoinPositions);
+                    focused.store(true, std::memory_order_release);
+                    break;
                 }
             }
+            // Drop the idle wall time so the sim resumes where it
+            // paused instead of fast-forwarding the gap
+            tickClock.restart();
+            accumulator = sf::Time::Zero;
+            continue;
+        }
+
+        /**
+         * @brief Accumulate elapsed wall-clock time and run as many fixed
+         * ticks as fit, recording previous positions for interpolation.
+         * The keyboard is sampled into an InputState once per tick; the
+         * simulation itself never touches sf::Keyboard.
+         */
+        accumulator += tickClock.restart();
+        if (accumulator > maxFrameTime)
+            accumulator = maxFrameTime;
+
+        while (!editorMode && accumulator >= tickDt)
+        {
+            playerPrevPos = sf::Vector2f(sim.playerX, sim.playerY);
+            obstaclePrevX.assign(sim.store.obstacleX.begin(), sim.store.obstacleX.end());
+            ballPrevX.assign(sim.store.ballX.begin(), sim.store.ballX.end());
+            ballPrevY.assign(sim.store.ballY.begin(), sim.store.ballY.end());
+            ghostPrevX.resize(ghosts.count());
+            ghostPrevY.resize(ghosts.count());
+            for (std::size_t i = 0; i < ghosts.count(); ++i)
+            {
+                ghostPrevX[i] = ghosts.x(i);
+                ghostPrevY[i] = ghosts.y(i);
+            }
+            ghosts.tick(tickDt.asSeconds());  // Recorded runs ride the same fixed step
+
+            /**
+             * @brief One keyboard snapshot drives the whole tick: the
+             * movement mask, the edge-triggered restart, and the
+             * replay capture all read the same sample.
+             */
+            sampler.sample();
+            if (sampler.pressed(InputSampler::KeyRestart))
+            {
+                sim.reset();  // Reset the game and coins
+                savestates.clear();
+            }
+
+            InputState input;
+            if (replayPlayer.active())
+            {
+                replayPlayer.next(input);  // Replay drives the tick; keyboard is ignored
+            }
+            else
+            {
+                input = sampler.movement();
+                if (replayRecorder.recording())
+                    replayRecorder.record(input, sim);  // Pre-tick: keyframes capture the state this input acts on
+            }
+            sim.tuning = config.current();  // Live-reload swap lands exactly at a tick boundary
+            {
+                // Physics and collision are designated allocation-free;
+                // armed after warm-up so first-pass growth stays legal
+                alloctrack::ForbidScope noAllocs(sim.tickIndex > 240);
+                sim.tick(tickDt.asSeconds(), input);
+            }
+            savestates.record(sim);
+
+            // Fire sounds off what this tick changed; the counter
+            // delta rides along as the event count, so a many-ball
+            // tick is one trigger that the drain plays as one voice
+            // scaled for the pile
+            if (sim.coinCount > audioPrevCoins)
+                audio.trigger(SoundEffect::Coin, sim.coinCount - audioPrevCoins);
+            if (sim.bounceCount > audioPrevBounces)
+                audio.trigger(SoundEffect::Bounce, sim.bounceCount - audioPrevBounces);
+            if (sim.deathCount > audioPrevDeaths)
+                audio.trigger(SoundEffect::Death, sim.deathCount - audioPrevDeaths);
+            audioPrevCoins = sim.coinCount;
+            audioPrevBounces = sim.bounceCount;
+            audioPrevDeaths = sim.deathCount;
 
             /**
-             * @brief Check for coin collection using a lambda function.
-             * If the player collects a coin, it is removed from the game and the coin count is updated.
+             * @brief Swaps the simulation onto @p next. Everything
+             * level-shaped rebuilds: the sim's store and broadphases
+             * from the decoded records, the savestate ring (the state
+             * block size follows the entity counts), the interpolation
+             * baselines and the audio diffs. The bumped generation
+             * makes the render thread rebuild its bake next frame.
              */
-            auto collectCoin = [&player, &coinCount](Coin& coin) {
-                if (coin.isCollected(player)) {
-                    coinCount++;  // Increase the coin count when a coin is collected
-                    return true;
+            auto switchLevel = [&](const LevelData& next) {
+                currentLevel = &next;
+                ++levelGeneration;
+                {
+                    alloctrack::TagScope entitiesTag(alloctrack::Entities);
+                    sim.init(next);
                 }
-                return false;
-                };
-            coins.erase(std::remove_if(coins.begin(), coins.end(), collectCoin), coins.end());
+                savestates.init(sim, 241);
+                playerPrevPos = sf::Vector2f(sim.playerX, sim.playerY);
+                obstaclePrevX.assign(sim.store.obstacleX.begin(), sim.store.obstacleX.end());
+                ballPrevX.assign(sim.store.ballX.begin(), sim.store.ballX.end());
+                ballPrevY.assign(sim.store.ballY.begin(), sim.store.ballY.end());
+                audioPrevCoins = sim.coinCount;
+                audioPrevBounces = sim.bounceCount;
+                audioPrevDeaths = sim.deathCount;
+            };
 
             /**
-             * @brief Update the coin counter text to show the number of collected coins.
+             * @brief Generate and enter the daily level. The seed is
+             * the calendar date, so the layout rolls over at midnight;
+             * 32 chunks of generated records feed the same chunk
+             * stream and obstacle sleep that pace any long level.
              */
-            std::ostringstream ss;
-            ss << "Coins: " << coinCount;
-            coinText.setString(ss.str());
+            if (dailyRequested)
+            {
+                dailyRequested = false;
+                const std::time_t now = std::time(nullptr);
+                std::tm stamp = {};
+#ifdef _WIN32
+                localtime_s(&stamp, &now);
+#else
+                localtime_r(&now, &stamp);
+#endif
+                const std::uint64_t seed = static_cast<std::uint64_t>((stamp.tm_year + 1900) * 10000 + (stamp.tm_mon + 1) * 100 + stamp.tm_mday);
+                dailySlot ^= 1;  // The render thread may still draw the other slot
+                if (!dailyLevel[dailySlot])
+                    dailyLevel[dailySlot] = std::make_unique<LevelData>();
+                *dailyLevel[dailySlot] = generateLevel(seed, 32);
+                switchLevel(*dailyLevel[dailySlot]);
+            }
 
             /**
-             * @brief Update the coin counter text position relative to the view.
+             * @brief Campaign transition on goal touch. With a level
+             * still ahead the swap happens inside this tick — the next
+             * level comes out of the LRU cache (or one decode on a
+             * cold miss) and play continues next tick, no loading
+             * screen. The victory flow below only triggers on the
+             * campaign's last level.
              */
-            sf::Vector2f viewCenter = view.getCenter();
-            sf::Vector2f viewSize = view.getSize();
-            coinText.setPosition(viewCenter.x - viewSize.x / 2 + 10, viewCenter.y - viewSize.y / 2 + 10);  // 10 pixels padding from the top-left corner
+            if (sim.levelCompleted && campaign.hasNext())
+                switchLevel(campaign.advance());
 
             /**
-             * @brief Check for collision with the goal.
-             * Only allow winning if all coins are collected.
+             * @brief Schedule and fire tick-deferred events. Handlers
+             * re-validate their conditions: the tick counter rewinds
+             * on resets, so an event can fire on a later run.
              */
-            if (player.getGlobalBounds().intersects(goal.shape.getGlobalBounds()) && coins.empty())
+            if (sim.levelCompleted && !victoryResetScheduled)
             {
-                levelCompleted = true;  // The player wins the level
-                victorySprite.setPosition(view.getCenter().x - 200, view.getCenter().y - 150);  // Adjust the position of the sprite
+                timers.schedule(sim.tickIndex + 600, eventVictoryReset);  // Five seconds of victory screen
+                victoryResetScheduled = true;
             }
+            timers.advance(sim.tickIndex, [&](std::uint32_t event) {
+                if (event == eventVictoryReset)
+                {
+                    victoryResetScheduled = false;
+                    if (sim.levelCompleted)
+                    {
+                        // Campaign complete: wrap back to the first
+                        // level, warm from the cache on short campaigns
+                        switchLevel(campaign.restart());
+                    }
+                }
+            });
 
-            /**
-             * @brief Update the view (camera) to follow the player if the level is not completed.
-             */
-            if (!levelCompleted) {
-                view.setCenter(player.getPosition().x + 200, 300);  // Keep the view centered ahead of the player
+            if (!victoryRequested && sim.coinCount == static_cast<int>(sim.coinBounds.size()))
+            {
+                assets.requestVictoryTexture("Viktory.png", "C:/C++ Jatkokurssi/Bounce/Bounce/assets/Viktory.png");
+                victoryRequested = true;
             }
-            window.setView(view);
-        }
+            publishSnapshot();
 
-        /**
-         * @brief Render the game elements on the screen.
-         */
-        window.clear(sf::Color::Cyan);
-
-        window.draw(player);   // Draw the player
-        for (auto& platform : platforms)
-            window.draw(platform.shape);  // Draw all platforms
-        window.draw(floor.shape);  // Draw the floor
-        for (auto& wall : walls)
-            window.draw(wall.shape);  // Draw all walls
-        for (auto& obstacle : obstacles)
-            window.draw(obstacle.shape);  // Draw all obstacles
-        for (auto& coin : coins)
-            window.draw(coin.shape);  // Draw all coins
-        window.draw(goal.shape);  // Draw the goal
-        window.draw(coinText);  // Draw the coin counter
+            if (sim.tickIndex % 120 == 0)
+                savegame.save(sim, "bounce_save.sav");  // Autosave once a second
 
-        /**
-         * @brief If the level is completed, draw the victory image.
-         */
-        if (levelCompleted)
-        {
-            window.draw(victorySprite);  // Draw the victory image
+            accumulator -= tickDt;
         }
 
-        window.display();  // Display everything drawn to the window
+        sf::sleep(sf::milliseconds(1));  // Yield until the next tick is due
     }
 
+    renderThread.join();
+    window.close();
+    savegame.save(sim, "bounce_save.sav");  // Final save; its writer joins in the destructor
 
     return 0;
 }
@@ -0,0 +1,167 @@
+#include "broadcast_codec.h"
+#include "net_varint.h"
+#include <cstring>
+
+namespace {
+
+constexpr std::uint8_t frameKeyframe = 1; ///< Payload type: full state block.
+constexpr std::uint8_t frameDelta = 2; ///< Payload type: run-length diff against a keyframe.
+
+/// Equal bytes inside a changed run worth copying over starting a new
+/// run: a copied byte costs one byte, a fresh (skip, copy) header two.
+constexpr std::size_t mergeGap = 2;
+
+} // namespace
+
+/**
+ * @brief Sizes the codec for a state block.
+ *
+ * @param stateSize Bytes in one captureState block.
+ * @param keyframeInterval Encodes between keyframes.
+ */
+void BroadcastEncoder::init(std::size_t stateSize, std::uint32_t keyframeInterval)
+{
+    keyframe.assign(stateSize, 0);
+    this->keyframeInterval = keyframeInterval;
+    sinceKeyframe = 0;
+    haveKeyframe = false;
+}
+
+/**
+ * @brief Encodes the next outgoing state block.
+ *
+ * @param state The state block; stateSize bytes.
+ * @param tick The simulation tick the block was captured at.
+ * @param out Receives the payload bytes; cleared first.
+ * @return true If the payload is a keyframe.
+ */
+bool BroadcastEncoder::encode(const unsigned char* state, std::uint32_t tick, std::vector<std::uint8_t>& out)
+{
+    out.clear();
+    const std::size_t size = keyframe.size();
+
+    if (!haveKeyframe || sinceKeyframe >= keyframeInterval)
+    {
+        std::memcpy(keyframe.data(), state, size);
+        keyframeTick = tick;
+        sinceKeyframe = 0;
+        haveKeyframe = true;
+
+        out.push_back(frameKeyframe);
+        net::putVarint(out, tick);
+        net::putVarint(out, size);
+        out.insert(out.end(), state, state + size);
+        return true;
+    }
+
+    ++sinceKeyframe;
+    out.push_back(frameDelta);
+    net::putVarint(out, tick);
+    net::putVarint(out, keyframeTick);
+    net::putVarint(out, size);
+
+    const unsigned char* base = keyframe.data();
+    std::size_t cursor = 0;
+    while (cursor < size)
+    {
+        // Walk the unchanged stretch eight bytes per compare, then
+        // byte-exact to the first difference
+        std::size_t copyStart = cursor;
+        while (copyStart + 8 <= size && std::memcmp(state + copyStart, base + copyStart, 8) == 0)
+            copyStart += 8;
+        while (copyStart < size && state[copyStart] == base[copyStart])
+            ++copyStart;
+        if (copyStart == size)
+            break;  // Trailing unchanged bytes are implied
+
+        // Extend the changed run, swallowing equal gaps too short to be
+        // worth a fresh run header
+        std::size_t copyEnd = copyStart + 1;
+        std::size_t probe = copyEnd;
+        std::size_t equal = 0;
+        while (probe < size && equal <= mergeGap)
+        {
+            if (state[probe] == base[probe])
+                ++equal;
+            else
+            {
+                equal = 0;
+                copyEnd = probe + 1;
+            }
+            ++probe;
+        }
+
+        net::putVarint(out, copyStart - cursor);
+        net::putVarint(out, copyEnd - copyStart);
+        out.insert(out.end(), state + copyStart, state + copyEnd);
+        cursor = copyEnd;
+    }
+    return false;
+}
+
+/**
+ * @brief Decodes a received payload.
+ *
+ * @param data The payload bytes.
+ * @param size The payload size in bytes.
+ * @param outState Receives the decoded state block on success.
+ * @param outTick Receives the block's simulation tick on success.
+ * @return true If a state was decoded.
+ * @return false If the payload is malformed or its keyframe is missing.
+ */
+bool BroadcastDecoder::decode(const std::uint8_t* data, std::size_t size,
+                              std::vector<unsigned char>& outState, std::uint32_t& outTick)
+{
+    const std::uint8_t* cursor = data;
+    const std::uint8_t* end = data + size;
+    if (cursor == end)
+        return false;
+    const std::uint8_t frame = *cursor++;
+
+    std::uint64_t tick = 0;
+    if (!net::getVarint(cursor, end, tick))
+        return false;
+
+    if (frame == frameKeyframe)
+    {
+        std::uint64_t stateSize = 0;
+        if (!net::getVarint(cursor, end, stateSize) || static_cast<std::size_t>(end - cursor) != stateSize)
+            return false;
+        keyframe.assign(cursor, end);
+        keyframeTick = static_cast<std::uint32_t>(tick);
+        haveKeyframe = true;
+        outState = keyframe;
+        outTick = keyframeTick;
+        return true;
+    }
+
+    if (frame != frameDelta)
+        return false;
+
+    std::uint64_t baseTick = 0;
+    std::uint64_t stateSize = 0;
+    if (!net::getVarint(cursor, end, baseTick) || !net::getVarint(cursor, end, stateSize))
+        return false;
+    if (!haveKeyframe || baseTick != keyframeTick || stateSize != keyframe.size())
+        return false;  // Late joiner or lost keyframe; wait for the next one
+
+    outState = keyframe;
+    std::size_t write = 0;
+    while (cursor != end)
+    {
+        std::uint64_t skip = 0;
+        std::uint64_t copy = 0;
+        if (!net::getVarint(cursor, end, skip) || !net::getVarint(cursor, end, copy))
+            return false;
+        if (skip > outState.size() - write)
+            return false;
+        write += skip;
+        if (copy > outState.size() - write || copy > static_cast<std::size_t>(end - cursor))
+            return false;
+        std::memcpy(outState.data() + write, cursor, copy);
+        write += copy;
+        cursor += copy;
+    }
+    outTick = static_cast<std::uint32_t>(tick);
+    return true;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Run-length diff codec for the spectator broadcast.
+ *
+ * One cabinet streaming to N spectator screens cannot use the acked
+ * delta codec — there is no per-viewer backchannel. This codec is
+ * stateless on the wire instead: every delta diffs against the last
+ * KEYFRAME, not the previous tick, so any receiver holding that
+ * keyframe can decode any later delta regardless of what it missed,
+ * and a periodic keyframe both bounds the drift and lets late joiners
+ * sync from nothing.
+ *
+ * The payload operates on the raw savestate block (captureState /
+ * restoreState), so it needs no per-field schema and survives state
+ * layout changes for free. A delta is a run-length diff: repeated
+ * (skip, copy, bytes) groups, skip and copy as varints, with trailing
+ * unchanged bytes implied. The encoder walks unchanged stretches eight
+ * bytes per compare and only touches changed bytes further, so a
+ * steady-state encode is dominated by the handful of fields that moved.
+ */
+class BroadcastEncoder {
+public:
+    /**
+     * @brief Sizes the codec for a state block; the only allocation.
+     *
+     * Must be re-run if the simulation is re-initialized with a
+     * different level, since the block size follows the entity counts.
+     *
+     * @param stateSize Bytes in one captureState block.
+     * @param keyframeInterval Encodes between keyframes; 120 is one
+     * second of deltas at the fixed tick.
+     */
+    void init(std::size_t stateSize, std::uint32_t keyframeInterval = 120);
+
+    /**
+     * @brief Encodes the next outgoing state block.
+     *
+     * Emits a keyframe on the first call and every keyframeInterval
+     * encodes after it, a delta against the last keyframe otherwise.
+     *
+     * @param state The state block; stateSize bytes.
+     * @param tick The simulation tick the block was captured at.
+     * @param out Receives the payload bytes; cleared first.
+     * @return true If the payload is a keyframe.
+     */
+    bool encode(const unsigned char* state, std::uint32_t tick, std::vector<std::uint8_t>& out);
+
+private:
+    std::vector<unsigned char> keyframe; ///< The last keyframe's block; delta base.
+    std::uint32_t keyframeTick = 0; ///< Tick of the held keyframe.
+    std::uint32_t keyframeInterval = 120; ///< Encodes between keyframes.
+    std::uint32_t sinceKeyframe = 0; ///< Deltas emitted since the last keyframe.
+    bool haveKeyframe = false; ///< False until the first encode.
+};
+
+/**
+ * @brief Decoder for one spectator screen.
+ *
+ * Holds the last received keyframe and applies run-length deltas to a
+ * copy of it. A delta whose keyframe was missed (late join, loss) is
+ * dropped; the stream self-heals at the next keyframe.
+ */
+class BroadcastDecoder {
+public:
+    /**
+     * @brief Decodes a received payload.
+     *
+     * @param data The payload bytes.
+     * @param size The payload size in bytes.
+     * @param outState Receives the decoded state block on success.
+     * @param outTick Receives the block's simulation tick on success.
+     * @return true If a state was decoded.
+     * @return false If the payload is malformed or its keyframe is missing.
+     */
+    bool decode(const std::uint8_t* data, std::size_t size,
+                std::vector<unsigned char>& outState, std::uint32_t& outTick);
+
+private:
+    std::vector<unsigned char> keyframe; ///< The last received keyframe's block.
+    std::uint32_t keyframeTick = 0; ///< Tick of the held keyframe.
+    bool haveKeyframe = false; ///< False until the first keyframe arrives.
+};
@@ -0,0 +1,82 @@
+#pragma once
+#include "geometry.h"
+
+/**
+ * @brief Smoothed follow camera with look-ahead and a dead zone.
+ *
+ * The camera used to snap rigidly to the player every tick, which
+ * jerked the view on every bounce and direction change. Camera damps
+ * toward a target that leads the player in the direction of travel:
+ * small wobbles inside the dead zone move nothing, larger errors close
+ * exponentially. The camera advances in the fixed tick, so the motion
+ * is deterministic and part of the saved state (its center persists in
+ * the savestate scalars; everything else here is constant config).
+ *
+ * The perf half: worldRect() publishes the camera's visible world
+ * rectangle once per tick, and draw culling, chunk streaming and the
+ * sleep logic all read that one rect instead of each re-deriving the
+ * view extent from center and size.
+ */
+struct Camera {
+    float x = 400.0f; ///< Center x; persisted in the savestate scalars.
+    float y = 300.0f; ///< Center y; fixed — the game scrolls horizontally.
+
+    float lookAhead = 200.0f; ///< Pixels the target leads the player, signed by travel direction.
+    float deadZone = 48.0f; ///< Target error the camera ignores, pixels.
+    float followRate = 6.0f; ///< Exponential closing rate, per second.
+    float halfWidth = 400.0f; ///< Half the view width in world pixels.
+    float halfHeight = 300.0f; ///< Half the view height in world pixels.
+
+    /**
+     * @brief Advances the camera one tick toward the player.
+     *
+     * The target leads the player by lookAhead in the direction of
+     * horizontal travel (a stationary player keeps the last lead via
+     * velocity sign zero treated as rightward, matching the original
+     * always-ahead camera). Error inside the dead zone is ignored;
+     * beyond it the camera closes the excess exponentially.
+     *
+     * @param playerX Player AABB left edge.
+     * @param playerVelX Player horizontal velocity, pixels per second.
+     * @param dt Fixed tick duration in seconds.
+     */
+    void follow(float playerX, float playerVelX, float dt)
+    {
+        const float target = playerX + (playerVelX < 0.0f ? -lookAhead : lookAhead);
+        float error = target - x;
+        if (error > deadZone)
+            error -= deadZone;
+        else if (error < -deadZone)
+            error += deadZone;
+        else
+            error = 0.0f;
+        const float step = followRate * dt;
+        x += error * (step < 1.0f ? step : 1.0f);
+    }
+
+    /**
+     * @brief Snaps the camera straight to its reset position.
+     *
+     * @param centerX Center x to snap to.
+     * @param centerY Center y to snap to.
+     */
+    void snapTo(float centerX, float centerY)
+    {
+        x = centerX;
+        y = centerY;
+    }
+
+    /**
+     * @brief The world rectangle the camera shows this tick.
+     *
+     * Published once per tick and shared by draw culling, chunk
+     * streaming and sleep logic, so the visible set is derived from
+     * one rect instead of three re-computations.
+     *
+     * @return Aabb<float> The visible world extent.
+     */
+    Aabb<float> worldRect() const
+    {
+        return { x - halfWidth, y - halfHeight, halfWidth * 2.0f, halfHeight * 2.0f };
+    }
+};
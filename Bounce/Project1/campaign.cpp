@@ -0,0 +1,123 @@
+#include "campaign.h"
+#include <cstdio>
+#include <cstring>
+
+/**
+ * @brief Loads the play-order manifest.
+ *
+ * @param path Path to the manifest text file.
+ * @return true If the manifest was read and lists at least one level.
+ * @return false If the file is missing or empty.
+ */
+bool Campaign::loadManifest(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    char line[512];
+    while (std::fgets(line, sizeof(line), file))
+    {
+        // Trim the newline and skip blanks and # comments
+        std::size_t length = std::strcspn(line, "\r\n");
+        line[length] = '\0';
+        if (length == 0 || line[0] == '#')
+            continue;
+        paths.emplace_back(line);
+    }
+    std::fclose(file);
+    return !paths.empty();
+}
+
+/**
+ * @brief Appends one level to the play order.
+ *
+ * @param path Path to the level file.
+ */
+void Campaign::addLevel(const std::string& path)
+{
+    paths.push_back(path);
+}
+
+/**
+ * @brief The current level, decoded through the cache.
+ *
+ * @return const LevelData& The decoded level; stable until evicted.
+ */
+const LevelData& Campaign::current()
+{
+    return fetch(index);
+}
+
+/**
+ * @brief Moves to the next level and returns it.
+ *
+ * @return const LevelData& The next level's decoded data.
+ */
+const LevelData& Campaign::advance()
+{
+    if (hasNext())
+        ++index;
+    return fetch(index);
+}
+
+/**
+ * @brief Moves back to the first level and returns it.
+ *
+ * @return const LevelData& The first level's decoded data.
+ */
+const LevelData& Campaign::restart()
+{
+    index = 0;
+    return fetch(index);
+}
+
+/**
+ * @brief Returns one level through the cache, decoding on a miss.
+ *
+ * A hit is a stamp bump and a pointer handback — no read, no parse.
+ * A miss decodes into a fresh block, evicting the least-recently-used
+ * entry once the cache is full; the two most recent entries (the
+ * current and previous levels, which the render thread may still be
+ * drawing from) always carry the highest stamps and survive.
+ *
+ * @param levelIndex Play-order index of the level.
+ * @return const LevelData& The decoded level.
+ */
+const LevelData& Campaign::fetch(std::size_t levelIndex)
+{
+    for (CacheEntry& entry : cache)
+    {
+        if (entry.level == levelIndex)
+        {
+            entry.lastUse = ++useClock;
+            return *entry.data;
+        }
+    }
+
+    // Mapping first: the records are read in place from the shared
+    // page cache, so parallel instances on one cabinet pay for one
+    // copy. The copying loader stays as the fallback for filesystems
+    // that refuse the mapping.
+    auto data = std::make_unique<LevelData>();
+    if (levelIndex >= paths.size()
+        || (!mapLevel(paths[levelIndex], *data) && !loadLevel(paths[levelIndex], *data)))
+        *data = makeDefaultLevel();  // Same fallback the single-level load used
+
+    if (cache.size() < cacheCapacity)
+    {
+        cache.push_back(CacheEntry{ levelIndex, ++useClock, std::move(data) });
+        return *cache.back().data;
+    }
+
+    CacheEntry* oldest = &cache[0];
+    for (CacheEntry& entry : cache)
+    {
+        if (entry.lastUse < oldest->lastUse)
+            oldest = &entry;
+    }
+    oldest->level = levelIndex;
+    oldest->lastUse = ++useClock;
+    oldest->data = std::move(data);
+    return *oldest->data;
+}
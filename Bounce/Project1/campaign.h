@@ -0,0 +1,115 @@
+#pragma once
+#include "level_loader.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief An ordered set of levels with an LRU cache of decoded data.
+ *
+ * The manifest is a text file of level paths, one per line in play
+ * order; with no manifest the campaign is whatever single level the
+ * caller adds, which is the shipped behavior. Levels decode through a
+ * small LRU cache of LevelData blocks, so advancing to a level played
+ * earlier (or restarting the campaign) touches no file and parses
+ * nothing — the records are handed back as decoded, and sim.init
+ * rebuilds its structures from memory. Cache entries are owned through
+ * unique_ptr, so the LevelData a caller holds never moves; eviction
+ * takes the least-recently-used entry, which is never the current or
+ * previous level while the capacity is above two.
+ */
+class Campaign {
+public:
+    /**
+     * @brief Loads the play-order manifest.
+     *
+     * @param path Path to the manifest text file.
+     * @return true If the manifest was read and lists at least one level.
+     * @return false If the file is missing or empty.
+     */
+    bool loadManifest(const std::string& path);
+
+    /**
+     * @brief Appends one level to the play order.
+     *
+     * The fallback when no manifest exists: add the single shipped
+     * level and the campaign degenerates to today's behavior.
+     *
+     * @param path Path to the level file.
+     */
+    void addLevel(const std::string& path);
+
+    /**
+     * @brief The current level, decoded through the cache.
+     *
+     * A missing or malformed level file falls back to the built-in
+     * default level, as the single-level load always has.
+     *
+     * @return const LevelData& The decoded level; stable until evicted.
+     */
+    const LevelData& current();
+
+    /**
+     * @brief Whether a level follows the current one.
+     *
+     * @return true If advance() has somewhere to go.
+     */
+    bool hasNext() const { return index + 1 < paths.size(); }
+
+    /**
+     * @brief Moves to the next level and returns it.
+     *
+     * @return const LevelData& The next level's decoded data.
+     */
+    const LevelData& advance();
+
+    /**
+     * @brief Moves back to the first level and returns it.
+     *
+     * The campaign-complete wrap; with the cache warm this is a
+     * pointer handback.
+     *
+     * @return const LevelData& The first level's decoded data.
+     */
+    const LevelData& restart();
+
+    /**
+     * @brief The current level's position in the play order.
+     *
+     * @return std::size_t Zero-based level index.
+     */
+    std::size_t levelIndex() const { return index; }
+
+    /**
+     * @brief Levels in the play order.
+     *
+     * @return std::size_t The manifest length.
+     */
+    std::size_t levelCount() const { return paths.size(); }
+
+private:
+    /**
+     * @brief One cached decode.
+     */
+    struct CacheEntry {
+        std::size_t level = 0; ///< Play-order index this entry decodes.
+        std::uint64_t lastUse = 0; ///< Use-clock stamp for LRU eviction.
+        std::unique_ptr<LevelData> data; ///< The decoded level; address stable.
+    };
+
+    /**
+     * @brief Returns one level through the cache, decoding on a miss.
+     *
+     * @param levelIndex Play-order index of the level.
+     * @return const LevelData& The decoded level.
+     */
+    const LevelData& fetch(std::size_t levelIndex);
+
+    static const std::size_t cacheCapacity = 4; ///< Decoded levels kept; eviction spares the two most recent.
+
+    std::vector<std::string> paths; ///< Level files in play order.
+    std::vector<CacheEntry> cache; ///< Decoded levels, up to cacheCapacity.
+    std::size_t index = 0; ///< Current position in the play order.
+    std::uint64_t useClock = 0; ///< Monotonic stamp source for LRU.
+};
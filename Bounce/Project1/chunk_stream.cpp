@@ -0,0 +1,133 @@
+#include "chunk_stream.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Partitions the level's static geometry into chunks.
+ *
+ * @param level The loaded level; platform/wall records are copied.
+ * @param chunkWidth Width of one chunk in pixels.
+ * @param margin Extra distance streamed in ahead of and behind the camera.
+ */
+void ChunkStream::build(const LevelData& level, float chunkWidth, float margin)
+{
+    this->chunkWidth = chunkWidth;
+    this->margin = margin;
+    platforms = level.platforms;
+    walls = level.walls;
+    floor = level.floor;
+
+    // The level's extent comes from the floor, which spans it by convention
+    chunkCount = std::max(1, static_cast<int>(std::ceil((floor.x + floor.w) / chunkWidth)));
+
+    // A mapped level with a valid baked index at this width already
+    // holds the tables in their runtime layout: adopt them in place.
+    // Anything else — generated level, old file, corrupt or mismatched
+    // bake — runs the same binning the packer does
+    const LevelData::BakedBroadphase& baked = level.bakedIndex;
+    if (baked.valid() && baked.chunkWidth == chunkWidth
+        && baked.chunkCount == static_cast<std::uint32_t>(chunkCount))
+    {
+        platformStarts.adopt(baked.platformStarts, chunkCount + 1);
+        wallStarts.adopt(baked.wallStarts, chunkCount + 1);
+        platformEntries.adopt(baked.platformEntries, baked.platformStarts[chunkCount]);
+        wallEntries.adopt(baked.wallEntries, baked.wallStarts[chunkCount]);
+    }
+    else
+    {
+        buildChunkIndex(platforms, chunkWidth, chunkCount, platformStarts, platformEntries);
+        buildChunkIndex(walls, chunkWidth, chunkCount, wallStarts, wallEntries);
+    }
+
+    activeFirst = -1;
+    activeLast = -2;
+}
+
+/**
+ * @brief Streams chunks for a camera position.
+ *
+ * @param cameraX Camera center x in world space.
+ * @param store Entity store whose static arrays are repopulated.
+ * @param platformHash Platform broadphase, rebuilt on chunk change.
+ * @param wallHash Wall broadphase, rebuilt on chunk change.
+ * @return true If the active window changed and geometry was restreamed.
+ * @return false If the active window is unchanged.
+ */
+bool ChunkStream::update(float cameraX, EntityStore& store, SpatialHash& platformHash, SpatialHash& wallHash)
+{
+    const int first = firstChunkFor(cameraX);
+    const int last = lastChunkFor(cameraX);
+
+    if (first == activeFirst && last == activeLast)
+        return false;
+
+    activeFirst = first;
+    activeLast = last;
+
+    store.clearStaticGeometry();
+
+    // Size the window's exact record counts up front so the adds below
+    // are allocation-free even the first time this window streams in
+    std::size_t platformCount = 1;  // The always-resident floor
+    std::size_t wallCount = 0;
+    // A window entirely past either level end has first > last and
+    // streams only the floor, as the per-chunk loops used to
+    if (first <= last)
+    {
+        platformCount += platformStarts[last + 1] - platformStarts[first];
+        wallCount += wallStarts[last + 1] - wallStarts[first];
+    }
+    store.reserveStaticGeometry(platformCount, wallCount);
+
+    if (first <= last)
+    {
+        for (std::uint32_t e = platformStarts[first]; e != platformStarts[last + 1]; ++e)
+        {
+            const level::RectRecord& record = platforms[platformEntries[e]];
+            store.addPlatform(record.x, record.y, record.w, record.h);
+        }
+        for (std::uint32_t e = wallStarts[first]; e != wallStarts[last + 1]; ++e)
+        {
+            const level::RectRecord& record = walls[wallEntries[e]];
+            store.addWall(record.x, record.y, record.w, record.h);
+        }
+    }
+
+    // The floor always stays resident so there is ground under the player;
+    // it is the one platform a drop-through must never pass
+    store.addPlatform(floor.x, floor.y, floor.w, floor.h, surface::Top);
+
+    platformHash.build(store.platformX, store.platformY, store.platformW, store.platformH);
+    wallHash.build(store.wallX, store.wallY, store.wallW, store.wallH);
+    return true;
+}
+
+/**
+ * @brief Pages in a chunk range's records without streaming them.
+ *
+ * @param first First chunk index to touch.
+ * @param last Last chunk index to touch.
+ */
+void ChunkStream::touchChunks(int first, int last) const
+{
+    first = std::max(first, 0);
+    last = std::min(last, chunkCount - 1);
+    if (first > last)
+        return;
+
+    // One read per cache line of each record is enough to fault the
+    // page in; the sum defeats dead-read elimination
+    volatile unsigned char sink = 0;
+    for (std::uint32_t e = platformStarts[first]; e != platformStarts[last + 1]; ++e)
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&platforms[platformEntries[e]]);
+        for (std::size_t offset = 0; offset < sizeof(level::RectRecord); offset += cacheLineSize)
+            sink = sink + bytes[offset];
+    }
+    for (std::uint32_t e = wallStarts[first]; e != wallStarts[last + 1]; ++e)
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&walls[wallEntries[e]]);
+        for (std::size_t offset = 0; offset < sizeof(level::RectRecord); offset += cacheLineSize)
+            sink = sink + bytes[offset];
+    }
+}
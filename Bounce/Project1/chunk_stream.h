@@ -0,0 +1,118 @@
+#pragma once
+#include "level_loader.h"
+#include "entity_store.h"
+#include "spatial_hash.h"
+#include <algorithm>
+#include <cstddef>
+
+/**
+ * @brief Streams static level geometry in fixed-width chunks around the camera.
+ *
+ * Long horizontal levels keep every platform and wall resident in the
+ * simulation even though the player only ever interacts with the slice
+ * near the camera. The stream partitions the level's static records into
+ * fixed-width chunks at load; each frame it checks which chunk window the
+ * camera is in and, only when that window changes, repopulates the entity
+ * store's platform/wall arrays (plus their spatial hashes) with the
+ * chunks around the camera. Simulation-side memory and scan counts stay
+ * O(visible window) instead of O(level). Dynamic entities (obstacles,
+ * coins) and the GPU-resident render bake stay whole-level.
+ */
+class ChunkStream {
+public:
+    /**
+     * @brief Partitions the level's static geometry into chunks.
+     *
+     * A mapped level carrying a valid baked index at this chunk width
+     * has the tables adopted straight from the mapping — no binning
+     * work and no owned copy; anything else is binned here at load.
+     *
+     * @param level The loaded level; platform/wall records are copied.
+     * @param chunkWidth Width of one chunk in pixels (default 1024).
+     * @param margin Extra distance streamed in ahead of and behind the camera.
+     */
+    void build(const LevelData& level, float chunkWidth = 1024.0f, float margin = 1024.0f);
+
+    /**
+     * @brief Streams chunks for a camera position.
+     *
+     * When the camera's chunk window differs from the active one, the
+     * store's platform and wall arrays are repopulated from the active
+     * chunks (the floor is always present) and the hashes are rebuilt.
+     *
+     * @param cameraX Camera center x in world space.
+     * @param store Entity store whose static arrays are repopulated.
+     * @param platformHash Platform broadphase, rebuilt on chunk change.
+     * @param wallHash Wall broadphase, rebuilt on chunk change.
+     * @return true If the active window changed and geometry was restreamed.
+     * @return false If the active window is unchanged.
+     */
+    bool update(float cameraX, EntityStore& store, SpatialHash& platformHash, SpatialHash& wallHash);
+
+    /**
+     * @brief First chunk a window centred on @p x would stream.
+     *
+     * @param x Camera (or predicted camera) center x in world space.
+     * @return int The window's first chunk index.
+     */
+    int firstChunkFor(float x) const { return std::max(0, static_cast<int>((x - margin) / chunkWidth)); }
+
+    /**
+     * @brief Last chunk a window centred on @p x would stream.
+     *
+     * @param x Camera (or predicted camera) center x in world space.
+     * @return int The window's last chunk index.
+     */
+    int lastChunkFor(float x) const { return std::min(chunkCount - 1, static_cast<int>((x + margin) / chunkWidth)); }
+
+    /// First chunk of the active window; -1 before the first update.
+    int activeFirstChunk() const { return activeFirst; }
+
+    /// Last chunk of the active window.
+    int activeLastChunk() const { return activeLast; }
+
+    /**
+     * @brief Pages in a chunk range's records without streaming them.
+     *
+     * Reads one byte per cache line of every record the chunks hold, so
+     * a mapped level's cold pages fault here — on whichever thread the
+     * caller chose — instead of inside the restream on the tick thread.
+     * Pure reads over immutable data: safe to run on a worker while the
+     * tick is in flight.
+     *
+     * @param first First chunk index to touch.
+     * @param last Last chunk index to touch.
+     */
+    void touchChunks(int first, int last) const;
+
+    /**
+     * @brief Left edge of the active chunk window in world space.
+     *
+     * @return float The window's left edge; meaningless before the first update.
+     */
+    float windowLeft() const { return activeFirst * chunkWidth; }
+
+    /**
+     * @brief Right edge of the active chunk window in world space.
+     *
+     * @return float The window's right edge; meaningless before the first update.
+     */
+    float windowRight() const { return (activeLast + 1) * chunkWidth; }
+
+private:
+    RecordArray<level::RectRecord> platforms; ///< All platform records; views the level's mapping when it has one.
+    RecordArray<level::RectRecord> walls; ///< All wall records; views the level's mapping when it has one.
+    level::RectRecord floor = {}; ///< The floor; always resident.
+    // The per-chunk index in the baked runtime layout: chunk c's records
+    // are entries[starts[c]] up to entries[starts[c + 1]]. The arrays
+    // view the level file's baked section when it has a valid one
+    RecordArray<std::uint32_t> platformStarts; ///< chunkCount + 1 offsets into platformEntries.
+    RecordArray<std::uint32_t> platformEntries; ///< Concatenated per-chunk platform indices.
+    RecordArray<std::uint32_t> wallStarts; ///< chunkCount + 1 offsets into wallEntries.
+    RecordArray<std::uint32_t> wallEntries; ///< Concatenated per-chunk wall indices.
+    float chunkWidth = 1024.0f; ///< Width of one chunk in pixels.
+    float margin = 1024.0f; ///< Streaming distance around the camera.
+    int chunkCount = 0; ///< Number of chunks covering the level.
+    int activeFirst = -1; ///< First chunk of the active window, -1 before the first update.
+    int activeLast = -2; ///< Last chunk of the active window.
+};
@@ -0,0 +1,377 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BOUNCE_COLLISION_KERNEL_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define BOUNCE_COLLISION_KERNEL_SSE2 0
+#endif
+
+/**
+ * @brief Branch-free contact selection over collision candidates.
+ *
+ * The per-candidate response used to run the full swept test with its
+ * falling checks and side disambiguation — a pile of compound branches
+ * per box that the predictor misses in dense-contact scenes and the
+ * vectorizer refuses outright. These kernels compute every candidate's
+ * crossing time and validity mask arithmetically and select the
+ * earliest hit with blends, leaving exactly one branch per entity:
+ * applying the result. The formulas mirror the swept slab test for the
+ * axis-constrained cases they cover (a vertical-only fall, a
+ * horizontal-only slide), including the clamp of an already-touching
+ * contact to t = 0, so they resolve bit-identically to the scalar
+ * sweep they replace.
+ *
+ * Two shapes per kernel: an indexed scalar form that walks the
+ * broadphase candidate list directly — the typical set is one or two
+ * boxes, where a gather costs more than it saves — and a gathered
+ * four-wide SSE2 form for dense sets. Callers switch on
+ * denseKernelThreshold; both produce identical selections.
+ */
+
+/// Candidate count at which gathering into SoA and running the wide
+/// kernel beats the indexed scalar walk.
+constexpr std::size_t denseKernelThreshold = 16;
+
+/**
+ * @brief Earliest downward landing among candidate platforms, indexed form.
+ *
+ * A candidate is hit when the falling box overlaps it horizontally,
+ * its top is crossed within the displacement (entry <= 1) and its
+ * underside has not already been passed (exit > 0); an entry in the
+ * past clamps to zero, matching the slab test's touching case. Invalid
+ * candidates score beyond any real hit, and ties keep the first
+ * candidate, exactly as the sequential scan did.
+ *
+ * @param x Left edge of the falling box.
+ * @param y Top edge of the falling box.
+ * @param size Edge length of the falling box.
+ * @param dy Downward displacement this tick; must be positive.
+ * @param px Platform left edges (full array).
+ * @param py Platform top edges (full array).
+ * @param pw Platform widths (full array).
+ * @param ph Platform heights (full array).
+ * @param candidates Broadphase candidate indices into the arrays.
+ * @param count Number of candidates.
+ * @return std::size_t Slot in @p candidates of the earliest landing, or count.
+ */
+inline std::size_t earliestLandingIndexed(float x, float y, float size, float dy,
+                                          const float* px, const float* py, const float* pw, const float* ph,
+                                          const std::size_t* candidates, std::size_t count)
+{
+    const float bottom = y + size;
+    float bestT = 2.0f;
+    std::size_t best = count;
+    for (std::size_t c = 0; c < count; ++c)
+    {
+        const std::size_t i = candidates[c];
+        const float entry = (py[i] - bottom) / dy;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool valid = entry <= 1.0f && py[i] + ph[i] > y
+            && x + size > px[i] && x < px[i] + pw[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? c : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return best;
+}
+
+/**
+ * @brief Earliest downward landing, gathered four-wide form.
+ *
+ * Same selection as the indexed form over SoA-gathered candidate
+ * boxes; four lanes resolve per instruction batch on SSE2 targets.
+ *
+ * @param x Left edge of the falling box.
+ * @param y Top edge of the falling box.
+ * @param size Edge length of the falling box.
+ * @param dy Downward displacement this tick; must be positive.
+ * @param px Gathered candidate platform left edges.
+ * @param py Gathered candidate platform top edges.
+ * @param pw Gathered candidate platform widths.
+ * @param ph Gathered candidate platform heights.
+ * @param count Number of candidates.
+ * @return std::size_t Slot of the earliest landing, or count if none.
+ */
+inline std::size_t earliestLanding(float x, float y, float size, float dy,
+                                   const float* px, const float* py, const float* pw, const float* ph,
+                                   std::size_t count)
+{
+    const float bottom = y + size;
+    float bestT = 2.0f;
+    std::size_t best = count;
+    std::size_t i = 0;
+
+#if BOUNCE_COLLISION_KERNEL_SSE2
+    const __m128 boxLeft = _mm_set1_ps(x);
+    const __m128 boxRight = _mm_set1_ps(x + size);
+    const __m128 boxTop = _mm_set1_ps(y);
+    const __m128 boxBottom = _mm_set1_ps(bottom);
+    const __m128 dyWide = _mm_set1_ps(dy);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 miss = _mm_set1_ps(2.0f);
+
+    __m128 bestTimes = miss;
+    __m128i bestSlots = _mm_set1_epi32(-1);
+    __m128i slots = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i four = _mm_set1_epi32(4);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 left = _mm_loadu_ps(px + i);
+        const __m128 top = _mm_loadu_ps(py + i);
+        const __m128 right = _mm_add_ps(left, _mm_loadu_ps(pw + i));
+        const __m128 under = _mm_add_ps(top, _mm_loadu_ps(ph + i));
+
+        const __m128 entry = _mm_div_ps(_mm_sub_ps(top, boxBottom), dyWide);
+        const __m128 t = _mm_max_ps(entry, zero);
+        __m128 valid = _mm_and_ps(_mm_cmple_ps(entry, one), _mm_cmpgt_ps(under, boxTop));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(boxRight, left), _mm_cmplt_ps(boxLeft, right)));
+
+        // Invalid lanes score as a miss; then keep the earlier time per lane
+        const __m128 scored = _mm_or_ps(_mm_and_ps(valid, t), _mm_andnot_ps(valid, miss));
+        const __m128 earlier = _mm_cmplt_ps(scored, bestTimes);
+        bestTimes = _mm_or_ps(_mm_and_ps(earlier, scored), _mm_andnot_ps(earlier, bestTimes));
+        const __m128i earlierMask = _mm_castps_si128(earlier);
+        bestSlots = _mm_or_si128(_mm_and_si128(earlierMask, slots), _mm_andnot_si128(earlierMask, bestSlots));
+        slots = _mm_add_epi32(slots, four);
+    }
+
+    // Reduce the four lanes; ties resolve to the lowest slot so the
+    // result matches a sequential first-wins scan
+    if (i != 0)
+    {
+        alignas(16) float laneTimes[4];
+        alignas(16) std::int32_t laneSlots[4];
+        _mm_store_ps(laneTimes, bestTimes);
+        _mm_store_si128(reinterpret_cast<__m128i*>(laneSlots), bestSlots);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const bool better = laneSlots[lane] >= 0
+                && (laneTimes[lane] < bestT
+                    || (laneTimes[lane] == bestT && (best == count || static_cast<std::size_t>(laneSlots[lane]) < best)));
+            bestT = better ? laneTimes[lane] : bestT;
+            best = better ? static_cast<std::size_t>(laneSlots[lane]) : best;
+        }
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        const float entry = (py[i] - bottom) / dy;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool valid = entry <= 1.0f && py[i] + ph[i] > y
+            && x + size > px[i] && x < px[i] + pw[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? i : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return bestT < 2.0f || best != count ? best : count;
+}
+
+/**
+ * @brief Earliest wall face crossed by a sliding box, indexed form.
+ *
+ * The face depends only on the travel direction — the left face when
+ * moving right, the right face when moving left — so the side
+ * disambiguation is one select outside the loop, not four compound
+ * conditions per hit. Valid when the face is crossed within the
+ * displacement (entry <= 1), the far face has not already been passed
+ * (exit > 0) and the boxes overlap vertically.
+ *
+ * @param x Left edge of the moving box.
+ * @param y Top edge of the moving box.
+ * @param size Edge length of the moving box.
+ * @param dx Horizontal displacement this tick; must be nonzero.
+ * @param wx Wall left edges (full array).
+ * @param wy Wall top edges (full array).
+ * @param ww Wall widths (full array).
+ * @param wh Wall heights (full array).
+ * @param candidates Broadphase candidate indices into the arrays.
+ * @param count Number of candidates.
+ * @return std::size_t Slot in @p candidates of the earliest blocking wall, or count.
+ */
+inline std::size_t earliestWallHitIndexed(float x, float y, float size, float dx,
+                                          const float* wx, const float* wy, const float* ww, const float* wh,
+                                          const std::size_t* candidates, std::size_t count)
+{
+    const bool movingRight = dx > 0.0f;
+    const float lead = movingRight ? x + size : x;  // The edge that meets the face first
+    float bestT = 2.0f;
+    std::size_t best = count;
+    for (std::size_t c = 0; c < count; ++c)
+    {
+        const std::size_t i = candidates[c];
+        const float face = movingRight ? wx[i] : wx[i] + ww[i];
+        const float entry = (face - lead) / dx;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool passed = movingRight ? wx[i] + ww[i] <= x : wx[i] >= x + size;
+        const bool valid = entry <= 1.0f && !passed
+            && y + size > wy[i] && y < wy[i] + wh[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? c : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return best;
+}
+
+/**
+ * @brief Earliest wall face crossed, gathered four-wide form.
+ *
+ * Same selection as the indexed form over SoA-gathered candidates.
+ *
+ * @param x Left edge of the moving box.
+ * @param y Top edge of the moving box.
+ * @param size Edge length of the moving box.
+ * @param dx Horizontal displacement this tick; must be nonzero.
+ * @param wx Gathered candidate wall left edges.
+ * @param wy Gathered candidate wall top edges.
+ * @param ww Gathered candidate wall widths.
+ * @param wh Gathered candidate wall heights.
+ * @param count Number of candidates.
+ * @return std::size_t Slot of the earliest blocking wall, or count if none.
+ */
+inline std::size_t earliestWallHit(float x, float y, float size, float dx,
+                                   const float* wx, const float* wy, const float* ww, const float* wh,
+                                   std::size_t count)
+{
+    const bool movingRight = dx > 0.0f;
+    const float lead = movingRight ? x + size : x;  // The edge that meets the face first
+    float bestT = 2.0f;
+    std::size_t best = count;
+    std::size_t i = 0;
+
+#if BOUNCE_COLLISION_KERNEL_SSE2
+    const __m128 boxTop = _mm_set1_ps(y);
+    const __m128 boxBottom = _mm_set1_ps(y + size);
+    const __m128 boxLeft = _mm_set1_ps(x);
+    const __m128 boxRight = _mm_set1_ps(x + size);
+    const __m128 leadWide = _mm_set1_ps(lead);
+    const __m128 dxWide = _mm_set1_ps(dx);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 miss = _mm_set1_ps(2.0f);
+
+    __m128 bestTimes = miss;
+    __m128i bestSlots = _mm_set1_epi32(-1);
+    __m128i slots = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i four = _mm_set1_epi32(4);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 left = _mm_loadu_ps(wx + i);
+        const __m128 top = _mm_loadu_ps(wy + i);
+        const __m128 right = _mm_add_ps(left, _mm_loadu_ps(ww + i));
+        const __m128 bottom = _mm_add_ps(top, _mm_loadu_ps(wh + i));
+
+        const __m128 face = movingRight ? left : right;
+        const __m128 entry = _mm_div_ps(_mm_sub_ps(face, leadWide), dxWide);
+        const __m128 t = _mm_max_ps(entry, zero);
+        const __m128 notPassed = movingRight ? _mm_cmpgt_ps(right, boxLeft) : _mm_cmplt_ps(left, boxRight);
+        __m128 valid = _mm_and_ps(_mm_cmple_ps(entry, one), notPassed);
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(boxBottom, top), _mm_cmplt_ps(boxTop, bottom)));
+
+        const __m128 scored = _mm_or_ps(_mm_and_ps(valid, t), _mm_andnot_ps(valid, miss));
+        const __m128 earlier = _mm_cmplt_ps(scored, bestTimes);
+        bestTimes = _mm_or_ps(_mm_and_ps(earlier, scored), _mm_andnot_ps(earlier, bestTimes));
+        const __m128i earlierMask = _mm_castps_si128(earlier);
+        bestSlots = _mm_or_si128(_mm_and_si128(earlierMask, slots), _mm_andnot_si128(earlierMask, bestSlots));
+        slots = _mm_add_epi32(slots, four);
+    }
+
+    if (i != 0)
+    {
+        alignas(16) float laneTimes[4];
+        alignas(16) std::int32_t laneSlots[4];
+        _mm_store_ps(laneTimes, bestTimes);
+        _mm_store_si128(reinterpret_cast<__m128i*>(laneSlots), bestSlots);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const bool better = laneSlots[lane] >= 0
+                && (laneTimes[lane] < bestT
+                    || (laneTimes[lane] == bestT && (best == count || static_cast<std::size_t>(laneSlots[lane]) < best)));
+            bestT = better ? laneTimes[lane] : bestT;
+            best = better ? static_cast<std::size_t>(laneSlots[lane]) : best;
+        }
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        const float face = movingRight ? wx[i] : wx[i] + ww[i];
+        const float entry = (face - lead) / dx;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool passed = movingRight ? wx[i] + ww[i] <= x : wx[i] >= x + size;
+        const bool valid = entry <= 1.0f && !passed
+            && y + size > wy[i] && y < wy[i] + wh[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? i : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return bestT < 2.0f || best != count ? best : count;
+}
+
+/**
+ * @brief Push-out vector for a box that starts a tick inside another.
+ *
+ * The swept tests above prevent entering geometry, but a box can
+ * begin a tick already overlapping — placed by a restream, a spawn or
+ * an external push. Resolving that case by travel direction (the way
+ * a crossing is resolved) snaps to the face the motion points at,
+ * which for a box deep inside a thin wall means coming out the far
+ * side: the teleport bug. This kernel instead resolves from
+ * penetration depth: per axis the signed push to the nearer face,
+ * then the axis with the smaller penetration, with the velocity sign
+ * breaking an exact tie toward the side the motion came from. All
+ * selects, no compound branches, so it batches the same way the
+ * selection kernels do.
+ *
+ * @param ax Left edge of the overlapping box.
+ * @param ay Top edge of the overlapping box.
+ * @param aw Width of the overlapping box.
+ * @param ah Height of the overlapping box.
+ * @param bx Left edge of the static box.
+ * @param by Top edge of the static box.
+ * @param bw Width of the static box.
+ * @param bh Height of the static box.
+ * @param velX The moving box's x velocity, for the tiebreak.
+ * @param velY The moving box's y velocity, for the tiebreak.
+ * @param pushX Receives the x displacement that clears the overlap.
+ * @param pushY Receives the y displacement that clears the overlap.
+ * @return true If the boxes overlap (a push was produced).
+ * @return false If they merely touch or are apart (pushes are zero).
+ */
+inline bool overlapPushOut(float ax, float ay, float aw, float ah,
+                           float bx, float by, float bw, float bh,
+                           float velX, float velY,
+                           float& pushX, float& pushY)
+{
+    pushX = 0.0f;
+    pushY = 0.0f;
+
+    const float depthLeft = (ax + aw) - bx;   // Clears by moving -x
+    const float depthRight = (bx + bw) - ax;  // Clears by moving +x
+    const float depthUp = (ay + ah) - by;     // Clears by moving -y
+    const float depthDown = (by + bh) - ay;   // Clears by moving +y
+    if (depthLeft <= 0.0f || depthRight <= 0.0f || depthUp <= 0.0f || depthDown <= 0.0f)
+        return false;  // Touching counts as resolved; the sweeps own that case
+
+    // Per axis, the signed push to the nearer face; a velocity pushes
+    // out the side it entered from when both faces are equally near
+    const float escapeX = depthLeft < depthRight ? -depthLeft
+                        : depthRight < depthLeft ? depthRight
+                        : velX > 0.0f ? -depthLeft : depthRight;
+    const float escapeY = depthUp < depthDown ? -depthUp
+                        : depthDown < depthUp ? depthDown
+                        : velY > 0.0f ? -depthUp : depthDown;
+
+    const float magX = escapeX < 0.0f ? -escapeX : escapeX;
+    const float magY = escapeY < 0.0f ? -escapeY : escapeY;
+    const bool alongX = magX <= magY;
+    pushX = alongX ? escapeX : 0.0f;
+    pushY = alongX ? 0.0f : escapeY;
+    return true;
+}
@@ -0,0 +1,87 @@
+#include "config.h"
+#include "file_watch.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+ConfigSystem::~ConfigSystem()
+{
+    watching.store(false, std::memory_order_release);
+    if (watcher.joinable())
+        watcher.join();
+}
+
+bool ConfigSystem::parseInto(TuningConfig& slot)
+{
+    slot = TuningConfig{};  // Absent keys keep their defaults
+    std::FILE* file = std::fopen(filePath.c_str(), "rb");
+    if (!file)
+        return false;
+
+    char line[128];
+    while (std::fgets(line, sizeof(line), file))
+    {
+        char key[64];
+        float value;
+        if (line[0] == '#' || std::sscanf(line, "%63s %f", key, &value) != 2)
+            continue;
+        if (std::strcmp(key, "gravity") == 0)
+            slot.gravity = value;
+        else if (std::strcmp(key, "jumpStrength") == 0)
+            slot.jumpStrength = value;
+        else if (std::strcmp(key, "moveSpeed") == 0)
+            slot.moveSpeed = value;
+        else if (std::strcmp(key, "groundFriction") == 0)
+            slot.groundFriction = value;
+        else if (std::strcmp(key, "obstacleSpeed") == 0)
+            slot.obstacleSpeed = value;
+        else if (std::strcmp(key, "targetFps") == 0)
+            slot.targetFps = value;
+        else if (std::strcmp(key, "magnetRadius") == 0)
+            slot.magnetRadius = value;
+        else if (std::strcmp(key, "magnetPull") == 0)
+            slot.magnetPull = value;
+        else if (std::strcmp(key, "theme") == 0)
+            slot.theme = value;
+        // Unknown keys are skipped so old builds tolerate new settings
+    }
+    std::fclose(file);
+    return true;
+}
+
+bool ConfigSystem::load(const std::string& path)
+{
+    filePath = path;
+    lastModified = fileModifiedTime(path);
+    if (!parseInto(slots[0]))
+        return false;  // published keeps pointing at the defaults
+    liveSlot = 0;
+    published.store(&slots[0], std::memory_order_release);
+    return true;
+}
+
+void ConfigSystem::startWatch()
+{
+    if (filePath.empty() || watching.load(std::memory_order_relaxed))
+        return;
+    watching.store(true, std::memory_order_release);
+    watcher = std::thread([this]() {
+        while (watching.load(std::memory_order_acquire))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            const std::int64_t modified = fileModifiedTime(filePath);
+            if (modified == 0 || modified == lastModified)
+                continue;
+            lastModified = modified;
+            // Parse into the slot the tick loop is not reading, then
+            // publish; readers that already loaded the old pointer
+            // finish their tick on the old struct, which stays intact
+            // until the following change
+            const int staging = liveSlot ^ 1;
+            if (!parseInto(slots[staging]))
+                continue;
+            liveSlot = staging;
+            published.store(&slots[staging], std::memory_order_release);
+        }
+    });
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <thread>
+#include <cstdint>
+
+/**
+ * @brief Gameplay tuning values, loaded from a config file.
+ *
+ * These were compile-time constants in the tick, so every tuning
+ * iteration was a full rebuild. They now live in one POD struct the
+ * simulation reads through a cached pointer: a hot-path read is a
+ * plain member load — no lookup, no lock, no string hashing per tick.
+ * The defaults are exactly the old constants, so a missing config file
+ * changes nothing.
+ */
+struct TuningConfig {
+    float gravity = 1800.0f; ///< Pixels per second squared (0.5 px/frame at 60Hz).
+    float jumpStrength = -720.0f; ///< Pixels per second (-12 px/frame at 60Hz).
+    float moveSpeed = 300.0f; ///< Pixels per second (5 px/frame at 60Hz).
+    float groundFriction = 0.9f; ///< Per-60Hz-frame decay factor, rescaled to dt in the tick.
+    float obstacleSpeed = 120.0f; ///< Obstacle patrol speed in pixels per second; applied at level init.
+    float targetFps = 60.0f; ///< Frame pacer target when vsync is off.
+    float magnetRadius = 0.0f; ///< Coin magnet reach in pixels; 0 disables the magnet.
+    float magnetPull = 240.0f; ///< Coin drift speed toward the player in pixels per second.
+    float theme = 0.0f; ///< Startup color theme index (see palette.h); F4 cycles it at runtime.
+};
+
+/// The built-in tuning every Simulation starts on; identical to the old constants.
+inline const TuningConfig defaultTuning{};
+
+/**
+ * @brief Loads the tuning config and optionally live-reloads it.
+ *
+ * load() parses the file once at startup. startWatch() spawns a
+ * watcher thread that polls the file's modification time twice a
+ * second and, on a change, parses into the inactive slot of a double
+ * buffer and publishes the pointer atomically. The tick loop reads
+ * current() at each tick boundary, so a swap never lands mid-tick and
+ * the simulation always sees one consistent struct.
+ */
+class ConfigSystem {
+public:
+    /**
+     * @brief Joins the watcher thread if one is running.
+     */
+    ~ConfigSystem();
+
+    /**
+     * @brief Parses the config file into the live slot.
+     *
+     * Lines are "key value"; '#' starts a comment; unknown keys are
+     * ignored so old builds skip new settings. Missing file keeps the
+     * defaults.
+     *
+     * @param path Path to the config file.
+     * @return true If the file was read.
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Starts watching the loaded file for changes.
+     *
+     * No-op if load() was never called or the watcher already runs.
+     */
+    void startWatch();
+
+    /**
+     * @brief The current tuning values.
+     *
+     * One atomic pointer load; the struct behind it is immutable once
+     * published.
+     *
+     * @return const TuningConfig* The latest published config.
+     */
+    const TuningConfig* current() const { return published.load(std::memory_order_acquire); }
+
+private:
+    /**
+     * @brief Parses the file into one slot; helper for load and the watcher.
+     *
+     * @param slot The slot to fill (reset to defaults first).
+     * @return true If the file was read.
+     */
+    bool parseInto(TuningConfig& slot);
+
+    TuningConfig slots[2]; ///< Double buffer; the watcher writes the unpublished one.
+    std::atomic<const TuningConfig*> published{ &defaultTuning }; ///< What current() hands out.
+    int liveSlot = 0; ///< Index of the published slot.
+    std::string filePath; ///< The config file being watched.
+    std::int64_t lastModified = 0; ///< Modification time at the last parse.
+    std::thread watcher; ///< Polls the file twice a second.
+    std::atomic<bool> watching{ false }; ///< Cleared to stop the watcher.
+};
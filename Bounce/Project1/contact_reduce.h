@@ -0,0 +1,92 @@
+#pragma once
+#include "job_system.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Deterministic nearest-contact reduction over a hit list.
+ *
+ * A parallel "first hit wins" races: whichever worker finishes last
+ * would decide the contact, and replays and lockstep diverge by thread
+ * count. This reduction is order-defined instead — the winner is the
+ * minimum (time of impact, hit-list position) pair. Each slice of the
+ * list reduces into its own local winner, and the slice winners merge
+ * IN SLICE ORDER with a strict less-than, so ties keep the earliest
+ * position; one thread, sixteen threads and the plain serial loop all
+ * select the identical contact. Small lists never touch the pool.
+ */
+
+/// No winning contact; matches the simulation's invalidContact value.
+constexpr std::size_t contactNone = static_cast<std::size_t>(-1);
+
+/// Hits per slice; below two slices the serial loop is the faster path.
+constexpr std::size_t contactReduceGrain = 2048;
+
+/**
+ * @brief Selects the earliest contact from @p hitCount candidates.
+ *
+ * @param jobs Worker pool, or null to force the serial path.
+ * @param hitCount Number of hit-list positions to evaluate.
+ * @param evaluate Callable (std::size_t position, float& t) -> bool;
+ * fills t on a hit. Runs concurrently across slices, so it must only
+ * read shared state.
+ * @param bestPosition Receives the winning position, or contactNone.
+ * @param bestTime Receives the winning time of impact.
+ */
+template <typename Eval>
+void reduceNearestContact(JobSystem* jobs, std::size_t hitCount, Eval&& evaluate,
+                          std::size_t& bestPosition, float& bestTime)
+{
+    bestPosition = contactNone;
+    bestTime = 2.0f;
+
+    if (jobs && hitCount >= contactReduceGrain * 2)
+    {
+        const std::size_t sliceCount = (hitCount + contactReduceGrain - 1) / contactReduceGrain;
+        std::vector<std::size_t> slicePosition(sliceCount, contactNone);
+        std::vector<float> sliceTime(sliceCount, 2.0f);
+        jobs->parallelFor(hitCount, contactReduceGrain, [&](std::size_t begin, std::size_t end) {
+            const std::size_t slice = begin / contactReduceGrain;
+            std::size_t localPosition = contactNone;
+            float localTime = 2.0f;
+            for (std::size_t p = begin; p < end; ++p)
+            {
+                float t;
+                if (evaluate(p, t) && (localPosition == contactNone || t < localTime))
+                {
+                    localPosition = p;
+                    localTime = t;
+                    if (localTime == 0.0f)
+                        break;  // Nothing in this slice can hit earlier
+                }
+            }
+            slicePosition[slice] = localPosition;
+            sliceTime[slice] = localTime;
+        });
+
+        // Ordered merge with strict less-than: a tie keeps the earlier
+        // slice, exactly as the serial scan keeps the earlier position
+        for (std::size_t slice = 0; slice < sliceCount; ++slice)
+        {
+            if (slicePosition[slice] != contactNone
+                && (bestPosition == contactNone || sliceTime[slice] < bestTime))
+            {
+                bestPosition = slicePosition[slice];
+                bestTime = sliceTime[slice];
+            }
+        }
+        return;
+    }
+
+    for (std::size_t p = 0; p < hitCount; ++p)
+    {
+        float t;
+        if (evaluate(p, t) && (bestPosition == contactNone || t < bestTime))
+        {
+            bestPosition = p;
+            bestTime = t;
+            if (bestTime == 0.0f)
+                break;  // Already touching: no candidate can hit earlier
+        }
+    }
+}
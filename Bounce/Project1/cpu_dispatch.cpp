@@ -0,0 +1,536 @@
+#include "cpu_dispatch.h"
+#include "simd_aabb.h"
+#include "simd_patrol.h"
+#include "collision_kernel.h"
+
+// MSVC compiles intrinsics of any instruction set regardless of /arch,
+// so the wider variants are always built there and selection is purely
+// a runtime question. GCC-family compilers only get a variant when the
+// build enables its instruction set; detection clamps to what was built.
+#if BOUNCE_COLLISION_KERNEL_SSE2 && (defined(_MSC_VER) || defined(__SSE4_1__))
+    #define BOUNCE_DISPATCH_SSE41 1
+    #include <smmintrin.h>
+#else
+    #define BOUNCE_DISPATCH_SSE41 0
+#endif
+
+#if BOUNCE_COLLISION_KERNEL_SSE2 && (defined(_MSC_VER) || defined(__AVX2__))
+    #define BOUNCE_DISPATCH_AVX2 1
+    #include <immintrin.h>
+#else
+    #define BOUNCE_DISPATCH_AVX2 0
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#if BOUNCE_DISPATCH_SSE41
+
+/**
+ * @brief SSE4.1 variant of the gathered landing selection.
+ *
+ * Same four-wide loop as the baseline kernel with the and/andnot/or
+ * select triples replaced by blend instructions — one µop where the
+ * baseline spends three. Arithmetic and tie-breaking are unchanged, so
+ * the selected slot is always the baseline's.
+ */
+static std::size_t earliestLandingSse41(float x, float y, float size, float dy,
+                                        const float* px, const float* py, const float* pw, const float* ph,
+                                        std::size_t count)
+{
+    const float bottom = y + size;
+    float bestT = 2.0f;
+    std::size_t best = count;
+    std::size_t i = 0;
+
+    const __m128 boxLeft = _mm_set1_ps(x);
+    const __m128 boxRight = _mm_set1_ps(x + size);
+    const __m128 boxTop = _mm_set1_ps(y);
+    const __m128 boxBottom = _mm_set1_ps(bottom);
+    const __m128 dyWide = _mm_set1_ps(dy);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 miss = _mm_set1_ps(2.0f);
+
+    __m128 bestTimes = miss;
+    __m128i bestSlots = _mm_set1_epi32(-1);
+    __m128i slots = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i four = _mm_set1_epi32(4);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 left = _mm_loadu_ps(px + i);
+        const __m128 top = _mm_loadu_ps(py + i);
+        const __m128 right = _mm_add_ps(left, _mm_loadu_ps(pw + i));
+        const __m128 under = _mm_add_ps(top, _mm_loadu_ps(ph + i));
+
+        const __m128 entry = _mm_div_ps(_mm_sub_ps(top, boxBottom), dyWide);
+        const __m128 t = _mm_max_ps(entry, zero);
+        __m128 valid = _mm_and_ps(_mm_cmple_ps(entry, one), _mm_cmpgt_ps(under, boxTop));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(boxRight, left), _mm_cmplt_ps(boxLeft, right)));
+
+        const __m128 scored = _mm_blendv_ps(miss, t, valid);
+        const __m128 earlier = _mm_cmplt_ps(scored, bestTimes);
+        bestTimes = _mm_blendv_ps(bestTimes, scored, earlier);
+        bestSlots = _mm_blendv_epi8(bestSlots, slots, _mm_castps_si128(earlier));
+        slots = _mm_add_epi32(slots, four);
+    }
+
+    if (i != 0)
+    {
+        alignas(16) float laneTimes[4];
+        alignas(16) std::int32_t laneSlots[4];
+        _mm_store_ps(laneTimes, bestTimes);
+        _mm_store_si128(reinterpret_cast<__m128i*>(laneSlots), bestSlots);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const bool better = laneSlots[lane] >= 0
+                && (laneTimes[lane] < bestT
+                    || (laneTimes[lane] == bestT && (best == count || static_cast<std::size_t>(laneSlots[lane]) < best)));
+            bestT = better ? laneTimes[lane] : bestT;
+            best = better ? static_cast<std::size_t>(laneSlots[lane]) : best;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        const float entry = (py[i] - bottom) / dy;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool valid = entry <= 1.0f && py[i] + ph[i] > y
+            && x + size > px[i] && x < px[i] + pw[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? i : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return best;
+}
+
+/**
+ * @brief SSE4.1 variant of the gathered wall selection.
+ */
+static std::size_t earliestWallHitSse41(float x, float y, float size, float dx,
+                                        const float* wx, const float* wy, const float* ww, const float* wh,
+                                        std::size_t count)
+{
+    const bool movingRight = dx > 0.0f;
+    const float lead = movingRight ? x + size : x;
+    float bestT = 2.0f;
+    std::size_t best = count;
+    std::size_t i = 0;
+
+    const __m128 boxTop = _mm_set1_ps(y);
+    const __m128 boxBottom = _mm_set1_ps(y + size);
+    const __m128 boxLeft = _mm_set1_ps(x);
+    const __m128 boxRight = _mm_set1_ps(x + size);
+    const __m128 leadWide = _mm_set1_ps(lead);
+    const __m128 dxWide = _mm_set1_ps(dx);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 miss = _mm_set1_ps(2.0f);
+
+    __m128 bestTimes = miss;
+    __m128i bestSlots = _mm_set1_epi32(-1);
+    __m128i slots = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i four = _mm_set1_epi32(4);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 left = _mm_loadu_ps(wx + i);
+        const __m128 top = _mm_loadu_ps(wy + i);
+        const __m128 right = _mm_add_ps(left, _mm_loadu_ps(ww + i));
+        const __m128 bottom = _mm_add_ps(top, _mm_loadu_ps(wh + i));
+
+        const __m128 face = movingRight ? left : right;
+        const __m128 entry = _mm_div_ps(_mm_sub_ps(face, leadWide), dxWide);
+        const __m128 t = _mm_max_ps(entry, zero);
+        const __m128 notPassed = movingRight ? _mm_cmpgt_ps(right, boxLeft) : _mm_cmplt_ps(left, boxRight);
+        __m128 valid = _mm_and_ps(_mm_cmple_ps(entry, one), notPassed);
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(boxBottom, top), _mm_cmplt_ps(boxTop, bottom)));
+
+        const __m128 scored = _mm_blendv_ps(miss, t, valid);
+        const __m128 earlier = _mm_cmplt_ps(scored, bestTimes);
+        bestTimes = _mm_blendv_ps(bestTimes, scored, earlier);
+        bestSlots = _mm_blendv_epi8(bestSlots, slots, _mm_castps_si128(earlier));
+        slots = _mm_add_epi32(slots, four);
+    }
+
+    if (i != 0)
+    {
+        alignas(16) float laneTimes[4];
+        alignas(16) std::int32_t laneSlots[4];
+        _mm_store_ps(laneTimes, bestTimes);
+        _mm_store_si128(reinterpret_cast<__m128i*>(laneSlots), bestSlots);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const bool better = laneSlots[lane] >= 0
+                && (laneTimes[lane] < bestT
+                    || (laneTimes[lane] == bestT && (best == count || static_cast<std::size_t>(laneSlots[lane]) < best)));
+            bestT = better ? laneTimes[lane] : bestT;
+            best = better ? static_cast<std::size_t>(laneSlots[lane]) : best;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        const float face = movingRight ? wx[i] : wx[i] + ww[i];
+        const float entry = (face - lead) / dx;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool passed = movingRight ? wx[i] + ww[i] <= x : wx[i] >= x + size;
+        const bool valid = entry <= 1.0f && !passed
+            && y + size > wy[i] && y < wy[i] + wh[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? i : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return best;
+}
+
+#endif // BOUNCE_DISPATCH_SSE41
+
+#if BOUNCE_DISPATCH_AVX2
+
+/**
+ * @brief AVX2 variant of the wide AABB batch test, eight boxes at a time.
+ *
+ * Identical overlap logic to aabbTestBatch; the movemask bits are
+ * walked in order, so hit indices come out ascending as always.
+ */
+static void aabbTestBatchAvx2(float qx, float qy, float qw, float qh,
+                              const float* xs, const float* ys, const float* ws, const float* hs,
+                              std::size_t count, std::vector<std::size_t>& outHits)
+{
+    outHits.clear();
+    std::size_t i = 0;
+
+    const __m256 queryLeft = _mm256_set1_ps(qx);
+    const __m256 queryTop = _mm256_set1_ps(qy);
+    const __m256 queryRight = _mm256_set1_ps(qx + qw);
+    const __m256 queryBottom = _mm256_set1_ps(qy + qh);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 boxLeft = _mm256_loadu_ps(xs + i);
+        const __m256 boxTop = _mm256_loadu_ps(ys + i);
+        const __m256 boxRight = _mm256_add_ps(boxLeft, _mm256_loadu_ps(ws + i));
+        const __m256 boxBottom = _mm256_add_ps(boxTop, _mm256_loadu_ps(hs + i));
+
+        const __m256 overlapX = _mm256_and_ps(_mm256_cmp_ps(queryLeft, boxRight, _CMP_LT_OQ),
+                                              _mm256_cmp_ps(boxLeft, queryRight, _CMP_LT_OQ));
+        const __m256 overlapY = _mm256_and_ps(_mm256_cmp_ps(queryTop, boxBottom, _CMP_LT_OQ),
+                                              _mm256_cmp_ps(boxTop, queryBottom, _CMP_LT_OQ));
+        int mask = _mm256_movemask_ps(_mm256_and_ps(overlapX, overlapY));
+
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            if (mask & (1 << bit))
+                outHits.push_back(i + bit);
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        if (qx < xs[i] + ws[i] && xs[i] < qx + qw && qy < ys[i] + hs[i] && ys[i] < qy + qh)
+            outHits.push_back(i);
+    }
+}
+
+/**
+ * @brief AVX2 variant of the patrol batch advance, eight obstacles at a time.
+ *
+ * Multiply and add stay separate operations — no FMA — so positions
+ * round exactly as the scalar and SSE2 forms do; lockstep peers on
+ * different tiers must integrate obstacles bit-identically.
+ */
+static void patrolAdvanceBatchAvx2(float dt, float* xs, const float* ws, float* velXs,
+                                   const float* leftLimits, const float* rightLimits, std::size_t count)
+{
+    std::size_t i = 0;
+
+    const __m256 step = _mm256_set1_ps(dt);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 vel = _mm256_loadu_ps(velXs + i);
+        const __m256 x = _mm256_add_ps(_mm256_loadu_ps(xs + i), _mm256_mul_ps(vel, step));
+        _mm256_storeu_ps(xs + i, x);
+
+        const __m256 atLeft = _mm256_cmp_ps(x, _mm256_loadu_ps(leftLimits + i), _CMP_LE_OQ);
+        const __m256 atRight = _mm256_cmp_ps(_mm256_add_ps(x, _mm256_loadu_ps(ws + i)),
+                                             _mm256_loadu_ps(rightLimits + i), _CMP_GE_OQ);
+        const __m256 flip = _mm256_and_ps(_mm256_or_ps(atLeft, atRight), signBit);
+        _mm256_storeu_ps(velXs + i, _mm256_xor_ps(vel, flip));
+    }
+
+    for (; i < count; ++i)
+    {
+        xs[i] += velXs[i] * dt;
+        if (xs[i] <= leftLimits[i] || xs[i] + ws[i] >= rightLimits[i])
+            velXs[i] = -velXs[i];
+    }
+}
+
+/**
+ * @brief AVX2 variant of the gathered landing selection, eight wide.
+ *
+ * The lane reduce keeps the lowest slot on time ties, so the winner is
+ * the lexicographic (time, slot) minimum — the same candidate every
+ * narrower variant selects.
+ */
+static std::size_t earliestLandingAvx2(float x, float y, float size, float dy,
+                                       const float* px, const float* py, const float* pw, const float* ph,
+                                       std::size_t count)
+{
+    const float bottom = y + size;
+    float bestT = 2.0f;
+    std::size_t best = count;
+    std::size_t i = 0;
+
+    const __m256 boxLeft = _mm256_set1_ps(x);
+    const __m256 boxRight = _mm256_set1_ps(x + size);
+    const __m256 boxTop = _mm256_set1_ps(y);
+    const __m256 boxBottom = _mm256_set1_ps(bottom);
+    const __m256 dyWide = _mm256_set1_ps(dy);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 miss = _mm256_set1_ps(2.0f);
+
+    __m256 bestTimes = miss;
+    __m256i bestSlots = _mm256_set1_epi32(-1);
+    __m256i slots = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i eight = _mm256_set1_epi32(8);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 left = _mm256_loadu_ps(px + i);
+        const __m256 top = _mm256_loadu_ps(py + i);
+        const __m256 right = _mm256_add_ps(left, _mm256_loadu_ps(pw + i));
+        const __m256 under = _mm256_add_ps(top, _mm256_loadu_ps(ph + i));
+
+        const __m256 entry = _mm256_div_ps(_mm256_sub_ps(top, boxBottom), dyWide);
+        const __m256 t = _mm256_max_ps(entry, zero);
+        __m256 valid = _mm256_and_ps(_mm256_cmp_ps(entry, one, _CMP_LE_OQ),
+                                     _mm256_cmp_ps(under, boxTop, _CMP_GT_OQ));
+        valid = _mm256_and_ps(valid, _mm256_and_ps(_mm256_cmp_ps(boxRight, left, _CMP_GT_OQ),
+                                                   _mm256_cmp_ps(boxLeft, right, _CMP_LT_OQ)));
+
+        const __m256 scored = _mm256_blendv_ps(miss, t, valid);
+        const __m256 earlier = _mm256_cmp_ps(scored, bestTimes, _CMP_LT_OQ);
+        bestTimes = _mm256_blendv_ps(bestTimes, scored, earlier);
+        bestSlots = _mm256_blendv_epi8(bestSlots, slots, _mm256_castps_si256(earlier));
+        slots = _mm256_add_epi32(slots, eight);
+    }
+
+    if (i != 0)
+    {
+        alignas(32) float laneTimes[8];
+        alignas(32) std::int32_t laneSlots[8];
+        _mm256_store_ps(laneTimes, bestTimes);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(laneSlots), bestSlots);
+        for (int lane = 0; lane < 8; ++lane)
+        {
+            const bool better = laneSlots[lane] >= 0
+                && (laneTimes[lane] < bestT
+                    || (laneTimes[lane] == bestT && (best == count || static_cast<std::size_t>(laneSlots[lane]) < best)));
+            bestT = better ? laneTimes[lane] : bestT;
+            best = better ? static_cast<std::size_t>(laneSlots[lane]) : best;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        const float entry = (py[i] - bottom) / dy;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool valid = entry <= 1.0f && py[i] + ph[i] > y
+            && x + size > px[i] && x < px[i] + pw[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? i : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return best;
+}
+
+/**
+ * @brief AVX2 variant of the gathered wall selection, eight wide.
+ */
+static std::size_t earliestWallHitAvx2(float x, float y, float size, float dx,
+                                       const float* wx, const float* wy, const float* ww, const float* wh,
+                                       std::size_t count)
+{
+    const bool movingRight = dx > 0.0f;
+    const float lead = movingRight ? x + size : x;
+    float bestT = 2.0f;
+    std::size_t best = count;
+    std::size_t i = 0;
+
+    const __m256 boxTop = _mm256_set1_ps(y);
+    const __m256 boxBottom = _mm256_set1_ps(y + size);
+    const __m256 boxLeft = _mm256_set1_ps(x);
+    const __m256 boxRight = _mm256_set1_ps(x + size);
+    const __m256 leadWide = _mm256_set1_ps(lead);
+    const __m256 dxWide = _mm256_set1_ps(dx);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 miss = _mm256_set1_ps(2.0f);
+
+    __m256 bestTimes = miss;
+    __m256i bestSlots = _mm256_set1_epi32(-1);
+    __m256i slots = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i eight = _mm256_set1_epi32(8);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 left = _mm256_loadu_ps(wx + i);
+        const __m256 top = _mm256_loadu_ps(wy + i);
+        const __m256 right = _mm256_add_ps(left, _mm256_loadu_ps(ww + i));
+        const __m256 bottom = _mm256_add_ps(top, _mm256_loadu_ps(wh + i));
+
+        const __m256 face = movingRight ? left : right;
+        const __m256 entry = _mm256_div_ps(_mm256_sub_ps(face, leadWide), dxWide);
+        const __m256 t = _mm256_max_ps(entry, zero);
+        const __m256 notPassed = movingRight ? _mm256_cmp_ps(right, boxLeft, _CMP_GT_OQ)
+                                             : _mm256_cmp_ps(left, boxRight, _CMP_LT_OQ);
+        __m256 valid = _mm256_and_ps(_mm256_cmp_ps(entry, one, _CMP_LE_OQ), notPassed);
+        valid = _mm256_and_ps(valid, _mm256_and_ps(_mm256_cmp_ps(boxBottom, top, _CMP_GT_OQ),
+                                                   _mm256_cmp_ps(boxTop, bottom, _CMP_LT_OQ)));
+
+        const __m256 scored = _mm256_blendv_ps(miss, t, valid);
+        const __m256 earlier = _mm256_cmp_ps(scored, bestTimes, _CMP_LT_OQ);
+        bestTimes = _mm256_blendv_ps(bestTimes, scored, earlier);
+        bestSlots = _mm256_blendv_epi8(bestSlots, slots, _mm256_castps_si256(earlier));
+        slots = _mm256_add_epi32(slots, eight);
+    }
+
+    if (i != 0)
+    {
+        alignas(32) float laneTimes[8];
+        alignas(32) std::int32_t laneSlots[8];
+        _mm256_store_ps(laneTimes, bestTimes);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(laneSlots), bestSlots);
+        for (int lane = 0; lane < 8; ++lane)
+        {
+            const bool better = laneSlots[lane] >= 0
+                && (laneTimes[lane] < bestT
+                    || (laneTimes[lane] == bestT && (best == count || static_cast<std::size_t>(laneSlots[lane]) < best)));
+            bestT = better ? laneTimes[lane] : bestT;
+            best = better ? static_cast<std::size_t>(laneSlots[lane]) : best;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        const float face = movingRight ? wx[i] : wx[i] + ww[i];
+        const float entry = (face - lead) / dx;
+        const float t = entry > 0.0f ? entry : 0.0f;
+        const bool passed = movingRight ? wx[i] + ww[i] <= x : wx[i] >= x + size;
+        const bool valid = entry <= 1.0f && !passed
+            && y + size > wy[i] && y < wy[i] + wh[i];
+        const float scored = valid ? t : 2.0f;
+        best = scored < bestT ? i : best;
+        bestT = scored < bestT ? scored : bestT;
+    }
+    return best;
+}
+
+#endif // BOUNCE_DISPATCH_AVX2
+
+// The table starts on the SSE2 baseline kernels so code linked without
+// an initCpuDispatch call (the headless tools) behaves as before
+void (*aabbTestWide)(float, float, float, float,
+                     const float*, const float*, const float*, const float*,
+                     std::size_t, std::vector<std::size_t>&) = &aabbTestBatch;
+void (*patrolAdvanceWide)(float, float*, const float*, float*,
+                          const float*, const float*, std::size_t) = &patrolAdvanceBatch;
+std::size_t (*landingSelectWide)(float, float, float, float,
+                                 const float*, const float*, const float*, const float*,
+                                 std::size_t) = &earliestLanding;
+std::size_t (*wallSelectWide)(float, float, float, float,
+                              const float*, const float*, const float*, const float*,
+                              std::size_t) = &earliestWallHit;
+
+static SimdTier boundTier = SimdTier::Sse2; ///< What the table is bound to.
+
+/**
+ * @brief Queries CPUID for the best tier this build can use.
+ *
+ * @return SimdTier The hardware tier, clamped to compiled-in support.
+ */
+static SimdTier detectSimdTier()
+{
+    bool sse41 = false;
+    bool avx2 = false;
+
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0);
+    const int maxLeaf = regs[0];
+    __cpuid(regs, 1);
+    sse41 = (regs[2] & (1 << 19)) != 0;
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool avx = (regs[2] & (1 << 28)) != 0;
+    // AVX2 needs the CPUID bit and the OS actually saving YMM state
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        __cpuidex(regs, 7, 0);
+        avx2 = (regs[1] & (1 << 5)) != 0;
+    }
+#else
+    sse41 = __builtin_cpu_supports("sse4.1") != 0;
+    avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+
+#if BOUNCE_DISPATCH_AVX2
+    if (avx2)
+        return SimdTier::Avx2;
+#endif
+#if BOUNCE_DISPATCH_SSE41
+    if (sse41)
+        return SimdTier::Sse41;
+#endif
+    (void)sse41;
+    (void)avx2;
+    return SimdTier::Sse2;
+}
+
+void initCpuDispatch()
+{
+    boundTier = detectSimdTier();
+    switch (boundTier)
+    {
+#if BOUNCE_DISPATCH_AVX2
+    case SimdTier::Avx2:
+        aabbTestWide = &aabbTestBatchAvx2;
+        patrolAdvanceWide = &patrolAdvanceBatchAvx2;
+        landingSelectWide = &earliestLandingAvx2;
+        wallSelectWide = &earliestWallHitAvx2;
+        break;
+#endif
+#if BOUNCE_DISPATCH_SSE41
+    case SimdTier::Sse41:
+        // SSE4.1 only helps the selection kernels; the batch test and
+        // patrol advance have no blends to upgrade
+        landingSelectWide = &earliestLandingSse41;
+        wallSelectWide = &earliestWallHitSse41;
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+SimdTier activeSimdTier()
+{
+    return boundTier;
+}
+
+const char* simdTierName(SimdTier tier)
+{
+    switch (tier)
+    {
+    case SimdTier::Sse2: return "sse2";
+    case SimdTier::Sse41: return "sse4.1";
+    case SimdTier::Avx2: return "avx2";
+    }
+    return "?";
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Runtime CPU-feature dispatch for the vectorized kernels.
+ *
+ * One binary serves everything from SSE2-era netbooks to AVX2
+ * desktops, so the hot kernels — the wide AABB batch test, the patrol
+ * advance and the collision selection kernels — exist in one variant
+ * per instruction set and are reached through the function pointers
+ * below. initCpuDispatch queries CPUID once at startup and rebinds the
+ * pointers to the best variant the machine and the build both support;
+ * after that every call is a direct indirect call with no per-call
+ * feature test. The pointers start on the SSE2 baseline variants, so
+ * translation units that never call initCpuDispatch (the headless
+ * tools) simply keep the previous behavior.
+ *
+ * Every variant of a kernel computes bit-identical results — same
+ * arithmetic, same tie-breaking — so the selected tier never affects
+ * the simulation, only how fast it runs. The active tier is shown on
+ * the profiler HUD.
+ */
+
+/**
+ * @brief The instruction-set tiers a build can dispatch between.
+ */
+enum class SimdTier : std::uint8_t {
+    Sse2, ///< Baseline; every x64 target has it.
+    Sse41, ///< Adds blend instructions the selection kernels use.
+    Avx2, ///< Eight-wide variants of every kernel.
+};
+
+/**
+ * @brief The display name of a tier, for the profiler HUD.
+ *
+ * @param tier The tier.
+ * @return const char* A short lowercase name.
+ */
+const char* simdTierName(SimdTier tier);
+
+/**
+ * @brief The tier the dispatch table is currently bound to.
+ *
+ * @return SimdTier Sse2 until initCpuDispatch has run.
+ */
+SimdTier activeSimdTier();
+
+/**
+ * @brief Detects CPU features and rebinds the dispatch table.
+ *
+ * Called once from main() before the threads start; never called
+ * again, so readers of the pointers need no synchronization.
+ */
+void initCpuDispatch();
+
+/// Wide AABB batch test; signature of aabbTestBatch in simd_aabb.h.
+extern void (*aabbTestWide)(float qx, float qy, float qw, float qh,
+                            const float* xs, const float* ys, const float* ws, const float* hs,
+                            std::size_t count, std::vector<std::size_t>& outHits);
+
+/// Patrol batch advance; signature of patrolAdvanceBatch in simd_patrol.h.
+extern void (*patrolAdvanceWide)(float dt, float* xs, const float* ws, float* velXs,
+                                 const float* leftLimits, const float* rightLimits, std::size_t count);
+
+/// Gathered landing selection; signature of earliestLanding in collision_kernel.h.
+extern std::size_t (*landingSelectWide)(float x, float y, float size, float dy,
+                                        const float* px, const float* py, const float* pw, const float* ph,
+                                        std::size_t count);
+
+/// Gathered wall selection; signature of earliestWallHit in collision_kernel.h.
+extern std::size_t (*wallSelectWide)(float x, float y, float size, float dx,
+                                     const float* wx, const float* wy, const float* ww, const float* wh,
+                                     std::size_t count);
@@ -0,0 +1,49 @@
+#include "cull_index.h"
+#include <algorithm>
+
+/**
+ * @brief Builds the index from parallel left-edge/width arrays.
+ *
+ * @param xs Left edges of the entities.
+ * @param ws Widths of the entities.
+ */
+void CullIndex::build(const std::vector<float>& xs, const std::vector<float>& ws)
+{
+    sortedIndex.resize(xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i)
+        sortedIndex[i] = i;
+    std::sort(sortedIndex.begin(), sortedIndex.end(), [&xs](std::size_t a, std::size_t b) { return xs[a] < xs[b]; });
+
+    sortedLeft.resize(xs.size());
+    sortedRight.resize(xs.size());
+    maxWidth = 0.0f;
+    for (std::size_t i = 0; i < sortedIndex.size(); ++i)
+    {
+        const std::size_t original = sortedIndex[i];
+        sortedLeft[i] = xs[original];
+        sortedRight[i] = xs[original] + ws[original];
+        maxWidth = std::max(maxWidth, ws[original]);
+    }
+}
+
+/**
+ * @brief Collects the indices of entities overlapping a view span.
+ *
+ * @param viewLeft Left edge of the visible span.
+ * @param viewRight Right edge of the visible span.
+ * @param outVisible Receives the original entity indices (cleared first).
+ */
+void CullIndex::visible(float viewLeft, float viewRight, std::vector<std::size_t>& outVisible) const
+{
+    outVisible.clear();
+
+    // An entity starting up to maxWidth before the view can still reach into it,
+    // so the binary search begins that far back.
+    const auto first = std::lower_bound(sortedLeft.begin(), sortedLeft.end(), viewLeft - maxWidth);
+
+    for (std::size_t i = static_cast<std::size_t>(first - sortedLeft.begin()); i < sortedLeft.size() && sortedLeft[i] <= viewRight; ++i)
+    {
+        if (sortedRight[i] >= viewLeft)
+            outVisible.push_back(sortedIndex[i]);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Sorted-by-x visibility index for static level geometry.
+ *
+ * The level is a horizontal scroller, so visibility is a pure x-interval
+ * query: an entity is on screen when its [left, right] span overlaps the
+ * view's. The index keeps entity spans sorted by left edge and binary
+ * searches the view window, so the draw loop only ever touches on-screen
+ * entities instead of walking the whole 9000-pixel level.
+ */
+class CullIndex {
+public:
+    /**
+     * @brief Builds the index from parallel left-edge/width arrays.
+     *
+     * @param xs Left edges of the entities.
+     * @param ws Widths of the entities.
+     */
+    void build(const std::vector<float>& xs, const std::vector<float>& ws);
+
+    /**
+     * @brief Collects the indices of entities overlapping a view span.
+     *
+     * @param viewLeft Left edge of the visible span.
+     * @param viewRight Right edge of the visible span.
+     * @param outVisible Receives the original entity indices (cleared first).
+     */
+    void visible(float viewLeft, float viewRight, std::vector<std::size_t>& outVisible) const;
+
+private:
+    std::vector<float> sortedLeft; ///< Entity left edges in ascending order.
+    std::vector<float> sortedRight; ///< Matching right edges.
+    std::vector<std::size_t> sortedIndex; ///< Matching original entity indices.
+    float maxWidth = 0.0f; ///< Widest entity; bounds the backward search window.
+};
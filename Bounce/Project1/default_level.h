@@ -0,0 +1,63 @@
+#pragma once
+#include "level_format.h"
+#include <cstddef>
+
+/**
+ * @brief The shipped level as compile-time tables.
+ *
+ * The built-in level used to be runtime-constructed through initializer
+ * lists inside makeDefaultLevel(); these are the same records as
+ * constexpr arrays, so the data is laid out in .rodata by the compiler
+ * and "building" the default level is a bulk copy per array with no
+ * per-entity work and no static-init ordering to reason about. The
+ * records are the binary format's own PODs, so the tables double as the
+ * source of truth when regenerating level1.lvl with saveLevel.
+ */
+namespace level {
+namespace defaults {
+
+constexpr RectRecord platforms[] = {
+    { 100.0f, 550.0f, 200.0f, 20.0f },
+    { 350.0f, 500.0f, 150.0f, 20.0f },
+    { 600.0f, 400.0f, 200.0f, 20.0f },
+    { 900.0f, 350.0f, 150.0f, 20.0f },
+    { 1250.0f, 300.0f, 250.0f, 20.0f },
+    { 1700.0f, 450.0f, 200.0f, 20.0f },
+    { 2100.0f, 380.0f, 200.0f, 20.0f },
+    { 2600.0f, 550.0f, 150.0f, 20.0f },
+    { 3100.0f, 400.0f, 200.0f, 20.0f },
+    { 3700.0f, 350.0f, 150.0f, 20.0f },
+    { 4200.0f, 300.0f, 200.0f, 20.0f }
+}; ///< Platforms the player can land on (floor excluded).
+
+constexpr RectRecord floor = { 0.0f, 580.0f, 9000.0f, 20.0f }; ///< The floor spanning the level.
+constexpr RectRecord goal = { 4700.0f, 250.0f, 100.0f, 20.0f }; ///< The goal platform.
+
+constexpr RectRecord walls[] = {
+    { 600.0f, 420.0f, 20.0f, 180.0f },
+    { 1600.0f, 450.0f, 20.0f, 200.0f },
+    { 3100.0f, 400.0f, 20.0f, 200.0f },
+    { 3700.0f, 350.0f, 20.0f, 200.0f }
+}; ///< Walls blocking horizontal movement.
+
+constexpr ObstacleRecord obstacles[] = {
+    { 800.0f, 530.0f, 50.0f, 50.0f, 700.0f, 1100.0f },
+    { 1500.0f, 530.0f, 50.0f, 50.0f, 1400.0f, 1800.0f },
+    { 2300.0f, 530.0f, 50.0f, 50.0f, 2200.0f, 2500.0f },
+    { 3200.0f, 530.0f, 50.0f, 50.0f, 3100.0f, 3400.0f },
+    { 4000.0f, 530.0f, 50.0f, 50.0f, 3900.0f, 4200.0f }
+}; ///< Patrolling obstacles with their patrol limits.
+
+constexpr CoinRecord coins[] = {
+    { 500.0f, 500.0f },
+    { 1200.0f, 400.0f },
+    { 2000.0f, 450.0f }
+}; ///< Collectible coin positions.
+
+constexpr std::size_t platformCount = sizeof(platforms) / sizeof(platforms[0]); ///< Number of platform records.
+constexpr std::size_t wallCount = sizeof(walls) / sizeof(walls[0]); ///< Number of wall records.
+constexpr std::size_t obstacleCount = sizeof(obstacles) / sizeof(obstacles[0]); ///< Number of obstacle records.
+constexpr std::size_t coinCount = sizeof(coins) / sizeof(coins[0]); ///< Number of coin records.
+
+} // namespace defaults
+} // namespace level
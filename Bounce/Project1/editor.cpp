@@ -0,0 +1,299 @@
+#include "editor.h"
+
+/**
+ * @brief Opens the editor on a copy of @p level.
+ *
+ * @param level The level to copy in.
+ * @param savePath Where Save writes the binary level.
+ */
+void LevelEditor::open(const LevelData& level, const std::string& savePath)
+{
+    editing = true;
+    if (opened)
+        return;  // Keep the working copy across Exit/Enter
+
+    opened = true;
+    path = savePath;
+    floor = level.floor;
+    goal = level.goal;
+
+    entities.clear();
+    entities.reserve(level.platforms.size() + level.walls.size() + level.obstacles.size() + level.coins.size());
+    hash.build({}, {}, {}, {});  // Empty hash at the editor's cell size
+    bake.bakeEditable(quadCapacity);
+
+    for (const auto& record : level.platforms)
+        addEntity(Entity{ EditorEntityKind::Platform, record, 0.0f, 0.0f });
+    for (const auto& record : level.walls)
+        addEntity(Entity{ EditorEntityKind::Wall, record, 0.0f, 0.0f });
+    for (const auto& record : level.obstacles)
+        addEntity(Entity{ EditorEntityKind::Obstacle, { record.x, record.y, record.w, record.h }, record.leftLimit, record.rightLimit });
+    for (const auto& record : level.coins)
+        addEntity(Entity{ EditorEntityKind::Coin, { record.x, record.y, 20.0f, 20.0f }, 0.0f, 0.0f });
+
+    selectionOutline.setFillColor(sf::Color::Transparent);
+    selectionOutline.setOutlineColor(sf::Color::White);
+    selectionOutline.setOutlineThickness(2.0f);
+}
+
+/**
+ * @brief The display color of an entity kind.
+ *
+ * @param kind The kind.
+ * @return sf::Color The game's color for that category.
+ */
+sf::Color LevelEditor::kindColor(EditorEntityKind kind)
+{
+    switch (kind)
+    {
+    case EditorEntityKind::Platform: return sf::Color::Green;
+    case EditorEntityKind::Wall: return sf::Color::Blue;
+    case EditorEntityKind::Obstacle: return sf::Color::Red;
+    case EditorEntityKind::Coin: return sf::Color::Yellow;
+    }
+    return sf::Color::White;
+}
+
+/**
+ * @brief Adds an entity, claiming its hash entry and quad slot.
+ *
+ * @param entity The entity to add.
+ * @return std::size_t The new entity's index.
+ */
+std::size_t LevelEditor::addEntity(const Entity& entity)
+{
+    const std::size_t index = entities.size();
+    if (index >= quadCapacity)
+        return noSelection;
+
+    entities.push_back(entity);
+    hash.insert(index, entity.box.x, entity.box.y, entity.box.w, entity.box.h);
+    bake.setQuad(index, entity.box.x, entity.box.y, entity.box.w, entity.box.h, kindColor(entity.kind));
+    return index;
+}
+
+/**
+ * @brief Deletes an entity by swap-remove, repairing the moved one.
+ *
+ * @param index The entity to delete.
+ */
+void LevelEditor::removeEntity(std::size_t index)
+{
+    const Entity& doomed = entities[index];
+    hash.remove(index, doomed.box.x, doomed.box.y, doomed.box.w, doomed.box.h);
+
+    const std::size_t last = entities.size() - 1;
+    if (index != last)
+    {
+        // The tail entity takes the freed index: rehash it under its
+        // new index and rewrite the freed quad with its box
+        const Entity& moved = entities[last];
+        hash.remove(last, moved.box.x, moved.box.y, moved.box.w, moved.box.h);
+        hash.insert(index, moved.box.x, moved.box.y, moved.box.w, moved.box.h);
+        bake.setQuad(index, moved.box.x, moved.box.y, moved.box.w, moved.box.h, kindColor(moved.kind));
+        entities[index] = moved;
+    }
+    entities.pop_back();
+    bake.clearQuad(last);
+}
+
+/**
+ * @brief Moves an entity's box, updating hash cells and its quad.
+ *
+ * @param index The entity to move.
+ * @param x New left edge.
+ * @param y New top edge.
+ */
+void LevelEditor::moveEntity(std::size_t index, float x, float y)
+{
+    Entity& entity = entities[index];
+    hash.remove(index, entity.box.x, entity.box.y, entity.box.w, entity.box.h);
+    if (entity.kind == EditorEntityKind::Obstacle)
+    {
+        // The patrol rides along, keeping its reach around the new spot
+        const float shift = x - entity.box.x;
+        entity.patrolLeft += shift;
+        entity.patrolRight += shift;
+    }
+    entity.box.x = x;
+    entity.box.y = y;
+    hash.insert(index, entity.box.x, entity.box.y, entity.box.w, entity.box.h);
+    bake.setQuad(index, entity.box.x, entity.box.y, entity.box.w, entity.box.h, kindColor(entity.kind));
+}
+
+/**
+ * @brief The entity under a world point, or none.
+ *
+ * @param worldX Point x in world space.
+ * @param worldY Point y in world space.
+ * @return std::size_t The topmost hit, or noSelection.
+ */
+std::size_t LevelEditor::pick(float worldX, float worldY)
+{
+    // Proximity query with a few pixels of slack, so clicking the edge
+    // of a thin wall still lands; the containment test gets the same slack
+    const float pickSlack = 4.0f;
+    std::size_t hit = noSelection;
+    hash.forEachInCircle(worldX, worldY, pickSlack, pickCandidates, [&](std::size_t index) {
+        const level::RectRecord& box = entities[index].box;
+        if (worldX >= box.x - pickSlack && worldX <= box.x + box.w + pickSlack
+            && worldY >= box.y - pickSlack && worldY <= box.y + box.h + pickSlack)
+            hit = index;  // Last hit wins: most recently placed sits on top
+    });
+    return hit;
+}
+
+/**
+ * @brief Applies one command from the queue.
+ *
+ * @param command The command.
+ */
+void LevelEditor::apply(const EditorCommand& command)
+{
+    switch (command.type)
+    {
+    case EditorCommand::Enter:
+    case EditorCommand::Exit:
+        // Handled by the caller, which owns the open() level source
+        break;
+
+    case EditorCommand::Cursor:
+        cursorX = command.x + (cameraX - 400.0f);
+        cursorY = command.y + (cameraY - 300.0f);
+        if (dragging && selected != noSelection)
+            moveEntity(selected, cursorX - dragOffsetX, cursorY - dragOffsetY);
+        break;
+
+    case EditorCommand::Press:
+        selected = pick(cursorX, cursorY);
+        if (selected != noSelection)
+        {
+            dragging = true;
+            dragOffsetX = cursorX - entities[selected].box.x;
+            dragOffsetY = cursorY - entities[selected].box.y;
+        }
+        else
+        {
+            // Empty space: place the chosen kind at the cursor
+            Entity entity;
+            entity.kind = placeKind;
+            switch (placeKind)
+            {
+            case EditorEntityKind::Platform: entity.box = { cursorX, cursorY, 150.0f, 20.0f }; break;
+            case EditorEntityKind::Wall: entity.box = { cursorX, cursorY, 20.0f, 200.0f }; break;
+            case EditorEntityKind::Obstacle:
+                entity.box = { cursorX, cursorY, 50.0f, 50.0f };
+                entity.patrolLeft = cursorX - 150.0f;
+                entity.patrolRight = cursorX + 150.0f;
+                break;
+            case EditorEntityKind::Coin: entity.box = { cursorX, cursorY, 20.0f, 20.0f }; break;
+            }
+            selected = addEntity(entity);
+            dragging = selected != noSelection;
+            dragOffsetX = 0.0f;
+            dragOffsetY = 0.0f;
+        }
+        break;
+
+    case EditorCommand::Release:
+        dragging = false;
+        break;
+
+    case EditorCommand::SetKind:
+        placeKind = static_cast<EditorEntityKind>(command.kind);
+        break;
+
+    case EditorCommand::Remove:
+        if (selected != noSelection)
+        {
+            removeEntity(selected);
+            selected = noSelection;
+            dragging = false;
+        }
+        break;
+
+    case EditorCommand::Save:
+    {
+        LevelData level;
+        toLevelData(level);
+        saveLevel(path, level);
+        break;
+    }
+
+    case EditorCommand::Pan:
+        cameraX += command.x;
+        cameraY += command.y;
+        break;
+    }
+}
+
+/**
+ * @brief Rebuilds the LevelData the working set represents.
+ *
+ * @param out Receives the level.
+ */
+void LevelEditor::toLevelData(LevelData& out) const
+{
+    out.floor = floor;
+    out.goal = goal;
+    for (const Entity& entity : entities)
+    {
+        switch (entity.kind)
+        {
+        case EditorEntityKind::Platform:
+            out.platforms.push_back(entity.box);
+            break;
+        case EditorEntityKind::Wall:
+            out.walls.push_back(entity.box);
+            break;
+        case EditorEntityKind::Obstacle:
+            out.obstacles.push_back({ entity.box.x, entity.box.y, entity.box.w, entity.box.h, entity.patrolLeft, entity.patrolRight });
+            break;
+        case EditorEntityKind::Coin:
+            out.coins.push_back({ entity.box.x, entity.box.y });
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Draws the working level, selection and cursor.
+ *
+ * @param target The render target; its view is set to the editor camera.
+ */
+void LevelEditor::draw(sf::RenderTarget& target)
+{
+    sf::View view(sf::FloatRect(cameraX - 400.0f, cameraY - 300.0f, 800.0f, 600.0f));
+    target.setView(view);
+
+    // The floor is not an entity; show it so placement has its datum
+    sf::RectangleShape floorShape(sf::Vector2f(floor.w, floor.h));
+    floorShape.setPosition(floor.x, floor.y);
+    floorShape.setFillColor(sf::Color(60, 120, 60));
+    target.draw(floorShape);
+
+    bake.draw(target);
+
+    if (selected != noSelection && selected < entities.size())
+    {
+        const level::RectRecord& box = entities[selected].box;
+        selectionOutline.setPosition(box.x, box.y);
+        selectionOutline.setSize(sf::Vector2f(box.w, box.h));
+        target.draw(selectionOutline);
+    }
+
+    // Cursor ghost: the footprint the next Press would place
+    sf::RectangleShape ghost;
+    switch (placeKind)
+    {
+    case EditorEntityKind::Platform: ghost.setSize(sf::Vector2f(150.0f, 20.0f)); break;
+    case EditorEntityKind::Wall: ghost.setSize(sf::Vector2f(20.0f, 200.0f)); break;
+    case EditorEntityKind::Obstacle: ghost.setSize(sf::Vector2f(50.0f, 50.0f)); break;
+    case EditorEntityKind::Coin: ghost.setSize(sf::Vector2f(20.0f, 20.0f)); break;
+    }
+    ghost.setPosition(cursorX, cursorY);
+    sf::Color ghostColor = kindColor(placeKind);
+    ghostColor.a = 90;
+    ghost.setFillColor(ghostColor);
+    target.draw(ghost);
+}
@@ -0,0 +1,236 @@
+#pragma once
+#include "level_loader.h"
+#include "level_bake.h"
+#include "spatial_hash.h"
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One editor input, translated from a window event.
+ *
+ * The main thread owns the window and its events; the editor's data
+ * structures live on the render thread, which owns the vertex buffer
+ * they update. Commands cross between them through the SPSC ring
+ * below, the same discipline as the snapshot channel.
+ */
+struct EditorCommand {
+    /**
+     * @brief What the input means.
+     */
+    enum Type : std::uint8_t {
+        Enter, ///< Open the editor on the current level.
+        Exit, ///< Close the editor; the working copy stays for re-entry.
+        Cursor, ///< Mouse moved; x/y are window pixels.
+        Press, ///< Left button down: select the entity under the cursor, or place one.
+        Release, ///< Left button up: end a drag.
+        SetKind, ///< Choose what Press places; kind is an EditorEntityKind.
+        Remove, ///< Delete the selected entity.
+        Save, ///< Write the working level to its file.
+        Pan, ///< Scroll the editor camera by x/y pixels.
+    };
+
+    Type type = Cursor; ///< The input.
+    float x = 0.0f; ///< Pixel or scroll x, per type.
+    float y = 0.0f; ///< Pixel or scroll y, per type.
+    int kind = 0; ///< EditorEntityKind for SetKind.
+};
+
+/**
+ * @brief Wait-free SPSC ring carrying editor commands to the render thread.
+ *
+ * Main thread pushes, render thread pops; head is producer-owned and
+ * tail consumer-owned, acquire/release on both. A full ring drops the
+ * command — mouse moves are dense and the next one supersedes.
+ */
+class EditorCommandQueue {
+public:
+    /**
+     * @brief Enqueues one command; main thread only.
+     *
+     * @param command The command.
+     * @return true If queued; false if the ring was full.
+     */
+    bool push(const EditorCommand& command)
+    {
+        const std::size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead - tail.load(std::memory_order_acquire) >= ringSize)
+            return false;
+        slots[currentHead % ringSize] = command;
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeues one command; render thread only.
+     *
+     * @param out Receives the command.
+     * @return true If a command was waiting.
+     */
+    bool pop(EditorCommand& out)
+    {
+        const std::size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail == head.load(std::memory_order_acquire))
+            return false;
+        out = slots[currentTail % ringSize];
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static const std::size_t ringSize = 256; ///< Commands buffered; a frame's worth of mouse moves fits easily.
+
+    EditorCommand slots[ringSize]; ///< The command buffer.
+    std::atomic<std::size_t> head{ 0 }; ///< Producer cursor; main thread writes.
+    std::atomic<std::size_t> tail{ 0 }; ///< Consumer cursor; render thread writes.
+};
+
+/**
+ * @brief What Press places, and how entities are colored and saved.
+ */
+enum class EditorEntityKind : std::uint8_t {
+    Platform, ///< A landable platform.
+    Wall, ///< A blocking wall.
+    Obstacle, ///< A patrolling obstacle; placed with a default patrol reach.
+    Coin, ///< A coin.
+};
+
+/**
+ * @brief In-game level editor with incrementally maintained structures.
+ *
+ * Opened on a copy of the playing level. Every entity owns one quad
+ * slot in an editable bake and one entry in a spatial hash; placing,
+ * dragging or deleting an entity updates exactly its grid cells and
+ * its six vertices — the level is never rebuilt or re-uploaded, which
+ * is what keeps a 10k-entity level at frame rate while editing.
+ * Deletion swap-removes, so the one entity that changed index has its
+ * hash entry and quad rewritten too. Save splits the working set back
+ * into the binary format's record arrays.
+ */
+class LevelEditor {
+public:
+    /**
+     * @brief Opens the editor on a copy of @p level.
+     *
+     * Re-entering while a working copy exists keeps it — Exit/Enter
+     * toggles the view, not the edits.
+     *
+     * @param level The level to copy in.
+     * @param savePath Where Save writes the binary level.
+     */
+    void open(const LevelData& level, const std::string& savePath);
+
+    /**
+     * @brief Closes the editor view; the working copy stays.
+     */
+    void close() { editing = false; }
+
+    /**
+     * @brief Whether the editor is showing.
+     *
+     * @return true While open.
+     */
+    bool active() const { return editing; }
+
+    /**
+     * @brief Applies one command from the queue.
+     *
+     * @param command The command.
+     */
+    void apply(const EditorCommand& command);
+
+    /**
+     * @brief Draws the working level, selection and cursor.
+     *
+     * @param target The render target; its view is set to the editor camera.
+     */
+    void draw(sf::RenderTarget& target);
+
+private:
+    /**
+     * @brief One editable entity: its kind, box and patrol reach.
+     */
+    struct Entity {
+        EditorEntityKind kind = EditorEntityKind::Platform; ///< What it saves as.
+        level::RectRecord box = {}; ///< Position and extent.
+        float patrolLeft = 0.0f; ///< Obstacle patrol left limit; moves with the box.
+        float patrolRight = 0.0f; ///< Obstacle patrol right limit.
+    };
+
+    /**
+     * @brief Adds an entity, claiming its hash entry and quad slot.
+     *
+     * @param entity The entity to add.
+     * @return std::size_t The new entity's index.
+     */
+    std::size_t addEntity(const Entity& entity);
+
+    /**
+     * @brief Deletes an entity by swap-remove, repairing the moved one.
+     *
+     * @param index The entity to delete.
+     */
+    void removeEntity(std::size_t index);
+
+    /**
+     * @brief Moves an entity's box, updating hash cells and its quad.
+     *
+     * @param index The entity to move.
+     * @param x New left edge.
+     * @param y New top edge.
+     */
+    void moveEntity(std::size_t index, float x, float y);
+
+    /**
+     * @brief The entity under a world point, or none.
+     *
+     * @param worldX Point x in world space.
+     * @param worldY Point y in world space.
+     * @return std::size_t The topmost hit, or noSelection.
+     */
+    std::size_t pick(float worldX, float worldY);
+
+    /**
+     * @brief The display color of an entity kind.
+     *
+     * @param kind The kind.
+     * @return sf::Color The game's color for that category.
+     */
+    static sf::Color kindColor(EditorEntityKind kind);
+
+    /**
+     * @brief Rebuilds the LevelData the working set represents.
+     *
+     * @param out Receives the level.
+     */
+    void toLevelData(LevelData& out) const;
+
+    /// Sentinel for "nothing selected".
+    static constexpr std::size_t noSelection = static_cast<std::size_t>(-1);
+    static const std::size_t quadCapacity = 16384; ///< Entities the bake can hold.
+
+    bool editing = false; ///< Whether the editor view is showing.
+    bool opened = false; ///< Whether a working copy exists.
+    std::vector<Entity> entities; ///< The working set; index == quad slot.
+    SpatialHash hash; ///< Picking index over the working set; maintained incrementally.
+    StaticLevelBake bake; ///< Editable bake; one quad per entity.
+    std::vector<std::size_t> pickCandidates; ///< Scratch for hash queries.
+    level::RectRecord floor = {}; ///< Carried through save unedited.
+    level::RectRecord goal = {}; ///< Carried through save unedited.
+    std::string path; ///< Where Save writes.
+
+    float cameraX = 400.0f; ///< Editor camera center x.
+    float cameraY = 300.0f; ///< Editor camera center y.
+    float cursorX = 0.0f; ///< Cursor in world space.
+    float cursorY = 0.0f; ///< Cursor in world space.
+    std::size_t selected = noSelection; ///< The selected entity.
+    bool dragging = false; ///< True between Press on an entity and Release.
+    float dragOffsetX = 0.0f; ///< Cursor-to-box offset held during a drag.
+    float dragOffsetY = 0.0f; ///< Cursor-to-box offset held during a drag.
+    EditorEntityKind placeKind = EditorEntityKind::Platform; ///< What Press places on empty space.
+
+    sf::RectangleShape selectionOutline; ///< Selection highlight; editor-only, not a hot path.
+};
@@ -0,0 +1,267 @@
+#include "entity_store.h"
+#include "simd_patrol.h"
+#include "cpu_dispatch.h"
+
+/**
+ * @brief Reserves the static-geometry arrays for exact counts.
+ *
+ * @param platformCount Platforms about to be added.
+ * @param wallCount Walls about to be added.
+ */
+void EntityStore::reserveStaticGeometry(std::size_t platformCount, std::size_t wallCount)
+{
+    platformX.reserve(platformCount);
+    platformY.reserve(platformCount);
+    platformW.reserve(platformCount);
+    platformH.reserve(platformCount);
+    platformSolid.reserve(platformCount);
+    wallX.reserve(wallCount);
+    wallY.reserve(wallCount);
+    wallW.reserve(wallCount);
+    wallH.reserve(wallCount);
+}
+
+/**
+ * @brief Reserves the obstacle arrays for an exact count.
+ *
+ * @param count Obstacles about to be added.
+ */
+void EntityStore::reserveObstacles(std::size_t count)
+{
+    obstacleX.reserve(count);
+    obstacleY.reserve(count);
+    obstacleW.reserve(count);
+    obstacleH.reserve(count);
+    obstacleVelX.reserve(count);
+    obstacleLeftLimit.reserve(count);
+    obstacleRightLimit.reserve(count);
+    obstacleSpawnX.reserve(count);
+}
+
+/**
+ * @brief Adds a platform AABB to the store.
+ *
+ * @param x X-coordinate of the platform.
+ * @param y Y-coordinate of the platform.
+ * @param width Width of the platform.
+ * @param height Height of the platform.
+ */
+void EntityStore::addPlatform(float x, float y, float width, float height, std::uint8_t solid)
+{
+    platformX.push_back(x);
+    platformY.push_back(y);
+    platformW.push_back(width);
+    platformH.push_back(height);
+    platformSolid.push_back(solid);
+}
+
+/**
+ * @brief Adds a wall AABB to the store.
+ *
+ * @param x X-coordinate of the wall.
+ * @param y Y-coordinate of the wall.
+ * @param width Width of the wall.
+ * @param height Height of the wall.
+ */
+void EntityStore::addWall(float x, float y, float width, float height)
+{
+    wallX.push_back(x);
+    wallY.push_back(y);
+    wallW.push_back(width);
+    wallH.push_back(height);
+}
+
+/**
+ * @brief Adds a moving obstacle to the store.
+ *
+ * @param x X-coordinate starting position.
+ * @param y Y-coordinate starting position.
+ * @param width Width of the obstacle.
+ * @param height Height of the obstacle.
+ * @param leftLimit Left boundary of the patrol movement.
+ * @param rightLimit Right boundary of the patrol movement.
+ */
+void EntityStore::addObstacle(float x, float y, float width, float height, float leftLimit, float rightLimit)
+{
+    obstacleX.push_back(x);
+    obstacleY.push_back(y);
+    obstacleW.push_back(width);
+    obstacleH.push_back(height);
+    obstacleVelX.push_back(obstacleSpeed);
+    obstacleLeftLimit.push_back(leftLimit);
+    obstacleRightLimit.push_back(rightLimit);
+    obstacleSpawnX.push_back(x);
+}
+
+/**
+ * @brief Adds a physics ball to the store.
+ *
+ * @param x X-coordinate starting position.
+ * @param y Y-coordinate starting position.
+ * @param velX Initial horizontal velocity in pixels per second.
+ * @param velY Initial vertical velocity in pixels per second.
+ */
+void EntityStore::addBall(float x, float y, float velX, float velY)
+{
+    spawnBall(x, y, velX, velY);
+}
+
+/**
+ * @brief Reserves the ball arrays and pool for an exact count.
+ *
+ * @param count Maximum expected live ball count.
+ */
+void EntityStore::reserveBalls(std::size_t count)
+{
+    ballX.reserve(count);
+    ballY.reserve(count);
+    ballVelX.reserve(count);
+    ballVelY.reserve(count);
+    ballPool.reserve(count);
+}
+
+/**
+ * @brief Spawns a physics ball and returns its handle.
+ *
+ * @param x X-coordinate starting position.
+ * @param y Y-coordinate starting position.
+ * @param velX Initial horizontal velocity in pixels per second.
+ * @param velY Initial vertical velocity in pixels per second.
+ * @return PoolHandle Handle naming the new ball.
+ */
+PoolHandle EntityStore::spawnBall(float x, float y, float velX, float velY)
+{
+    const PoolHandle handle = ballPool.spawn();
+    ballX.push_back(x);
+    ballY.push_back(y);
+    ballVelX.push_back(velX);
+    ballVelY.push_back(velY);
+    return handle;
+}
+
+/**
+ * @brief Despawns one ball by handle, compacting the arrays.
+ *
+ * @param handle Handle from spawnBall.
+ */
+void EntityStore::despawnBall(PoolHandle handle)
+{
+    const std::size_t vacated = ballPool.despawn(handle);
+    if (vacated >= ballX.size())
+        return;  // Stale handle: the pool left everything untouched
+
+    // Mirror the pool's swap-and-pop in every parallel array
+    const std::size_t last = ballX.size() - 1;
+    ballX[vacated] = ballX[last];
+    ballY[vacated] = ballY[last];
+    ballVelX[vacated] = ballVelX[last];
+    ballVelY[vacated] = ballVelY[last];
+    ballX.pop_back();
+    ballY.pop_back();
+    ballVelX.pop_back();
+    ballVelY.pop_back();
+}
+
+/**
+ * @brief Removes every ball from the store.
+ */
+void EntityStore::clearBalls()
+{
+    ballX.clear();
+    ballY.clear();
+    ballVelX.clear();
+    ballVelY.clear();
+    ballPool.clear();
+}
+
+/**
+ * @brief Puts every obstacle back at its spawn position and velocity.
+ */
+void EntityStore::resetObstacles()
+{
+    for (std::size_t i = 0; i < obstacleX.size(); ++i)
+    {
+        obstacleX[i] = obstacleSpawnX[i];
+        obstacleVelX[i] = 120.0f;
+    }
+}
+
+/**
+ * @brief Empties the platform and wall arrays.
+ */
+void EntityStore::clearStaticGeometry()
+{
+    platformX.clear();
+    platformY.clear();
+    platformW.clear();
+    platformH.clear();
+    platformSolid.clear();
+    wallX.clear();
+    wallY.clear();
+    wallW.clear();
+    wallH.clear();
+}
+
+/**
+ * @brief Precomputes which walls each obstacle's patrol can ever reach.
+ */
+void EntityStore::buildObstacleWallLists()
+{
+    obstacleWallStart.assign(obstacleX.size() + 1, 0);
+    obstacleWallList.clear();
+
+    for (std::size_t i = 0; i < obstacleX.size(); ++i)
+    {
+        obstacleWallStart[i] = obstacleWallList.size();
+
+        // The box the obstacle's AABB sweeps over its whole patrol range
+        const float sweptX = obstacleLeftLimit[i];
+        const float sweptW = obstacleRightLimit[i] - obstacleLeftLimit[i];
+        for (std::size_t j = 0; j < wallX.size(); ++j)
+        {
+            if (aabbIntersects(sweptX, obstacleY[i], sweptW, obstacleH[i], wallX[j], wallY[j], wallW[j], wallH[j]))
+                obstacleWallList.push_back(j);
+        }
+    }
+    obstacleWallStart[obstacleX.size()] = obstacleWallList.size();
+}
+
+/**
+ * @brief Advances all obstacles by one tick.
+ *
+ * @param dt Fixed tick duration in seconds.
+ */
+void EntityStore::moveObstacles(float dt)
+{
+    moveObstaclesRange(dt, 0, obstacleX.size());
+}
+
+/**
+ * @brief Advances one contiguous range of obstacles by one tick.
+ *
+ * @param dt Fixed tick duration in seconds.
+ * @param begin First obstacle index in the range.
+ * @param end One past the last obstacle index in the range.
+ */
+void EntityStore::moveObstaclesRange(float dt, std::size_t begin, std::size_t end)
+{
+    // Advance positions and flip at patrol limits, a SIMD batch at a
+    // time through the dispatched kernel
+    patrolAdvanceWide(dt, obstacleX.data() + begin, obstacleW.data() + begin, obstacleVelX.data() + begin,
+                       obstacleLeftLimit.data() + begin, obstacleRightLimit.data() + begin, end - begin);
+
+    // Wall reversals stay scalar over the precomputed candidate lists,
+    // which are empty for almost every obstacle
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        for (std::size_t k = obstacleWallStart[i]; k < obstacleWallStart[i + 1]; ++k)
+        {
+            const std::size_t j = obstacleWallList[k];
+            if (aabbIntersects(obstacleX[i], obstacleY[i], obstacleW[i], obstacleH[i], wallX[j], wallY[j], wallW[j], wallH[j]))
+            {
+                obstacleVelX[i] = -obstacleVelX[i];
+                break;
+            }
+        }
+    }
+}
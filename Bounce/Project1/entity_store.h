@@ -0,0 +1,293 @@
+#pragma once
+#include "geometry.h"
+#include "cache_aligned.h"
+#include "handle_pool.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Collision layer bits.
+ *
+ * Each entity category is one bit; a mask is the set of categories a
+ * collider interacts with. The store keeps entities split by category
+ * already, so filtering is a single AND against the mask before a whole
+ * pass — categories that can't interact never reach any bounds math.
+ */
+namespace layers {
+    constexpr std::uint32_t Platform = 1u << 0; ///< Landable platforms and the floor.
+    constexpr std::uint32_t Wall = 1u << 1; ///< Solid walls.
+    constexpr std::uint32_t Obstacle = 1u << 2; ///< Patrolling hazards.
+    constexpr std::uint32_t Coin = 1u << 3; ///< Collectible coins.
+    constexpr std::uint32_t Goal = 1u << 4; ///< The level goal.
+    constexpr std::uint32_t All = Platform | Wall | Obstacle | Coin | Goal; ///< Default player mask.
+}
+
+/**
+ * @brief Per-surface solidity bits, precomputed at level load.
+ *
+ * The response kernels consult these as masks — one AND against a
+ * byte per candidate, no new branches — so one-way behaviour is data
+ * on the platform instead of logic in the hot loop. Platforms are
+ * landable from above and droppable by holding down; the floor is
+ * landable only, so there is always ground at the bottom of a drop.
+ */
+namespace surface {
+    constexpr std::uint8_t Top = 1u << 0; ///< Landable from above.
+    constexpr std::uint8_t DropThrough = 1u << 1; ///< Holding down falls through.
+}
+
+/**
+ * @brief Structure-of-arrays storage for the level entities.
+ *
+ * Collision and movement only ever need four floats of AABB (plus a
+ * velocity for obstacles) per entity, so those are kept in parallel
+ * arrays that the hot loops can walk contiguously. The SFML shapes that
+ * used to carry this data live purely on the render side and are
+ * positioned from these arrays once per frame.
+ *
+ * Layout is alignment-aware for the job-system splits: every array a
+ * parallel range writes (obstacle and ball positions and velocities)
+ * is an AlignedVector starting on a cache line, and the parallel grain
+ * in simulation.cpp is a multiple of 16 floats, so two workers never
+ * write the same line. The read-mostly arrays (sizes, patrol limits,
+ * spawn origins) are declared apart from the written ones so a store
+ * to a position never invalidates the line a neighbouring worker is
+ * reading limits from.
+ */
+struct EntityStore {
+    // Static geometry: rebuilt on a chunk restream, read-only between.
+    // Aligned for the broadphase and SIMD kernels that walk them.
+    AlignedVector<float> platformX; ///< Platform left edges.
+    AlignedVector<float> platformY; ///< Platform top edges.
+    AlignedVector<float> platformW; ///< Platform widths.
+    AlignedVector<float> platformH; ///< Platform heights.
+    std::vector<std::uint8_t> platformSolid; ///< Per-platform surface bits (see surface namespace).
+
+    AlignedVector<float> wallX; ///< Wall left edges.
+    AlignedVector<float> wallY; ///< Wall top edges.
+    AlignedVector<float> wallW; ///< Wall widths.
+    AlignedVector<float> wallH; ///< Wall heights.
+
+    // Hot write arrays: every tick's parallel ranges store into these.
+    AlignedVector<float> obstacleX; ///< Obstacle left edges.
+    AlignedVector<float> obstacleVelX; ///< Obstacle horizontal velocities in pixels per second.
+    AlignedVector<float> ballX; ///< Ball AABB left edges (party mode; empty otherwise).
+    AlignedVector<float> ballY; ///< Ball AABB top edges.
+    AlignedVector<float> ballVelX; ///< Ball horizontal velocities in pixels per second.
+    AlignedVector<float> ballVelY; ///< Ball vertical velocities in pixels per second.
+
+    // Read-mostly obstacle arrays: written at level init, read per tick.
+    AlignedVector<float> obstacleY; ///< Obstacle top edges; patrols never move vertically.
+    AlignedVector<float> obstacleW; ///< Obstacle widths.
+    AlignedVector<float> obstacleH; ///< Obstacle heights.
+    AlignedVector<float> obstacleLeftLimit; ///< Obstacle patrol left boundaries.
+    AlignedVector<float> obstacleRightLimit; ///< Obstacle patrol right boundaries.
+    AlignedVector<float> obstacleSpawnX; ///< Obstacle spawn left edges; the patrol phase origin.
+    float obstacleSpeed = 120.0f; ///< Patrol speed given to newly added obstacles; set from config at level init.
+
+    /**
+     * The categories the player collides with. Levels (or modes like a
+     * post-hit grace period) clear bits to switch whole collision passes
+     * off before any geometry is touched; the default interacts with
+     * everything.
+     */
+    std::uint32_t playerMask = layers::All;
+
+    /**
+     * @brief Reserves the static-geometry arrays for exact counts.
+     *
+     * The loader and the chunk stream know from the level header how
+     * many records they are about to add, so every parallel array grows
+     * to its final capacity in one allocation and the add calls below
+     * never re-touch growth logic. Records are interleaved on disk and
+     * split per field here, so population is one de-interleave pass
+     * rather than a memcpy, but it is allocation-free.
+     *
+     * @param platformCount Platforms about to be added.
+     * @param wallCount Walls about to be added.
+     */
+    void reserveStaticGeometry(std::size_t platformCount, std::size_t wallCount);
+
+    /**
+     * @brief Reserves the obstacle arrays for an exact count.
+     *
+     * @param count Obstacles about to be added.
+     */
+    void reserveObstacles(std::size_t count);
+
+    /**
+     * @brief Adds a platform AABB to the store.
+     *
+     * @param x X-coordinate of the platform.
+     * @param y Y-coordinate of the platform.
+     * @param width Width of the platform.
+     * @param height Height of the platform.
+     * @param solid Surface bits; regular platforms are one-way and droppable.
+     */
+    void addPlatform(float x, float y, float width, float height, std::uint8_t solid = surface::Top | surface::DropThrough);
+
+    /**
+     * @brief Adds a wall AABB to the store.
+     *
+     * @param x X-coordinate of the wall.
+     * @param y Y-coordinate of the wall.
+     * @param width Width of the wall.
+     * @param height Height of the wall.
+     */
+    void addWall(float x, float y, float width, float height);
+
+    /**
+     * @brief Adds a moving obstacle to the store.
+     *
+     * @param x X-coordinate starting position.
+     * @param y Y-coordinate starting position.
+     * @param width Width of the obstacle.
+     * @param height Height of the obstacle.
+     * @param leftLimit Left boundary of the patrol movement.
+     * @param rightLimit Right boundary of the patrol movement.
+     */
+    void addObstacle(float x, float y, float width, float height, float leftLimit, float rightLimit);
+
+    /**
+     * @brief Adds a physics ball to the store.
+     *
+     * Convenience over spawnBall for callers that never despawn
+     * individual balls; the handle is issued and dropped.
+     *
+     * @param x X-coordinate starting position.
+     * @param y Y-coordinate starting position.
+     * @param velX Initial horizontal velocity in pixels per second.
+     * @param velY Initial vertical velocity in pixels per second.
+     */
+    void addBall(float x, float y, float velX, float velY);
+
+    /**
+     * @brief Reserves the ball arrays and pool for an exact count.
+     *
+     * After this, @p count concurrent balls spawn and despawn without
+     * any allocation, which is what keeps an endless session's churn
+     * bounded.
+     *
+     * @param count Maximum expected live ball count.
+     */
+    void reserveBalls(std::size_t count);
+
+    /**
+     * @brief Spawns a physics ball and returns its handle.
+     *
+     * O(1): a slot pops off the ball pool's free list and the data
+     * appends to the parallel arrays. The handle survives other balls'
+     * despawns (the arrays compact underneath it) and goes stale when
+     * this ball despawns.
+     *
+     * @param x X-coordinate starting position.
+     * @param y Y-coordinate starting position.
+     * @param velX Initial horizontal velocity in pixels per second.
+     * @param velY Initial vertical velocity in pixels per second.
+     * @return PoolHandle Handle naming the new ball.
+     */
+    PoolHandle spawnBall(float x, float y, float velX, float velY);
+
+    /**
+     * @brief Despawns one ball by handle.
+     *
+     * O(1) swap-and-pop: the last ball's data moves into the vacated
+     * array index, so the arrays stay packed and the per-tick ball walk
+     * never skips holes. Stale handles are ignored.
+     *
+     * @param handle Handle from spawnBall.
+     */
+    void despawnBall(PoolHandle handle);
+
+    /**
+     * @brief Removes every ball from the store.
+     */
+    void clearBalls();
+
+    /**
+     * @brief Puts every obstacle back at its spawn position and velocity.
+     *
+     * Makes a reset a complete state reset, so a run (and any replay of
+     * it) always starts from the same obstacle phases.
+     */
+    void resetObstacles();
+
+    /**
+     * @brief Empties the platform and wall arrays.
+     *
+     * Used by the chunk stream when it repopulates the static geometry for
+     * a new camera window; obstacle arrays (and their patrol state) are
+     * untouched. The vectors keep their capacity so restreaming does not
+     * reallocate.
+     */
+    void clearStaticGeometry();
+
+    /**
+     * @brief Precomputes which walls each obstacle's patrol can ever reach.
+     *
+     * An obstacle's reachable area is fixed at construction: the box its
+     * AABB sweeps between leftLimit and rightLimit. Intersecting that
+     * swept box with every wall once yields a per-obstacle candidate
+     * list — usually empty — so the per-tick wall check degenerates to
+     * walking a near-zero list instead of querying a broadphase per
+     * obstacle. Must be re-run whenever the wall arrays change (the
+     * chunk stream does this after each restream).
+     */
+    void buildObstacleWallLists();
+
+    /**
+     * @brief Advances all obstacles by one tick.
+     *
+     * Moves each obstacle horizontally and reverses its direction when it
+     * reaches a patrol boundary or overlaps a wall in its precomputed
+     * candidate list (see buildObstacleWallLists).
+     *
+     * @param dt Fixed tick duration in seconds.
+     */
+    void moveObstacles(float dt);
+
+    /**
+     * @brief Advances one contiguous range of obstacles by one tick.
+     *
+     * Obstacles are independent of each other, so disjoint ranges can run
+     * on different job-system workers; the range only reads shared state.
+     *
+     * @param dt Fixed tick duration in seconds.
+     * @param begin First obstacle index in the range.
+     * @param end One past the last obstacle index in the range.
+     */
+    void moveObstaclesRange(float dt, std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Tells whether an obstacle's patrol can reach any wall.
+     *
+     * @param i Obstacle index.
+     * @return true If the precomputed wall candidate list is non-empty.
+     * @return false If the patrol never touches a wall.
+     */
+    bool obstacleHasWallCandidates(std::size_t i) const { return obstacleWallStart[i + 1] > obstacleWallStart[i]; }
+
+    /**
+     * @brief Tells whether a ball handle still names a live ball.
+     *
+     * @param handle Handle from spawnBall.
+     * @return true If the ball has not been despawned since.
+     * @return false If the handle is stale.
+     */
+    bool ballAlive(PoolHandle handle) const { return ballPool.alive(handle); }
+
+    /**
+     * @brief Resolves a live ball handle to its current array index.
+     *
+     * @param handle A live handle from spawnBall.
+     * @return std::size_t Index into the ball arrays this tick.
+     */
+    std::size_t ballIndex(PoolHandle handle) const { return ballPool.denseIndex(handle); }
+
+private:
+    HandlePool ballPool; ///< Generational slot map over the ball arrays.
+    std::vector<std::size_t> obstacleWallStart; ///< Per obstacle, the first entry in obstacleWallList (size + 1 entries).
+    std::vector<std::size_t> obstacleWallList; ///< Concatenated wall candidate indices for all obstacles.
+};
+
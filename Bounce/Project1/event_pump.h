@@ -0,0 +1,96 @@
+#pragma once
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Drains the window's event queue into a fixed buffer, once per
+ * frame.
+ *
+ * The old loop interleaved OS message handling with game logic: each
+ * pollEvent call crossed into the windowing system and each handler ran
+ * inline before the next poll. The pump drains everything pending in
+ * one pass at frame start into a preallocated array; game systems then
+ * iterate the buffer by reference with no further OS calls. Redundant
+ * events coalesce during the drain — key-repeat KeyPressed for a key
+ * already recorded this pump is dropped (held keys are the sampler's
+ * job; handlers want the edge), and a resize storm from a window drag
+ * collapses to the final size in place. A mash-the-keyboard or
+ * drag-the-window burst therefore costs one bounded pass, not an
+ * unbounded stretch of inline handling.
+ */
+class EventPump {
+public:
+    /**
+     * @brief Drains all pending events from @p window into the buffer.
+     *
+     * Call once per frame before iterating. The OS queue is always
+     * drained fully; if a burst overflows the buffer the excess events
+     * are dropped after coalescing (the queue must empty either way or
+     * the window becomes unresponsive).
+     *
+     * @tparam Window Anything with SFML's pollEvent signature.
+     * @param window The window to drain.
+     */
+    template <typename Window>
+    void pump(Window& window)
+    {
+        stored = 0;
+        resizeSlot = capacity;
+        for (bool& seen : keySeen)
+            seen = false;
+
+        sf::Event event;
+        while (window.pollEvent(event))
+        {
+            if (event.type == sf::Event::KeyPressed)
+            {
+                // Key-repeat: the key already produced its edge this
+                // pump; later repeats carry no new information
+                const int code = event.key.code;
+                if (code >= 0 && code < sf::Keyboard::KeyCount)
+                {
+                    if (keySeen[code])
+                        continue;
+                    keySeen[code] = true;
+                }
+            }
+            if (event.type == sf::Event::Resized && resizeSlot < stored)
+            {
+                // A drag delivers dozens of sizes; only the last matters
+                events[resizeSlot] = event;
+                continue;
+            }
+
+            if (stored >= capacity)
+                continue;  // Burst overflow: keep draining, drop the rest
+            if (event.type == sf::Event::Resized)
+                resizeSlot = stored;
+            events[stored++] = event;
+        }
+    }
+
+    /**
+     * @brief Events stored by the last pump.
+     *
+     * @return std::size_t The count.
+     */
+    std::size_t count() const { return stored; }
+
+    /**
+     * @brief One stored event, in arrival order.
+     *
+     * @param index Index below count().
+     * @return const sf::Event& The event.
+     */
+    const sf::Event& at(std::size_t index) const { return events[index]; }
+
+private:
+    static const std::size_t capacity = 128; ///< Events kept per pump; bursts beyond this drop.
+
+    sf::Event events[capacity]; ///< The drained events.
+    std::size_t stored = 0; ///< Valid entries from the last pump.
+    std::size_t resizeSlot = capacity; ///< Slot of the stored Resized event, if any.
+    bool keySeen[sf::Keyboard::KeyCount] = {}; ///< KeyPressed codes recorded this pump.
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <sys/stat.h>
+
+/**
+ * @brief Modification-time polling shared by the live-reload watchers.
+ *
+ * The config system and the asset hot-reload both detect edits the
+ * same way: poll the file's mtime on a background thread and act when
+ * it moves. Seconds resolution is enough to catch a save, and a plain
+ * stat keeps the watchers free of any platform notification API.
+ */
+
+/**
+ * @brief Modification time of a file, or zero when it is missing.
+ *
+ * @param path The file to stat.
+ * @return std::int64_t Seconds-resolution mtime.
+ */
+inline std::int64_t fileModifiedTime(const std::string& path)
+{
+#if defined(_WIN32)
+    struct _stat64 info;
+    if (_stat64(path.c_str(), &info) != 0)
+        return 0;
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+        return 0;
+#endif
+    return static_cast<std::int64_t>(info.st_mtime);
+}
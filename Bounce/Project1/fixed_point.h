@@ -0,0 +1,99 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief 20.12 fixed-point scalar for the deterministic physics mode.
+ *
+ * IEEE float arithmetic is deterministic per operation, but the tick
+ * also leans on std::pow for the friction decay, and different libms
+ * (and compilers contracting a*b+c into FMA) can disagree in the last
+ * bit — enough to desync a lockstep session or fail a cross-compiler
+ * replay verification over thousands of ticks. Fixed keeps 12
+ * fraction bits in a plain int32: adds and subtracts are integer
+ * adds, multiplies and divides go through int64 and a shift, so every
+ * compiler on every machine produces the same bits. Twelve fraction
+ * bits resolve 1/4096 px — far below anything visible — while twenty
+ * integer bits cover the longest generated level with room to spare.
+ *
+ * Division saturates instead of overflowing: the swept test divides
+ * level-scale distances by tick-scale displacements, and a quotient
+ * beyond the 20.12 range only ever feeds an entry-time comparison
+ * that rejects it anyway.
+ */
+struct Fixed {
+    static const int fractionBits = 12; ///< 1/4096 px resolution.
+    static const std::int32_t oneRaw = 1 << fractionBits; ///< Raw value of 1.0.
+
+    std::int32_t raw = 0; ///< The scaled integer representation.
+
+    Fixed() = default;
+
+    /**
+     * @brief Constructs from a whole number.
+     *
+     * @param value The integer value.
+     */
+    explicit Fixed(int value) : raw(static_cast<std::int32_t>(value) << fractionBits) {}
+
+    /**
+     * @brief Wraps an already-scaled raw value.
+     *
+     * @param rawValue The 20.12 bits.
+     * @return Fixed The wrapped value.
+     */
+    static Fixed fromRaw(std::int32_t rawValue)
+    {
+        Fixed result;
+        result.raw = rawValue;
+        return result;
+    }
+
+    /**
+     * @brief Quantizes a float onto the 20.12 grid, rounding to nearest.
+     *
+     * @param value The float to quantize.
+     * @return Fixed The nearest representable value.
+     */
+    static Fixed fromFloat(float value)
+    {
+        const float scaled = value * static_cast<float>(oneRaw);
+        return fromRaw(static_cast<std::int32_t>(scaled + (scaled >= 0.0f ? 0.5f : -0.5f)));
+    }
+
+    /**
+     * @brief The exact float this value represents.
+     *
+     * Every 20.12 value is exactly representable in a float, so the
+     * round trip through storage loses nothing.
+     *
+     * @return float The represented value.
+     */
+    float toFloat() const { return static_cast<float>(raw) / static_cast<float>(oneRaw); }
+
+    Fixed operator+(Fixed other) const { return fromRaw(raw + other.raw); }
+    Fixed operator-(Fixed other) const { return fromRaw(raw - other.raw); }
+    Fixed operator-() const { return fromRaw(-raw); }
+
+    Fixed operator*(Fixed other) const
+    {
+        return fromRaw(static_cast<std::int32_t>(
+            (static_cast<std::int64_t>(raw) * other.raw) >> fractionBits));
+    }
+
+    Fixed operator/(Fixed other) const
+    {
+        const std::int64_t wide = (static_cast<std::int64_t>(raw) << fractionBits) / other.raw;
+        if (wide > INT32_MAX)
+            return fromRaw(INT32_MAX);
+        if (wide < INT32_MIN)
+            return fromRaw(INT32_MIN);
+        return fromRaw(static_cast<std::int32_t>(wide));
+    }
+
+    bool operator<(Fixed other) const { return raw < other.raw; }
+    bool operator>(Fixed other) const { return raw > other.raw; }
+    bool operator<=(Fixed other) const { return raw <= other.raw; }
+    bool operator>=(Fixed other) const { return raw >= other.raw; }
+    bool operator==(Fixed other) const { return raw == other.raw; }
+    bool operator!=(Fixed other) const { return raw != other.raw; }
+};
@@ -0,0 +1,104 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Fixed-capacity vector: one allocation, then pointer-stable forever.
+ *
+ * Capacity is set once from a count that is known up front — for the
+ * entity lists that count comes straight out of the binary level
+ * header — so all elements live contiguously in a single block that is
+ * never reallocated. Appends are a placement-new and a counter bump
+ * with no capacity branch growth path, elements never move, and
+ * references taken at build time stay valid for the container's whole
+ * life. Exceeding the capacity is a programming error, caught by
+ * assert in debug builds.
+ *
+ * @tparam T Element type.
+ */
+template <typename T>
+class FixedVector {
+public:
+    FixedVector() = default;
+
+    /**
+     * @brief Constructs with the capacity already set; see setCapacity().
+     *
+     * @param capacity Exact number of elements the container will hold.
+     */
+    explicit FixedVector(std::size_t capacity) { setCapacity(capacity); }
+
+    ~FixedVector() { clear(); }
+
+    FixedVector(const FixedVector&) = delete;
+    FixedVector& operator=(const FixedVector&) = delete;
+
+    /**
+     * @brief Makes the container's single allocation.
+     *
+     * Destroys any current contents. The capacity is exact — the point
+     * is that the caller knows the count from the level header, so no
+     * growth slack is kept.
+     *
+     * @param capacity Exact number of elements the container will hold.
+     */
+    void setCapacity(std::size_t capacity)
+    {
+        clear();
+        storage.reset(capacity > 0 ? static_cast<unsigned char*>(::operator new(capacity * sizeof(T), std::align_val_t(alignof(T)))) : nullptr);
+        cap = capacity;
+    }
+
+    /**
+     * @brief Constructs an element in place at the end.
+     *
+     * @param args Constructor arguments for the element.
+     * @return T& The constructed element.
+     */
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        assert(count < cap && "FixedVector capacity exceeded; the level header count was wrong");
+        T* element = new (data() + count) T(std::forward<Args>(args)...);
+        ++count;
+        return *element;
+    }
+
+    /**
+     * @brief Destroys all elements; the allocation and capacity remain.
+     */
+    void clear()
+    {
+        for (std::size_t i = count; i > 0; --i)
+            data()[i - 1].~T();
+        count = 0;
+    }
+
+    T& operator[](std::size_t i) { return data()[i]; }
+    const T& operator[](std::size_t i) const { return data()[i]; }
+
+    T* data() { return reinterpret_cast<T*>(storage.get()); }
+    const T* data() const { return reinterpret_cast<const T*>(storage.get()); }
+
+    T* begin() { return data(); }
+    T* end() { return data() + count; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + count; }
+
+    std::size_t size() const { return count; }
+    std::size_t capacity() const { return cap; }
+    bool empty() const { return count == 0; }
+
+private:
+    /// Deleter matching the aligned operator new in setCapacity.
+    struct AlignedDelete {
+        void operator()(unsigned char* p) const { ::operator delete(p, std::align_val_t(alignof(T))); }
+    };
+
+    std::unique_ptr<unsigned char[], AlignedDelete> storage; ///< The single backing block.
+    std::size_t cap = 0; ///< Capacity in elements; fixed after setCapacity.
+    std::size_t count = 0; ///< Live element count.
+};
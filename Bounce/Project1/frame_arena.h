@@ -0,0 +1,134 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+ * @brief Bump allocator for data that lives exactly one frame.
+ *
+ * Allocation is a pointer bump into one block grabbed at construction;
+ * freeing the whole frame is a single reset of that pointer, so the hot
+ * loop makes zero malloc/free calls and multiple threads each owning an
+ * arena never contend on the global heap. Nothing allocated from an
+ * arena may outlive the next reset — the snapshot channel, not the
+ * arena, is how state crosses frames.
+ *
+ * If a frame ever outgrows the block, the spill goes to the heap and is
+ * returned on the next reset, so correctness never depends on the
+ * capacity guess; a spilling frame just loses the speed.
+ */
+class FrameArena {
+public:
+    /**
+     * @brief Grabs the arena's block; the only allocation it ever keeps.
+     *
+     * @param capacity Block size in bytes.
+     */
+    explicit FrameArena(std::size_t capacity = 64 * 1024)
+        : block(new unsigned char[capacity]), blockSize(capacity)
+    {
+    }
+
+    /**
+     * @brief Allocates transient bytes by bumping the frame pointer.
+     *
+     * @param bytes Number of bytes requested.
+     * @param alignment Required alignment; must be a power of two.
+     * @return void* Storage valid until the next reset().
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
+    {
+        const std::size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes > blockSize)
+        {
+            // Frame outgrew the block; spill to the heap until reset.
+            // The alignment rides along so reset() can call the matching
+            // aligned delete — the plain form is a different allocator
+            Spill spill;
+            spill.alignment = alignment;
+            spill.ptr = static_cast<unsigned char*>(::operator new(bytes, std::align_val_t(alignment)));
+            overflow.push_back(spill);
+            return spill.ptr;
+        }
+        offset = aligned + bytes;
+        return block.get() + aligned;
+    }
+
+    /**
+     * @brief Frees everything allocated this frame.
+     *
+     * Rewinds the bump pointer and returns any overflow spills. Called
+     * once at the top of each frame; every pointer handed out since the
+     * previous reset becomes invalid.
+     */
+    void reset()
+    {
+        offset = 0;
+        for (const Spill& spill : overflow)
+            ::operator delete(spill.ptr, std::align_val_t(spill.alignment));
+        overflow.clear();
+    }
+
+    ~FrameArena() { reset(); }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+private:
+    /**
+     * @brief One heap spill and the alignment it was allocated with.
+     *
+     * Aligned operator new must be paired with the aligned delete of
+     * the same alignment, so the value is kept until reset returns it.
+     */
+    struct Spill {
+        unsigned char* ptr = nullptr; ///< The spilled allocation.
+        std::size_t alignment = alignof(std::max_align_t); ///< Alignment passed to operator new.
+    };
+
+    std::unique_ptr<unsigned char[]> block; ///< The arena's single backing block.
+    std::size_t blockSize = 0; ///< Block size in bytes.
+    std::size_t offset = 0; ///< Bump pointer; bytes handed out this frame.
+    std::vector<Spill> overflow; ///< Heap spills, returned on reset.
+};
+
+/**
+ * @brief std-compatible allocator handle over a FrameArena.
+ *
+ * Lets standard containers (temporary vectors, strings) draw their
+ * storage from the frame arena: allocate bumps, deallocate is a no-op
+ * because reset() reclaims the whole frame at once. The handle is a
+ * single pointer, cheap to copy into containers; the arena it refers to
+ * must outlive every container using it.
+ *
+ * @tparam T Element type the container stores.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    /**
+     * @brief Binds the handle to an arena.
+     *
+     * @param arena The arena that backs every allocation.
+     */
+    explicit ArenaAllocator(FrameArena& arena) : arena(&arena) {}
+
+    /// Rebinding copy, so containers can allocate their internal types.
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T))); }
+
+    /// No-op; the arena's reset reclaims the whole frame at once.
+    void deallocate(T*, std::size_t) {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+    FrameArena* arena; ///< The backing arena; shared by rebound copies.
+};
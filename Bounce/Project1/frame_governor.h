@@ -0,0 +1,115 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @brief Frame-budget governor with tiered load shedding.
+ *
+ * A cabinet that starts thermal throttling used to slow down uniformly
+ * — everything judders a little. The governor instead watches the
+ * frame's busy time (work only, never the vsync wait) against the
+ * frame budget and sheds optional work in defined tiers when the
+ * smoothed busy time stays over budget, restoring it when headroom
+ * returns:
+ *
+ *   tier 0  everything on
+ *   tier 1  no particles (emission, update and draw)
+ *   tier 2  + no parallax background
+ *   tier 3  + sprite animation advanced on alternate frames
+ *
+ * Transitions are hysteretic and deliberately slow: degrading takes a
+ * sustained run of over-budget frames and recovering a longer run of
+ * clearly-under-budget ones, so a single hitch never flickers a tier
+ * and the system cannot oscillate at the threshold. The render loop
+ * consults tier() at each shed point; the telemetry record carries the
+ * tier and the lifetime transition count so fleet monitoring can
+ * correlate degradation with cabinet temperature.
+ */
+class FrameGovernor {
+public:
+    static constexpr int maxTier = 3; ///< Deepest shedding tier.
+
+    /**
+     * @brief Sets the frame budget.
+     *
+     * @param budgetMs Whole-frame budget in milliseconds.
+     */
+    void init(float budgetMs) { budget = budgetMs; }
+
+    /**
+     * @brief Folds one frame's busy time into the governor.
+     *
+     * Call once per frame with the work time only — with vsync on the
+     * frame-to-frame interval is pinned to the refresh period and would
+     * hide all headroom.
+     *
+     * @param busyMs Milliseconds of work this frame (no display wait).
+     */
+    void frameMeasured(float busyMs)
+    {
+        // EWMA over ~30 frames; one hitch moves it little
+        smoothedMs = smoothedMs <= 0.0f ? busyMs : smoothedMs * (1.0f - alpha) + busyMs * alpha;
+
+        if (smoothedMs > budget * degradeAt)
+        {
+            recoverRun = 0;
+            if (++degradeRun >= degradeFrames && currentTier < maxTier)
+            {
+                ++currentTier;
+                ++shiftCounter;
+                degradeRun = 0;
+            }
+        }
+        else if (smoothedMs < budget * recoverAt)
+        {
+            degradeRun = 0;
+            if (++recoverRun >= recoverFrames && currentTier > 0)
+            {
+                --currentTier;
+                ++shiftCounter;
+                recoverRun = 0;
+            }
+        }
+        else
+        {
+            // In the dead band between the thresholds: hold the tier
+            degradeRun = 0;
+            recoverRun = 0;
+        }
+    }
+
+    /**
+     * @brief The active shedding tier.
+     *
+     * @return int 0 (everything on) through maxTier.
+     */
+    int tier() const { return currentTier; }
+
+    /**
+     * @brief Tier transitions since startup, for telemetry.
+     *
+     * @return std::uint32_t Degrades plus recoveries.
+     */
+    std::uint32_t shiftCount() const { return shiftCounter; }
+
+    /**
+     * @brief The smoothed busy time, for the profiler HUD.
+     *
+     * @return float Milliseconds.
+     */
+    float smoothedBusyMs() const { return smoothedMs; }
+
+private:
+    static constexpr float alpha = 1.0f / 30.0f; ///< EWMA weight of one frame.
+    static constexpr float degradeAt = 0.95f; ///< Degrade above this fraction of budget.
+    static constexpr float recoverAt = 0.70f; ///< Recover below this fraction of budget.
+    static constexpr int degradeFrames = 30; ///< Sustained over-budget frames to shed a tier.
+    static constexpr int recoverFrames = 180; ///< Sustained headroom frames to restore one.
+
+    float budget = 16.6f; ///< Frame budget in milliseconds.
+    float smoothedMs = 0.0f; ///< EWMA of the busy time; 0 until the first frame.
+    int currentTier = 0; ///< Active shedding tier.
+    int degradeRun = 0; ///< Consecutive frames over the degrade threshold.
+    int recoverRun = 0; ///< Consecutive frames under the recover threshold.
+    std::uint32_t shiftCounter = 0; ///< Lifetime tier transitions.
+};
@@ -0,0 +1,103 @@
+#include "frame_pacer.h"
+#include <cmath>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Refresh rates worth snapping an adaptive target to.
+ */
+constexpr float commonRatesHz[] = { 60.0f, 75.0f, 90.0f, 120.0f, 144.0f, 165.0f, 240.0f };
+
+} // namespace
+
+/**
+ * @brief Sets the pacing target.
+ *
+ * @param targetHz Frame rate to pace to when vsync is off.
+ * @param adaptive Infer the target from the measured cadence instead.
+ */
+void FramePacer::init(float targetHz, bool adaptive)
+{
+    targetMs = 1000.0f / targetHz;
+    adaptiveTarget = adaptive;
+    intervalAvgMs = targetMs;
+}
+
+/**
+ * @brief Measures the finished frame and paces the next one.
+ */
+void FramePacer::frameComplete()
+{
+    const Clock::time_point now = Clock::now();
+    if (primed)
+        recordInterval(std::chrono::duration<float, std::milli>(now - lastFrame).count());
+    lastFrame = now;
+
+    if (!primed || vsyncActive)
+    {
+        // Vsync (or the first frame) paces; just keep the deadline
+        // clock warm so a vsync-off switch starts from a sane point
+        nextDeadline = now + std::chrono::microseconds(static_cast<long long>(targetMs * 1000.0f));
+        primed = true;
+        return;
+    }
+
+    nextDeadline += std::chrono::microseconds(static_cast<long long>(targetMs * 1000.0f));
+    if (nextDeadline < now)
+    {
+        nextDeadline = now;  // A long frame ate the deadline; resync instead of sprinting to catch up
+        return;
+    }
+
+    // Sleep in short steps while far out — cheap, but imprecise by
+    // however much the OS oversleeps — then burn the last stretch in a
+    // spin, which lands within tens of microseconds
+    const auto spinMargin = std::chrono::microseconds(static_cast<long long>(spinMarginMs * 1000.0f));
+    while (Clock::now() + spinMargin < nextDeadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    while (Clock::now() < nextDeadline)
+        std::this_thread::yield();
+}
+
+/**
+ * @brief Folds one measured interval into the jitter window.
+ *
+ * @param intervalMs The measured frame-to-frame interval.
+ */
+void FramePacer::recordInterval(float intervalMs)
+{
+    if (adaptiveTarget)
+    {
+        // Smooth the cadence and snap to the nearest common refresh
+        // rate; a vsynced 60Hz display measures ~16.67ms regardless of
+        // what we asked for, and that is the cadence to judge against
+        intervalAvgMs = intervalAvgMs * 0.95f + intervalMs * 0.05f;
+        float best = targetMs;
+        float bestError = 1.0e9f;
+        for (const float rate : commonRatesHz)
+        {
+            const float candidate = 1000.0f / rate;
+            const float error = std::fabs(candidate - intervalAvgMs);
+            if (error < bestError)
+            {
+                bestError = error;
+                best = candidate;
+            }
+        }
+        targetMs = best;
+    }
+
+    const float deviation = std::fabs(intervalMs - targetMs);
+    jitterSumMs += deviation;
+    if (deviation > jitterWorstMs)
+        jitterWorstMs = deviation;
+    if (++windowFrames >= windowSize)
+    {
+        publishedAvgMs = jitterSumMs / windowFrames;
+        publishedWorstMs = jitterWorstMs;
+        jitterSumMs = 0.0f;
+        jitterWorstMs = 0.0f;
+        windowFrames = 0;
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+/**
+ * @brief Frame pacing with a sleep-then-spin deadline and jitter stats.
+ *
+ * SFML's framerate limit is one coarse sleep, which oversleeps by a
+ * millisecond or more on Windows and shows up as judder. The pacer
+ * instead sleeps in small steps until just short of the frame deadline
+ * and spins the rest, hitting the deadline within tens of microseconds.
+ * It is vsync-aware: while vsync paces the thread (our default), the
+ * pacer only measures; switch vsync off and it takes over the pacing at
+ * the target rate. In adaptive mode the target is inferred from the
+ * measured presentation cadence snapped to the common refresh rates,
+ * since sf::VideoMode does not expose the display's rate.
+ *
+ * Either way it records the achieved frame-to-frame jitter (average and
+ * worst over a rolling window) for the profiler HUD, so pacing
+ * complaints become numbers.
+ */
+class FramePacer {
+public:
+    /**
+     * @brief Sets the pacing target.
+     *
+     * @param targetHz Frame rate to pace to when vsync is off.
+     * @param adaptive Infer the target from the measured cadence instead.
+     */
+    void init(float targetHz, bool adaptive);
+
+    /**
+     * @brief Tells the pacer whether vsync is pacing the thread.
+     *
+     * @param active True while vertical sync is enabled on the window.
+     */
+    void setVsyncActive(bool active) { vsyncActive = active; }
+
+    /**
+     * @brief Call once per frame, right after display(); measures the
+     * frame interval and, when vsync is off, sleeps-then-spins to the
+     * next deadline.
+     */
+    void frameComplete();
+
+    /**
+     * @brief Average deviation from the frame cadence, milliseconds.
+     *
+     * @return float Mean |interval - target| over the last full window.
+     */
+    float averageJitterMs() const { return publishedAvgMs; }
+
+    /**
+     * @brief Worst deviation from the frame cadence, milliseconds.
+     *
+     * @return float Max |interval - target| over the last full window.
+     */
+    float worstJitterMs() const { return publishedWorstMs; }
+
+    /**
+     * @brief The cadence currently paced or measured against.
+     *
+     * @return float Frame interval in milliseconds.
+     */
+    float targetIntervalMs() const { return targetMs; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Folds one measured interval into the jitter window and,
+     * in adaptive mode, re-snaps the target cadence.
+     *
+     * @param intervalMs The measured frame-to-frame interval.
+     */
+    void recordInterval(float intervalMs);
+
+    static constexpr std::size_t windowSize = 120; ///< Frames per jitter window (~2 s at 60).
+    static constexpr float spinMarginMs = 2.0f; ///< Sleep until this close to the deadline, then spin.
+
+    float targetMs = 1000.0f / 60.0f; ///< Paced frame interval.
+    bool adaptiveTarget = false; ///< Re-snap targetMs from the measured cadence.
+    bool vsyncActive = true; ///< While set, measure only; vsync paces.
+
+    Clock::time_point lastFrame{}; ///< Previous frameComplete time.
+    Clock::time_point nextDeadline{}; ///< Next frame's pacing deadline.
+    bool primed = false; ///< Set after the first frameComplete seeds the clock.
+
+    float jitterSumMs = 0.0f; ///< Sum of deviations in the current window.
+    float jitterWorstMs = 0.0f; ///< Worst deviation in the current window.
+    float publishedAvgMs = 0.0f; ///< Last full window's average, for the HUD.
+    float publishedWorstMs = 0.0f; ///< Last full window's worst, for the HUD.
+    std::size_t windowFrames = 0; ///< Frames accumulated in the window.
+    float intervalAvgMs = 0.0f; ///< Smoothed interval, for the adaptive snap.
+};
@@ -0,0 +1,137 @@
+#include "frame_profiler.h"
+#include <algorithm>
+#include <cstdio>
+
+/**
+ * @brief Marks the start of a frame.
+ */
+void FrameProfiler::beginFrame()
+{
+    clock.restart();
+    lastMark = 0;
+    frameStartTimes[cursor] = globalClock.getElapsedTime().asMicroseconds();
+    allocMark = alloctrack::counters().count;
+}
+
+/**
+ * @brief Marks the end of a phase.
+ *
+ * @param phase The phase that just finished.
+ */
+void FrameProfiler::endPhase(Phase phase)
+{
+    const sf::Int64 now = clock.getElapsedTime().asMicroseconds();
+    samples[phase][cursor] = now - lastMark;
+    lastMark = now;
+
+    // Allocations since the previous marker belong to this phase
+    const std::uint64_t allocNow = alloctrack::counters().count;
+    allocsThisFrame[phase] = static_cast<std::uint32_t>(allocNow - allocMark);
+    allocMark = allocNow;
+}
+
+/**
+ * @brief Completes the frame and advances the ring buffer.
+ */
+void FrameProfiler::endFrame()
+{
+    for (int phase = 0; phase < PhaseCount; ++phase)
+    {
+        allocsLastFrame[phase] = allocsThisFrame[phase];
+        allocsThisFrame[phase] = 0;
+    }
+    cursor = (cursor + 1) % sampleCount;
+    if (filled < sampleCount)
+        filled++;
+
+    if (shown && --framesUntilRefresh <= 0)
+    {
+        formatReport();
+        framesUntilRefresh = refreshInterval;
+    }
+}
+
+/**
+ * @brief Returns true once per report refresh.
+ *
+ * @return true If a new report was formatted since the last call.
+ * @return false Otherwise.
+ */
+bool FrameProfiler::consumeHudUpdate()
+{
+    const bool fresh = reportFresh;
+    reportFresh = false;
+    return fresh;
+}
+
+/**
+ * @brief Copies the sample window into @p out, oldest frame first.
+ *
+ * @param out Receives the unrolled ring buffers.
+ */
+void FrameProfiler::snapshot(ProfilerSnapshot& out) const
+{
+    out.frameCount = filled;
+    for (std::size_t f = 0; f < filled; ++f)
+    {
+        // Oldest sample sits at the cursor once the ring has wrapped
+        const std::size_t slot = (cursor + sampleCount - filled + f) % sampleCount;
+        out.frameStart[f] = frameStartTimes[slot];
+        for (int phase = 0; phase < PhaseCount; ++phase)
+            out.samples[phase][f] = samples[phase][slot];
+    }
+}
+
+/**
+ * @brief The display name of a phase.
+ *
+ * @param phase The phase.
+ * @return const char* A short lowercase name.
+ */
+const char* FrameProfiler::phaseName(Phase phase)
+{
+    static const char* phaseNames[PhaseCount] = { "acquire", "build", "render", "display" };
+    return phaseNames[phase];
+}
+
+/**
+ * @brief Reformats the percentile report from the ring buffers.
+ */
+void FrameProfiler::formatReport()
+{
+    char* out = report;
+    char* end = report + sizeof(report);
+
+    for (int phase = 0; phase < PhaseCount; ++phase)
+    {
+        // Copy the window so the ring buffer keeps recording while we select
+        sf::Int64 sorted[sampleCount];
+        std::copy(samples[phase], samples[phase] + filled, sorted);
+
+        sf::Int64* p50 = sorted + (filled * 50) / 100;
+        sf::Int64* p95 = sorted + (filled * 95) / 100;
+        sf::Int64* p99 = sorted + (filled * 99) / 100;
+        std::nth_element(sorted, p50, sorted + filled);
+        std::nth_element(p50 + 1, p95, sorted + filled);
+        std::nth_element(p95 + 1, p99, sorted + filled);
+
+        out += std::snprintf(out, end - out, "%-8s p50 %5lld us  p95 %5lld us  p99 %5lld us\n",
+                             phaseName(static_cast<Phase>(phase)),
+                             static_cast<long long>(*p50),
+                             static_cast<long long>(*p95),
+                             static_cast<long long>(*p99));
+        if (out >= end)
+            break;
+    }
+
+    // Last frame's per-phase allocation counts; steady state is zeros
+    if (out < end)
+    {
+        std::snprintf(out, end - out, "allocs   acq %u  build %u  render %u  disp %u  violations %llu\n",
+                      allocsLastFrame[PhaseAcquire], allocsLastFrame[PhaseBuild],
+                      allocsLastFrame[PhaseRender], allocsLastFrame[PhaseDisplay],
+                      static_cast<unsigned long long>(alloctrack::counters().violations));
+    }
+
+    reportFresh = true;
+}
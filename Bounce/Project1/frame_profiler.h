@@ -0,0 +1,140 @@
+#pragma once
+#include "alloc_tracker.h"
+#include <SFML/System/Clock.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief A chronological copy of the profiler's sample window.
+ *
+ * Taken on the game thread with plain memcpy-sized stores so a capture
+ * cannot hitch the loop; the trace exporter formats it to JSON on a
+ * background thread.
+ */
+struct ProfilerSnapshot {
+    static const std::size_t maxFrames = 240; ///< Matches FrameProfiler's window.
+    sf::Int64 samples[4][maxFrames]; ///< Per-phase (PhaseCount) durations in microseconds, oldest frame first.
+    sf::Int64 frameStart[maxFrames]; ///< Frame start timestamps in microseconds since startup.
+    std::size_t frameCount = 0; ///< Number of valid frames.
+};
+
+/**
+ * @brief Lightweight per-phase frame profiler with percentile reporting.
+ *
+ * Each frame is split into phases (snapshot acquire, scene build,
+ * render submission, display/vsync wait); a phase marker costs one clock
+ * read and one array store. Samples go into a fixed ring buffer of the
+ * last 240 frames, and p50/p95/p99 per phase are recomputed only every
+ * 30 frames when the overlay is visible, so neither the markers nor the
+ * reporting can themselves hitch the loop. The overlay is toggled with
+ * F1 and rendered by main() with the HUD font.
+ */
+class FrameProfiler {
+public:
+    /**
+     * @brief The instrumented phases of one frame, in order.
+     */
+    enum Phase {
+        PhaseAcquire = 0, ///< Taking the newest simulation snapshot.
+        PhaseBuild, ///< Asset swap-in, HUD updates and batch building.
+        PhaseRender, ///< Batch building and draw submission.
+        PhaseDisplay, ///< window.display(), including any vsync wait.
+        PhaseCount ///< Number of phases.
+    };
+
+    /**
+     * @brief Marks the start of a frame.
+     */
+    void beginFrame();
+
+    /**
+     * @brief Marks the end of a phase.
+     *
+     * Records the time elapsed since the previous marker (or the frame
+     * start) against @p phase. One clock read, no allocation.
+     *
+     * @param phase The phase that just finished.
+     */
+    void endPhase(Phase phase);
+
+    /**
+     * @brief Completes the frame and advances the ring buffer.
+     *
+     * Every 30 frames while the overlay is visible, reformats the
+     * percentile report.
+     */
+    void endFrame();
+
+    /**
+     * @brief Toggles the overlay on or off.
+     */
+    void toggle() { shown = !shown; }
+
+    /**
+     * @brief Whether the overlay is currently visible.
+     *
+     * @return true If the overlay should be drawn.
+     * @return false If the overlay is hidden.
+     */
+    bool visible() const { return shown; }
+
+    /**
+     * @brief Returns true once per report refresh.
+     *
+     * main() uses this to call sf::Text::setString only when the report
+     * text actually changed, keeping glyph rebuilds off the steady path.
+     *
+     * @return true If a new report was formatted since the last call.
+     * @return false Otherwise.
+     */
+    bool consumeHudUpdate();
+
+    /**
+     * @brief Copies the sample window into @p out, oldest frame first.
+     *
+     * @param out Receives the unrolled ring buffers.
+     */
+    void snapshot(ProfilerSnapshot& out) const;
+
+    /**
+     * @brief The display name of a phase.
+     *
+     * @param phase The phase.
+     * @return const char* A short lowercase name.
+     */
+    static const char* phaseName(Phase phase);
+
+    /**
+     * @brief The formatted percentile report.
+     *
+     * One line per phase: name, p50, p95 and p99 in microseconds over
+     * the sample window.
+     *
+     * @return const char* Pointer to the internal report buffer.
+     */
+    const char* hudText() const { return report; }
+
+private:
+    static const std::size_t sampleCount = 240; ///< Frames kept per phase (two seconds at 120fps).
+    static const int refreshInterval = 30; ///< Frames between report reformats.
+
+    /**
+     * @brief Reformats the percentile report from the ring buffers.
+     */
+    void formatReport();
+
+    sf::Clock clock; ///< Restarted every frame; markers read it once each.
+    std::uint64_t allocMark = 0; ///< This thread's allocation count at the previous marker.
+    std::uint32_t allocsThisFrame[PhaseCount] = {}; ///< Per-phase allocations, current frame.
+    std::uint32_t allocsLastFrame[PhaseCount] = {}; ///< Per-phase allocations, last completed frame.
+    sf::Clock globalClock; ///< Never restarted; timestamps frame starts for traces.
+    sf::Int64 frameStartTimes[sampleCount] = {}; ///< Frame start times in microseconds since startup.
+    sf::Int64 lastMark = 0; ///< Elapsed microseconds at the previous marker.
+    sf::Int64 samples[PhaseCount][sampleCount] = {}; ///< Per-phase ring buffers in microseconds.
+    std::size_t cursor = 0; ///< Current slot in the ring buffers.
+    std::size_t filled = 0; ///< Number of valid samples, up to sampleCount.
+    int framesUntilRefresh = 0; ///< Countdown to the next report reformat.
+    bool shown = false; ///< Overlay visibility.
+    bool reportFresh = false; ///< Set by formatReport, cleared by consumeHudUpdate.
+    char report[512] = ""; ///< The formatted percentile report.
+};
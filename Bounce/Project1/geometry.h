@@ -0,0 +1,124 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * @brief Header-only geometry substrate, decoupled from SFML types.
+ *
+ * The simulation never touches sf::FloatRect or sf::Vector2f: shapes
+ * and vectors cross to SFML only at the render boundary. Everything
+ * the collision code needs lives here as plain aggregates with
+ * constexpr operations, so the optimizer sees through every call in
+ * every translation unit, and the same types instantiate over float
+ * and Fixed alike — this is the substrate the SIMD batch tests, the
+ * swept sweep and the fixed-point mode all sit on. Aabb is aligned to
+ * its full width, which keeps an array of boxes load-friendly for the
+ * vector kernels.
+ */
+
+/**
+ * @brief A two-component vector over any scalar.
+ *
+ * @tparam T The scalar type.
+ */
+template <typename T>
+struct Vec2 {
+    T x{}; ///< Horizontal component.
+    T y{}; ///< Vertical component.
+
+    constexpr Vec2 operator+(Vec2 other) const { return { x + other.x, y + other.y }; }
+    constexpr Vec2 operator-(Vec2 other) const { return { x - other.x, y - other.y }; }
+    constexpr Vec2 operator*(T scale) const { return { x * scale, y * scale }; }
+};
+
+/**
+ * @brief An axis-aligned box over any scalar: left, top, width, height.
+ *
+ * The member names match level::RectRecord so level data brace-copies
+ * straight in.
+ *
+ * @tparam T The scalar type.
+ */
+template <typename T>
+struct alignas(sizeof(T) * 4) Aabb {
+    T x{}; ///< Left edge.
+    T y{}; ///< Top edge.
+    T w{}; ///< Width.
+    T h{}; ///< Height.
+
+    /**
+     * @brief The right edge.
+     *
+     * @return T x + w.
+     */
+    constexpr T right() const { return x + w; }
+
+    /**
+     * @brief The bottom edge.
+     *
+     * @return T y + h.
+     */
+    constexpr T bottom() const { return y + h; }
+
+    /**
+     * @brief The top-left corner.
+     *
+     * @return Vec2<T> The position.
+     */
+    constexpr Vec2<T> position() const { return { x, y }; }
+
+    /**
+     * @brief The extent.
+     *
+     * @return Vec2<T> Width and height.
+     */
+    constexpr Vec2<T> size() const { return { w, h }; }
+
+    /**
+     * @brief Whether this box overlaps another.
+     *
+     * Open intervals: boxes that merely share an edge do not overlap,
+     * matching every collision test in the simulation.
+     *
+     * @param other The other box.
+     * @return true If the interiors intersect.
+     */
+    constexpr bool intersects(const Aabb& other) const
+    {
+        return x < other.right() && other.x < right() && y < other.bottom() && other.y < bottom();
+    }
+
+    /**
+     * @brief Whether a point lies inside or on this box.
+     *
+     * @param point The point.
+     * @return true If contained.
+     */
+    constexpr bool contains(Vec2<T> point) const
+    {
+        return point.x >= x && point.x <= right() && point.y >= y && point.y <= bottom();
+    }
+};
+
+/**
+ * @brief Tests two axis-aligned boxes for overlap, from raw components.
+ *
+ * The form the structure-of-arrays loops use: the store hands the hot
+ * loops eight floats straight from its parallel arrays, with no box
+ * object assembled in between.
+ *
+ * @param ax Left edge of box A.
+ * @param ay Top edge of box A.
+ * @param aw Width of box A.
+ * @param ah Height of box A.
+ * @param bx Left edge of box B.
+ * @param by Top edge of box B.
+ * @param bw Width of box B.
+ * @param bh Height of box B.
+ * @return true If the boxes overlap.
+ * @return false If the boxes do not overlap.
+ */
+constexpr bool aabbIntersects(float ax, float ay, float aw, float ah,
+                              float bx, float by, float bw, float bh)
+{
+    return ax < bx + bw && bx < ax + aw && ay < by + bh && by < ay + ah;
+}
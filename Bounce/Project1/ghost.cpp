@@ -0,0 +1,121 @@
+#include "ghost.h"
+#include <cstring>
+
+GhostInputStream::~GhostInputStream()
+{
+    if (file)
+        std::fclose(file);
+}
+
+/**
+ * @brief Opens a replay file and validates its header.
+ *
+ * @param path Path of the replay file.
+ * @return true If the header is valid and ticks are available.
+ */
+bool GhostInputStream::open(const std::string& path)
+{
+    file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    replay::Header header;
+    const bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+        && std::memcmp(header.magic, "BRPL", 4) == 0
+        && header.version == replay::replayVersion;
+    if (!ok)
+    {
+        std::fclose(file);
+        file = nullptr;
+        return false;
+    }
+
+    tickCount = header.tickCount;
+    tick = 0;
+    currentBits = 0;
+    windowBytes = std::fread(window, 1, windowSize, file);
+    bitPos = 0;
+    return tickCount > 0;
+}
+
+/**
+ * @brief Reads one bit, refilling the window off the file as needed.
+ */
+bool GhostInputStream::pullBit()
+{
+    if (bitPos >= windowBytes * 8)
+    {
+        // Window exhausted: the next slice of the file replaces it.
+        // Decode consumes bits strictly in order, so nothing behind
+        // the cursor is ever needed again.
+        windowBytes = file ? std::fread(window, 1, windowSize, file) : 0;
+        bitPos = 0;
+        if (windowBytes == 0)
+            return false;  // Truncated file; active() ends playback
+    }
+    const bool bit = (window[bitPos / 8] >> (bitPos % 8)) & 1;
+    ++bitPos;
+    return bit;
+}
+
+/**
+ * @brief Decodes the next tick of input.
+ *
+ * @param out Receives the input for this tick.
+ * @return true If a tick was decoded.
+ */
+bool GhostInputStream::next(InputState& out)
+{
+    if (tick >= tickCount)
+        return false;
+    tick++;
+
+    if (pullBit())
+    {
+        currentBits = static_cast<std::uint8_t>((pullBit() ? 1 : 0)
+            | (pullBit() ? 2 : 0)
+            | (pullBit() ? 4 : 0)
+            | (pullBit() ? 8 : 0));
+    }
+    out.left = (currentBits & 1) != 0;
+    out.right = (currentBits & 2) != 0;
+    out.up = (currentBits & 4) != 0;
+    out.down = (currentBits & 8) != 0;
+    return true;
+}
+
+/**
+ * @brief Adds a ghost from a replay file, reset to the level start.
+ *
+ * @param path Path of the replay file.
+ * @param level The level the run was recorded on.
+ * @return true If the ghost was added.
+ */
+bool GhostSystem::add(const std::string& path, const LevelData& level)
+{
+    if (ghosts.size() >= maxGhosts)
+        return false;
+
+    auto ghost = std::make_unique<Ghost>();
+    if (!ghost->stream.open(path))
+        return false;
+    ghost->sim.init(level);
+    ghosts.push_back(std::move(ghost));
+    return true;
+}
+
+/**
+ * @brief Advances every active ghost one tick.
+ *
+ * @param dt The fixed tick length in seconds.
+ */
+void GhostSystem::tick(float dt)
+{
+    InputState input;
+    for (auto& ghost : ghosts)
+    {
+        if (!ghost->stream.next(input))
+            continue;  // Stream ended: the ghost freezes at its final position
+        ghost->sim.tick(dt, input);
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include "replay.h"
+#include "level_loader.h"
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Streams a replay file's input bits through a fixed window.
+ *
+ * The ghost racer can have many replays open at once, so unlike
+ * ReplayPlayer this decoder never loads a stream whole: it holds one
+ * 4 KiB window of the file and refills it as the bit cursor crosses
+ * the end. Memory per open ghost is the window plus the FILE handle,
+ * regardless of run length, and a refill is one fread a few thousand
+ * ticks apart. The bit format is ReplayRecorder's.
+ */
+class GhostInputStream {
+public:
+    ~GhostInputStream();
+
+    /**
+     * @brief Opens a replay file and validates its header.
+     *
+     * @param path Path of the replay file.
+     * @return true If the header is valid and ticks are available.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Whether the stream still has ticks left.
+     *
+     * @return true If next() will produce another tick.
+     */
+    bool active() const { return tick < tickCount; }
+
+    /**
+     * @brief Decodes the next tick of input.
+     *
+     * @param out Receives the input for this tick.
+     * @return true If a tick was decoded.
+     */
+    bool next(InputState& out);
+
+private:
+    /**
+     * @brief Reads one bit, refilling the window off the file as needed.
+     */
+    bool pullBit();
+
+    static constexpr std::size_t windowSize = 4096; ///< Bytes of stream held at once.
+
+    std::FILE* file = nullptr; ///< The open replay; closed in the destructor.
+    std::uint8_t window[windowSize]; ///< The current slice of the bit stream.
+    std::size_t windowBytes = 0; ///< Valid bytes in the window.
+    std::uint64_t bitPos = 0; ///< Read position in bits within the window.
+    std::uint64_t tickCount = 0; ///< Total ticks in the file.
+    std::uint64_t tick = 0; ///< Next tick to decode.
+    std::uint8_t currentBits = 0; ///< Decoded key bits carried between ticks.
+};
+
+/**
+ * @brief Ghost racing: recorded runs simulated alongside the live player.
+ *
+ * Each ghost is a streaming input decoder driving its own headless
+ * Simulation — the same deterministic tick the player runs, so a ghost
+ * retraces its recorded run exactly, but with no input polling, no
+ * savestates, no audio and no snapshot work. That keeps a ghost's tick
+ * cost to the simulation kernel alone; ten ghosts ride along well under
+ * one player frame's budget. The tick thread advances them next to the
+ * player's tick and publishes their positions for the render thread to
+ * draw translucent.
+ */
+class GhostSystem {
+public:
+    static constexpr std::size_t maxGhosts = 10; ///< Simultaneous ghosts supported.
+
+    /**
+     * @brief Adds a ghost from a replay file, reset to the level start.
+     *
+     * @param path Path of the replay file.
+     * @param level The level the run was recorded on.
+     * @return true If the ghost was added.
+     */
+    bool add(const std::string& path, const LevelData& level);
+
+    /**
+     * @brief Removes every ghost.
+     */
+    void clear() { ghosts.clear(); }
+
+    /**
+     * @brief Advances every active ghost one tick.
+     *
+     * Ghosts whose stream has ended freeze in place at their final
+     * position.
+     *
+     * @param dt The fixed tick length in seconds.
+     */
+    void tick(float dt);
+
+    /**
+     * @brief The number of loaded ghosts.
+     *
+     * @return std::size_t Ghost count.
+     */
+    std::size_t count() const { return ghosts.size(); }
+
+    /**
+     * @brief A ghost's current x position.
+     *
+     * @param index The ghost index.
+     * @return float World x in pixels.
+     */
+    float x(std::size_t index) const { return ghosts[index]->sim.playerX; }
+
+    /**
+     * @brief A ghost's current y position.
+     *
+     * @param index The ghost index.
+     * @return float World y in pixels.
+     */
+    float y(std::size_t index) const { return ghosts[index]->sim.playerY; }
+
+private:
+    /**
+     * @brief One recorded run being retraced.
+     */
+    struct Ghost {
+        GhostInputStream stream; ///< The windowed input decode.
+        Simulation sim; ///< The headless tick instance.
+    };
+
+    std::vector<std::unique_ptr<Ghost>> ghosts; ///< The loaded ghosts.
+};
@@ -0,0 +1,91 @@
+#include "gpu_timer.h"
+#include <SFML/OpenGL.hpp>
+#include <SFML/Window/Context.hpp>
+#include <cstdint>
+
+/**
+ * @brief Timer-query entry points, loaded at runtime.
+ *
+ * The vendored SFML/OpenGL.hpp exposes the platform's baseline GL
+ * header, which predates timer queries, so the functions and the
+ * constants they take are declared here and resolved through
+ * sf::Context::getFunction against the live context.
+ */
+namespace {
+
+typedef std::uint64_t GlUint64;
+
+#ifndef GL_TIMESTAMP
+#define GL_TIMESTAMP 0x8E28
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
+typedef void (APIENTRY* GenQueriesFn)(GLsizei, GLuint*);
+typedef void (APIENTRY* QueryCounterFn)(GLuint, GLenum);
+typedef void (APIENTRY* GetQueryObjectuivFn)(GLuint, GLenum, GLuint*);
+typedef void (APIENTRY* GetQueryObjectui64vFn)(GLuint, GLenum, GlUint64*);
+
+GenQueriesFn genQueries = nullptr;
+QueryCounterFn queryCounter = nullptr;
+GetQueryObjectuivFn getQueryObjectuiv = nullptr;
+GetQueryObjectui64vFn getQueryObjectui64v = nullptr;
+
+} // namespace
+
+void GpuTimer::init()
+{
+    genQueries = reinterpret_cast<GenQueriesFn>(sf::Context::getFunction("glGenQueries"));
+    queryCounter = reinterpret_cast<QueryCounterFn>(sf::Context::getFunction("glQueryCounter"));
+    getQueryObjectuiv = reinterpret_cast<GetQueryObjectuivFn>(sf::Context::getFunction("glGetQueryObjectuiv"));
+    getQueryObjectui64v = reinterpret_cast<GetQueryObjectui64vFn>(sf::Context::getFunction("glGetQueryObjectui64v"));
+    if (!genQueries || !queryCounter || !getQueryObjectuiv || !getQueryObjectui64v)
+        return;  // No ARB_timer_query; the HUD simply omits the GPU line
+
+    for (int set = 0; set < 2; ++set)
+        genQueries(PhaseCount + 1, queries[set]);
+    active = true;
+}
+
+void GpuTimer::beginFrame()
+{
+    if (!active)
+        return;
+    queryCounter(queries[writeSet][0], GL_TIMESTAMP);
+}
+
+void GpuTimer::endPhase(Phase phase)
+{
+    if (!active)
+        return;
+    queryCounter(queries[writeSet][phase + 1], GL_TIMESTAMP);
+}
+
+void GpuTimer::endFrame()
+{
+    if (!active)
+        return;
+    setWritten[writeSet] = true;
+
+    // Harvest the set stamped last frame, but only if its final
+    // timestamp has landed; otherwise the previous results stand and
+    // the set is simply re-stamped next frame
+    const int readSet = writeSet ^ 1;
+    writeSet = readSet;
+    if (!setWritten[readSet])
+        return;
+    GLuint available = 0;
+    getQueryObjectuiv(queries[readSet][PhaseCount], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return;
+
+    GlUint64 stamps[PhaseCount + 1];
+    for (int i = 0; i <= PhaseCount; ++i)
+        getQueryObjectui64v(queries[readSet][i], GL_QUERY_RESULT, &stamps[i]);
+    for (int i = 0; i < PhaseCount; ++i)
+        resultsMs[i] = static_cast<float>(stamps[i + 1] - stamps[i]) / 1.0e6f;  // Nanoseconds to ms
+}
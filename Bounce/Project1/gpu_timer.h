@@ -0,0 +1,81 @@
+#pragma once
+
+/**
+ * @brief GPU frame timing from GL timer queries, beside the CPU phases.
+ *
+ * The frame profiler times the CPU, but on integrated GPUs the frame is
+ * often GPU-bound and window.display() just blocks opaquely — "is it
+ * CPU or GPU" was unanswerable from the HUD. GpuTimer drops a GL
+ * timestamp query after the world pass, the HUD pass and the present,
+ * and reports the GPU time between them.
+ *
+ * Queries are double-buffered: each frame writes one set and harvests
+ * the set written the frame before, checking availability first, so a
+ * read never stalls the pipeline waiting for the GPU to catch up. The
+ * timer-query entry points are loaded through sf::Context::getFunction
+ * on init; on drivers without them (GL before 3.3 and no
+ * ARB_timer_query) the timer reports unsupported and costs nothing.
+ */
+class GpuTimer {
+public:
+    /// The spans reported, in frame order.
+    enum Phase {
+        PhaseWorld, ///< Clear through the last world-pass submission.
+        PhaseHud, ///< HUD pass submissions.
+        PhasePresent, ///< The present and whatever the driver flushes with it.
+        PhaseCount ///< Number of phases.
+    };
+
+    /**
+     * @brief Loads the GL entry points and creates the query objects.
+     *
+     * Must run on the render thread with its context active. Failure
+     * to resolve any entry point leaves the timer unsupported.
+     */
+    void init();
+
+    /**
+     * @brief Whether timer queries resolved and timing is live.
+     *
+     * @return true If phaseMs returns real measurements.
+     */
+    bool supported() const { return active; }
+
+    /**
+     * @brief Stamps the start of this frame's GPU work.
+     */
+    void beginFrame();
+
+    /**
+     * @brief Stamps the end of one phase's GPU work.
+     *
+     * Phases must end in order; each phase spans from the previous
+     * stamp to its own.
+     *
+     * @param phase The phase just submitted.
+     */
+    void endPhase(Phase phase);
+
+    /**
+     * @brief Flips the query sets and harvests last frame's results.
+     *
+     * If the aged set has not completed on the GPU yet its values are
+     * skipped and the previous measurements stand — never a stall.
+     */
+    void endFrame();
+
+    /**
+     * @brief The most recent measured GPU time of one phase.
+     *
+     * @param phase The phase to read.
+     * @return float GPU milliseconds; zero until the first harvest.
+     */
+    float phaseMs(Phase phase) const { return resultsMs[phase]; }
+
+private:
+    unsigned int queries[2][PhaseCount + 1] = {}; ///< Timestamp queries: frame start plus one per phase, two sets.
+    float resultsMs[PhaseCount] = {}; ///< Last harvested phase durations.
+    int writeSet = 0; ///< The set this frame stamps into.
+    bool setWritten[2] = { false, false }; ///< Whether a set holds a full frame to harvest.
+    bool active = false; ///< Entry points resolved and queries created.
+};
@@ -0,0 +1,190 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Generational handle into a HandlePool.
+ *
+ * The slot names a fixed pool entry; the generation is bumped every
+ * time that slot is despawned, so a handle held across a despawn and a
+ * respawn of the same slot goes stale instead of silently pointing at
+ * the new entity. A handle is eight bytes and trivially copyable, so
+ * gameplay code can keep them in state blocks and events.
+ */
+struct PoolHandle {
+    std::uint32_t slot = 0xFFFFFFFFu; ///< Pool slot, stable for the entity's lifetime.
+    std::uint32_t generation = 0; ///< Slot generation the handle was issued under.
+
+    bool operator==(const PoolHandle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const PoolHandle& other) const { return !(*this == other); }
+};
+
+/// Handle that never resolves; the default-constructed value.
+constexpr PoolHandle invalidHandle{};
+
+/**
+ * @brief Generational slot map backing one archetype's entity arrays.
+ *
+ * The pool owns indexing only — the archetype keeps its data in the
+ * usual parallel arrays and mirrors the pool's dense order. Spawning
+ * pops a slot from an intrusive free list and appends a dense index;
+ * despawning swaps the vacated dense entry with the last one, so the
+ * dense range [0, size()) stays packed and iteration stays a contiguous
+ * walk with no alive-checks. Both operations are O(1), and after
+ * reserve() neither allocates, so a tick's worth of churn is bounded
+ * no matter how long the cabinet has been running.
+ *
+ * Coins predate this pool and keep their alive-bitmask scheme: their
+ * population is fixed per level and resurrect on reset, which a free
+ * list models poorly. New despawnable archetypes should start here.
+ */
+class HandlePool {
+public:
+    /**
+     * @brief Preallocates every internal array for @p capacity entities.
+     *
+     * Spawn and despawn are allocation-free up to this many live
+     * entities at once; spawning past it falls back to vector growth.
+     *
+     * @param capacity Maximum expected live entity count.
+     */
+    void reserve(std::size_t capacity)
+    {
+        slots.reserve(capacity);
+        denseSlot.reserve(capacity);
+    }
+
+    /**
+     * @brief Allocates a slot and appends a dense index.
+     *
+     * The new entity's data belongs at dense index size() - 1; the
+     * caller pushes onto its parallel arrays right after this call.
+     *
+     * @return PoolHandle Handle naming the new entity.
+     */
+    PoolHandle spawn()
+    {
+        std::uint32_t slot;
+        if (freeHead != 0xFFFFFFFFu)
+        {
+            slot = freeHead;
+            freeHead = slots[slot].denseOrNextFree;
+        }
+        else
+        {
+            slot = static_cast<std::uint32_t>(slots.size());
+            slots.push_back(Slot{});
+        }
+        slots[slot].denseOrNextFree = static_cast<std::uint32_t>(denseSlot.size());
+        denseSlot.push_back(slot);
+        return PoolHandle{ slot, slots[slot].generation };
+    }
+
+    /**
+     * @brief Frees a handle's slot and compacts the dense range.
+     *
+     * The last dense entry moves into the vacated dense index; the
+     * caller must mirror that move (swap-and-pop) in its parallel
+     * arrays. Stale handles are ignored, so double despawns are safe.
+     *
+     * @param handle The entity to despawn.
+     * @return std::size_t The vacated dense index the caller swaps the
+     * last array element into, or size() if the handle was stale.
+     */
+    std::size_t despawn(PoolHandle handle)
+    {
+        if (!alive(handle))
+            return denseSlot.size();
+
+        const std::uint32_t dense = slots[handle.slot].denseOrNextFree;
+        const std::uint32_t lastSlot = denseSlot.back();
+        denseSlot[dense] = lastSlot;
+        slots[lastSlot].denseOrNextFree = dense;
+        denseSlot.pop_back();
+
+        slots[handle.slot].generation++;
+        slots[handle.slot].denseOrNextFree = freeHead;
+        freeHead = handle.slot;
+        return dense;
+    }
+
+    /**
+     * @brief Tells whether a handle still names a live entity.
+     *
+     * @param handle The handle to test.
+     * @return true If the slot is live and the generation matches.
+     * @return false If the entity was despawned since the handle was issued.
+     */
+    bool alive(PoolHandle handle) const
+    {
+        return handle.slot < slots.size()
+            && slots[handle.slot].generation == handle.generation
+            && slots[handle.slot].denseOrNextFree < denseSlot.size()
+            && denseSlot[slots[handle.slot].denseOrNextFree] == handle.slot;
+    }
+
+    /**
+     * @brief Resolves a live handle to its current dense index.
+     *
+     * Valid only while the handle is alive; the index moves on other
+     * entities' despawns, so resolve per use rather than caching.
+     *
+     * @param handle A live handle.
+     * @return std::size_t Index into the archetype's parallel arrays.
+     */
+    std::size_t denseIndex(PoolHandle handle) const { return slots[handle.slot].denseOrNextFree; }
+
+    /**
+     * @brief Issues the handle of the entity at a dense index.
+     *
+     * @param dense Index into the dense range [0, size()).
+     * @return PoolHandle Handle of that entity.
+     */
+    PoolHandle handleAt(std::size_t dense) const
+    {
+        const std::uint32_t slot = denseSlot[dense];
+        return PoolHandle{ slot, slots[slot].generation };
+    }
+
+    /**
+     * @brief Number of live entities.
+     *
+     * @return std::size_t The packed dense count.
+     */
+    std::size_t size() const { return denseSlot.size(); }
+
+    /**
+     * @brief Despawns everything, invalidating every outstanding handle.
+     *
+     * Generations are kept, not reset, so handles from before the clear
+     * stay stale forever; slot storage is kept for reuse.
+     */
+    void clear()
+    {
+        for (std::size_t dense = denseSlot.size(); dense > 0; --dense)
+        {
+            const std::uint32_t slot = denseSlot[dense - 1];
+            slots[slot].generation++;
+            slots[slot].denseOrNextFree = freeHead;
+            freeHead = slot;
+        }
+        denseSlot.clear();
+    }
+
+private:
+    /**
+     * @brief One pool slot; meaning of the index field depends on state.
+     *
+     * While live it is the entity's dense index; while free it is the
+     * next free slot (0xFFFFFFFF ends the list).
+     */
+    struct Slot {
+        std::uint32_t denseOrNextFree = 0; ///< Dense index when live, next free slot when free.
+        std::uint32_t generation = 0; ///< Bumped on every despawn of this slot.
+    };
+
+    std::vector<Slot> slots; ///< All slots ever issued, live and free.
+    std::vector<std::uint32_t> denseSlot; ///< Dense index -> owning slot; the packed live set.
+    std::uint32_t freeHead = 0xFFFFFFFFu; ///< First slot of the intrusive free list.
+};
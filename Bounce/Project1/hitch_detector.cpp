@@ -0,0 +1,125 @@
+#include "hitch_detector.h"
+#include <algorithm>
+#include <cstdio>
+
+HitchDetector::~HitchDetector()
+{
+    if (worker.joinable())
+        worker.join();
+}
+
+/**
+ * @brief Configures the trigger.
+ *
+ * @param multiple Frames beyond median * multiple trigger a dump.
+ * @param floorUs Never trigger below this absolute duration.
+ */
+void HitchDetector::init(float multiple, sf::Int64 floorUs)
+{
+    thresholdMultiple = multiple;
+    thresholdFloorUs = floorUs;
+}
+
+/**
+ * @brief Records one frame; triggers a dump if it hitched.
+ *
+ * @param frameUs The whole frame's duration in microseconds.
+ * @param profiler The profiler to snapshot on a trigger.
+ * @param context Scene counts for the dump metadata.
+ * @return true If this frame triggered a dump.
+ */
+bool HitchDetector::frameCompleted(sf::Int64 frameUs, const FrameProfiler& profiler, const HitchContext& context)
+{
+    durations[cursor] = frameUs;
+    cursor = (cursor + 1) % ringSize;
+    if (filled < ringSize)
+        filled++;
+
+    if (--framesUntilRefresh <= 0)
+    {
+        refreshThreshold();
+        framesUntilRefresh = refreshInterval;
+    }
+    if (cooldown > 0)
+        --cooldown;
+
+    // The one comparison the steady path pays; thresholdUs stays 0
+    // (never triggering) until the ring has filled once
+    if (thresholdUs == 0 || frameUs <= thresholdUs || cooldown > 0)
+        return false;
+
+    dump(frameUs, profiler, context);
+    cooldown = cooldownFrames;
+    return true;
+}
+
+/**
+ * @brief Recomputes the cached threshold from the duration ring.
+ */
+void HitchDetector::refreshThreshold()
+{
+    if (filled < ringSize)
+        return;
+
+    sf::Int64 sorted[ringSize];
+    std::copy(durations, durations + filled, sorted);
+    sf::Int64* mid = sorted + filled / 2;
+    std::nth_element(sorted, mid, sorted + filled);
+    medianUs = *mid;
+    const sf::Int64 scaled = static_cast<sf::Int64>(static_cast<float>(medianUs) * thresholdMultiple);
+    thresholdUs = scaled > thresholdFloorUs ? scaled : thresholdFloorUs;
+}
+
+/**
+ * @brief Snapshots and hands the dump to the background writer.
+ */
+void HitchDetector::dump(sf::Int64 frameUs, const FrameProfiler& profiler, const HitchContext& context)
+{
+    if (writing.load(std::memory_order_acquire))
+        return;  // Previous dump still writing; the cooldown covers the gap
+
+    if (worker.joinable())
+        worker.join();
+
+    profiler.snapshot(snap);
+    writing.store(true, std::memory_order_release);
+
+    char path[64];
+    std::snprintf(path, sizeof(path), "bounce_hitch_%03d.json", dumpIndex++);
+    const std::string file = path;
+    const sf::Int64 median = medianUs;
+
+    worker = std::thread([this, file, frameUs, median, context]() {
+        std::FILE* out = std::fopen(file.c_str(), "wb");
+        if (out)
+        {
+            // Same complete-event layout the trace exporter writes, so
+            // the dump opens straight in chrome://tracing / Perfetto
+            std::fputs("{\"traceEvents\":[", out);
+            std::fprintf(out, "{\"name\":\"hitch\",\"ph\":\"i\",\"ts\":%lld,\"pid\":0,\"tid\":0,\"s\":\"g\","
+                              "\"args\":{\"frame_us\":%lld,\"median_us\":%lld,"
+                              "\"obstacles\":%u,\"coins\":%u,\"balls\":%u,\"ghosts\":%u,"
+                              "\"allocs\":%llu,\"violations\":%llu}}",
+                         static_cast<long long>(snap.frameCount > 0 ? snap.frameStart[snap.frameCount - 1] : 0),
+                         static_cast<long long>(frameUs), static_cast<long long>(median),
+                         context.obstacles, context.coins, context.balls, context.ghosts,
+                         static_cast<unsigned long long>(context.allocs),
+                         static_cast<unsigned long long>(context.violations));
+            for (std::size_t f = 0; f < snap.frameCount; ++f)
+            {
+                sf::Int64 ts = snap.frameStart[f];
+                for (int phase = 0; phase < FrameProfiler::PhaseCount; ++phase)
+                {
+                    std::fprintf(out, ",{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":0,\"tid\":0}",
+                                 FrameProfiler::phaseName(static_cast<FrameProfiler::Phase>(phase)),
+                                 static_cast<long long>(ts),
+                                 static_cast<long long>(snap.samples[phase][f]));
+                    ts += snap.samples[phase][f];
+                }
+            }
+            std::fputs("]}", out);
+            std::fclose(out);
+        }
+        writing.store(false, std::memory_order_release);
+    });
+}
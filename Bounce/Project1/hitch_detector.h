@@ -0,0 +1,92 @@
+#pragma once
+#include "frame_profiler.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Scene context captured alongside a hitch dump.
+ *
+ * Plain counts the render thread already has in hand; they go into the
+ * dump's metadata so a field stall can be correlated with what the
+ * scene was doing.
+ */
+struct HitchContext {
+    std::uint32_t obstacles = 0; ///< Obstacles in the snapshot.
+    std::uint32_t coins = 0; ///< Coin slots in the snapshot.
+    std::uint32_t balls = 0; ///< Party-mode balls live.
+    std::uint32_t ghosts = 0; ///< Ghosts racing.
+    std::uint64_t allocs = 0; ///< This thread's lifetime allocation count.
+    std::uint64_t violations = 0; ///< Hot-scope allocation violations so far.
+};
+
+/**
+ * @brief Catches intermittent stalls and dumps the evidence.
+ *
+ * The field bug nobody can reproduce: a 100ms frame once an hour. The
+ * detector keeps its own ring of whole-frame durations and a cached
+ * threshold — the rolling median times a multiple, refreshed by one
+ * nth_element every 240 frames — so the steady-state cost is storing
+ * the duration and one comparison. When a frame crosses the threshold
+ * it snapshots the profiler's window (plain stores) and a background
+ * thread writes the preceding two seconds of per-phase timings as
+ * chrome://tracing JSON, with a metadata event carrying the hitch
+ * frame's duration, the median it was judged against, allocation
+ * counters and entity counts. A cooldown keeps one bad minute from
+ * burying the disk; dumps are numbered so consecutive hitches coexist.
+ */
+class HitchDetector {
+public:
+    ~HitchDetector();
+
+    /**
+     * @brief Configures the trigger.
+     *
+     * @param multiple Frames beyond median * multiple trigger a dump.
+     * @param floorUs Never trigger below this absolute duration.
+     */
+    void init(float multiple = 4.0f, sf::Int64 floorUs = 25000);
+
+    /**
+     * @brief Records one frame; triggers a dump if it hitched.
+     *
+     * One ring store and one comparison on the steady path.
+     *
+     * @param frameUs The whole frame's duration in microseconds.
+     * @param profiler The profiler to snapshot on a trigger.
+     * @param context Scene counts for the dump metadata.
+     * @return true If this frame triggered a dump.
+     */
+    bool frameCompleted(sf::Int64 frameUs, const FrameProfiler& profiler, const HitchContext& context);
+
+private:
+    /**
+     * @brief Recomputes the cached threshold from the duration ring.
+     */
+    void refreshThreshold();
+
+    /**
+     * @brief Snapshots and hands the dump to the background writer.
+     */
+    void dump(sf::Int64 frameUs, const FrameProfiler& profiler, const HitchContext& context);
+
+    static const std::size_t ringSize = 240; ///< Frame durations kept; matches the profiler window.
+    static const int refreshInterval = 240; ///< Frames between threshold refreshes.
+    static const int cooldownFrames = 600; ///< Minimum frames between dumps.
+
+    sf::Int64 durations[ringSize] = {}; ///< Whole-frame durations in microseconds.
+    std::size_t cursor = 0; ///< Current ring slot.
+    std::size_t filled = 0; ///< Valid samples, up to ringSize.
+    sf::Int64 thresholdUs = 0; ///< Cached trigger level; 0 until the ring fills.
+    sf::Int64 medianUs = 0; ///< The median behind the threshold, for the dump.
+    float thresholdMultiple = 4.0f; ///< Hitch = median times this.
+    sf::Int64 thresholdFloorUs = 25000; ///< Absolute minimum trigger level.
+    int framesUntilRefresh = refreshInterval; ///< Countdown to the next refresh.
+    int cooldown = 0; ///< Frames left before another dump may fire.
+    int dumpIndex = 0; ///< Numbers the dump files.
+
+    ProfilerSnapshot snap; ///< The captured window; writer-owned while busy.
+    std::thread worker; ///< The background writer.
+    std::atomic<bool> writing{ false }; ///< Set while the writer owns the snapshot.
+};
@@ -0,0 +1,104 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstring>
+
+/**
+ * @brief Fixed-capacity HUD text lines with change detection.
+ *
+ * sf::Text::setString copies into an sf::String — a UTF-32 heap buffer
+ * — every call, so naively re-setting ten HUD lines at 60Hz is six
+ * hundred allocations a second for text that rarely changes. Each line
+ * here owns a preallocated char buffer the caller formats into in
+ * place (snprintf, std::to_chars), and commit() compares it against
+ * what the sf::Text already holds: unchanged lines do zero string
+ * work and re-render their cached glyph geometry, and only an actual
+ * change pays the one setString. The coin counter, the profiler
+ * report and future netplay/editor status lines all go through this.
+ */
+class HudTextSystem {
+public:
+    using LineId = std::size_t; ///< Index of a registered line.
+
+    static constexpr std::size_t maxLines = 10; ///< Registered lines supported.
+    static constexpr std::size_t lineCapacity = 1024; ///< Bytes per line buffer, multi-line reports included.
+
+    /**
+     * @brief Registers one line at a fixed HUD position.
+     *
+     * @param x HUD-space x of the line.
+     * @param y HUD-space y of the line.
+     * @param characterSize Text size in pixels.
+     * @return LineId The line's id for scratch()/commit()/text().
+     */
+    LineId addLine(float x, float y, unsigned int characterSize)
+    {
+        Line& line = lines[lineCount];
+        line.text.setCharacterSize(characterSize);
+        line.text.setFillColor(sf::Color::White);
+        line.text.setPosition(x, y);
+        line.pending[0] = '\0';
+        line.committed[0] = '\0';
+        return lineCount++;
+    }
+
+    /**
+     * @brief The line's format buffer; write a terminated string here.
+     *
+     * @param id The line.
+     * @return char* lineCapacity bytes of scratch.
+     */
+    char* scratch(LineId id) { return lines[id].pending; }
+
+    /**
+     * @brief Applies the scratch buffer if it changed.
+     *
+     * The comparison is the whole cost for an unchanged line; only a
+     * differing buffer touches sf::Text.
+     *
+     * @param id The line.
+     * @return true If the text changed and glyph geometry will rebuild.
+     * @return false If the line is unchanged.
+     */
+    bool commit(LineId id)
+    {
+        Line& line = lines[id];
+        if (std::strcmp(line.pending, line.committed) == 0)
+            return false;
+        std::strcpy(line.committed, line.pending);
+        line.text.setString(line.committed);
+        return true;
+    }
+
+    /**
+     * @brief Re-points every line at a font; call on load and reload.
+     *
+     * @param font The font to draw with.
+     */
+    void applyFont(const sf::Font& font)
+    {
+        for (std::size_t i = 0; i < lineCount; ++i)
+            lines[i].text.setFont(font);
+    }
+
+    /**
+     * @brief The line's drawable; push it into the render queue.
+     *
+     * @param id The line.
+     * @return const sf::Text& The text with its cached geometry.
+     */
+    const sf::Text& text(LineId id) const { return lines[id].text; }
+
+private:
+    /**
+     * @brief One registered line: its drawable and both buffers.
+     */
+    struct Line {
+        sf::Text text; ///< The drawable; holds the cached glyph geometry.
+        char pending[lineCapacity]; ///< The caller's format target.
+        char committed[lineCapacity]; ///< What the drawable currently shows.
+    };
+
+    Line lines[maxLines]; ///< Storage for every registered line.
+    std::size_t lineCount = 0; ///< Lines registered so far.
+};
@@ -0,0 +1,88 @@
+#pragma once
+#include "simulation.h"
+#include <SFML/Window/Keyboard.hpp>
+#include <cstdint>
+
+/**
+ * @brief One keyboard snapshot per tick, consumed as a bitmask.
+ *
+ * sf::Keyboard::isKeyPressed is an OS query per call; the tick loop
+ * used to issue several per tick plus an event-path restart check that
+ * read event.key.code for non-key events. The sampler queries each
+ * relevant key exactly once per tick into a bitmask; everything
+ * downstream — movement, edge-triggered restart, the replay recorder,
+ * the lockstep input word — reads the mask. The movement bits are laid
+ * out to match the replay and lockstep wire formats (left, right, up),
+ * so the snapshot IS the capture point.
+ */
+class InputSampler {
+public:
+    /**
+     * @brief The sampled keys; the first four are the wire bits.
+     */
+    enum Key : std::uint8_t {
+        KeyLeft = 0, ///< Move left. Wire bit 0.
+        KeyRight, ///< Move right. Wire bit 1.
+        KeyUp, ///< Jump. Wire bit 2.
+        KeyDown, ///< Drop through one-way platforms. Wire bit 3.
+        KeyRestart, ///< Restart the run; edge-triggered.
+        KeyCount ///< Number of sampled keys.
+    };
+
+    /**
+     * @brief Takes this tick's snapshot; one OS query per key.
+     */
+    void sample()
+    {
+        previousMask = mask;
+        mask = 0;
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
+            mask |= 1u << KeyLeft;
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+            mask |= 1u << KeyRight;
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
+            mask |= 1u << KeyUp;
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+            mask |= 1u << KeyDown;
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::R))
+            mask |= 1u << KeyRestart;
+    }
+
+    /**
+     * @brief Whether a key is down in this tick's snapshot.
+     *
+     * @param key The key.
+     * @return true If down.
+     */
+    bool isDown(Key key) const { return (mask & (1u << key)) != 0; }
+
+    /**
+     * @brief Whether a key went down this tick (edge).
+     *
+     * @param key The key.
+     * @return true If down now and up in the previous snapshot.
+     */
+    bool pressed(Key key) const
+    {
+        return (mask & ~previousMask & (1u << key)) != 0;
+    }
+
+    /**
+     * @brief The snapshot as the simulation's input.
+     *
+     * @return InputState The movement keys.
+     */
+    InputState movement() const
+    {
+        InputState input;
+        input.left = isDown(KeyLeft);
+        input.right = isDown(KeyRight);
+        input.up = isDown(KeyUp);
+        input.down = isDown(KeyDown);
+        return input;
+    }
+
+private:
+    std::uint8_t mask = 0; ///< This tick's key bits.
+    std::uint8_t previousMask = 0; ///< The previous tick's, for edges.
+};
@@ -0,0 +1,149 @@
+#include "job_system.h"
+#include "thread_control.h"
+#include <cstdio>
+
+/**
+ * @brief Starts the worker pool.
+ *
+ * @param threadCount Number of workers; 0 means hardware concurrency minus one.
+ */
+JobSystem::JobSystem(unsigned threadCount)
+{
+    if (threadCount == 0)
+    {
+        const unsigned cores = std::thread::hardware_concurrency();
+        threadCount = cores > 1 ? cores - 1 : 1;  // Leave a core for the game thread
+    }
+
+    queues.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i)
+        queues.push_back(std::make_unique<WorkerQueue>());
+
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i)
+        workers.emplace_back(&JobSystem::workerLoop, this, static_cast<std::size_t>(i));
+}
+
+/**
+ * @brief Drains and joins the workers.
+ */
+JobSystem::~JobSystem()
+{
+    running.store(false, std::memory_order_release);
+    sleepCv.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+/**
+ * @brief Submits one job against a counter.
+ *
+ * @param counter The counter the job completes against.
+ * @param fn The work to run.
+ */
+void JobSystem::run(Counter& counter, std::function<void()> fn)
+{
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t target = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[target]->mutex);
+        queues[target]->jobs.push_back({ std::move(fn), &counter });
+    }
+    queuedJobs.fetch_add(1, std::memory_order_release);
+    sleepCv.notify_one();
+}
+
+/**
+ * @brief Waits until every job on @p counter has finished.
+ *
+ * @param counter The counter to drain.
+ */
+void JobSystem::wait(Counter& counter)
+{
+    while (counter.pending.load(std::memory_order_acquire) > 0)
+    {
+        Job job;
+        if (tryPop(0, job))
+            execute(job);
+        else
+            std::this_thread::yield();  // Our jobs are in flight on workers; spin briefly
+    }
+}
+
+/**
+ * @brief Pops a job, preferring @p preferred 's own queue, then stealing.
+ *
+ * @param preferred Queue index to try first.
+ * @param out Receives the job.
+ * @return true If a job was popped.
+ * @return false If every queue was empty.
+ */
+bool JobSystem::tryPop(std::size_t preferred, Job& out)
+{
+    // Own queue: pop the back for cache-warm LIFO execution
+    {
+        WorkerQueue& own = *queues[preferred];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty())
+        {
+            out = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal from the front of the other queues, oldest job first
+    for (std::size_t offset = 1; offset < queues.size(); ++offset)
+    {
+        WorkerQueue& victim = *queues[(preferred + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            out = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Executes one job and completes its counter.
+ *
+ * @param job The job to run.
+ */
+void JobSystem::execute(Job& job)
+{
+    job.fn();
+    job.counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+/**
+ * @brief Worker thread body.
+ *
+ * @param index The worker's queue index.
+ */
+void JobSystem::workerLoop(std::size_t index)
+{
+    char name[16];
+    std::snprintf(name, sizeof(name), "job-%zu", index);
+    threadControl::registerCurrentThread(name);
+    while (running.load(std::memory_order_acquire))
+    {
+        Job job;
+        if (tryPop(index, job))
+        {
+            execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCv.wait(lock, [this]() {
+            return queuedJobs.load(std::memory_order_acquire) > 0
+                || !running.load(std::memory_order_acquire);
+        });
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+
+/**
+ * @brief Small work-stealing job system with a fixed thread pool.
+ *
+ * Each worker owns a deque: it pops its own jobs LIFO (hot caches) and
+ * steals from the front of other workers' deques when it runs dry.
+ * Submissions are distributed round-robin. Completion is tracked with
+ * Counter handles; a thread waiting on a counter executes jobs itself
+ * instead of blocking, so the pool never deadlocks on nested waits.
+ * parallelFor splits an index range into grain-sized jobs, which is how
+ * the simulation spreads the obstacle update and the coin sweep across
+ * cores on large community levels.
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Handle tracking a batch of outstanding jobs.
+     *
+     * Incremented on submit, decremented when a job finishes; wait()
+     * drains it to zero.
+     */
+    class Counter {
+        friend class JobSystem;
+        std::atomic<int> pending{ 0 }; ///< Jobs submitted but not yet finished.
+    };
+
+    /**
+     * @brief Starts the worker pool.
+     *
+     * @param threadCount Number of workers; 0 means hardware concurrency minus one.
+     */
+    explicit JobSystem(unsigned threadCount = 0);
+
+    /**
+     * @brief Drains and joins the workers.
+     */
+    ~JobSystem();
+
+    /**
+     * @brief Submits one job against a counter.
+     *
+     * @param counter The counter the job completes against.
+     * @param fn The work to run.
+     */
+    void run(Counter& counter, std::function<void()> fn);
+
+    /**
+     * @brief Waits until every job on @p counter has finished.
+     *
+     * The calling thread executes queued jobs while it waits rather than
+     * sleeping.
+     *
+     * @param counter The counter to drain.
+     */
+    void wait(Counter& counter);
+
+    /**
+     * @brief Runs fn(begin, end) over grain-sized slices of an index range.
+     *
+     * Slice boundaries fall on multiples of @p grain (except the last),
+     * which callers rely on for word-disjoint bitmask updates. Blocks
+     * until every slice has run; the calling thread works too.
+     *
+     * @param count Number of indices to cover.
+     * @param grain Maximum slice length.
+     * @param fn Invoked as fn(std::size_t begin, std::size_t end).
+     */
+    template <typename Fn>
+    void parallelFor(std::size_t count, std::size_t grain, Fn&& fn)
+    {
+        if (count == 0)
+            return;
+
+        Counter counter;
+        for (std::size_t begin = 0; begin < count; begin += grain)
+        {
+            const std::size_t end = std::min(begin + grain, count);
+            run(counter, [&fn, begin, end]() { fn(begin, end); });
+        }
+        wait(counter);
+    }
+
+    /**
+     * @brief Number of pool workers (excluding calling threads).
+     *
+     * @return unsigned The worker count.
+     */
+    unsigned workerCount() const { return static_cast<unsigned>(workers.size()); }
+
+private:
+    /**
+     * @brief One queued job and the counter it completes against.
+     */
+    struct Job {
+        std::function<void()> fn; ///< The work to run.
+        Counter* counter; ///< Decremented when the job finishes.
+    };
+
+    /**
+     * @brief One worker's deque; the owner pops the back, thieves the front.
+     */
+    struct WorkerQueue {
+        std::deque<Job> jobs; ///< Pending jobs.
+        std::mutex mutex; ///< Guards the deque.
+    };
+
+    /**
+     * @brief Pops a job, preferring @p preferred 's own queue, then stealing.
+     *
+     * @param preferred Queue index to try first.
+     * @param out Receives the job.
+     * @return true If a job was popped.
+     * @return false If every queue was empty.
+     */
+    bool tryPop(std::size_t preferred, Job& out);
+
+    /**
+     * @brief Executes one job and completes its counter.
+     *
+     * @param job The job to run.
+     */
+    void execute(Job& job);
+
+    /**
+     * @brief Worker thread body.
+     *
+     * @param index The worker's queue index.
+     */
+    void workerLoop(std::size_t index);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues; ///< One deque per worker.
+    std::vector<std::thread> workers; ///< The pool threads.
+    std::mutex sleepMutex; ///< Pairs with sleepCv for idle workers.
+    std::condition_variable sleepCv; ///< Wakes workers on submission and shutdown.
+    std::atomic<int> queuedJobs{ 0 }; ///< Jobs sitting in queues; lets idle workers sleep.
+    std::atomic<bool> running{ true }; ///< Cleared on shutdown.
+    std::atomic<std::size_t> nextQueue{ 0 }; ///< Round-robin submission cursor.
+};
@@ -0,0 +1,135 @@
+#include "leaderboard.h"
+#include <cstdio>
+
+LeaderboardClient::~LeaderboardClient()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        running = false;
+    }
+    queueCv.notify_all();
+    if (worker.joinable())
+        worker.join();  // At most one request timeout away
+}
+
+/**
+ * @brief Starts the worker pointed at the leaderboard server.
+ *
+ * @param host The server host.
+ * @param port The server port.
+ */
+void LeaderboardClient::init(const std::string& host, unsigned short port)
+{
+    http.setHost(host, port);
+    running = true;
+    worker = std::thread(&LeaderboardClient::run, this);
+}
+
+/**
+ * @brief Queues a best-time post; returns immediately.
+ *
+ * @param level The level name.
+ * @param coinTimeSeconds The run's coin time.
+ * @param player The player tag.
+ * @param callback Optional completion callback.
+ * @return std::uint32_t The request id, echoed in the result.
+ */
+std::uint32_t LeaderboardClient::postScore(const std::string& level, float coinTimeSeconds,
+                                           const std::string& player, Callback callback)
+{
+    char body[160];
+    std::snprintf(body, sizeof(body), "level=%s&time=%.3f&player=%s",
+                  level.c_str(), coinTimeSeconds, player.c_str());
+
+    sf::Http::Request request("/scores", sf::Http::Request::Post, body);
+    request.setField("Content-Type", "application/x-www-form-urlencoded");
+    return enqueue(std::move(request), std::move(callback));
+}
+
+/**
+ * @brief Queues a top-times fetch; returns immediately.
+ *
+ * @param level The level name.
+ * @param callback Receives the listing body.
+ * @return std::uint32_t The request id, echoed in the result.
+ */
+std::uint32_t LeaderboardClient::fetchTop(const std::string& level, Callback callback)
+{
+    sf::Http::Request request("/scores?level=" + level, sf::Http::Request::Get);
+    return enqueue(std::move(request), std::move(callback));
+}
+
+/**
+ * @brief Enqueues a prepared request and wakes the worker.
+ */
+std::uint32_t LeaderboardClient::enqueue(sf::Http::Request&& request, Callback&& callback)
+{
+    const std::uint32_t id = nextId++;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push_back(Pending{ id, std::move(request), maxAttempts, std::move(callback) });
+    }
+    queueCv.notify_one();
+    return id;
+}
+
+/**
+ * @brief Delivers every finished request's callback; call at a tick
+ * boundary.
+ */
+void LeaderboardClient::dispatch()
+{
+    std::vector<std::pair<LeaderboardResult, Callback>> ready;
+    {
+        std::lock_guard<std::mutex> lock(completedMutex);
+        ready.swap(completed);  // One short lock; callbacks run unlocked
+    }
+    for (auto& entry : ready)
+    {
+        if (entry.second)
+            entry.second(entry.first);
+    }
+}
+
+/**
+ * @brief Worker body: send, classify, requeue or complete.
+ */
+void LeaderboardClient::run()
+{
+    for (;;)
+    {
+        Pending pending;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCv.wait(lock, [this] { return !queue.empty() || !running; });
+            if (!running)
+                return;
+            pending = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        // The timeout bounds what a hung server can cost this request;
+        // the same client is reused so the host resolves only once
+        const sf::Http::Response response = http.sendRequest(pending.request, sf::seconds(5.0f));
+        const int status = static_cast<int>(response.getStatus());
+        const bool succeeded = status >= 200 && status < 300;
+        const bool retryable = status >= 500 || response.getStatus() == sf::Http::Response::ConnectionFailed;
+
+        if (!succeeded && retryable && --pending.attemptsLeft > 0)
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            queue.push_back(std::move(pending));  // Behind newer requests
+            continue;
+        }
+
+        LeaderboardResult result;
+        result.requestId = pending.id;
+        result.ok = succeeded;
+        result.status = response.getStatus() == sf::Http::Response::ConnectionFailed ? 0 : status;
+        result.body = response.getBody();
+        {
+            std::lock_guard<std::mutex> lock(completedMutex);
+            completed.emplace_back(std::move(result), std::move(pending.callback));
+        }
+    }
+}
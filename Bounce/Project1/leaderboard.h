@@ -0,0 +1,115 @@
+#pragma once
+#include <SFML/Network/Http.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief One finished leaderboard request, delivered by dispatch().
+ */
+struct LeaderboardResult {
+    std::uint32_t requestId = 0; ///< The id postScore()/fetchTop() returned.
+    bool ok = false; ///< True on a 2xx response.
+    int status = 0; ///< The HTTP status, or 0 if the server never answered.
+    std::string body; ///< The response body; the top-times listing for fetches.
+};
+
+/**
+ * @brief Async cabinet leaderboard client over sf::Http.
+ *
+ * sf::Http::sendRequest blocks for the full round trip, so every
+ * request here runs on one background worker instead: the tick thread
+ * enqueues under a short lock and returns immediately, the worker
+ * drains the queue against a single sf::Http instance (host resolved
+ * once, requests back to back on the same client), and finished
+ * results queue up for dispatch() — called at a tick boundary — which
+ * invokes the request's callback on the tick thread. No handler ever
+ * runs off-thread and nothing on the tick thread waits on a socket: a
+ * hung server stalls the worker inside its bounded request timeout,
+ * never the loop.
+ *
+ * Posts are fire-and-forget with bounded retry: connection failures
+ * and 5xx responses requeue the request up to maxAttempts times, then
+ * the result is delivered as failed. Callbacks are optional; a post
+ * with no callback just disappears into the retry machinery.
+ */
+class LeaderboardClient {
+public:
+    /** @brief Invoked by dispatch() on the tick thread. */
+    using Callback = std::function<void(const LeaderboardResult&)>;
+
+    ~LeaderboardClient();
+
+    /**
+     * @brief Starts the worker pointed at the leaderboard server.
+     *
+     * @param host The server host.
+     * @param port The server port.
+     */
+    void init(const std::string& host, unsigned short port = 80);
+
+    /**
+     * @brief Queues a best-time post; returns immediately.
+     *
+     * @param level The level name.
+     * @param coinTimeSeconds The run's coin time.
+     * @param player The player tag.
+     * @param callback Optional completion callback.
+     * @return std::uint32_t The request id, echoed in the result.
+     */
+    std::uint32_t postScore(const std::string& level, float coinTimeSeconds,
+                            const std::string& player, Callback callback = {});
+
+    /**
+     * @brief Queues a top-times fetch; returns immediately.
+     *
+     * @param level The level name.
+     * @param callback Receives the listing body.
+     * @return std::uint32_t The request id, echoed in the result.
+     */
+    std::uint32_t fetchTop(const std::string& level, Callback callback);
+
+    /**
+     * @brief Delivers every finished request's callback; call at a
+     * tick boundary. Never blocks on the network.
+     */
+    void dispatch();
+
+private:
+    /**
+     * @brief One queued request and its remaining retry budget.
+     */
+    struct Pending {
+        std::uint32_t id = 0; ///< Echoed in the result.
+        sf::Http::Request request; ///< The prepared HTTP request.
+        int attemptsLeft = 0; ///< Requeues remaining before failing out.
+        Callback callback; ///< Delivered by dispatch(); may be empty.
+    };
+
+    /**
+     * @brief Enqueues a prepared request and wakes the worker.
+     */
+    std::uint32_t enqueue(sf::Http::Request&& request, Callback&& callback);
+
+    /**
+     * @brief Worker body: send, classify, requeue or complete.
+     */
+    void run();
+
+    static constexpr int maxAttempts = 3; ///< Tries per request before failing out.
+
+    sf::Http http; ///< The worker's client; host resolved once in init().
+    std::thread worker; ///< The background sender.
+    std::mutex queueMutex; ///< Guards the queue and the running flag handoff.
+    std::condition_variable queueCv; ///< Wakes the worker on enqueue and shutdown.
+    std::deque<Pending> queue; ///< Requests waiting to be sent.
+    std::mutex completedMutex; ///< Guards the completed list.
+    std::vector<std::pair<LeaderboardResult, Callback>> completed; ///< Awaiting dispatch().
+    std::uint32_t nextId = 1; ///< Request id source; tick thread only.
+    bool running = false; ///< Cleared under queueMutex on shutdown.
+};
@@ -0,0 +1,94 @@
+#include "level_bake.h"
+
+/**
+ * @brief Uploads the packed static geometry to the GPU.
+ *
+ * @param staticGeometry All static triangles, packed once at load.
+ */
+void StaticLevelBake::bake(const sf::VertexArray& staticGeometry)
+{
+    const std::size_t count = staticGeometry.getVertexCount();
+
+    if (sf::VertexBuffer::isAvailable() && count > 0)
+    {
+        buffer.setPrimitiveType(staticGeometry.getPrimitiveType());
+        buffer.setUsage(sf::VertexBuffer::Static);
+        if (buffer.create(count) && buffer.update(&staticGeometry[0]))
+        {
+            useBuffer = true;
+            return;
+        }
+    }
+
+    // No vertex buffer support: keep the packed array and draw it directly
+    fallback = staticGeometry;
+    useBuffer = false;
+}
+
+/**
+ * @brief Creates an editable bake with room for @p quadCapacity quads.
+ *
+ * @param quadCapacity Maximum quads the bake can hold.
+ * @return true If the buffer (or the fallback) is ready.
+ */
+bool StaticLevelBake::bakeEditable(std::size_t quadCapacity)
+{
+    const std::size_t count = quadCapacity * 6;
+    fallback.setPrimitiveType(sf::Triangles);
+    fallback.resize(count);  // Default vertices are degenerate at the origin
+
+    useBuffer = false;
+    if (sf::VertexBuffer::isAvailable() && count > 0)
+    {
+        buffer.setPrimitiveType(sf::Triangles);
+        buffer.setUsage(sf::VertexBuffer::Dynamic);
+        if (buffer.create(count) && buffer.update(&fallback[0]))
+            useBuffer = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Rewrites one quad in place.
+ *
+ * @param slot Quad slot below the bakeEditable capacity.
+ * @param x Left edge of the quad.
+ * @param y Top edge of the quad.
+ * @param w Width of the quad.
+ * @param h Height of the quad.
+ * @param color Fill color.
+ */
+void StaticLevelBake::setQuad(std::size_t slot, float x, float y, float w, float h, const sf::Color& color)
+{
+    const std::size_t base = slot * 6;
+    if (base + 6 > fallback.getVertexCount())
+        return;
+
+    const sf::Vector2f topLeft(x, y);
+    const sf::Vector2f topRight(x + w, y);
+    const sf::Vector2f bottomLeft(x, y + h);
+    const sf::Vector2f bottomRight(x + w, y + h);
+
+    fallback[base + 0] = sf::Vertex(topLeft, color);
+    fallback[base + 1] = sf::Vertex(topRight, color);
+    fallback[base + 2] = sf::Vertex(bottomRight, color);
+    fallback[base + 3] = sf::Vertex(topLeft, color);
+    fallback[base + 4] = sf::Vertex(bottomRight, color);
+    fallback[base + 5] = sf::Vertex(bottomLeft, color);
+
+    if (useBuffer)
+        buffer.update(&fallback[base], 6, static_cast<unsigned int>(base));
+}
+
+/**
+ * @brief Draws the baked geometry in one call.
+ *
+ * @param target The render target to draw to.
+ */
+void StaticLevelBake::draw(sf::RenderTarget& target) const
+{
+    if (useBuffer)
+        target.draw(buffer);
+    else
+        target.draw(fallback);
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @brief GPU-resident bake of the static level geometry.
+ *
+ * Platforms, walls, the floor and the goal never change after load, so
+ * their quads are packed once into an sf::VertexBuffer with Static usage
+ * and drawn with a single call per frame. Only the dynamic entities
+ * (player, obstacles, coins) still go through the per-frame batch. On
+ * targets without vertex buffer support the bake falls back to a kept
+ * sf::VertexArray, which still avoids per-frame re-packing.
+ */
+class StaticLevelBake {
+public:
+    /**
+     * @brief Uploads the packed static geometry to the GPU.
+     *
+     * @param staticGeometry All static triangles, packed once at load.
+     */
+    void bake(const sf::VertexArray& staticGeometry);
+
+    /**
+     * @brief Creates an editable bake with room for @p quadCapacity quads.
+     *
+     * The editor's variant: a Dynamic-usage buffer whose quads are
+     * rewritten individually with setQuad, so moving one entity never
+     * re-uploads the level. Unused slots are degenerate (zero-area)
+     * quads the GPU discards for free. A CPU mirror is kept for the
+     * no-vertex-buffer fallback and as the update staging area.
+     *
+     * @param quadCapacity Maximum quads the bake can hold.
+     * @return true If the buffer (or the fallback) is ready.
+     */
+    bool bakeEditable(std::size_t quadCapacity);
+
+    /**
+     * @brief Rewrites one quad in place.
+     *
+     * One six-vertex write to the mirror and, when the GPU buffer is
+     * live, one sub-range upload at the quad's offset — the whole cost
+     * of moving or recoloring an entity.
+     *
+     * @param slot Quad slot below the bakeEditable capacity.
+     * @param x Left edge of the quad.
+     * @param y Top edge of the quad.
+     * @param w Width of the quad.
+     * @param h Height of the quad.
+     * @param color Fill color.
+     */
+    void setQuad(std::size_t slot, float x, float y, float w, float h, const sf::Color& color);
+
+    /**
+     * @brief Collapses one quad to nothing.
+     *
+     * @param slot Quad slot to clear.
+     */
+    void clearQuad(std::size_t slot) { setQuad(slot, 0.0f, 0.0f, 0.0f, 0.0f, sf::Color::Transparent); }
+
+    /**
+     * @brief Draws the baked geometry in one call.
+     *
+     * @param target The render target to draw to.
+     */
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    sf::VertexBuffer buffer; ///< GPU-resident vertex storage (Static usage; Dynamic when editable).
+    sf::VertexArray fallback; ///< CPU-side mirror; drawn directly when vertex buffers are unavailable.
+    bool useBuffer = false; ///< Whether the GPU buffer was successfully created.
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief On-disk layout of the binary level format.
+ *
+ * A level file is a header followed by plain arrays of fixed-size POD
+ * records (platforms, walls, obstacles, coin positions), so loading is a
+ * handful of bulk reads with zero per-entity parsing, and level edits no
+ * longer require recompiling the hardcoded tables that used to live in
+ * main(). This format is also the basis for the level streaming and
+ * campaign work.
+ */
+namespace level {
+
+constexpr std::uint32_t levelVersion = 1; ///< Bumped on any layout change.
+
+/**
+ * @brief One axis-aligned rectangle record.
+ */
+struct RectRecord {
+    float x; ///< Left edge.
+    float y; ///< Top edge.
+    float w; ///< Width.
+    float h; ///< Height.
+};
+
+/**
+ * @brief One moving-obstacle record.
+ */
+struct ObstacleRecord {
+    float x; ///< Left edge of the starting position.
+    float y; ///< Top edge of the starting position.
+    float w; ///< Width.
+    float h; ///< Height.
+    float leftLimit; ///< Left boundary of the patrol movement.
+    float rightLimit; ///< Right boundary of the patrol movement.
+};
+
+/**
+ * @brief One coin-position record.
+ */
+struct CoinRecord {
+    float x; ///< X-coordinate of the coin.
+    float y; ///< Y-coordinate of the coin.
+};
+
+/**
+ * @brief Fixed header at the start of every level file.
+ */
+struct Header {
+    char magic[4]; ///< "BLVL".
+    std::uint32_t version; ///< Must equal levelVersion.
+    std::uint32_t platformCount; ///< Number of platform records (floor not included).
+    std::uint32_t wallCount; ///< Number of wall records.
+    std::uint32_t obstacleCount; ///< Number of obstacle records.
+    std::uint32_t coinCount; ///< Number of coin records.
+    RectRecord floor; ///< The floor spanning the level.
+    RectRecord goal; ///< The goal platform.
+};
+
+constexpr std::uint32_t broadphaseBakeVersion = 1; ///< Bumped on any baked-index layout change.
+constexpr float bakedChunkWidth = 1024.0f; ///< Chunk width the packer bins at; matches ChunkStream's default.
+
+/**
+ * @brief Optional baked broadphase section after the record arrays.
+ *
+ * The chunk stream's per-chunk index lists are identical on every
+ * machine for a given level, so the packer bakes them into the file in
+ * their runtime layout: this header, then four uint32 tables —
+ * platform starts (chunkCount + 1), wall starts (chunkCount + 1),
+ * platform entries, wall entries. A mapped level adopts the tables in
+ * place with zero build work. The section is advisory: a file without
+ * it (or with a version, width or checksum mismatch) just takes the
+ * runtime build, so old files and old builds keep working unchanged.
+ */
+struct BroadphaseBakeHeader {
+    char magic[4]; ///< "BBPH".
+    std::uint32_t version; ///< Must equal broadphaseBakeVersion.
+    std::uint32_t chunkCount; ///< Chunks the tables cover.
+    float chunkWidth; ///< Chunk width the tables were binned at.
+    std::uint32_t platformEntryCount; ///< Entries in the platform index table.
+    std::uint32_t wallEntryCount; ///< Entries in the wall index table.
+    std::uint32_t checksum; ///< FNV-1a over the four tables.
+};
+
+} // namespace level
@@ -0,0 +1,246 @@
+#include "level_gen.h"
+#include <algorithm>
+
+/**
+ * @brief splitmix64 step; the per-chunk random source.
+ *
+ * @param state The generator state, advanced in place.
+ * @return std::uint64_t The next 64 random bits.
+ */
+static std::uint64_t nextRandom(std::uint64_t& state)
+{
+    state += 0x9E3779B97F4A7C15ull;
+    std::uint64_t z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief A random float in [lo, hi) from the chunk's source.
+ *
+ * @param state The generator state.
+ * @param lo Inclusive lower bound.
+ * @param hi Exclusive upper bound.
+ * @return float The value.
+ */
+static float randomRange(std::uint64_t& state, float lo, float hi)
+{
+    // 24 mantissa bits of uniformity is plenty for level layout
+    const float unit = static_cast<float>(nextRandom(state) >> 40) * (1.0f / 16777216.0f);
+    return lo + unit * (hi - lo);
+}
+
+/**
+ * @brief Seeds the generator.
+ *
+ * @param seed The level seed; same seed, same level.
+ * @param chunkWidth Width of one chunk in pixels.
+ */
+void LevelGenerator::init(std::uint64_t seed, float chunkWidth)
+{
+    levelSeed = seed;
+    width = chunkWidth;
+}
+
+/**
+ * @brief Generates one chunk's records into @p out.
+ *
+ * @param chunkIndex Chunk position along the level.
+ * @param out Receives the records; cleared first, capacity kept.
+ */
+void LevelGenerator::materialize(int chunkIndex, GeneratedChunk& out) const
+{
+    out.clear();
+    out.index = chunkIndex;
+
+    // The chunk's entire content comes from state hashed out of
+    // (seed, index), so materialization order can never matter
+    std::uint64_t state = levelSeed ^ (static_cast<std::uint64_t>(chunkIndex) * 0xD6E8FEB86659FD93ull);
+    nextRandom(state);  // One warm-up step decorrelates nearby indices
+
+    const float left = static_cast<float>(chunkIndex) * width;
+
+    // Chunk zero stays sparse: coins only, so the spawn area at
+    // (400, 300) is never generated into a wall or an obstacle
+    const bool spawnChunk = chunkIndex == 0;
+
+    const int platformCount = spawnChunk ? 2 : 3 + static_cast<int>(nextRandom(state) % 3);
+    for (int i = 0; i < platformCount; ++i)
+    {
+        level::RectRecord platform;
+        platform.w = randomRange(state, 120.0f, 260.0f);
+        platform.h = 20.0f;
+        // Spread platforms across the chunk so each is reachable from
+        // the floor or a neighbor; heights match the shipped tables
+        platform.x = left + (static_cast<float>(i) + randomRange(state, 0.1f, 0.7f)) * (width / static_cast<float>(platformCount));
+        platform.y = randomRange(state, 280.0f, 560.0f);
+        out.platforms.push_back(platform);
+
+        // Coins sit above platforms, where the shipped level puts them
+        const int coinCount = 1 + static_cast<int>(nextRandom(state) % 3);
+        for (int c = 0; c < coinCount; ++c)
+        {
+            level::CoinRecord coin;
+            coin.x = platform.x + randomRange(state, 0.1f, 0.9f) * platform.w - 10.0f;
+            coin.y = platform.y - randomRange(state, 50.0f, 90.0f);
+            out.coins.push_back(coin);
+        }
+    }
+
+    if (!spawnChunk)
+    {
+        const int wallCount = static_cast<int>(nextRandom(state) % 3);  // 0..2
+        for (int i = 0; i < wallCount; ++i)
+        {
+            level::RectRecord wall;
+            wall.w = 20.0f;
+            wall.h = randomRange(state, 150.0f, 250.0f);
+            wall.x = left + randomRange(state, 0.15f, 0.85f) * width;
+            wall.y = 580.0f - wall.h;  // Standing on the floor
+            out.walls.push_back(wall);
+        }
+
+        const int obstacleCount = static_cast<int>(nextRandom(state) % 3);  // 0..2
+        for (int i = 0; i < obstacleCount; ++i)
+        {
+            level::ObstacleRecord obstacle;
+            obstacle.w = 50.0f;
+            obstacle.h = 50.0f;
+            obstacle.y = 530.0f;  // Patrolling the floor, like the shipped ones
+            obstacle.x = left + randomRange(state, 0.2f, 0.8f) * width;
+            const float reach = randomRange(state, 150.0f, 300.0f);
+            obstacle.leftLimit = obstacle.x - reach;
+            obstacle.rightLimit = obstacle.x + reach;
+            out.obstacles.push_back(obstacle);
+        }
+    }
+}
+
+/**
+ * @brief Takes a cleared chunk buffer, reusing a released one.
+ *
+ * @return GeneratedChunk* A buffer owned by the pool.
+ */
+GeneratedChunk* ChunkPool::acquire()
+{
+    if (!free.empty())
+    {
+        GeneratedChunk* chunk = free.back();
+        free.pop_back();
+        return chunk;
+    }
+    storage.push_back(std::make_unique<GeneratedChunk>());
+    return storage.back().get();
+}
+
+/**
+ * @brief Returns a buffer for reuse.
+ *
+ * @param chunk A buffer previously acquired from this pool.
+ */
+void ChunkPool::release(GeneratedChunk* chunk)
+{
+    free.push_back(chunk);
+}
+
+/**
+ * @brief Seeds the stream and sets the live window shape.
+ *
+ * @param seed The level seed.
+ * @param chunkWidth Width of one chunk in pixels.
+ * @param ahead Chunks kept materialized ahead of the camera.
+ * @param behind Chunks kept materialized behind the camera.
+ */
+void EndlessStream::init(std::uint64_t seed, float chunkWidth, int ahead_, int behind_)
+{
+    generator.init(seed, chunkWidth);
+    ahead = ahead_;
+    behind = behind_;
+    for (GeneratedChunk* chunk : liveChunks)
+        pool.release(chunk);
+    liveChunks.clear();
+}
+
+/**
+ * @brief Advances the window toward the camera.
+ *
+ * @param cameraX Camera center x in world space.
+ * @return true If a chunk was materialized this call.
+ */
+bool EndlessStream::update(float cameraX)
+{
+    const int cameraChunk = static_cast<int>(cameraX / generator.chunkWidth());
+    const int wantFirst = std::max(cameraChunk - behind, 0);
+    const int wantLast = cameraChunk + ahead;
+
+    // Evict behind (and ahead, after a backward jump): releases are
+    // pointer pushes, so clearing the stale edge is trivial
+    std::size_t keep = 0;
+    for (GeneratedChunk* chunk : liveChunks)
+    {
+        if (chunk->index >= wantFirst && chunk->index <= wantLast)
+            liveChunks[keep++] = chunk;
+        else
+            pool.release(chunk);
+    }
+    liveChunks.resize(keep);
+
+    // Materialize at most one missing chunk per call — the per-tick
+    // generation budget; the ahead margin hides the ramp-up
+    for (int index = wantFirst; index <= wantLast; ++index)
+    {
+        bool present = false;
+        for (const GeneratedChunk* chunk : liveChunks)
+        {
+            if (chunk->index == index)
+            {
+                present = true;
+                break;
+            }
+        }
+        if (present)
+            continue;
+
+        GeneratedChunk* chunk = pool.acquire();
+        generator.materialize(index, *chunk);
+        liveChunks.insert(std::upper_bound(liveChunks.begin(), liveChunks.end(), chunk,
+                                           [](const GeneratedChunk* a, const GeneratedChunk* b) { return a->index < b->index; }),
+                          chunk);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Assembles a finite level from @p chunkCount generated chunks.
+ *
+ * @param seed The level seed.
+ * @param chunkCount Chunks to generate.
+ * @return LevelData The assembled level.
+ */
+LevelData generateLevel(std::uint64_t seed, int chunkCount)
+{
+    LevelGenerator generator;
+    generator.init(seed);
+
+    LevelData level;
+    const float span = static_cast<float>(chunkCount) * generator.chunkWidth();
+    level.floor = { 0.0f, 580.0f, span, 20.0f };
+    level.goal = { span - 300.0f, 250.0f, 100.0f, 20.0f };
+
+    ChunkPool pool;
+    GeneratedChunk* chunk = pool.acquire();
+    for (int index = 0; index < chunkCount; ++index)
+    {
+        generator.materialize(index, *chunk);
+        level.platforms.insert(level.platforms.end(), chunk->platforms.begin(), chunk->platforms.end());
+        level.walls.insert(level.walls.end(), chunk->walls.begin(), chunk->walls.end());
+        level.obstacles.insert(level.obstacles.end(), chunk->obstacles.begin(), chunk->obstacles.end());
+        level.coins.insert(level.coins.end(), chunk->coins.begin(), chunk->coins.end());
+    }
+    // A reachable perch under the goal, whatever the last chunk rolled
+    level.platforms.push_back({ span - 400.0f, 400.0f, 200.0f, 20.0f });
+    pool.release(chunk);
+    return level;
+}
@@ -0,0 +1,168 @@
+#pragma once
+#include "level_loader.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief One materialized chunk of generated level geometry.
+ *
+ * The generator writes the existing binary-format records, so
+ * everything downstream — the chunk stream, the entity store, the
+ * render bake — consumes generated chunks exactly like loaded ones.
+ * Buffers keep their capacity across reuse through the pool.
+ */
+struct GeneratedChunk {
+    int index = 0; ///< Chunk position along the level.
+    std::vector<level::RectRecord> platforms; ///< Platforms in this chunk.
+    std::vector<level::RectRecord> walls; ///< Walls in this chunk.
+    std::vector<level::ObstacleRecord> obstacles; ///< Patrolling obstacles in this chunk.
+    std::vector<level::CoinRecord> coins; ///< Coins in this chunk.
+
+    /**
+     * @brief Empties the record vectors; their capacity remains.
+     */
+    void clear()
+    {
+        platforms.clear();
+        walls.clear();
+        obstacles.clear();
+        coins.clear();
+    }
+};
+
+/**
+ * @brief Seeded procedural chunk generator.
+ *
+ * Each chunk's content is a pure function of (seed, chunk index): the
+ * per-chunk generator state is hashed from both, so chunks can
+ * materialize in any order — lazily ahead of the camera, or all at
+ * once for a finite level — and always come out identical. That is
+ * what makes daily-challenge seeds, replays and ghost runs line up:
+ * the same seed is the same level, bit for bit.
+ */
+class LevelGenerator {
+public:
+    /**
+     * @brief Seeds the generator.
+     *
+     * @param seed The level seed; same seed, same level.
+     * @param chunkWidth Width of one chunk in pixels.
+     */
+    void init(std::uint64_t seed, float chunkWidth = 1024.0f);
+
+    /**
+     * @brief Generates one chunk's records into @p out.
+     *
+     * Independent of any other chunk and of materialization order. A
+     * chunk is a handful of records — single-digit microseconds — so
+     * one materialization fits comfortably inside a tick's budget.
+     *
+     * @param chunkIndex Chunk position along the level; chunk zero
+     * stays sparse so the spawn area is safe.
+     * @param out Receives the records; cleared first, capacity kept.
+     */
+    void materialize(int chunkIndex, GeneratedChunk& out) const;
+
+    /**
+     * @brief Width of one chunk in pixels.
+     *
+     * @return float The chunk width passed to init.
+     */
+    float chunkWidth() const { return width; }
+
+private:
+    std::uint64_t levelSeed = 0; ///< The level seed.
+    float width = 1024.0f; ///< Chunk width in pixels.
+};
+
+/**
+ * @brief Recycles chunk buffers so steady-state generation allocates
+ * nothing.
+ *
+ * Evicted chunks return their buffers here and the next
+ * materialization takes one back, capacity intact; the pool only
+ * allocates while growing toward the window size.
+ */
+class ChunkPool {
+public:
+    /**
+     * @brief Takes a cleared chunk buffer, reusing a released one.
+     *
+     * @return GeneratedChunk* A buffer owned by the pool.
+     */
+    GeneratedChunk* acquire();
+
+    /**
+     * @brief Returns a buffer for reuse.
+     *
+     * @param chunk A buffer previously acquired from this pool.
+     */
+    void release(GeneratedChunk* chunk);
+
+private:
+    std::vector<std::unique_ptr<GeneratedChunk>> storage; ///< Every buffer ever made.
+    std::vector<GeneratedChunk*> free; ///< Buffers awaiting reuse.
+};
+
+/**
+ * @brief Keeps a window of generated chunks live around the camera.
+ *
+ * Endless mode's frontier: each update materializes at most one
+ * missing chunk of the wanted window (the generation budget — a chunk
+ * per tick, a few microseconds) and releases chunks fallen behind the
+ * player back to the pool. Because chunks are order-independent,
+ * catching up after a savestate rewind or a camera jump regenerates
+ * exactly what was there before.
+ */
+class EndlessStream {
+public:
+    /**
+     * @brief Seeds the stream and sets the live window shape.
+     *
+     * @param seed The level seed.
+     * @param chunkWidth Width of one chunk in pixels.
+     * @param ahead Chunks kept materialized ahead of the camera.
+     * @param behind Chunks kept materialized behind the camera.
+     */
+    void init(std::uint64_t seed, float chunkWidth = 1024.0f, int ahead = 3, int behind = 1);
+
+    /**
+     * @brief Advances the window toward the camera.
+     *
+     * Evicts chunks outside the wanted window and materializes at most
+     * one missing chunk per call.
+     *
+     * @param cameraX Camera center x in world space.
+     * @return true If a chunk was materialized this call.
+     */
+    bool update(float cameraX);
+
+    /**
+     * @brief Live chunks, ascending by index.
+     *
+     * @return const std::vector<GeneratedChunk*>& The materialized window.
+     */
+    const std::vector<GeneratedChunk*>& live() const { return liveChunks; }
+
+private:
+    LevelGenerator generator; ///< The seeded per-chunk generator.
+    ChunkPool pool; ///< Buffer recycling for evicted chunks.
+    std::vector<GeneratedChunk*> liveChunks; ///< Materialized chunks, ascending.
+    int ahead = 3; ///< Window reach ahead of the camera.
+    int behind = 1; ///< Window reach behind the camera.
+};
+
+/**
+ * @brief Assembles a finite level from @p chunkCount generated chunks.
+ *
+ * The bridge into everything that exists today: the result is a plain
+ * LevelData — floor spanning the span, goal at the end — that
+ * sim.init, the chunk stream, the campaign and the replay/ghost
+ * systems consume unchanged. Deterministic from the seed.
+ *
+ * @param seed The level seed.
+ * @param chunkCount Chunks to generate.
+ * @return LevelData The assembled level.
+ */
+LevelData generateLevel(std::uint64_t seed, int chunkCount);
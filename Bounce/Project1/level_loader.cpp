@@ -0,0 +1,279 @@
+#include "level_loader.h"
+#include "default_level.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static constexpr std::uint32_t fnv1aSeed = 2166136261u; ///< FNV-1a 32-bit offset basis.
+
+/**
+ * @brief Folds a byte range into a running FNV-1a hash.
+ *
+ * Seedable so the writer can hash the four index tables from their
+ * separate buffers while the mapped reader hashes them contiguously.
+ *
+ * @param hash The running hash; fnv1aSeed for the first range.
+ * @param data Start of the bytes to fold in.
+ * @param size Number of bytes.
+ * @return std::uint32_t The updated hash.
+ */
+static std::uint32_t fnv1a(std::uint32_t hash, const void* data, std::size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+        hash = (hash ^ bytes[i]) * 16777619u;
+    return hash;
+}
+
+/**
+ * @brief Reads one POD array from the file in a single bulk read.
+ *
+ * @param file The open level file.
+ * @param records The destination vector, already sized from the header.
+ * @return true If all records were read.
+ * @return false If the file ended early.
+ */
+template <typename Record>
+static bool readRecords(std::FILE* file, RecordArray<Record>& records)
+{
+    if (records.empty())
+        return true;
+    return std::fread(records.mutableData(), sizeof(Record), records.size(), file) == records.size();
+}
+
+/**
+ * @brief Loads a binary level file.
+ *
+ * @param path Path to the level file.
+ * @param outLevel Receives the level contents on success.
+ * @return true If the level was loaded and its header is valid.
+ * @return false If the file is missing, unreadable or malformed.
+ */
+bool loadLevel(const std::string& path, LevelData& outLevel)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    level::Header header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+        && std::memcmp(header.magic, "BLVL", 4) == 0
+        && header.version == level::levelVersion;
+
+    if (ok)
+    {
+        outLevel.platforms.resize(header.platformCount);
+        outLevel.walls.resize(header.wallCount);
+        outLevel.obstacles.resize(header.obstacleCount);
+        outLevel.coins.resize(header.coinCount);
+        outLevel.floor = header.floor;
+        outLevel.goal = header.goal;
+
+        ok = readRecords(file, outLevel.platforms)
+            && readRecords(file, outLevel.walls)
+            && readRecords(file, outLevel.obstacles)
+            && readRecords(file, outLevel.coins);
+    }
+
+    std::fclose(file);
+    return ok;
+}
+
+/**
+ * @brief Opens a level as a shared read-only mapping, copy-free.
+ *
+ * @param path Path to the level file.
+ * @param outLevel Receives the level views and owns the mapping.
+ * @return true If the level was mapped and its header is valid.
+ * @return false If the file is missing, unmappable or malformed.
+ */
+bool mapLevel(const std::string& path, LevelData& outLevel)
+{
+    MappedFile mapping;
+    if (!mapping.open(path) || mapping.size() < sizeof(level::Header))
+        return false;
+
+    const level::Header* header = reinterpret_cast<const level::Header*>(mapping.data());
+    if (std::memcmp(header->magic, "BLVL", 4) != 0 || header->version != level::levelVersion)
+        return false;
+
+    const std::size_t recordBytes = header->platformCount * sizeof(level::RectRecord)
+        + header->wallCount * sizeof(level::RectRecord)
+        + header->obstacleCount * sizeof(level::ObstacleRecord)
+        + header->coinCount * sizeof(level::CoinRecord);
+    if (sizeof(level::Header) + recordBytes > mapping.size())
+        return false;
+
+    // The arrays view the mapping in place, in the order saveLevel
+    // writes them; the records are float-aligned by layout
+    const unsigned char* cursor = mapping.data() + sizeof(level::Header);
+    outLevel.platforms.adopt(reinterpret_cast<const level::RectRecord*>(cursor), header->platformCount);
+    cursor += header->platformCount * sizeof(level::RectRecord);
+    outLevel.walls.adopt(reinterpret_cast<const level::RectRecord*>(cursor), header->wallCount);
+    cursor += header->wallCount * sizeof(level::RectRecord);
+    outLevel.obstacles.adopt(reinterpret_cast<const level::ObstacleRecord*>(cursor), header->obstacleCount);
+    cursor += header->obstacleCount * sizeof(level::ObstacleRecord);
+    outLevel.coins.adopt(reinterpret_cast<const level::CoinRecord*>(cursor), header->coinCount);
+    outLevel.floor = header->floor;
+    outLevel.goal = header->goal;
+
+    // The baked broadphase section is advisory: present and fully valid
+    // means the chunk stream adopts its tables in place, anything else
+    // (old file, truncated tail, corrupt tables) means the runtime build
+    const std::size_t recordEnd = sizeof(level::Header) + recordBytes;
+    if (mapping.size() >= recordEnd + sizeof(level::BroadphaseBakeHeader))
+    {
+        const level::BroadphaseBakeHeader* bake
+            = reinterpret_cast<const level::BroadphaseBakeHeader*>(mapping.data() + recordEnd);
+        const std::size_t tableCount = 2 * (static_cast<std::size_t>(bake->chunkCount) + 1)
+            + bake->platformEntryCount + bake->wallEntryCount;
+        if (std::memcmp(bake->magic, "BBPH", 4) == 0
+            && bake->version == level::broadphaseBakeVersion
+            && recordEnd + sizeof(*bake) + tableCount * sizeof(std::uint32_t) <= mapping.size())
+        {
+            const std::uint32_t* tables
+                = reinterpret_cast<const std::uint32_t*>(mapping.data() + recordEnd + sizeof(*bake));
+            if (fnv1a(fnv1aSeed, tables, tableCount * sizeof(std::uint32_t)) == bake->checksum)
+            {
+                outLevel.bakedIndex.platformStarts = tables;
+                outLevel.bakedIndex.wallStarts = tables + bake->chunkCount + 1;
+                outLevel.bakedIndex.platformEntries = outLevel.bakedIndex.wallStarts + bake->chunkCount + 1;
+                outLevel.bakedIndex.wallEntries = outLevel.bakedIndex.platformEntries + bake->platformEntryCount;
+                outLevel.bakedIndex.chunkCount = bake->chunkCount;
+                outLevel.bakedIndex.chunkWidth = bake->chunkWidth;
+            }
+        }
+    }
+
+    outLevel.mapping = static_cast<MappedFile&&>(mapping);
+    return true;
+}
+
+/**
+ * @brief Bins rectangle records into the chunk stream's per-chunk index.
+ *
+ * @param records The rectangle records to bin.
+ * @param chunkWidth Width of one chunk in pixels.
+ * @param chunkCount Number of chunks covering the level.
+ * @param starts Receives the chunkCount + 1 start offsets.
+ * @param entries Receives the concatenated per-chunk record indices.
+ */
+void buildChunkIndex(const RecordArray<level::RectRecord>& records, float chunkWidth, int chunkCount,
+                     RecordArray<std::uint32_t>& starts, RecordArray<std::uint32_t>& entries)
+{
+    starts.resize(chunkCount + 1);
+    std::uint32_t* offsets = starts.mutableData();
+    std::memset(offsets, 0, (chunkCount + 1) * sizeof(std::uint32_t));
+
+    // Two passes: count per chunk, prefix-sum into start offsets, then
+    // fill — record order is preserved within each chunk
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        const int first = std::max(0, static_cast<int>(records[i].x / chunkWidth));
+        const int last = std::min(chunkCount - 1, static_cast<int>((records[i].x + records[i].w) / chunkWidth));
+        for (int c = first; c <= last; ++c)
+            ++offsets[c + 1];
+    }
+    for (int c = 0; c < chunkCount; ++c)
+        offsets[c + 1] += offsets[c];
+
+    entries.resize(offsets[chunkCount]);
+    std::uint32_t* indices = entries.mutableData();
+    std::vector<std::uint32_t> cursor(offsets, offsets + chunkCount);
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        const int first = std::max(0, static_cast<int>(records[i].x / chunkWidth));
+        const int last = std::min(chunkCount - 1, static_cast<int>((records[i].x + records[i].w) / chunkWidth));
+        for (int c = first; c <= last; ++c)
+            indices[cursor[c]++] = static_cast<std::uint32_t>(i);
+    }
+}
+
+/**
+ * @brief Writes a level to the binary format.
+ *
+ * @param path Path of the file to write.
+ * @param levelData The level to serialize.
+ * @return true If the file was written successfully.
+ * @return false If the file could not be written.
+ */
+bool saveLevel(const std::string& path, const LevelData& levelData)
+{
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+
+    level::Header header = {};
+    std::memcpy(header.magic, "BLVL", 4);
+    header.version = level::levelVersion;
+    header.platformCount = static_cast<std::uint32_t>(levelData.platforms.size());
+    header.wallCount = static_cast<std::uint32_t>(levelData.walls.size());
+    header.obstacleCount = static_cast<std::uint32_t>(levelData.obstacles.size());
+    header.coinCount = static_cast<std::uint32_t>(levelData.coins.size());
+    header.floor = levelData.floor;
+    header.goal = levelData.goal;
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && (levelData.platforms.empty() || std::fwrite(levelData.platforms.data(), sizeof(level::RectRecord), levelData.platforms.size(), file) == levelData.platforms.size());
+    ok = ok && (levelData.walls.empty() || std::fwrite(levelData.walls.data(), sizeof(level::RectRecord), levelData.walls.size(), file) == levelData.walls.size());
+    ok = ok && (levelData.obstacles.empty() || std::fwrite(levelData.obstacles.data(), sizeof(level::ObstacleRecord), levelData.obstacles.size(), file) == levelData.obstacles.size());
+    ok = ok && (levelData.coins.empty() || std::fwrite(levelData.coins.data(), sizeof(level::CoinRecord), levelData.coins.size(), file) == levelData.coins.size());
+
+    // Bake the chunk stream's index after the records, in its runtime
+    // layout, so a mapped load adopts the tables with zero build work.
+    // The level's extent comes from the floor, as in ChunkStream::build
+    const int chunkCount = std::max(1,
+        static_cast<int>(std::ceil((levelData.floor.x + levelData.floor.w) / level::bakedChunkWidth)));
+    RecordArray<std::uint32_t> platformStarts;
+    RecordArray<std::uint32_t> platformEntries;
+    RecordArray<std::uint32_t> wallStarts;
+    RecordArray<std::uint32_t> wallEntries;
+    buildChunkIndex(levelData.platforms, level::bakedChunkWidth, chunkCount, platformStarts, platformEntries);
+    buildChunkIndex(levelData.walls, level::bakedChunkWidth, chunkCount, wallStarts, wallEntries);
+
+    level::BroadphaseBakeHeader bake = {};
+    std::memcpy(bake.magic, "BBPH", 4);
+    bake.version = level::broadphaseBakeVersion;
+    bake.chunkCount = static_cast<std::uint32_t>(chunkCount);
+    bake.chunkWidth = level::bakedChunkWidth;
+    bake.platformEntryCount = static_cast<std::uint32_t>(platformEntries.size());
+    bake.wallEntryCount = static_cast<std::uint32_t>(wallEntries.size());
+    std::uint32_t checksum = fnv1aSeed;
+    checksum = fnv1a(checksum, platformStarts.data(), platformStarts.size() * sizeof(std::uint32_t));
+    checksum = fnv1a(checksum, wallStarts.data(), wallStarts.size() * sizeof(std::uint32_t));
+    checksum = fnv1a(checksum, platformEntries.data(), platformEntries.size() * sizeof(std::uint32_t));
+    checksum = fnv1a(checksum, wallEntries.data(), wallEntries.size() * sizeof(std::uint32_t));
+    bake.checksum = checksum;
+
+    ok = ok && std::fwrite(&bake, sizeof(bake), 1, file) == 1;
+    ok = ok && std::fwrite(platformStarts.data(), sizeof(std::uint32_t), platformStarts.size(), file) == platformStarts.size();
+    ok = ok && std::fwrite(wallStarts.data(), sizeof(std::uint32_t), wallStarts.size(), file) == wallStarts.size();
+    ok = ok && (platformEntries.empty() || std::fwrite(platformEntries.data(), sizeof(std::uint32_t), platformEntries.size(), file) == platformEntries.size());
+    ok = ok && (wallEntries.empty() || std::fwrite(wallEntries.data(), sizeof(std::uint32_t), wallEntries.size(), file) == wallEntries.size());
+
+    std::fclose(file);
+    return ok;
+}
+
+/**
+ * @brief Builds the shipped level.
+ *
+ * @return LevelData The default level.
+ */
+LevelData makeDefaultLevel()
+{
+    LevelData levelData;
+
+    // The shipped level's geometry lives in constexpr tables (see
+    // default_level.h); building it is one bulk copy per array
+    levelData.platforms.assign(level::defaults::platforms, level::defaults::platforms + level::defaults::platformCount);
+    levelData.walls.assign(level::defaults::walls, level::defaults::walls + level::defaults::wallCount);
+    levelData.obstacles.assign(level::defaults::obstacles, level::defaults::obstacles + level::defaults::obstacleCount);
+    levelData.coins.assign(level::defaults::coins, level::defaults::coins + level::defaults::coinCount);
+    levelData.floor = level::defaults::floor;
+    levelData.goal = level::defaults::goal;
+
+    return levelData;
+}
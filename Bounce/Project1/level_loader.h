@@ -0,0 +1,181 @@
+#pragma once
+#include "level_format.h"
+#include "mapped_file.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A record array that either owns its records or views a mapping.
+ *
+ * Generated and edited levels build their records in owned storage, as
+ * the vectors always did. A level opened through mapLevel instead
+ * adopts a view straight into the read-only file mapping: no copy is
+ * made, and every game instance on the machine reading the same level
+ * file shares one set of physical pages. Mutating calls are only for
+ * owned arrays; a mapped level is read-only end to end. Copying a view
+ * copies the pointer, not the records — the mapping in the LevelData
+ * outlives every consumer by the campaign cache's eviction rule.
+ */
+template <typename Record>
+class RecordArray {
+public:
+    /**
+     * @brief Points the array into mapped records, dropping owned ones.
+     *
+     * @param records Start of the records inside the mapping.
+     * @param count Number of records.
+     */
+    void adopt(const Record* records, std::size_t count)
+    {
+        storage.clear();
+        view = records;
+        viewCount = count;
+    }
+
+    /// Appends one record; owned arrays only.
+    void push_back(const Record& record) { storage.push_back(record); }
+
+    /// Reserves owned storage; owned arrays only.
+    void reserve(std::size_t count) { storage.reserve(count); }
+
+    /// Appends a record range at the end; owned arrays only.
+    template <typename Iterator>
+    void insert(const Record* at, Iterator first, Iterator last)
+    {
+        (void)at;  // Only end() insertion is ever used
+        storage.insert(storage.end(), first, last);
+    }
+
+    /// Replaces the contents with a record range; owned arrays only.
+    void assign(const Record* first, const Record* last)
+    {
+        view = nullptr;
+        viewCount = 0;
+        storage.assign(first, last);
+    }
+
+    /// Resizes owned storage, dropping any view.
+    void resize(std::size_t count)
+    {
+        view = nullptr;
+        viewCount = 0;
+        storage.resize(count);
+    }
+
+    std::size_t size() const { return view ? viewCount : storage.size(); }
+    bool empty() const { return size() == 0; }
+    const Record* data() const { return view ? view : storage.data(); }
+    Record* mutableData() { return storage.data(); } ///< Owned storage only; the loader's bulk-read target.
+    const Record& operator[](std::size_t index) const { return data()[index]; }
+    const Record* begin() const { return data(); }
+    const Record* end() const { return data() + size(); }
+
+private:
+    std::vector<Record> storage; ///< Owned records; empty while viewing.
+    const Record* view = nullptr; ///< Mapped records, or null when owning.
+    std::size_t viewCount = 0; ///< Number of mapped records.
+};
+
+/**
+ * @brief In-memory level description populated from a level file.
+ *
+ * Mirrors the binary format one-to-one so loading is bulk reads into the
+ * arrays; the entity store, render shapes and coin array in main() are
+ * all built from this. A level opened with mapLevel holds its file
+ * mapping here and the record arrays view it in place.
+ */
+struct LevelData {
+    RecordArray<level::RectRecord> platforms; ///< Platforms the player can land on (floor excluded).
+    RecordArray<level::RectRecord> walls; ///< Walls blocking horizontal movement.
+    RecordArray<level::ObstacleRecord> obstacles; ///< Patrolling obstacles.
+    RecordArray<level::CoinRecord> coins; ///< Collectible coin positions.
+    level::RectRecord floor = {}; ///< The floor spanning the level.
+    level::RectRecord goal = {}; ///< The goal platform.
+    MappedFile mapping; ///< Backing mapping when loaded via mapLevel; empty otherwise.
+
+    /**
+     * @brief Views into the file's baked chunk index, when present and valid.
+     *
+     * The starts arrays hold chunkCount + 1 offsets into the entry
+     * arrays; chunk c's indices are entries[starts[c]] up to
+     * entries[starts[c + 1]]. Only mapLevel fills this, and only after
+     * the section's magic, version and checksum all pass — a consumer
+     * seeing valid() can adopt the tables without further validation.
+     */
+    struct BakedBroadphase {
+        const std::uint32_t* platformStarts = nullptr; ///< chunkCount + 1 offsets into platformEntries.
+        const std::uint32_t* wallStarts = nullptr; ///< chunkCount + 1 offsets into wallEntries.
+        const std::uint32_t* platformEntries = nullptr; ///< Concatenated per-chunk platform indices.
+        const std::uint32_t* wallEntries = nullptr; ///< Concatenated per-chunk wall indices.
+        std::uint32_t chunkCount = 0; ///< Chunks the tables cover.
+        float chunkWidth = 0.0f; ///< Chunk width the tables were binned at.
+        bool valid() const { return platformStarts != nullptr; }
+    };
+    BakedBroadphase bakedIndex; ///< Set by mapLevel when the file carries a valid baked section.
+};
+
+/**
+ * @brief Loads a binary level file.
+ *
+ * @param path Path to the level file.
+ * @param outLevel Receives the level contents on success.
+ * @return true If the level was loaded and its header is valid.
+ * @return false If the file is missing, unreadable or malformed.
+ */
+bool loadLevel(const std::string& path, LevelData& outLevel);
+
+/**
+ * @brief Opens a level as a shared read-only mapping, copy-free.
+ *
+ * The record arrays view the mapping in place, so N game instances
+ * opening the same level file share one copy of its pages in physical
+ * RAM. Falls back to nothing: a missing or malformed file just
+ * returns false and the caller uses loadLevel or the default level.
+ *
+ * @param path Path to the level file.
+ * @param outLevel Receives the level views and owns the mapping.
+ * @return true If the level was mapped and its header is valid.
+ * @return false If the file is missing, unmappable or malformed.
+ */
+bool mapLevel(const std::string& path, LevelData& outLevel);
+
+/**
+ * @brief Writes a level to the binary format.
+ *
+ * @param path Path of the file to write.
+ * @param levelData The level to serialize.
+ * @return true If the file was written successfully.
+ * @return false If the file could not be written.
+ */
+bool saveLevel(const std::string& path, const LevelData& levelData);
+
+/**
+ * @brief Bins rectangle records into the chunk stream's per-chunk index.
+ *
+ * Produces the index in its runtime layout — chunkCount + 1 start
+ * offsets and a concatenated entry array, record order preserved within
+ * each chunk, a record spanning several chunks listed in each one it
+ * touches. saveLevel runs this to bake the tables into the file, and
+ * ChunkStream::build runs the same function when a level has no usable
+ * baked section, so the two paths can never disagree.
+ *
+ * @param records The rectangle records to bin.
+ * @param chunkWidth Width of one chunk in pixels.
+ * @param chunkCount Number of chunks covering the level.
+ * @param starts Receives the chunkCount + 1 start offsets.
+ * @param entries Receives the concatenated per-chunk record indices.
+ */
+void buildChunkIndex(const RecordArray<level::RectRecord>& records, float chunkWidth, int chunkCount,
+                     RecordArray<std::uint32_t>& starts, RecordArray<std::uint32_t>& entries);
+
+/**
+ * @brief Builds the shipped level.
+ *
+ * This is the level that used to be hardcoded as initializer lists in
+ * main(); it doubles as the fallback when no level file is present and
+ * as the input for generating one with saveLevel.
+ *
+ * @return LevelData The default level.
+ */
+LevelData makeDefaultLevel();
@@ -0,0 +1,119 @@
+#include "mapped_file.h"
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * @brief Unmaps the file and closes the handles.
+ */
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = static_cast<MappedFile&&>(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        bytes = other.bytes;
+        mappedSize = other.mappedSize;
+#if defined(_WIN32)
+        fileHandle = other.fileHandle;
+        mappingHandle = other.mappingHandle;
+        other.fileHandle = nullptr;
+        other.mappingHandle = nullptr;
+#else
+        fileDescriptor = other.fileDescriptor;
+        other.fileDescriptor = -1;
+#endif
+        other.bytes = nullptr;
+        other.mappedSize = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Maps a file read-only, shared across processes.
+ *
+ * @param path Path of the file to map.
+ * @return true If the file was mapped.
+ * @return false If the file is missing, empty or unmappable.
+ */
+bool MappedFile::open(const std::string& path)
+{
+    close();
+#if defined(_WIN32)
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        fileHandle = nullptr;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        return false;
+
+    mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle)
+        return false;
+
+    bytes = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (!bytes)
+        return false;
+    mappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    fileDescriptor = ::open(path.c_str(), O_RDONLY);
+    if (fileDescriptor == -1)
+        return false;
+
+    struct stat fileInfo;
+    if (fstat(fileDescriptor, &fileInfo) != 0 || fileInfo.st_size == 0)
+        return false;
+
+    void* mapping = mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    if (mapping == MAP_FAILED)
+        return false;
+    bytes = static_cast<const unsigned char*>(mapping);
+    mappedSize = static_cast<std::size_t>(fileInfo.st_size);
+#endif
+    return true;
+}
+
+/**
+ * @brief Releases the mapping early; the destructor also does this.
+ */
+void MappedFile::close()
+{
+#if defined(_WIN32)
+    if (bytes)
+        UnmapViewOfFile(const_cast<unsigned char*>(bytes));
+    if (mappingHandle)
+        CloseHandle(mappingHandle);
+    if (fileHandle)
+        CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (bytes)
+        munmap(const_cast<unsigned char*>(bytes), mappedSize);
+    if (fileDescriptor != -1)
+        ::close(fileDescriptor);
+    fileDescriptor = -1;
+#endif
+    bytes = nullptr;
+    mappedSize = 0;
+}
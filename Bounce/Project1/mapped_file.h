@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Read-only shared memory mapping of a file.
+ *
+ * The kiosk machines run one game process per screen, and every
+ * process used to hold its own heap copy of whatever it read from
+ * disk. A read-only file mapping instead backs the bytes with the OS
+ * page cache: N processes mapping the same file reference the same
+ * physical pages, so the asset bundle and the binary level files cost
+ * one copy of RAM however many instances run. The asset bundle and the
+ * mapped level path both build on this; the platform code lives here
+ * once.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief Unmaps the file and closes the handles.
+     */
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file read-only, shared across processes.
+     *
+     * @param path Path of the file to map.
+     * @return true If the file was mapped.
+     * @return false If the file is missing, empty or unmappable.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Releases the mapping early; the destructor also does this.
+     */
+    void close();
+
+    /**
+     * @brief Start of the mapped bytes.
+     *
+     * @return const unsigned char* The mapping, or nullptr when closed.
+     */
+    const unsigned char* data() const { return bytes; }
+
+    /**
+     * @brief Size of the mapping.
+     *
+     * @return std::size_t The file size in bytes; zero when closed.
+     */
+    std::size_t size() const { return mappedSize; }
+
+private:
+    const unsigned char* bytes = nullptr; ///< Start of the mapped file.
+    std::size_t mappedSize = 0; ///< Size of the mapping in bytes.
+#if defined(_WIN32)
+    void* fileHandle = nullptr; ///< Win32 file handle.
+    void* mappingHandle = nullptr; ///< Win32 file-mapping handle.
+#else
+    int fileDescriptor = -1; ///< POSIX file descriptor.
+#endif
+};
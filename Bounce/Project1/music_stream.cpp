@@ -0,0 +1,42 @@
+#include "music_stream.h"
+#include <chrono>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/**
+ * @brief Times the base class decode and publishes the load figure.
+ *
+ * @param data Receives the decoded chunk.
+ * @return true While more audio remains (or the stream loops).
+ */
+bool MusicStream::onGetData(Chunk& data)
+{
+    if (!priorityLowered)
+    {
+        // First callback runs on the stream's decode thread: park it
+        // below normal so it never preempts the tick or render threads
+#ifdef _WIN32
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#endif
+        priorityLowered = true;
+    }
+
+    const auto decodeStart = std::chrono::steady_clock::now();
+    const bool more = sf::Music::onGetData(data);
+    const float decodeSeconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - decodeStart).count();
+
+    // Load = decode time over the playback time of what it produced;
+    // smoothed so the overlay figure does not flicker chunk to chunk
+    const std::size_t samplesPerSecond = static_cast<std::size_t>(getSampleRate()) * getChannelCount();
+    if (samplesPerSecond > 0 && data.sampleCount > 0)
+    {
+        const float chunkSeconds = static_cast<float>(data.sampleCount) / samplesPerSecond;
+        const float instant = decodeSeconds / chunkSeconds;
+        const float smoothed = decodeLoad() * 0.8f + instant * 0.2f;
+        std::uint32_t bits;
+        std::memcpy(&bits, &smoothed, sizeof(bits));
+        loadBits.store(bits, std::memory_order_relaxed);
+    }
+    return more;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Streaming background music with tunable buffering and decode
+ * instrumentation.
+ *
+ * sf::Music already decodes on its own dedicated thread; this subclass
+ * makes the two things we care about on weak CPUs explicit. The chunk
+ * interval is configurable — bigger chunks mean fewer, longer decode
+ * wake-ups, which is what the single-core kiosks want — and every
+ * decode callback is timed against the amount of audio it produced, so
+ * the profiler overlay can show how much of realtime the decoder is
+ * eating. On Windows the decode thread drops itself below normal
+ * priority on its first callback, so OGG decode never competes with the
+ * tick loop for a core.
+ */
+class MusicStream : public sf::Music {
+public:
+    /**
+     * @brief Sets the decode chunk interval; call before play().
+     *
+     * @param interval Audio decoded per wake-up of the stream thread.
+     */
+    void configure(sf::Time interval) { setProcessingInterval(interval); }
+
+    /**
+     * @brief Fraction of realtime the decode thread spends decoding.
+     *
+     * Smoothed across recent chunks; 1.0 means decode alone eats the
+     * whole core and the stream is about to underrun. Safe from any
+     * thread.
+     *
+     * @return float Decode load in [0, ~1].
+     */
+    float decodeLoad() const
+    {
+        const std::uint32_t bits = loadBits.load(std::memory_order_relaxed);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));  // Atomic<float> without the platform caveats
+        return value;
+    }
+
+protected:
+    /**
+     * @brief Times the base class decode and publishes the load figure.
+     *
+     * Runs on the stream's decode thread.
+     *
+     * @param data Receives the decoded chunk.
+     * @return true While more audio remains (or the stream loops).
+     */
+    bool onGetData(Chunk& data) override;
+
+private:
+    std::atomic<std::uint32_t> loadBits{ 0 }; ///< Smoothed decode load, float bits.
+    bool priorityLowered = false; ///< Set after the first callback adjusts the thread.
+};
@@ -0,0 +1,80 @@
+#include "net_broadcast.h"
+
+/**
+ * @brief Opens the socket and sizes the codec for a simulation.
+ *
+ * @param sim The simulation whose state will be streamed.
+ * @param port Destination port the spectator screens listen on.
+ * @param group Destination address; LAN broadcast by default.
+ * @param keyframeInterval Ticks between keyframes.
+ * @return true If the socket opened.
+ */
+bool BroadcastSender::open(const Simulation& sim, unsigned short port,
+                           const sf::IpAddress& group, std::uint32_t keyframeInterval)
+{
+    if (socket.bind(sf::Socket::AnyPort) != sf::Socket::Done)
+        return false;
+    socket.setBlocking(false);
+    groupAddress = group;
+    groupPort = port;
+    encoder.init(sim.stateSize(), keyframeInterval);
+    stateScratch.resize(sim.stateSize());
+    return true;
+}
+
+/**
+ * @brief Captures, encodes and sends the state; call once per tick.
+ *
+ * @param sim The simulation to broadcast.
+ */
+void BroadcastSender::sendState(const Simulation& sim)
+{
+    if (groupPort == 0)
+        return;
+
+    sim.captureState(stateScratch.data());
+    encoder.encode(stateScratch.data(), static_cast<std::uint32_t>(sim.tickIndex), sendBuffer);
+    socket.send(sendBuffer.data(), sendBuffer.size(), groupAddress, groupPort);
+    payloadBytesAvg = payloadBytesAvg * 0.95f + static_cast<float>(sendBuffer.size()) * 0.05f;
+}
+
+/**
+ * @brief Binds the listening socket in non-blocking mode.
+ *
+ * @param port The port the sender broadcasts to.
+ * @return true If the socket bound.
+ */
+bool BroadcastReceiver::open(unsigned short port)
+{
+    if (socket.bind(port) != sf::Socket::Done)
+        return false;
+    socket.setBlocking(false);
+    return true;
+}
+
+/**
+ * @brief Drains arrived datagrams; never blocks.
+ *
+ * @param outState Receives the newest decoded state block.
+ * @param outTick Receives the block's simulation tick.
+ * @return true If a new state was decoded this call.
+ */
+bool BroadcastReceiver::poll(std::vector<unsigned char>& outState, std::uint32_t& outTick)
+{
+    bool decoded = false;
+    std::size_t received = 0;
+    sf::IpAddress from;
+    unsigned short fromPort = 0;
+    while (socket.receive(receiveBuffer, sizeof(receiveBuffer), received, from, fromPort) == sf::Socket::Done)
+    {
+        std::uint32_t tick = 0;
+        if (decoder.decode(receiveBuffer, received, stateScratch, tick)
+            && (!decoded || static_cast<std::int32_t>(tick - outTick) > 0))
+        {
+            outState = stateScratch;
+            outTick = tick;
+            decoded = true;
+        }
+    }
+    return decoded;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "broadcast_codec.h"
+#include "simulation.h"
+#include <SFML/Network.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief One-to-many UDP transport for the spectator broadcast.
+ *
+ * Tournament mode streams one cabinet's game to N spectator screens as
+ * ONE datagram per tick instead of N unicast streams. sf::UdpSocket
+ * has no multicast group membership API, so the default destination is
+ * the LAN broadcast address — on a tournament switch that is exactly
+ * the one-datagram-to-every-screen delivery wanted; a routed multicast
+ * or unicast address can be passed instead where the network supports
+ * it. There is no backchannel: the run-length codec's keyframe cadence
+ * is the whole loss and late-join story.
+ *
+ * The sender belongs on the tick thread; a receiver belongs to its
+ * spectator screen's own loop and applies decoded blocks with
+ * restoreState on a simulation loaded with the same level.
+ */
+class BroadcastSender {
+public:
+    /**
+     * @brief Opens the socket and sizes the codec for a simulation.
+     *
+     * Must be re-run if the simulation is re-initialized with a
+     * different level, since the block size follows the entity counts.
+     *
+     * @param sim The simulation whose state will be streamed.
+     * @param port Destination port the spectator screens listen on.
+     * @param group Destination address; LAN broadcast by default.
+     * @param keyframeInterval Ticks between keyframes.
+     * @return true If the socket opened.
+     */
+    bool open(const Simulation& sim, unsigned short port,
+              const sf::IpAddress& group = sf::IpAddress::Broadcast,
+              std::uint32_t keyframeInterval = 120);
+
+    /**
+     * @brief Captures, encodes and sends the state; call once per tick.
+     *
+     * @param sim The simulation to broadcast.
+     */
+    void sendState(const Simulation& sim);
+
+    /**
+     * @brief Smoothed outgoing payload size, for the net counters.
+     *
+     * @return float Bytes per sent payload.
+     */
+    float averagePayloadBytes() const { return payloadBytesAvg; }
+
+private:
+    sf::UdpSocket socket; ///< Send-only socket.
+    sf::IpAddress groupAddress = sf::IpAddress::Broadcast; ///< Where datagrams go.
+    unsigned short groupPort = 0; ///< Destination port.
+    BroadcastEncoder encoder; ///< Keyframe/delta codec.
+    std::vector<unsigned char> stateScratch; ///< Capture target; sized at open.
+    std::vector<std::uint8_t> sendBuffer; ///< Encode scratch.
+    float payloadBytesAvg = 0.0f; ///< Smoothed outgoing payload size.
+};
+
+/**
+ * @brief Receiving side of the spectator broadcast; one per screen.
+ */
+class BroadcastReceiver {
+public:
+    /**
+     * @brief Binds the listening socket in non-blocking mode.
+     *
+     * @param port The port the sender broadcasts to.
+     * @return true If the socket bound.
+     */
+    bool open(unsigned short port);
+
+    /**
+     * @brief Drains arrived datagrams; never blocks.
+     *
+     * Decodes everything queued and keeps the newest tick, so a screen
+     * that stalled a frame skips straight to the freshest state.
+     *
+     * @param outState Receives the newest decoded state block.
+     * @param outTick Receives the block's simulation tick.
+     * @return true If a new state was decoded this call.
+     */
+    bool poll(std::vector<unsigned char>& outState, std::uint32_t& outTick);
+
+private:
+    sf::UdpSocket socket; ///< Non-blocking listening socket.
+    BroadcastDecoder decoder; ///< Keyframe/delta codec.
+    std::uint8_t receiveBuffer[sf::UdpSocket::MaxDatagramSize]; ///< Datagram scratch.
+    std::vector<unsigned char> stateScratch; ///< Decode target.
+};
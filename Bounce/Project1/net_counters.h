@@ -0,0 +1,158 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief One second's worth of network rates, computed on demand.
+ *
+ * Plain values; fill one via NetCounters::sample() and hand it to the
+ * HUD or the telemetry export.
+ */
+struct NetCounterSample {
+    float sentBytesPerSec = 0.0f; ///< Outgoing payload bytes per second.
+    float sentPacketsPerSec = 0.0f; ///< Outgoing datagrams per second.
+    float receivedBytesPerSec = 0.0f; ///< Incoming payload bytes per second.
+    float receivedPacketsPerSec = 0.0f; ///< Incoming datagrams per second.
+    float compressionRatio = 1.0f; ///< Raw state bytes / wire bytes, this window.
+    float lossPercent = 0.0f; ///< Sequence-gap loss over packets expected, this window.
+    float rttMs = 0.0f; ///< Smoothed round-trip time.
+};
+
+/**
+ * @brief Relaxed-atomic traffic counters shared by the net threads.
+ *
+ * The receive thread and the tick thread both bump totals here with
+ * relaxed fetch_adds — one uncontended atomic add per datagram, which
+ * is as close to free as instrumentation gets; no ordering is needed
+ * because each counter is an independent monotonic total. sample()
+ * runs on whichever thread reads the HUD, differencing the totals
+ * against the previous call to turn them into per-second rates, so the
+ * hot paths never compute a rate.
+ *
+ * Loss is inferred by the snapshot decoder's sequence gaps and RTT from
+ * ack turnaround; both are pushed in by NetSync, which owns the
+ * sequence bookkeeping.
+ */
+class NetCounters {
+public:
+    /**
+     * @brief Records one sent datagram; tick thread.
+     *
+     * @param wireBytes Bytes on the wire.
+     * @param rawBytes Size the payload would be unencoded.
+     */
+    void addSent(std::size_t wireBytes, std::size_t rawBytes)
+    {
+        sentBytes.fetch_add(wireBytes, std::memory_order_relaxed);
+        sentPackets.fetch_add(1, std::memory_order_relaxed);
+        rawPayloadBytes.fetch_add(rawBytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records one received datagram; receive thread.
+     *
+     * @param wireBytes Bytes off the wire.
+     */
+    void addReceived(std::size_t wireBytes)
+    {
+        receivedBytes.fetch_add(wireBytes, std::memory_order_relaxed);
+        receivedPackets.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records datagrams inferred lost from a sequence gap.
+     *
+     * @param gap Sequences skipped between consecutive arrivals.
+     */
+    void addLost(std::uint32_t gap)
+    {
+        lostPackets.fetch_add(gap, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Folds one RTT measurement into the smoothed estimate.
+     *
+     * @param seconds Ack turnaround for one sequence.
+     */
+    void addRtt(float seconds)
+    {
+        const float previous = rttSeconds();
+        const float smoothed = previous == 0.0f ? seconds : previous * 0.9f + seconds * 0.1f;
+        std::uint32_t bits;
+        std::memcpy(&bits, &smoothed, sizeof(bits));
+        rttBits.store(bits, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Turns the totals into rates over the window since the
+     * previous call.
+     *
+     * @param nowSeconds Steady-clock seconds.
+     * @param out Receives the rates; untouched if the window is empty.
+     */
+    void sample(float nowSeconds, NetCounterSample& out)
+    {
+        const float window = nowSeconds - lastSampleSeconds;
+        if (window <= 0.0f)
+            return;
+        lastSampleSeconds = nowSeconds;
+
+        const std::uint64_t sentB = sentBytes.load(std::memory_order_relaxed);
+        const std::uint64_t sentP = sentPackets.load(std::memory_order_relaxed);
+        const std::uint64_t recvB = receivedBytes.load(std::memory_order_relaxed);
+        const std::uint64_t recvP = receivedPackets.load(std::memory_order_relaxed);
+        const std::uint64_t rawB = rawPayloadBytes.load(std::memory_order_relaxed);
+        const std::uint64_t lostP = lostPackets.load(std::memory_order_relaxed);
+
+        out.sentBytesPerSec = static_cast<float>(sentB - lastSentBytes) / window;
+        out.sentPacketsPerSec = static_cast<float>(sentP - lastSentPackets) / window;
+        out.receivedBytesPerSec = static_cast<float>(recvB - lastReceivedBytes) / window;
+        out.receivedPacketsPerSec = static_cast<float>(recvP - lastReceivedPackets) / window;
+        const std::uint64_t wireWindow = sentB - lastSentBytes;
+        out.compressionRatio = wireWindow == 0
+            ? 1.0f
+            : static_cast<float>(rawB - lastRawBytes) / static_cast<float>(wireWindow);
+        const std::uint64_t arrived = recvP - lastReceivedPackets;
+        const std::uint64_t lost = lostP - lastLostPackets;
+        out.lossPercent = arrived + lost == 0
+            ? 0.0f
+            : 100.0f * static_cast<float>(lost) / static_cast<float>(arrived + lost);
+        out.rttMs = rttSeconds() * 1000.0f;
+
+        lastSentBytes = sentB;
+        lastSentPackets = sentP;
+        lastReceivedBytes = recvB;
+        lastReceivedPackets = recvP;
+        lastRawBytes = rawB;
+        lastLostPackets = lostP;
+    }
+
+private:
+    /**
+     * @brief The smoothed RTT out of its atomic bits.
+     */
+    float rttSeconds() const
+    {
+        const std::uint32_t bits = rttBits.load(std::memory_order_relaxed);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::atomic<std::uint64_t> sentBytes{ 0 }; ///< Total outgoing bytes.
+    std::atomic<std::uint64_t> sentPackets{ 0 }; ///< Total outgoing datagrams.
+    std::atomic<std::uint64_t> receivedBytes{ 0 }; ///< Total incoming bytes.
+    std::atomic<std::uint64_t> receivedPackets{ 0 }; ///< Total incoming datagrams.
+    std::atomic<std::uint64_t> rawPayloadBytes{ 0 }; ///< Unencoded size of everything sent.
+    std::atomic<std::uint64_t> lostPackets{ 0 }; ///< Total inferred-lost datagrams.
+    std::atomic<std::uint32_t> rttBits{ 0 }; ///< Smoothed RTT, float bits.
+
+    float lastSampleSeconds = 0.0f; ///< When sample() last ran.
+    std::uint64_t lastSentBytes = 0; ///< Totals at the previous sample.
+    std::uint64_t lastSentPackets = 0; ///< Totals at the previous sample.
+    std::uint64_t lastReceivedBytes = 0; ///< Totals at the previous sample.
+    std::uint64_t lastReceivedPackets = 0; ///< Totals at the previous sample.
+    std::uint64_t lastRawBytes = 0; ///< Totals at the previous sample.
+    std::uint64_t lastLostPackets = 0; ///< Totals at the previous sample.
+};
@@ -0,0 +1,105 @@
+#include "net_interp.h"
+
+/**
+ * @brief Configures the playback delay.
+ *
+ * @param tickDt The sender's fixed tick length in seconds.
+ * @param delaySeconds How far behind the newest snapshot to render.
+ */
+void SnapshotInterpolator::init(float tickDt, float delaySeconds)
+{
+    tickSeconds = tickDt;
+    renderDelay = delaySeconds;
+}
+
+/**
+ * @brief Adds an arrived snapshot.
+ *
+ * @param sequence The snapshot's tick sequence number.
+ * @param x Remote player x in world pixels.
+ * @param y Remote player y in world pixels.
+ * @param velX Remote player x velocity in px/s.
+ * @param velY Remote player y velocity in px/s.
+ * @param localNow Local time of arrival in seconds.
+ */
+void SnapshotInterpolator::push(std::uint32_t sequence, float x, float y, float velX, float velY, float localNow)
+{
+    if (sequence <= newestSequence && newestSequence != 0)
+        return;  // Reordered stragglers: the ring already moved past them
+
+    Entry& slot = ring[sequence % ringSize];
+    if (slot.sequence == 0)
+        ++held;
+    slot = Entry{ sequence, x, y, velX, velY };
+    newestSequence = sequence;
+
+    // Track the local-to-remote clock offset; a slow EMA rides out
+    // per-packet jitter while following clock drift
+    const float remoteTime = static_cast<float>(sequence) * tickSeconds;
+    const float offset = localNow - remoteTime;
+    if (!offsetPrimed)
+    {
+        clockOffset = offset;
+        offsetPrimed = true;
+    }
+    else
+    {
+        clockOffset = clockOffset * 0.95f + offset * 0.05f;
+    }
+}
+
+/**
+ * @brief Samples the remote player position for a frame.
+ *
+ * @param localNow Local time in the same clock as push().
+ * @param x Receives the interpolated x.
+ * @param y Receives the interpolated y.
+ * @return true If a position was produced.
+ */
+bool SnapshotInterpolator::sample(float localNow, float& x, float& y)
+{
+    if (newestSequence == 0)
+        return false;
+
+    const float newestTime = static_cast<float>(newestSequence) * tickSeconds;
+    const float targetTime = (localNow - clockOffset) - renderDelay;
+    lastDelay = newestTime - targetTime;
+
+    const Entry& newest = ring[newestSequence % ringSize];
+    if (targetTime >= newestTime)
+    {
+        // Past the newest snapshot: extrapolate along its velocity for
+        // a bounded stretch, then hold so a silent peer freezes
+        const float ahead = targetTime - newestTime;
+        const float clamped = ahead < maxExtrapolation ? ahead : maxExtrapolation;
+        x = newest.x + newest.velX * clamped;
+        y = newest.y + newest.velY * clamped;
+        return true;
+    }
+
+    // Walk back from the newest snapshot to the pair bracketing the
+    // target; the ring holds at most ringSize entries, so this is short
+    const Entry* after = &newest;
+    for (std::uint32_t seq = newestSequence; seq-- > 1 && newestSequence - seq <= ringSize - 1; )
+    {
+        const Entry& before = ring[seq % ringSize];
+        if (before.sequence != seq)
+            continue;  // A lost packet; keep scanning and lerp across the gap
+        const float beforeTime = static_cast<float>(seq) * tickSeconds;
+        if (beforeTime <= targetTime)
+        {
+            const float afterTime = static_cast<float>(after->sequence) * tickSeconds;
+            const float span = afterTime - beforeTime;
+            const float alpha = span > 0.0f ? (targetTime - beforeTime) / span : 1.0f;
+            x = before.x + (after->x - before.x) * alpha;
+            y = before.y + (after->y - before.y) * alpha;
+            return true;
+        }
+        after = &before;
+    }
+
+    // Older than everything held: clamp to the oldest entry we reached
+    x = after->x;
+    y = after->y;
+    return true;
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Jitter buffer and interpolator for remote player state.
+ *
+ * Remote snapshots arrive at network rate with network jitter; frames
+ * render at display rate. The buffer holds the last few snapshots in a
+ * fixed ring keyed on their tick sequence — the sender's fixed tick is
+ * the remote clock, so every snapshot has an exact remote timestamp —
+ * and sampling renders the remote player a configurable delay behind
+ * the newest arrival, interpolating between the two snapshots that
+ * bracket the target time. When loss or a jitter spike leaves the
+ * target beyond the newest snapshot, the position is extrapolated from
+ * the snapshot's velocity for a bounded interval and then holds, so a
+ * dead peer freezes instead of sliding away. Push is one ring write,
+ * sampling is a short scan of the ring; nothing allocates per packet.
+ *
+ * The buffer only maps remote tick time to local time (smoothed offset
+ * estimate) and interpolates; it is SFML-free and feeds whatever draws
+ * the remote entity the same prev/cur-blended positions the local
+ * interpolation path uses.
+ */
+class SnapshotInterpolator {
+public:
+    /**
+     * @brief Configures the playback delay.
+     *
+     * @param tickDt The sender's fixed tick length in seconds.
+     * @param delaySeconds How far behind the newest snapshot to render;
+     * about two network send intervals rides out most jitter.
+     */
+    void init(float tickDt, float delaySeconds);
+
+    /**
+     * @brief Adds an arrived snapshot; call from wherever decodes them.
+     *
+     * Snapshots older than the newest held are dropped (UDP reorder).
+     *
+     * @param sequence The snapshot's tick sequence number.
+     * @param x Remote player x in world pixels.
+     * @param y Remote player y in world pixels.
+     * @param velX Remote player x velocity in px/s.
+     * @param velY Remote player y velocity in px/s.
+     * @param localNow Local time of arrival in seconds (any steady clock).
+     */
+    void push(std::uint32_t sequence, float x, float y, float velX, float velY, float localNow);
+
+    /**
+     * @brief Samples the remote player position for a frame.
+     *
+     * @param localNow Local time in the same clock as push().
+     * @param x Receives the interpolated x.
+     * @param y Receives the interpolated y.
+     * @return true If a position was produced.
+     * @return false Before the first push.
+     */
+    bool sample(float localNow, float& x, float& y);
+
+    /**
+     * @brief Snapshots currently held, for the HUD readout.
+     *
+     * @return std::size_t The buffer depth.
+     */
+    std::size_t depth() const { return held; }
+
+    /**
+     * @brief How far behind the newest snapshot the last sample
+     * rendered, for the HUD readout.
+     *
+     * @return float Delay in milliseconds; negative while extrapolating.
+     */
+    float lastDelayMs() const { return lastDelay * 1000.0f; }
+
+private:
+    /**
+     * @brief One buffered snapshot.
+     */
+    struct Entry {
+        std::uint32_t sequence = 0; ///< Tick sequence; 0 marks an empty slot.
+        float x = 0.0f; ///< Player x.
+        float y = 0.0f; ///< Player y.
+        float velX = 0.0f; ///< Player x velocity.
+        float velY = 0.0f; ///< Player y velocity.
+    };
+
+    static constexpr std::size_t ringSize = 8; ///< Snapshots held; power of two.
+    static constexpr float maxExtrapolation = 0.1f; ///< Seconds to extrapolate past the newest snapshot.
+
+    Entry ring[ringSize]; ///< Snapshots by sequence % ringSize.
+    std::uint32_t newestSequence = 0; ///< Highest sequence pushed.
+    std::size_t held = 0; ///< Valid entries in the ring.
+    float tickSeconds = 1.0f / 120.0f; ///< Remote tick length.
+    float renderDelay = 0.05f; ///< Target distance behind the newest snapshot.
+    float clockOffset = 0.0f; ///< Smoothed localNow - remoteTime estimate.
+    bool offsetPrimed = false; ///< Set by the first push.
+    float lastDelay = 0.0f; ///< Delay achieved by the last sample.
+};
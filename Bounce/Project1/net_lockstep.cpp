@@ -0,0 +1,165 @@
+#include "net_lockstep.h"
+#include "net_varint.h"
+
+/**
+ * @brief Packs an input state into its wire bits.
+ */
+std::uint8_t LockstepTimeline::packInput(const InputState& input)
+{
+    return static_cast<std::uint8_t>((input.left ? 1 : 0) | (input.right ? 2 : 0) | (input.up ? 4 : 0) | (input.down ? 8 : 0));
+}
+
+/**
+ * @brief Records the local input for a tick.
+ *
+ * @param tick The tick the input drives.
+ * @param input The local input state.
+ */
+void LockstepTimeline::recordLocalInput(std::uint64_t tick, const InputState& input)
+{
+    localInputs[tick % ringSize] = packInput(input);
+    localNewest = tick + 1;  // Stored +1 so zero means "nothing recorded"
+}
+
+/**
+ * @brief Encodes the newest local inputs into a payload.
+ *
+ * The payload is the newest tick, a count, and that many masks
+ * walking backwards — the redundant tail that rides out datagram loss.
+ *
+ * @param out Receives the payload; cleared first.
+ */
+void LockstepTimeline::encodeInputs(std::vector<std::uint8_t>& out) const
+{
+    out.clear();
+    if (localNewest == 0)
+        return;
+
+    const std::uint64_t newest = localNewest - 1;
+    const std::size_t count = newest + 1 < redundancy ? static_cast<std::size_t>(newest + 1) : redundancy;
+    net::putVarint(out, newest);
+    out.push_back(static_cast<std::uint8_t>(count));
+    for (std::size_t i = 0; i < count; ++i)
+        out.push_back(localInputs[(newest - i) % ringSize]);
+}
+
+/**
+ * @brief Decodes a peer input payload into the remote ring.
+ *
+ * @param data The payload bytes.
+ * @param size The payload size.
+ * @return true If the payload parsed.
+ */
+bool LockstepTimeline::decodeInputs(const std::uint8_t* data, std::size_t size)
+{
+    const std::uint8_t* cursor = data;
+    const std::uint8_t* const end = data + size;
+
+    std::uint64_t newest;
+    if (!net::getVarint(cursor, end, newest) || cursor == end)
+        return false;
+    const std::size_t count = *cursor++;
+    if (count > redundancy || static_cast<std::size_t>(end - cursor) < count)
+        return false;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i > newest)
+            break;  // The tail reaches past tick 0; nothing further back exists
+        const std::uint64_t tick = newest - i;
+        remoteInputs[tick % ringSize] = cursor[i];
+        remoteTick[tick % ringSize] = tick + 1;  // +1: zero marks an empty slot
+    }
+    return true;
+}
+
+/**
+ * @brief Whether the remote input for a tick has arrived.
+ *
+ * @param tick The tick about to be simulated.
+ * @return true If remoteInput(tick) is valid.
+ */
+bool LockstepTimeline::remoteReady(std::uint64_t tick) const
+{
+    return remoteTick[tick % ringSize] == tick + 1;
+}
+
+/**
+ * @brief The remote input for a tick.
+ *
+ * @param tick The tick being simulated.
+ * @return InputState The peer's input.
+ */
+InputState LockstepTimeline::remoteInput(std::uint64_t tick) const
+{
+    const std::uint8_t mask = remoteInputs[tick % ringSize];
+    InputState input;
+    input.left = (mask & 1) != 0;
+    input.right = (mask & 2) != 0;
+    input.up = (mask & 4) != 0;
+    input.down = (mask & 8) != 0;
+    return input;
+}
+
+/**
+ * @brief Records the local state checksum for a tick.
+ *
+ * @param tick The tick the checksum was taken after.
+ * @param checksum The simulation checksum.
+ */
+void LockstepTimeline::recordLocalChecksum(std::uint64_t tick, std::uint64_t checksum)
+{
+    checksumTick[tick % checksumRingSize] = tick + 1;
+    checksumValue[tick % checksumRingSize] = checksum;
+}
+
+/**
+ * @brief Encodes the newest local checksum into a payload.
+ *
+ * @param out Receives the payload; cleared first.
+ */
+void LockstepTimeline::encodeChecksum(std::vector<std::uint8_t>& out) const
+{
+    out.clear();
+    std::uint64_t newest = 0;
+    std::size_t newestSlot = 0;
+    for (std::size_t i = 0; i < checksumRingSize; ++i)
+    {
+        if (checksumTick[i] > newest)
+        {
+            newest = checksumTick[i];
+            newestSlot = i;
+        }
+    }
+    if (newest == 0)
+        return;
+    net::putVarint(out, newest - 1);
+    net::putVarint(out, checksumValue[newestSlot]);
+}
+
+/**
+ * @brief Decodes and compares a peer checksum payload.
+ *
+ * @param data The payload bytes.
+ * @param size The payload size.
+ * @return true If the payload parsed.
+ */
+bool LockstepTimeline::decodeChecksum(const std::uint8_t* data, std::size_t size)
+{
+    const std::uint8_t* cursor = data;
+    const std::uint8_t* const end = data + size;
+
+    std::uint64_t tick, peerChecksum;
+    if (!net::getVarint(cursor, end, tick) || !net::getVarint(cursor, end, peerChecksum))
+        return false;
+
+    // Compare only if we still hold our checksum for that tick; an
+    // aged-out slot just means this report goes unverified
+    if (checksumTick[tick % checksumRingSize] == tick + 1
+        && checksumValue[tick % checksumRingSize] != peerChecksum
+        && diverged == 0)
+    {
+        diverged = tick + 1;
+    }
+    return true;
+}
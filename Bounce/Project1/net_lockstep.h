@@ -0,0 +1,129 @@
+#pragma once
+#include "simulation.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Input timeline and codec for lockstep netplay.
+ *
+ * Tournament mode exchanges inputs, not state: each peer feeds both
+ * input streams into an identical fixed-tick simulation, so the whole
+ * sync traffic is a 3-bit mask per tick and divergence is impossible
+ * unless the simulations themselves disagree. The tick math qualifies:
+ * every operation in the tick path is IEEE float add/sub/mul/div or
+ * compare in a fixed order — no transcendentals, no reductions whose
+ * order varies — which IEEE 754 defines bit-exactly, and the checksum
+ * harness proves the stream reproducible. As a safety net peers still
+ * swap state checksums at an interval and flag the first tick they
+ * disagree on.
+ *
+ * Wire format: each input payload carries the newest local tick and a
+ * redundant tail of the inputs before it, so any single datagram loss
+ * is covered by the next arrival; inputs are idempotent by tick, so
+ * duplicates cost nothing. A peer may only advance its simulation
+ * through ticks whose remote input has arrived — remoteReady() is the
+ * lockstep gate — and stalls otherwise, which is the mode's contract.
+ *
+ * SFML-free; a transport owns the sockets and hands payloads in and
+ * out of here.
+ */
+class LockstepTimeline {
+public:
+    /**
+     * @brief Records the local input for a tick; call before sending.
+     *
+     * @param tick The tick the input drives.
+     * @param input The local input state.
+     */
+    void recordLocalInput(std::uint64_t tick, const InputState& input);
+
+    /**
+     * @brief Encodes the newest local inputs into a payload.
+     *
+     * @param out Receives the payload; cleared first.
+     */
+    void encodeInputs(std::vector<std::uint8_t>& out) const;
+
+    /**
+     * @brief Decodes a peer input payload into the remote ring.
+     *
+     * @param data The payload bytes.
+     * @param size The payload size.
+     * @return true If the payload parsed.
+     */
+    bool decodeInputs(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * @brief Whether the remote input for a tick has arrived.
+     *
+     * The lockstep gate: do not simulate a tick this returns false for.
+     *
+     * @param tick The tick about to be simulated.
+     * @return true If remoteInput(tick) is valid.
+     */
+    bool remoteReady(std::uint64_t tick) const;
+
+    /**
+     * @brief The remote input for a tick; valid if remoteReady(tick).
+     *
+     * @param tick The tick being simulated.
+     * @return InputState The peer's input.
+     */
+    InputState remoteInput(std::uint64_t tick) const;
+
+    /**
+     * @brief Records the local state checksum for a tick.
+     *
+     * Call at the checksum interval; kept so a peer report for that
+     * tick can be compared.
+     *
+     * @param tick The tick the checksum was taken after.
+     * @param checksum The simulation checksum.
+     */
+    void recordLocalChecksum(std::uint64_t tick, std::uint64_t checksum);
+
+    /**
+     * @brief Encodes the newest local checksum into a payload.
+     *
+     * @param out Receives the payload; cleared first.
+     */
+    void encodeChecksum(std::vector<std::uint8_t>& out) const;
+
+    /**
+     * @brief Decodes and compares a peer checksum payload.
+     *
+     * A mismatch against the locally recorded checksum for the same
+     * tick latches divergedTick().
+     *
+     * @param data The payload bytes.
+     * @param size The payload size.
+     * @return true If the payload parsed.
+     */
+    bool decodeChecksum(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * @brief The first tick the peers' checksums disagreed on.
+     *
+     * @return std::uint64_t The tick, or 0 while the session agrees.
+     */
+    std::uint64_t divergedTick() const { return diverged; }
+
+private:
+    static constexpr std::size_t ringSize = 256; ///< Inputs held per side; power of two.
+    static constexpr std::size_t redundancy = 16; ///< Past inputs repeated in every payload.
+    static constexpr std::size_t checksumRingSize = 8; ///< Recent local checksums held.
+
+    /**
+     * @brief Packs an input state into its wire bits.
+     */
+    static std::uint8_t packInput(const InputState& input);
+
+    std::uint8_t localInputs[ringSize] = {}; ///< Local input masks by tick % ringSize.
+    std::uint64_t localNewest = 0; ///< Newest local tick recorded.
+    std::uint8_t remoteInputs[ringSize] = {}; ///< Remote input masks by tick % ringSize.
+    std::uint64_t remoteTick[ringSize] = {}; ///< Which tick occupies each remote slot.
+    std::uint64_t checksumTick[checksumRingSize] = {}; ///< Ticks of the recorded checksums.
+    std::uint64_t checksumValue[checksumRingSize] = {}; ///< The recorded checksums.
+    std::uint64_t diverged = 0; ///< First mismatching tick, or 0.
+};
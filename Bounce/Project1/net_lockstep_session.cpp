@@ -0,0 +1,76 @@
+#include "net_lockstep_session.h"
+
+/**
+ * @brief Opens the socket in non-blocking mode.
+ *
+ * @param port Local port to bind; sf::Socket::AnyPort for the connecting side.
+ * @return true If the socket bound.
+ */
+bool LockstepSession::open(unsigned short port)
+{
+    if (socket.bind(port) != sf::Socket::Done)
+        return false;
+    socket.setBlocking(false);
+    receiveThread.start(socket);
+    return true;
+}
+
+/**
+ * @brief Sets the peer everything is sent to.
+ *
+ * @param address The peer's address.
+ * @param port The peer's port.
+ */
+void LockstepSession::setPeer(const sf::IpAddress& address, unsigned short port)
+{
+    peerAddress = address;
+    peerPort = port;
+}
+
+/**
+ * @brief Records the local input and sends the input payload.
+ *
+ * @param tick The tick the input drives.
+ * @param input The local input state.
+ */
+void LockstepSession::sendInput(std::uint64_t tick, const InputState& input)
+{
+    inputTimeline.recordLocalInput(tick, input);
+    if (peerPort == 0)
+        return;
+    inputTimeline.encodeInputs(sendBuffer);
+    sendBuffer.insert(sendBuffer.begin(), packetInput);
+    socket.send(sendBuffer.data(), sendBuffer.size(), peerAddress, peerPort);
+}
+
+/**
+ * @brief Records the local checksum and sends the checksum payload.
+ *
+ * @param tick The tick the checksum was taken after.
+ * @param checksum The simulation checksum.
+ */
+void LockstepSession::sendChecksum(std::uint64_t tick, std::uint64_t checksum)
+{
+    inputTimeline.recordLocalChecksum(tick, checksum);
+    if (peerPort == 0)
+        return;
+    inputTimeline.encodeChecksum(sendBuffer);
+    sendBuffer.insert(sendBuffer.begin(), packetChecksum);
+    socket.send(sendBuffer.data(), sendBuffer.size(), peerAddress, peerPort);
+}
+
+/**
+ * @brief Processes every datagram the receive thread queued; never blocks.
+ */
+void LockstepSession::receive()
+{
+    receiveThread.drain([this](const std::uint8_t* data, std::size_t size, const sf::IpAddress&, unsigned short)
+    {
+        if (size < 1)
+            return;
+        if (data[0] == packetInput)
+            inputTimeline.decodeInputs(data + 1, size - 1);
+        else if (data[0] == packetChecksum)
+            inputTimeline.decodeChecksum(data + 1, size - 1);
+    });
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "net_lockstep.h"
+#include "net_thread.h"
+#include <SFML/Network.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief UDP transport around a LockstepTimeline.
+ *
+ * The thin half of lockstep mode: owns the socket and a
+ * NetReceiveThread, frames timeline payloads with a one-byte type, and
+ * feeds arrivals back into the timeline at tick boundaries. All the
+ * interesting logic — redundancy, the ready gate, the divergence latch
+ * — lives in the SFML-free timeline so it stays testable without a
+ * socket. Type bytes are disjoint from NetSync's so a capture of
+ * either mode's traffic reads unambiguously.
+ *
+ * All calls belong on the tick thread, the same contract as NetSync.
+ */
+class LockstepSession {
+public:
+    /**
+     * @brief Opens the socket in non-blocking mode.
+     *
+     * @param port Local port to bind; sf::Socket::AnyPort for the connecting side.
+     * @return true If the socket bound.
+     */
+    bool open(unsigned short port);
+
+    /**
+     * @brief Sets the peer everything is sent to.
+     *
+     * @param address The peer's address.
+     * @param port The peer's port.
+     */
+    void setPeer(const sf::IpAddress& address, unsigned short port);
+
+    /**
+     * @brief Records the local input and sends the input payload.
+     *
+     * Call once per tick before simulating it.
+     *
+     * @param tick The tick the input drives.
+     * @param input The local input state.
+     */
+    void sendInput(std::uint64_t tick, const InputState& input);
+
+    /**
+     * @brief Records the local checksum and sends the checksum payload.
+     *
+     * Call at the checksum interval.
+     *
+     * @param tick The tick the checksum was taken after.
+     * @param checksum The simulation checksum.
+     */
+    void sendChecksum(std::uint64_t tick, std::uint64_t checksum);
+
+    /**
+     * @brief Processes every datagram the receive thread queued;
+     * never blocks. Call at a tick boundary.
+     */
+    void receive();
+
+    /**
+     * @brief The timeline; the tick loop gates on its remoteReady().
+     *
+     * @return LockstepTimeline& The input timeline.
+     */
+    LockstepTimeline& timeline() { return inputTimeline; }
+
+private:
+    static constexpr std::uint8_t packetInput = 3; ///< Datagram type: input payload.
+    static constexpr std::uint8_t packetChecksum = 4; ///< Datagram type: checksum payload.
+
+    sf::UdpSocket socket; ///< The non-blocking socket.
+    NetReceiveThread receiveThread; ///< Drains the socket off-thread into its ring.
+    sf::IpAddress peerAddress = sf::IpAddress::None; ///< Where to send.
+    unsigned short peerPort = 0; ///< Peer port.
+
+    LockstepTimeline inputTimeline; ///< The input exchange and divergence latch.
+    std::vector<std::uint8_t> sendBuffer; ///< Encode scratch.
+};
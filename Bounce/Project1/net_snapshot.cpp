@@ -0,0 +1,176 @@
+#include "net_snapshot.h"
+#include "net_varint.h"
+#include "quant16.h"
+#include <cstring>
+
+namespace {
+
+using quant16::positionScale;
+using quant16::velocityScale;
+
+/**
+ * @brief Appends one field as a zigzag varint delta against its base.
+ */
+void putDelta(std::vector<std::uint8_t>& out, std::int64_t value, std::int64_t base)
+{
+    net::putVarint(out, net::zigzag(value - base));
+}
+
+/**
+ * @brief Reads one field delta and reapplies its base.
+ */
+bool getDelta(const std::uint8_t*& cursor, const std::uint8_t* end, std::int64_t base, std::int64_t& value)
+{
+    std::uint64_t raw;
+    if (!net::getVarint(cursor, end, raw))
+        return false;
+    value = base + net::unzigzag(raw);
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief Quantizes a simulation's syncable state into a net snapshot.
+ *
+ * @param sim The simulation to capture.
+ * @param out Receives the quantized state.
+ */
+void captureNetSnapshot(const Simulation& sim, NetSnapshot& out)
+{
+    out.playerX = static_cast<std::int32_t>(sim.playerX * positionScale);
+    out.playerY = static_cast<std::int32_t>(sim.playerY * positionScale);
+    out.velocityX = static_cast<std::int32_t>(sim.velocityX * velocityScale);
+    out.velocityY = static_cast<std::int32_t>(sim.velocityY * velocityScale);
+
+    out.coinWords.assign(sim.coinAlive.wordData(), sim.coinAlive.wordData() + sim.coinAlive.wordCount());
+
+    // One branchless batch transform over the SoA arrays: phases become
+    // 16-bit offsets from spawn, so range never depends on level length
+    out.obstacleX.resize(sim.store.obstacleX.size());
+    quant16::encodeRelative(sim.store.obstacleX.data(), sim.store.obstacleSpawnX.data(),
+                            out.obstacleX.data(), out.obstacleX.size(), positionScale);
+}
+
+/**
+ * @brief Encodes the next outgoing snapshot.
+ *
+ * @param snapshot The state to send; copied into the sent ring.
+ * @param out Receives the payload bytes; cleared first.
+ * @return std::uint32_t The payload's sequence number.
+ */
+std::uint32_t SnapshotEncoder::encode(const NetSnapshot& snapshot, std::vector<std::uint8_t>& out)
+{
+    const std::uint32_t sequence = nextSequence++;
+
+    // Delta against the newest acked snapshot still in the ring; zero
+    // (an all-zero implicit base) while nothing usable is acked
+    static const NetSnapshot emptyBase;
+    const NetSnapshot* base = &emptyBase;
+    std::uint32_t baseSequence = 0;
+    if (ackedSequence != 0 && sequence - ackedSequence < ringSize)
+    {
+        base = &ring[ackedSequence % ringSize];
+        baseSequence = ackedSequence;
+    }
+
+    out.clear();
+    net::putVarint(out, sequence);
+    net::putVarint(out, baseSequence);
+    putDelta(out, snapshot.playerX, base->playerX);
+    putDelta(out, snapshot.playerY, base->playerY);
+    putDelta(out, snapshot.velocityX, base->velocityX);
+    putDelta(out, snapshot.velocityY, base->velocityY);
+
+    net::putVarint(out, snapshot.coinWords.size());
+    for (std::size_t i = 0; i < snapshot.coinWords.size(); ++i)
+    {
+        const std::uint64_t baseWord = i < base->coinWords.size() ? base->coinWords[i] : 0;
+        net::putVarint(out, snapshot.coinWords[i] ^ baseWord);  // XOR: unchanged masks cost one byte
+    }
+
+    net::putVarint(out, snapshot.obstacleX.size());
+    for (std::size_t i = 0; i < snapshot.obstacleX.size(); ++i)
+    {
+        const std::int16_t baseX = i < base->obstacleX.size() ? base->obstacleX[i] : 0;
+        putDelta(out, snapshot.obstacleX[i], baseX);
+    }
+
+    ring[sequence % ringSize] = snapshot;
+    return sequence;
+}
+
+/**
+ * @brief Records the peer's newest acked sequence.
+ *
+ * @param sequence The sequence number from an ack packet.
+ */
+void SnapshotEncoder::acked(std::uint32_t sequence)
+{
+    if (sequence > ackedSequence && sequence < nextSequence)
+        ackedSequence = sequence;
+}
+
+/**
+ * @brief Decodes a received payload.
+ *
+ * @param data The payload bytes.
+ * @param size The payload size in bytes.
+ * @param out Receives the decoded snapshot on success.
+ * @return std::uint32_t The decoded sequence, or 0 on failure.
+ */
+std::uint32_t SnapshotDecoder::decode(const std::uint8_t* data, std::size_t size, NetSnapshot& out)
+{
+    const std::uint8_t* cursor = data;
+    const std::uint8_t* const end = data + size;
+
+    std::uint64_t sequence, baseSequence;
+    if (!net::getVarint(cursor, end, sequence) || !net::getVarint(cursor, end, baseSequence) || sequence == 0)
+        return 0;
+
+    static const NetSnapshot emptyBase;
+    const NetSnapshot* base = &emptyBase;
+    if (baseSequence != 0)
+    {
+        if (ringSequence[baseSequence % ringSize] != baseSequence)
+            return 0;  // The base is gone; drop and let the sender recover
+        base = &ring[baseSequence % ringSize];
+    }
+
+    std::int64_t value;
+    if (!getDelta(cursor, end, base->playerX, value)) return 0;
+    out.playerX = static_cast<std::int32_t>(value);
+    if (!getDelta(cursor, end, base->playerY, value)) return 0;
+    out.playerY = static_cast<std::int32_t>(value);
+    if (!getDelta(cursor, end, base->velocityX, value)) return 0;
+    out.velocityX = static_cast<std::int32_t>(value);
+    if (!getDelta(cursor, end, base->velocityY, value)) return 0;
+    out.velocityY = static_cast<std::int32_t>(value);
+
+    std::uint64_t count;
+    if (!net::getVarint(cursor, end, count) || count > 1024)
+        return 0;
+    out.coinWords.resize(static_cast<std::size_t>(count));
+    for (std::size_t i = 0; i < out.coinWords.size(); ++i)
+    {
+        std::uint64_t word;
+        if (!net::getVarint(cursor, end, word))
+            return 0;
+        out.coinWords[i] = word ^ (i < base->coinWords.size() ? base->coinWords[i] : 0);
+    }
+
+    if (!net::getVarint(cursor, end, count) || count > 1u << 20)
+        return 0;
+    out.obstacleX.resize(static_cast<std::size_t>(count));
+    for (std::size_t i = 0; i < out.obstacleX.size(); ++i)
+    {
+        const std::int16_t baseX = i < base->obstacleX.size() ? base->obstacleX[i] : 0;
+        if (!getDelta(cursor, end, baseX, value))
+            return 0;
+        out.obstacleX[i] = static_cast<std::int16_t>(value);
+    }
+
+    ring[sequence % ringSize] = out;
+    ringSequence[sequence % ringSize] = static_cast<std::uint32_t>(sequence);
+    return static_cast<std::uint32_t>(sequence);
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "simulation.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief One tick of syncable state, quantized for the wire.
+ *
+ * The fields mirror the savestate block's dynamic content — player
+ * position/velocity, the coin mask, obstacle phases — with positions
+ * quantized to 1/8 pixel and velocities to 1/4 px/s, which is below
+ * any visible threshold and makes every field a small integer whose
+ * tick-to-tick delta encodes in one or two bytes.
+ *
+ * The obstacle array uses the quant16 codec: each phase is a 16-bit
+ * offset from the obstacle's spawn x, so the bulk of the snapshot —
+ * and of the 64-entry delta rings both peers keep — is two bytes per
+ * obstacle instead of four. Patrol offsets are far inside the ±4096 px
+ * the relative encoding spans. The four player scalars stay int32:
+ * the player's absolute x outranges an int16 at 1/8 px, and at four
+ * fields the varint layer already shrinks them to a byte or two each.
+ */
+struct NetSnapshot {
+    std::int32_t playerX = 0; ///< Player x, 1/8-pixel units.
+    std::int32_t playerY = 0; ///< Player y, 1/8-pixel units.
+    std::int32_t velocityX = 0; ///< Player x velocity, 1/4 px/s units.
+    std::int32_t velocityY = 0; ///< Player y velocity, 1/4 px/s units.
+    std::vector<std::uint64_t> coinWords; ///< The coin alive mask, word for word.
+    std::vector<std::int16_t> obstacleX; ///< Obstacle phases as 1/8-pixel offsets from spawn x.
+};
+
+/**
+ * @brief Quantizes a simulation's syncable state into a net snapshot.
+ *
+ * @param sim The simulation to capture.
+ * @param out Receives the quantized state; vectors keep their capacity.
+ */
+void captureNetSnapshot(const Simulation& sim, NetSnapshot& out);
+
+/**
+ * @brief Delta-encoder for the sending side of the state sync.
+ *
+ * Each encode produces a packet payload: a sequence number, the
+ * sequence it deltas against (zero for a full snapshot), then every
+ * field as a zigzag varint of its difference from the base. Against
+ * the previous tick nearly every difference is zero or tiny, so the
+ * steady-state payload is a fraction of the raw block. The encoder
+ * keeps a ring of recently sent snapshots and deltas against the
+ * newest one the peer has acked — an unacked stretch just means
+ * slightly larger deltas, never a stall — and falls back to a full
+ * snapshot while no ack has arrived (or the acked base has left the
+ * ring).
+ */
+class SnapshotEncoder {
+public:
+    /**
+     * @brief Encodes the next outgoing snapshot.
+     *
+     * @param snapshot The state to send; copied into the sent ring.
+     * @param out Receives the payload bytes; cleared first.
+     * @return std::uint32_t The payload's sequence number.
+     */
+    std::uint32_t encode(const NetSnapshot& snapshot, std::vector<std::uint8_t>& out);
+
+    /**
+     * @brief Records the peer's newest acked sequence.
+     *
+     * @param sequence The sequence number from an ack packet.
+     */
+    void acked(std::uint32_t sequence);
+
+private:
+    static constexpr std::size_t ringSize = 64; ///< Sent snapshots kept as delta bases.
+
+    NetSnapshot ring[ringSize]; ///< Recently sent snapshots by sequence % ringSize.
+    std::uint32_t nextSequence = 1; ///< Sequence for the next encode; 0 means "no base".
+    std::uint32_t ackedSequence = 0; ///< Newest sequence the peer confirmed.
+};
+
+/**
+ * @brief Delta-decoder for the receiving side of the state sync.
+ *
+ * Mirrors the encoder's ring: every decoded snapshot is kept so a
+ * later payload can delta against whichever of them the sender used.
+ * A payload whose base has been lost (never received, or evicted) is
+ * dropped — the sender recovers by deltaing against an older ack or
+ * sending a full snapshot.
+ */
+class SnapshotDecoder {
+public:
+    /**
+     * @brief Decodes a received payload.
+     *
+     * @param data The payload bytes.
+     * @param size The payload size in bytes.
+     * @param out Receives the decoded snapshot on success.
+     * @return std::uint32_t The decoded sequence (this is what to ack),
+     * or 0 if the payload was undecodable or its base is missing.
+     */
+    std::uint32_t decode(const std::uint8_t* data, std::size_t size, NetSnapshot& out);
+
+private:
+    static constexpr std::size_t ringSize = 64; ///< Decoded snapshots kept as delta bases.
+
+    NetSnapshot ring[ringSize]; ///< Decoded snapshots by sequence % ringSize.
+    std::uint32_t ringSequence[ringSize] = {}; ///< Which sequence occupies each slot.
+};
@@ -0,0 +1,128 @@
+#include "net_sync.h"
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+constexpr float positionScale = 8.0f; ///< Matches the codec's quantization.
+constexpr float velocityScale = 4.0f; ///< Matches the codec's quantization.
+
+/**
+ * @brief Seconds on a steady clock, for the jitter buffer's local timeline.
+ */
+float localSeconds()
+{
+    return std::chrono::duration<float>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+/**
+ * @brief Opens the socket in non-blocking mode.
+ *
+ * @param port Local port to bind.
+ * @return true If the socket bound.
+ */
+bool NetSync::open(unsigned short port)
+{
+    if (socket.bind(port) != sf::Socket::Done)
+        return false;
+    socket.setBlocking(false);
+    receiveThread.attachCounters(counters);
+    receiveThread.start(socket);  // Receives never touch the tick thread's time
+    return true;
+}
+
+/**
+ * @brief Sets the peer everything is sent to.
+ *
+ * @param address The peer's address.
+ * @param port The peer's port.
+ */
+void NetSync::setPeer(const sf::IpAddress& address, unsigned short port)
+{
+    peerAddress = address;
+    peerPort = port;
+}
+
+/**
+ * @brief Captures, encodes and sends the local state.
+ *
+ * @param sim The local simulation.
+ */
+void NetSync::sendState(const Simulation& sim)
+{
+    if (peerAddress == sf::IpAddress::None)
+        return;
+
+    captureNetSnapshot(sim, local);
+    const std::uint32_t sequence = encoder.encode(local, sendBuffer);
+    sendBuffer.insert(sendBuffer.begin(), packetSnapshot);  // Type byte ahead of the payload
+
+    socket.send(sendBuffer.data(), sendBuffer.size(), peerAddress, peerPort);
+    payloadBytesAvg = payloadBytesAvg * 0.95f + static_cast<float>(sendBuffer.size()) * 0.05f;
+
+    // Timestamp by sequence for the ack-turnaround RTT, and credit the
+    // counters with the size this state would be unencoded
+    sendSeconds[sequence % rttRingSize] = localSeconds();
+    sendSequence[sequence % rttRingSize] = sequence;
+    const std::size_t rawBytes = 4 * sizeof(std::int32_t)
+        + local.coinWords.size() * sizeof(std::uint32_t)
+        + local.obstacleX.size() * sizeof(std::int16_t);
+    counters.addSent(sendBuffer.size(), rawBytes);
+}
+
+/**
+ * @brief Processes every datagram the receive thread queued; never blocks.
+ */
+void NetSync::receive()
+{
+    receiveThread.drain([this](const std::uint8_t* data, std::size_t size,
+                               const sf::IpAddress& from, unsigned short fromPort) {
+        if (size < 2)
+            return;
+        if (data[0] == packetSnapshot)
+        {
+            const std::uint32_t sequence = decoder.decode(data + 1, size - 1, remote);
+            if (sequence == 0)
+                return;  // Undecodable or its base is missing; the stream self-heals
+            if (sequence > remoteSequence)
+            {
+                if (remoteSequence != 0 && sequence > remoteSequence + 1)
+                    counters.addLost(sequence - remoteSequence - 1);  // Gap = inferred loss
+                remoteSequence = sequence;
+                remoteInterp.push(sequence,
+                                  static_cast<float>(remote.playerX) / positionScale,
+                                  static_cast<float>(remote.playerY) / positionScale,
+                                  static_cast<float>(remote.velocityX) / velocityScale,
+                                  static_cast<float>(remote.velocityY) / velocityScale,
+                                  localSeconds());
+            }
+
+            // Ack what we decoded so the peer's deltas stay tight
+            std::uint8_t ack[5] = { packetAck };
+            std::memcpy(ack + 1, &sequence, sizeof(sequence));
+            socket.send(ack, sizeof(ack), from, fromPort);
+        }
+        else if (data[0] == packetAck && size >= 5)
+        {
+            std::uint32_t sequence;
+            std::memcpy(&sequence, data + 1, sizeof(sequence));
+            encoder.acked(sequence);
+            if (sendSequence[sequence % rttRingSize] == sequence)
+                counters.addRtt(localSeconds() - sendSeconds[sequence % rttRingSize]);
+        }
+    });
+}
+
+/**
+ * @brief The remote player position in world pixels.
+ *
+ * @param x Receives the x coordinate.
+ * @param y Receives the y coordinate.
+ */
+void NetSync::remotePlayerPosition(float& x, float& y) const
+{
+    x = static_cast<float>(remote.playerX) / positionScale;
+    y = static_cast<float>(remote.playerY) / positionScale;
+}
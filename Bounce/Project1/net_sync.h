@@ -0,0 +1,137 @@
+#pragma once
+#include "net_snapshot.h"
+#include "net_interp.h"
+#include "net_thread.h"
+#include <SFML/Network.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief UDP transport for the delta-compressed state sync.
+ *
+ * Head-to-head cabinets run their own simulations and stream state at
+ * each other: after every tick sendState() quantizes the local state,
+ * delta-encodes it against the last snapshot the peer acked and fires
+ * one datagram; a dedicated NetReceiveThread parks in a socket
+ * selector and batches arrived datagrams into its wait-free ring, and
+ * receive() — called at a tick boundary — decodes them there,
+ * answering each with a one-byte-type ack so
+ * the peer's encoder can advance its delta base. Loss needs no
+ * handling beyond what the codec already does — a lost snapshot only
+ * means the next delta spans two ticks, and a lost ack only means a
+ * slightly staler base.
+ *
+ * The class owns the socket and the codec rings; the caller owns when
+ * to send and what to do with the remote state (drawing a ghost,
+ * race-position HUD). All calls belong on the tick thread.
+ */
+class NetSync {
+public:
+    /**
+     * @brief Opens the socket in non-blocking mode.
+     *
+     * @param port Local port to bind; sf::Socket::AnyPort for the connecting side.
+     * @return true If the socket bound.
+     */
+    bool open(unsigned short port);
+
+    /**
+     * @brief Sets the peer everything is sent to.
+     *
+     * @param address The peer's address.
+     * @param port The peer's port.
+     */
+    void setPeer(const sf::IpAddress& address, unsigned short port);
+
+    /**
+     * @brief Captures, encodes and sends the local state; call once per tick.
+     *
+     * @param sim The local simulation.
+     */
+    void sendState(const Simulation& sim);
+
+    /**
+     * @brief Processes every datagram the receive thread queued;
+     * never blocks. Call at a tick boundary.
+     *
+     * Peer snapshots update the remote state (and are acked); peer
+     * acks advance the encoder's delta base.
+     */
+    void receive();
+
+    /**
+     * @brief Whether a remote snapshot has ever been decoded.
+     *
+     * @return true Once remote state is valid.
+     */
+    bool hasRemoteState() const { return remoteSequence != 0; }
+
+    /**
+     * @brief The newest decoded remote state, quantized wire units.
+     *
+     * @return const NetSnapshot& The remote snapshot.
+     */
+    const NetSnapshot& remoteState() const { return remote; }
+
+    /**
+     * @brief The remote player position in world pixels.
+     *
+     * @param x Receives the x coordinate.
+     * @param y Receives the y coordinate.
+     */
+    void remotePlayerPosition(float& x, float& y) const;
+
+    /**
+     * @brief Configures the remote player's jitter buffer.
+     *
+     * @param tickDt The peer's fixed tick length in seconds.
+     * @param delaySeconds Playback delay behind the newest snapshot.
+     */
+    void configureInterpolation(float tickDt, float delaySeconds) { remoteInterp.init(tickDt, delaySeconds); }
+
+    /**
+     * @brief The remote player's jitter buffer; receive() feeds it and
+     * the render side samples it (and reads its HUD stats).
+     *
+     * @return SnapshotInterpolator& The interpolator.
+     */
+    SnapshotInterpolator& interpolator() { return remoteInterp; }
+
+    /**
+     * @brief Smoothed outgoing payload size, for the net counters.
+     *
+     * @return float Bytes per sent snapshot.
+     */
+    float averagePayloadBytes() const { return payloadBytesAvg; }
+
+    /**
+     * @brief The session's traffic counters; sample() them for the
+     * HUD or the telemetry export.
+     *
+     * @return NetCounters& The shared counters.
+     */
+    NetCounters& netCounters() { return counters; }
+
+private:
+    static constexpr std::uint8_t packetSnapshot = 1; ///< Datagram type: snapshot payload.
+    static constexpr std::uint8_t packetAck = 2; ///< Datagram type: ack.
+
+    sf::UdpSocket socket; ///< The non-blocking socket.
+    NetReceiveThread receiveThread; ///< Drains the socket off-thread into its ring.
+    sf::IpAddress peerAddress = sf::IpAddress::None; ///< Where to send.
+    unsigned short peerPort = 0; ///< Peer port.
+
+    SnapshotEncoder encoder; ///< Outgoing delta codec.
+    SnapshotDecoder decoder; ///< Incoming delta codec.
+    NetSnapshot local; ///< Capture scratch; keeps its vector capacity.
+    NetSnapshot remote; ///< Newest decoded peer state.
+    SnapshotInterpolator remoteInterp; ///< Jitter buffer over the decoded remote player.
+    std::uint32_t remoteSequence = 0; ///< Sequence of `remote`; 0 before first decode.
+    std::vector<std::uint8_t> sendBuffer; ///< Encode scratch.
+    float payloadBytesAvg = 0.0f; ///< Smoothed outgoing payload size.
+
+    NetCounters counters; ///< Traffic totals; receive thread and tick thread both feed it.
+    static constexpr std::size_t rttRingSize = 64; ///< Send timestamps held; matches the codec ring.
+    float sendSeconds[rttRingSize] = {}; ///< When each recent sequence went out.
+    std::uint32_t sendSequence[rttRingSize] = {}; ///< Which sequence occupies each slot.
+};
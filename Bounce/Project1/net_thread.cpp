@@ -0,0 +1,82 @@
+#include "net_thread.h"
+#include "alloc_tracker.h"
+
+NetReceiveThread::~NetReceiveThread()
+{
+    stop();
+}
+
+/**
+ * @brief Starts the worker on an open, non-blocking socket.
+ *
+ * @param socket The bound socket; must outlive the thread.
+ */
+void NetReceiveThread::start(sf::UdpSocket& boundSocket)
+{
+    slots = std::make_unique<Datagram[]>(slotCount);
+    socket = &boundSocket;
+    running.store(true, std::memory_order_release);
+    worker = std::thread(&NetReceiveThread::run, this);
+}
+
+/**
+ * @brief Stops and joins the worker; safe to call twice.
+ */
+void NetReceiveThread::stop()
+{
+    running.store(false, std::memory_order_release);
+    if (worker.joinable())
+        worker.join();  // At most one selector timeout away
+}
+
+/**
+ * @brief Worker body: wait on the selector, drain, publish.
+ */
+void NetReceiveThread::run()
+{
+    alloctrack::TagScope netTag(alloctrack::Net);  // Datagram queue growth lands on this gauge
+    sf::SocketSelector selector;
+    selector.add(*socket);
+
+    while (running.load(std::memory_order_acquire))
+    {
+        // The timeout bounds both shutdown latency and the cost of a
+        // quiet socket; a readable socket returns immediately
+        if (!selector.wait(sf::milliseconds(20)) || !selector.isReady(*socket))
+            continue;
+
+        // Drain the whole burst into the ring, then publish it with
+        // one store; the consumer sees the batch as a unit
+        std::uint32_t writeAt = head.load(std::memory_order_relaxed);
+        const std::uint32_t readTail = tail.load(std::memory_order_acquire);
+        bool wrote = false;
+        for (;;)
+        {
+            if (writeAt - readTail >= slotCount)
+            {
+                // Ring full: sink the datagram so the socket buffer
+                // cannot back up into the OS
+                Datagram sink;
+                std::size_t received = 0;
+                if (socket->receive(sink.bytes, sizeof(sink.bytes), received, sink.from, sink.port) != sf::Socket::Done)
+                    break;
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                if (counters)
+                    counters->addReceived(received);  // Arrived, even if unqueued
+                continue;
+            }
+
+            Datagram& slot = slots[writeAt % slotCount];
+            std::size_t received = 0;
+            if (socket->receive(slot.bytes, sizeof(slot.bytes), received, slot.from, slot.port) != sf::Socket::Done)
+                break;  // NotReady: the burst is drained
+            slot.size = static_cast<std::uint16_t>(received);
+            if (counters)
+                counters->addReceived(received);
+            ++writeAt;
+            wrote = true;
+        }
+        if (wrote)
+            head.store(writeAt, std::memory_order_release);
+    }
+}
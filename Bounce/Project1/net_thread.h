@@ -0,0 +1,109 @@
+#pragma once
+#include "net_counters.h"
+#include <SFML/Network.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+/**
+ * @brief Dedicated receive thread draining a UDP socket into a
+ * wait-free ring.
+ *
+ * Sockets must never block a tick. The worker parks in an
+ * sf::SocketSelector wait; when the socket turns readable it drains
+ * every pending datagram in one burst into preallocated ring slots and
+ * publishes the whole batch with a single release store — fifty queued
+ * packets cost the consumer one atomic acquire, not fifty handoffs.
+ * The simulation thread calls drain() at a tick boundary and processes
+ * in place; no allocation, no locks, no copies beyond the one off the
+ * socket. Single producer (the worker), single consumer (the tick
+ * thread), the snapshot channel's discipline.
+ *
+ * Sending stays on the tick thread directly on the same socket — a
+ * UDP send is one non-blocking syscall and shares no state with
+ * receives. A full ring drops the oldest-unread datagrams' successors
+ * (they are state snapshots; newer ones supersede them anyway).
+ */
+class NetReceiveThread {
+public:
+    ~NetReceiveThread();
+
+    /**
+     * @brief Starts the worker on an open, non-blocking socket.
+     *
+     * @param socket The bound socket; must outlive the thread.
+     */
+    void start(sf::UdpSocket& socket);
+
+    /**
+     * @brief Stops and joins the worker; safe to call twice.
+     */
+    void stop();
+
+    /**
+     * @brief Processes every queued datagram; tick thread only.
+     *
+     * @param handle Invoked as handle(data, size, fromAddress, fromPort).
+     * @return std::size_t Datagrams processed.
+     */
+    template <typename Fn>
+    std::size_t drain(Fn&& handle)
+    {
+        std::uint32_t readAt = tail.load(std::memory_order_relaxed);
+        const std::uint32_t readEnd = head.load(std::memory_order_acquire);
+        std::size_t processed = 0;
+        while (readAt != readEnd)
+        {
+            const Datagram& slot = slots[readAt % slotCount];
+            handle(slot.bytes, static_cast<std::size_t>(slot.size), slot.from, slot.port);
+            ++readAt;
+            ++processed;
+        }
+        tail.store(readAt, std::memory_order_release);
+        return processed;
+    }
+
+    /**
+     * @brief Points the worker at shared traffic counters.
+     *
+     * Call before start(); the worker bumps them with relaxed adds.
+     *
+     * @param shared The counters to feed.
+     */
+    void attachCounters(NetCounters& shared) { counters = &shared; }
+
+    /**
+     * @brief Datagrams dropped because the ring was full.
+     *
+     * @return std::uint64_t The drop count; for the net counters.
+     */
+    std::uint64_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @brief One received datagram in the ring.
+     */
+    struct Datagram {
+        sf::IpAddress from; ///< Sender address.
+        unsigned short port = 0; ///< Sender port.
+        std::uint16_t size = 0; ///< Payload bytes used.
+        std::uint8_t bytes[1472]; ///< Payload; one MTU's worth.
+    };
+
+    /**
+     * @brief Worker body: wait on the selector, drain, publish.
+     */
+    void run();
+
+    static constexpr std::size_t slotCount = 256; ///< Ring capacity; power of two.
+
+    std::unique_ptr<Datagram[]> slots; ///< The preallocated ring.
+    std::atomic<std::uint32_t> head{ 0 }; ///< Next slot to write; published per batch.
+    std::atomic<std::uint32_t> tail{ 0 }; ///< Next slot to read; consumer-owned.
+    std::atomic<std::uint64_t> droppedCount{ 0 }; ///< Datagrams discarded on a full ring.
+    std::atomic<bool> running{ false }; ///< Cleared by stop().
+    NetCounters* counters = nullptr; ///< Optional shared traffic counters.
+    sf::UdpSocket* socket = nullptr; ///< The socket being drained.
+    std::thread worker; ///< The receive thread.
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Varint and zigzag primitives shared by the wire codecs.
+ *
+ * Seven value bits per byte with the high bit chaining, and zigzag
+ * mapping so small signed magnitudes stay small. Every payload the
+ * network layer produces is built from these.
+ */
+namespace net {
+
+/**
+ * @brief Zigzag-maps a signed value so small magnitudes stay small.
+ */
+inline std::uint64_t zigzag(std::int64_t value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+/**
+ * @brief Undoes zigzag.
+ */
+inline std::int64_t unzigzag(std::uint64_t value)
+{
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+/**
+ * @brief Appends a varint to a payload.
+ */
+inline void putVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<std::uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+/**
+ * @brief Reads a varint; advances the cursor.
+ *
+ * @param cursor Read position; advanced past the varint.
+ * @param end One past the last readable byte.
+ * @param value Receives the decoded value.
+ * @return true If a complete varint was read within bounds.
+ */
+inline bool getVarint(const std::uint8_t*& cursor, const std::uint8_t* end, std::uint64_t& value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        if (cursor == end)
+            return false;
+        const std::uint8_t byte = *cursor++;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+} // namespace net
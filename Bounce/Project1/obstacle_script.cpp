@@ -0,0 +1,177 @@
+#include "obstacle_script.h"
+#include <cstring>
+
+namespace {
+
+// State word layout: remaining ticks in the low 16 bits, step index in
+// the next 8, patrol direction sign in bit 24 (set = moving left)
+constexpr std::uint32_t remainingMask = 0xFFFFu;
+constexpr std::uint32_t stepShift = 16;
+constexpr std::uint32_t stepMask = 0xFFu;
+constexpr std::uint32_t leftwardBit = 1u << 24;
+
+/**
+ * @brief A fresh state word at the start of a step.
+ */
+std::uint32_t packStep(std::size_t step, std::uint16_t remaining, bool leftward)
+{
+    return (remaining & remainingMask)
+         | (static_cast<std::uint32_t>(step & stepMask) << stepShift)
+         | (leftward ? leftwardBit : 0u);
+}
+
+} // namespace
+
+/**
+ * @brief Registers a behavior program.
+ *
+ * @param steps The program's steps, looped forever in order.
+ * @return ObstacleScriptEngine::ProgramId Id to attach to obstacles.
+ */
+ObstacleScriptEngine::ProgramId ObstacleScriptEngine::addProgram(std::vector<ScriptStep> steps)
+{
+    programs.push_back(std::move(steps));
+    return programs.size() - 1;
+}
+
+/**
+ * @brief Puts an obstacle under a program's control.
+ *
+ * @param store The entity store; the obstacle's velocity is zeroed.
+ * @param obstacle Obstacle index in the store.
+ * @param program Program from addProgram.
+ */
+void ObstacleScriptEngine::attach(EntityStore& store, std::size_t obstacle, ProgramId program)
+{
+    store.obstacleVelX[obstacle] = 0.0f;  // The patrol kernel must see it as stationary
+    scripted.push_back(Binding{ obstacle, program, store.obstacleY[obstacle] });
+    state.push_back(packStep(0, programs[program].front().durationTicks, false));
+}
+
+/**
+ * @brief Executes one tick of every scripted obstacle.
+ *
+ * One pass over the bindings; per entity this is a word decode, a
+ * switch on the step kind and a store write-back — no indirect calls.
+ *
+ * @param store The entity store whose positions are advanced.
+ * @param dt Fixed tick duration in seconds.
+ */
+void ObstacleScriptEngine::run(EntityStore& store, float dt)
+{
+    for (std::size_t s = 0; s < scripted.size(); ++s)
+    {
+        const Binding& binding = scripted[s];
+        const std::vector<ScriptStep>& program = programs[binding.program];
+        std::uint32_t word = state[s];
+        std::size_t step = (word >> stepShift) & stepMask;
+        bool leftward = (word & leftwardBit) != 0;
+        const std::size_t i = binding.obstacle;
+        const ScriptStep& current = program[step];
+
+        switch (current.op)
+        {
+        case ScriptStep::Op::Patrol:
+        {
+            float x = store.obstacleX[i] + (leftward ? -current.param : current.param) * dt;
+            if (x < store.obstacleLeftLimit[i])
+            {
+                x = store.obstacleLeftLimit[i];
+                leftward = false;
+            }
+            else if (x + store.obstacleW[i] > store.obstacleRightLimit[i])
+            {
+                x = store.obstacleRightLimit[i] - store.obstacleW[i];
+                leftward = true;
+            }
+            store.obstacleX[i] = x;
+            break;
+        }
+        case ScriptStep::Op::Dash:
+        {
+            float x = store.obstacleX[i] + current.param * dt;
+            if (x < store.obstacleLeftLimit[i])
+                x = store.obstacleLeftLimit[i];
+            else if (x + store.obstacleW[i] > store.obstacleRightLimit[i])
+                x = store.obstacleRightLimit[i] - store.obstacleW[i];
+            store.obstacleX[i] = x;
+            break;
+        }
+        case ScriptStep::Op::Hop:
+            store.obstacleY[i] += current.param * dt;
+            break;
+        case ScriptStep::Op::Pause:
+            break;
+        }
+
+        // Advance the step clock; on expiry move to the next step (the
+        // program loops) with its full duration
+        std::uint32_t remaining = word & remainingMask;
+        if (--remaining == 0)
+        {
+            step = step + 1 < program.size() ? step + 1 : 0;
+            remaining = program[step].durationTicks;
+        }
+        state[s] = packStep(step, static_cast<std::uint16_t>(remaining), leftward);
+    }
+}
+
+/**
+ * @brief Rewinds every scripted obstacle to its program start.
+ *
+ * @param store The entity store.
+ */
+void ObstacleScriptEngine::reset(EntityStore& store)
+{
+    for (std::size_t s = 0; s < scripted.size(); ++s)
+    {
+        const Binding& binding = scripted[s];
+        store.obstacleVelX[binding.obstacle] = 0.0f;  // resetObstacles restored the spawn velocity
+        store.obstacleY[binding.obstacle] = binding.baseY;
+        state[s] = packStep(0, programs[binding.program].front().durationTicks, false);
+    }
+}
+
+/**
+ * @brief Bytes of dynamic state in the savestate block.
+ *
+ * @return std::size_t One state word and one Y position per scripted obstacle.
+ */
+std::size_t ObstacleScriptEngine::stateBytes() const
+{
+    return scripted.size() * (sizeof(std::uint32_t) + sizeof(float));
+}
+
+/**
+ * @brief Copies the dynamic state into a savestate block.
+ *
+ * @param store The entity store, for the scripted Y positions.
+ * @param dst Destination with room for stateBytes().
+ */
+void ObstacleScriptEngine::captureState(const EntityStore& store, unsigned char* dst) const
+{
+    std::memcpy(dst, state.data(), state.size() * sizeof(std::uint32_t));
+    dst += state.size() * sizeof(std::uint32_t);
+    for (const Binding& binding : scripted)
+    {
+        std::memcpy(dst, &store.obstacleY[binding.obstacle], sizeof(float));
+        dst += sizeof(float);
+    }
+}
+
+/**
+ * @brief Restores the dynamic state from a savestate block.
+ *
+ * @param store The entity store receiving the scripted Y positions.
+ * @param src Block written by captureState with the same attachments.
+ */
+void ObstacleScriptEngine::restoreState(EntityStore& store, const unsigned char* src)
+{
+    std::memcpy(state.data(), src, state.size() * sizeof(std::uint32_t));
+    src += state.size() * sizeof(std::uint32_t);
+    for (const Binding& binding : scripted)
+    {
+        std::memcpy(&store.obstacleY[binding.obstacle], src, sizeof(float));
+        src += sizeof(float);
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include "entity_store.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief One step of an obstacle behavior program.
+ */
+struct ScriptStep {
+    /**
+     * @brief What the obstacle does during this step.
+     */
+    enum class Op : std::uint8_t {
+        Patrol, ///< Ping-pong between the patrol limits at `param` px/s.
+        Pause,  ///< Hold position.
+        Dash,   ///< Move horizontally at `param` px/s, clamped to the limits.
+        Hop     ///< Move vertically at `param` px/s (author symmetric up/down pairs).
+    };
+
+    Op op; ///< The step's operation.
+    std::uint16_t durationTicks; ///< Step length in fixed ticks; minimum 1.
+    float param; ///< Velocity in pixels per second; unused by Pause.
+};
+
+/**
+ * @brief Batch interpreter for scripted obstacle behaviors.
+ *
+ * A behavior is a loop of ScriptSteps — pauses, patrol stretches,
+ * dashes, hops — registered once as a program. Each scripted obstacle
+ * carries a single packed state word (current step, remaining ticks,
+ * patrol direction); run() executes every scripted obstacle in one pass
+ * over the SoA arrays, a switch on the step kind per entity instead of
+ * a virtual dispatch per object, so thousands of scripted obstacles
+ * stay one tight loop. Plain obstacles never enter the engine and keep
+ * the vectorized patrol kernel.
+ *
+ * Attaching zeroes the obstacle's store velocity so the patrol kernel
+ * and the sleep system's phase reconstruction both see it as
+ * stationary; all scripted motion comes from the interpreter. Step
+ * timing counts fixed ticks, so scripted levels stay deterministic and
+ * replay-exact; the dynamic words (and the Y positions Hop moves) are
+ * part of the savestate block whenever scripts are attached.
+ */
+class ObstacleScriptEngine {
+public:
+    /**
+     * @brief Identifies one registered program; see addProgram.
+     */
+    using ProgramId = std::size_t;
+
+    /**
+     * @brief Registers a behavior program.
+     *
+     * @param steps The program's steps, looped forever in order.
+     * @return ProgramId Id to attach to obstacles.
+     */
+    ProgramId addProgram(std::vector<ScriptStep> steps);
+
+    /**
+     * @brief Puts an obstacle under a program's control.
+     *
+     * @param store The entity store; the obstacle's velocity is zeroed.
+     * @param obstacle Obstacle index in the store.
+     * @param program Program from addProgram.
+     */
+    void attach(EntityStore& store, std::size_t obstacle, ProgramId program);
+
+    /**
+     * @brief Executes one tick of every scripted obstacle.
+     *
+     * @param store The entity store whose positions are advanced.
+     * @param dt Fixed tick duration in seconds.
+     */
+    void run(EntityStore& store, float dt);
+
+    /**
+     * @brief Rewinds every scripted obstacle to its program start.
+     *
+     * Called from Simulation::reset after resetObstacles, which has
+     * already put X back at spawn; this restores Y and re-zeroes the
+     * store velocities resetObstacles just restored.
+     *
+     * @param store The entity store.
+     */
+    void reset(EntityStore& store);
+
+    /**
+     * @brief Whether no obstacle is scripted (the engine costs nothing).
+     *
+     * @return true If run() would do no work.
+     */
+    bool empty() const { return scripted.empty(); }
+
+    /**
+     * @brief Bytes of dynamic state in the savestate block.
+     *
+     * @return std::size_t One state word and one Y position per scripted obstacle.
+     */
+    std::size_t stateBytes() const;
+
+    /**
+     * @brief Copies the dynamic state into a savestate block.
+     *
+     * @param store The entity store, for the scripted Y positions.
+     * @param dst Destination with room for stateBytes().
+     */
+    void captureState(const EntityStore& store, unsigned char* dst) const;
+
+    /**
+     * @brief Restores the dynamic state from a savestate block.
+     *
+     * @param store The entity store receiving the scripted Y positions.
+     * @param src Block written by captureState with the same attachments.
+     */
+    void restoreState(EntityStore& store, const unsigned char* src);
+
+private:
+    /**
+     * @brief One scripted obstacle: which obstacle, which program, its base Y.
+     */
+    struct Binding {
+        std::size_t obstacle; ///< Index into the store's obstacle arrays.
+        ProgramId program; ///< The behavior it runs.
+        float baseY; ///< Y at attach time, restored by reset().
+    };
+
+    std::vector<std::vector<ScriptStep>> programs; ///< All registered programs.
+    std::vector<Binding> scripted; ///< Scripted obstacles in attach order.
+    std::vector<std::uint32_t> state; ///< Packed word per scripted obstacle: remaining ticks (16), step (8), patrol direction (1).
+};
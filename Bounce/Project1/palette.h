@@ -0,0 +1,73 @@
+#pragma once
+#include <SFML/Graphics/Color.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Palette slot indices for the entity draw records.
+ *
+ * Draw records carry a 1-byte slot index instead of an sf::Color; the
+ * vertex-generation passes resolve the index through the active
+ * palette at submission time. Switching themes therefore swaps one
+ * 16-entry table (plus one static-bake re-pack) instead of rewriting
+ * a color into every record — the same instant whether the level has
+ * ten entities or a hundred thousand.
+ */
+namespace palette {
+    constexpr std::uint8_t Player = 0; ///< The player circle.
+    constexpr std::uint8_t Platform = 1; ///< Platforms and the floor.
+    constexpr std::uint8_t Wall = 2; ///< Walls.
+    constexpr std::uint8_t Goal = 3; ///< The level goal.
+    constexpr std::uint8_t Obstacle = 4; ///< Patrolling obstacles.
+    constexpr std::uint8_t Coin = 5; ///< Coins (flat-shape fallback and pickup sparkle).
+    constexpr std::uint8_t Ball = 6; ///< Party-mode balls.
+    constexpr std::uint8_t Ghost = 7; ///< Ghost racers (alpha is part of the entry).
+    constexpr std::uint8_t Background = 8; ///< The window clear color.
+    constexpr std::uint8_t Dust = 9; ///< Landing dust particles.
+
+    constexpr std::size_t slotCount = 16; ///< Entries per palette; unused slots stay default.
+}
+
+/**
+ * @brief One 16-entry color table; the active one is all a theme is.
+ */
+struct Palette {
+    sf::Color entries[palette::slotCount];
+
+    const sf::Color& operator[](std::uint8_t slot) const { return entries[slot]; }
+};
+
+namespace palette {
+    /// Number of built-in themes theme() can return.
+    constexpr std::size_t themeCount = 3;
+
+    /**
+     * @brief One of the built-in themes.
+     *
+     * Index 0 is the classic palette — the exact defaults of the old
+     * per-category constants, so the default look is unchanged. Index 1
+     * is a night variant, index 2 a high-contrast palette that keeps
+     * every category distinguishable without relying on red/green.
+     *
+     * @param index Theme index; wrapped modulo themeCount.
+     * @return const Palette& The theme's color table.
+     */
+    inline const Palette& theme(std::size_t index)
+    {
+        static const Palette themes[themeCount] = {
+            // Classic: the original per-category shape colors
+            { { sf::Color::Red, sf::Color::Green, sf::Color::Blue, sf::Color::Yellow,
+                sf::Color::Red, sf::Color::Yellow, sf::Color(255, 150, 40),
+                sf::Color(255, 255, 255, 90), sf::Color::Cyan, sf::Color(200, 200, 200) } },
+            // Night: dark backdrop, desaturated geometry, warm pickups
+            { { sf::Color(235, 90, 90), sf::Color(70, 110, 80), sf::Color(70, 80, 120), sf::Color(220, 190, 90),
+                sf::Color(200, 80, 80), sf::Color(230, 200, 100), sf::Color(220, 130, 50),
+                sf::Color(200, 210, 255, 70), sf::Color(18, 22, 34), sf::Color(120, 120, 140) } },
+            // High contrast: blue/orange axis, no red/green pairing
+            { { sf::Color(230, 120, 0), sf::Color(0, 90, 180), sf::Color(40, 40, 40), sf::Color(255, 220, 0),
+                sf::Color(150, 0, 200), sf::Color(255, 220, 0), sf::Color(230, 120, 0),
+                sf::Color(255, 255, 255, 120), sf::Color(240, 240, 240), sf::Color(90, 90, 90) } },
+        };
+        return themes[index % themeCount];
+    }
+}
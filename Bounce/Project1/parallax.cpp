@@ -0,0 +1,130 @@
+#include "parallax.h"
+#include "batch_renderer.h"
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+constexpr std::size_t layerCount = 3; ///< Far mountains, near hills, clouds.
+constexpr float layerFactors[layerCount] = { 0.1f, 0.25f, 0.4f }; ///< Scroll fraction per layer, farthest first.
+
+/**
+ * @brief The layers' own cheap RNG; baked once, so determinism between
+ * machines is irrelevant, but a fixed seed keeps the skyline stable
+ * between runs.
+ */
+std::uint32_t nextRandom(std::uint32_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace
+
+/**
+ * @brief Bakes the layers; call once on the render thread at load.
+ *
+ * @param width View width in pixels.
+ * @param height View height in pixels.
+ * @return true If every layer's render texture was created.
+ * @return false If render texture creation failed.
+ */
+bool ParallaxBackground::init(unsigned int width, unsigned int height)
+{
+    layers.clear();
+    for (std::size_t depth = 0; depth < layerCount; ++depth)
+    {
+        auto layer = std::make_unique<Layer>();
+        if (!layer->texture.create(width, height))
+        {
+            layers.clear();
+            return false;
+        }
+        layer->factor = layerFactors[depth];
+        paintLayer(*layer, depth);
+        layer->texture.setRepeated(true);  // Shifted texture rects wrap instead of clamping
+        layers.push_back(std::move(layer));
+    }
+    return true;
+}
+
+/**
+ * @brief Paints one layer's scenery into its texture.
+ *
+ * The scenery is procedural flat-color shapes in the game's palette:
+ * mountains on the far layer, hills in the middle, clouds on top. Shapes
+ * are placed so the left and right edges line up, keeping the repeat
+ * seamless.
+ *
+ * @param layer The layer to paint.
+ * @param depth Layer index from farthest (0) to nearest.
+ */
+void ParallaxBackground::paintLayer(Layer& layer, std::size_t depth)
+{
+    const float width = static_cast<float>(layer.texture.getSize().x);
+    const float height = static_cast<float>(layer.texture.getSize().y);
+    std::uint32_t rng = 0x2545F491u + static_cast<std::uint32_t>(depth) * 0x9E3779B9u;
+
+    layer.texture.clear(sf::Color::Transparent);
+    BatchRenderer scenery;
+
+    if (depth == 0)
+    {
+        // Far mountains: tall dimmed-blue triangles along the bottom
+        const sf::Color mountainColor(90, 140, 180);
+        for (float x = 0.0f; x < width; x += 160.0f)
+        {
+            const float peak = 180.0f + (nextRandom(rng) % 120);
+            scenery.addCircle(x - peak, height - peak, peak, mountainColor, 3);
+        }
+    }
+    else if (depth == 1)
+    {
+        // Near hills: wide semicircles hugging the bottom edge
+        const sf::Color hillColor(110, 185, 130);
+        for (float x = -60.0f; x < width; x += 200.0f)
+        {
+            const float radius = 90.0f + (nextRandom(rng) % 60);
+            scenery.addCircle(x, height - radius, radius, hillColor, 24);
+        }
+    }
+    else
+    {
+        // Clouds: clusters of soft white circles in the upper half
+        const sf::Color cloudColor(255, 255, 255, 200);
+        for (float x = 20.0f; x < width - 80.0f; x += 190.0f)
+        {
+            const float y = 40.0f + (nextRandom(rng) % 140);
+            scenery.addCircle(x, y, 28.0f, cloudColor, 16);
+            scenery.addCircle(x + 30.0f, y - 12.0f, 34.0f, cloudColor, 16);
+            scenery.addCircle(x + 66.0f, y, 26.0f, cloudColor, 16);
+        }
+    }
+
+    scenery.draw(layer.texture);
+    layer.texture.display();
+}
+
+/**
+ * @brief Draws every layer under the current view.
+ *
+ * @param target The render target to draw to.
+ * @param view The world view; layers scroll at a fraction of its center.
+ */
+void ParallaxBackground::draw(sf::RenderTarget& target, const sf::View& view)
+{
+    const sf::Vector2f topLeft(view.getCenter() - view.getSize() * 0.5f);
+    for (auto& layer : layers)
+    {
+        // The scroll shift goes into the texture rect, not the sprite
+        // position: the repeated texture wraps it for free
+        const int offsetX = static_cast<int>(std::floor(view.getCenter().x * layer->factor));
+        sf::Sprite quad(layer->texture.getTexture());
+        quad.setTextureRect(sf::IntRect(offsetX, 0,
+                                        static_cast<int>(view.getSize().x), static_cast<int>(view.getSize().y)));
+        quad.setPosition(topLeft);
+        target.draw(quad);
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Multi-layer parallax background baked to render textures.
+ *
+ * Each layer's scenery is drawn exactly once, at load, into an
+ * sf::RenderTexture; per frame a layer costs one screen-sized textured
+ * quad offset by a fraction of the camera position, so the background's
+ * frame cost is a handful of quads no matter how much is painted into
+ * the layers. The textures are repeated and sampled through a shifted
+ * texture rectangle, which gives seamless horizontal wrapping without
+ * drawing a second quad at the seam. Lives on the render thread — the
+ * render textures need the GL context — and reads only the view.
+ */
+class ParallaxBackground {
+public:
+    /**
+     * @brief Bakes the layers; call once on the render thread at load.
+     *
+     * @param width View width in pixels; each layer bakes at this size.
+     * @param height View height in pixels.
+     * @return true If every layer's render texture was created.
+     * @return false If render texture creation failed (layers are
+     * skipped at draw and the plain clear color shows instead).
+     */
+    bool init(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Draws every layer under the current view.
+     *
+     * @param target The render target to draw to.
+     * @param view The world view; layers scroll at a fraction of its center.
+     */
+    void draw(sf::RenderTarget& target, const sf::View& view);
+
+private:
+    /**
+     * @brief One baked layer and its scroll factor.
+     */
+    struct Layer {
+        sf::RenderTexture texture; ///< The baked scenery, repeated horizontally.
+        float factor = 0.0f; ///< Fraction of camera motion this layer scrolls at.
+    };
+
+    /**
+     * @brief Paints one layer's scenery into its texture.
+     *
+     * @param layer The layer to paint.
+     * @param depth Layer index from farthest (0) to nearest.
+     */
+    void paintLayer(Layer& layer, std::size_t depth);
+
+    std::vector<std::unique_ptr<Layer>> layers; ///< Farthest first; render textures are not movable, hence the indirection.
+};
@@ -0,0 +1,111 @@
+#include "particle_system.h"
+#include <cmath>
+
+namespace {
+
+constexpr float particleGravity = 600.0f; ///< Downward pull in pixels per second squared.
+constexpr float particleSize = 3.0f; ///< Quad edge length in pixels.
+
+} // namespace
+
+/**
+ * @brief Allocates the pool; the only allocation the system makes.
+ *
+ * @param capacity Maximum simultaneous live particles.
+ */
+void ParticleSystem::init(std::size_t capacity)
+{
+    posX.resize(capacity);
+    posY.resize(capacity);
+    velX.resize(capacity);
+    velY.resize(capacity);
+    life.resize(capacity);
+    color.resize(capacity);
+    live = 0;
+}
+
+/**
+ * @brief Emits a radial burst of particles.
+ *
+ * @param x Burst center x.
+ * @param y Burst center y.
+ * @param count Particles to emit (clamped to the pool's free space).
+ * @param color Particle color.
+ * @param minSpeed Minimum initial speed in pixels per second.
+ * @param maxSpeed Maximum initial speed in pixels per second.
+ * @param lifetime Particle lifetime in seconds.
+ */
+void ParticleSystem::emitBurst(float x, float y, std::size_t count, const sf::Color& burstColor,
+                               float minSpeed, float maxSpeed, float lifetime)
+{
+    const std::size_t free = posX.size() - live;
+    if (count > free)
+        count = free;  // The pool is the budget; drop the overflow
+
+    for (std::size_t n = 0; n < count; ++n)
+    {
+        // xorshift32: plenty for visual spread, no allocation, no libc
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 17;
+        rngState ^= rngState << 5;
+        const float angle = (rngState & 0xFFFF) * (6.2831853f / 65536.0f);
+        const float speed = minSpeed + ((rngState >> 16) & 0xFFFF) * ((maxSpeed - minSpeed) / 65536.0f);
+
+        const std::size_t i = live++;
+        posX[i] = x;
+        posY[i] = y;
+        velX[i] = std::cos(angle) * speed;
+        velY[i] = std::sin(angle) * speed;
+        life[i] = lifetime;
+        color[i] = burstColor;
+    }
+}
+
+/**
+ * @brief Advances all live particles by a frame.
+ *
+ * @param dt Frame duration in seconds.
+ */
+void ParticleSystem::update(float dt)
+{
+    // Integrate and age in one straight-line pass over the dense arrays;
+    // plain independent float ops, so the compiler vectorizes it
+    const float gravityStep = particleGravity * dt;
+    for (std::size_t i = 0; i < live; ++i)
+    {
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        velY[i] += gravityStep;
+        life[i] -= dt;
+    }
+
+    // Compact the dead by swap-with-last so the arrays stay dense; order
+    // between particles is meaningless, so the swap is free correctness
+    for (std::size_t i = 0; i < live;)
+    {
+        if (life[i] > 0.0f)
+        {
+            ++i;
+            continue;
+        }
+        const std::size_t last = --live;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        life[i] = life[last];
+        color[i] = color[last];
+    }
+}
+
+/**
+ * @brief Appends every live particle as a quad to a batch.
+ *
+ * @param batch The frame's batch renderer.
+ */
+void ParticleSystem::appendTo(BatchRenderer& batch) const
+{
+    for (std::size_t i = 0; i < live; ++i)
+        batch.addRect(posX[i] - particleSize * 0.5f, posY[i] - particleSize * 0.5f,
+                      particleSize, particleSize, color[i]);
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "batch_renderer.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Pooled particle effects with SoA state and one-batch submission.
+ *
+ * All particle state lives in parallel arrays allocated once at init:
+ * position, velocity, remaining life and color. The update is one tight
+ * pass over the arrays (integrate, age, gravity) with dead particles
+ * compacted by swap-with-last, so the arrays stay dense and the loop
+ * stays branch-light and vectorizable; rendering appends one small quad
+ * per particle to the frame's batch, so any number of live particles
+ * still costs a single draw call. Purely cosmetic — the system lives on
+ * the render thread and never touches simulation state.
+ */
+class ParticleSystem {
+public:
+    /**
+     * @brief Allocates the pool; the only allocation the system makes.
+     *
+     * @param capacity Maximum simultaneous live particles. Emissions
+     * beyond it are dropped, never grown.
+     */
+    void init(std::size_t capacity);
+
+    /**
+     * @brief Emits a radial burst of particles.
+     *
+     * Directions and speeds are drawn from the system's own cheap RNG;
+     * effects are cosmetic, so this randomness never feeds back into
+     * gameplay or determinism.
+     *
+     * @param x Burst center x.
+     * @param y Burst center y.
+     * @param count Particles to emit (clamped to the pool's free space).
+     * @param color Particle color.
+     * @param minSpeed Minimum initial speed in pixels per second.
+     * @param maxSpeed Maximum initial speed in pixels per second.
+     * @param lifetime Particle lifetime in seconds.
+     */
+    void emitBurst(float x, float y, std::size_t count, const sf::Color& color,
+                   float minSpeed, float maxSpeed, float lifetime);
+
+    /**
+     * @brief Advances all live particles by a frame.
+     *
+     * @param dt Frame duration in seconds.
+     */
+    void update(float dt);
+
+    /**
+     * @brief Appends every live particle as a quad to a batch.
+     *
+     * @param batch The frame's batch renderer.
+     */
+    void appendTo(BatchRenderer& batch) const;
+
+    /**
+     * @brief Number of currently live particles.
+     *
+     * @return std::size_t The live count.
+     */
+    std::size_t liveCount() const { return live; }
+
+private:
+    std::vector<float> posX; ///< Particle x positions.
+    std::vector<float> posY; ///< Particle y positions.
+    std::vector<float> velX; ///< Particle x velocities in pixels per second.
+    std::vector<float> velY; ///< Particle y velocities in pixels per second.
+    std::vector<float> life; ///< Remaining lifetime in seconds.
+    std::vector<sf::Color> color; ///< Particle colors.
+    std::size_t live = 0; ///< Live particles; they occupy indices [0, live).
+    std::uint32_t rngState = 0x9E3779B9u; ///< xorshift state for emission spread.
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include "config.h"
+
+/**
+ * @brief Physics constant providers for the templated tick variants.
+ *
+ * The tick reads its tuning through a profile type: the runtime
+ * profile loads each value off the live TuningConfig (the normal,
+ * live-reloadable path), while the classic profile returns the locked
+ * competition constants as literals. The tick body is a template over
+ * the profile, so the classic instantiation lets the compiler
+ * constant-fold every tuning multiply — and fold away whole blocks
+ * the constants disable, like the coin magnet at radius zero —
+ * instead of issuing a pointer load per value per tick. Both
+ * instantiations live in simulation.cpp; which one runs is a per-tick
+ * branch on Simulation::lockedPhysics.
+ */
+struct RuntimePhysicsProfile {
+    static float gravity(const TuningConfig* t) { return t->gravity; }
+    static float jumpStrength(const TuningConfig* t) { return t->jumpStrength; }
+    static float moveSpeed(const TuningConfig* t) { return t->moveSpeed; }
+    static float groundFriction(const TuningConfig* t) { return t->groundFriction; }
+    static float magnetRadius(const TuningConfig* t) { return t->magnetRadius; }
+    static float magnetPull(const TuningConfig* t) { return t->magnetPull; }
+};
+
+/**
+ * @brief The locked constants; identical to the TuningConfig defaults.
+ *
+ * The asserts below pin that equality, so a default-config runtime
+ * tick and a classic tick advance the simulation identically and the
+ * two variants can never drift apart when someone retunes a default.
+ */
+struct ClassicPhysicsProfile {
+    static constexpr float gravity(const TuningConfig*) { return 1800.0f; }
+    static constexpr float jumpStrength(const TuningConfig*) { return -720.0f; }
+    static constexpr float moveSpeed(const TuningConfig*) { return 300.0f; }
+    static constexpr float groundFriction(const TuningConfig*) { return 0.9f; }
+    static constexpr float magnetRadius(const TuningConfig*) { return 0.0f; }
+    static constexpr float magnetPull(const TuningConfig*) { return 240.0f; }
+};
+
+static_assert(ClassicPhysicsProfile::gravity(nullptr) == TuningConfig{}.gravity,
+              "classic profile must match the default tuning");
+static_assert(ClassicPhysicsProfile::jumpStrength(nullptr) == TuningConfig{}.jumpStrength,
+              "classic profile must match the default tuning");
+static_assert(ClassicPhysicsProfile::moveSpeed(nullptr) == TuningConfig{}.moveSpeed,
+              "classic profile must match the default tuning");
+static_assert(ClassicPhysicsProfile::groundFriction(nullptr) == TuningConfig{}.groundFriction,
+              "classic profile must match the default tuning");
+static_assert(ClassicPhysicsProfile::magnetRadius(nullptr) == TuningConfig{}.magnetRadius,
+              "classic profile must match the default tuning");
+static_assert(ClassicPhysicsProfile::magnetPull(nullptr) == TuningConfig{}.magnetPull,
+              "classic profile must match the default tuning");
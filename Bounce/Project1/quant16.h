@@ -0,0 +1,85 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Branchless 16-bit quantization codec for float SoA arrays.
+ *
+ * Positions quantize at 1/8 pixel and velocities at 1/4 px/s — both
+ * an order of magnitude below anything visible — so a snapshot field
+ * is two bytes instead of four, and a ring of them holds at half the
+ * memory. An absolute int16 at 1/8 px only spans ±4096 px, which a
+ * long generated level exceeds, so array encoding is relative to a
+ * per-element base (an obstacle's spawn x, a patrol origin): the
+ * offsets are patrol-sized, the range problem disappears, and the
+ * values stay small for the varint delta layer downstream.
+ *
+ * The transforms are straight-line per element: scale, clamp through
+ * min/max, round through lrintf — no data-dependent branches, so the
+ * compiler can vectorize the batch loops.
+ */
+namespace quant16 {
+
+constexpr float positionScale = 8.0f; ///< Quantization: 1/8 pixel (max error 1/16 px).
+constexpr float velocityScale = 4.0f; ///< Quantization: 1/4 px/s.
+
+/**
+ * @brief Quantizes one float onto a 16-bit grid.
+ *
+ * @param value The value to quantize.
+ * @param scale Grid steps per unit (positionScale or velocityScale).
+ * @return std::int16_t The nearest representable grid value, saturated.
+ */
+inline std::int16_t encode(float value, float scale)
+{
+    const float scaled = std::min(std::max(value * scale, -32768.0f), 32767.0f);
+    return static_cast<std::int16_t>(std::lrintf(scaled));
+}
+
+/**
+ * @brief Restores a quantized value to float.
+ *
+ * @param value The 16-bit grid value.
+ * @param scale The scale it was encoded with.
+ * @return float The grid point, within half a step of the original.
+ */
+inline float decode(std::int16_t value, float scale)
+{
+    return static_cast<float>(value) / scale;
+}
+
+/**
+ * @brief Quantizes an SoA array relative to a per-element base.
+ *
+ * @param src The float values.
+ * @param base Per-element reference values (e.g. spawn positions).
+ * @param dst Receives count quantized offsets.
+ * @param count Elements to transform.
+ * @param scale Grid steps per unit.
+ */
+inline void encodeRelative(const float* src, const float* base, std::int16_t* dst,
+                           std::size_t count, float scale)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        dst[i] = encode(src[i] - base[i], scale);
+}
+
+/**
+ * @brief Restores an SoA array from per-element-relative offsets.
+ *
+ * @param src The quantized offsets.
+ * @param base The same per-element reference values used to encode.
+ * @param dst Receives count restored floats.
+ * @param count Elements to transform.
+ * @param scale The scale the offsets were encoded with.
+ */
+inline void decodeRelative(const std::int16_t* src, const float* base, float* dst,
+                           std::size_t count, float scale)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        dst[i] = base[i] + decode(src[i], scale);
+}
+
+} // namespace quant16
@@ -0,0 +1,124 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Sorted render submission with state-change minimization.
+ *
+ * Draw order used to be fixed by code layout, which interleaved
+ * untextured geometry with textured sprites and text and paid a GL
+ * state change at every seam. Systems now push their items with a
+ * sort key — layer first, then texture, then blend mode — and one
+ * flush per pass orders the list and walks it, so everything sharing
+ * a texture submits back to back and the frame settles at a handful
+ * of binds regardless of push order.
+ *
+ * The queue is fixed-capacity and the sort is an in-place insertion
+ * sort (stable, so equal keys keep push order): a frame pushes well
+ * under a dozen items, and flush runs inside the allocation-forbidden
+ * region of the render loop.
+ */
+
+/// Draw layers, back to front; the major field of every sort key.
+namespace drawlayer {
+    enum : std::uint8_t {
+        Backdrop, ///< Parallax sky, behind everything.
+        Level, ///< The static level bake.
+        Entities, ///< The dynamic batch.
+        Overlay, ///< Camera-space dressing (victory image).
+        Hud, ///< Screen-space text.
+    };
+}
+
+/**
+ * @brief Fixed-capacity queue of type-erased draw items.
+ */
+class RenderQueue {
+public:
+    /**
+     * @brief Packs a sort key from its ordered fields.
+     *
+     * Layer dominates, blend mode breaks texture groups apart, and
+     * the texture pointer's stable bits group items that can share a
+     * bind. Items with equal keys draw in push order.
+     *
+     * @param layer The drawlayer value.
+     * @param texture The texture the item binds, or nullptr for none.
+     * @param blend A small blend-mode discriminator; 0 for the default.
+     * @return std::uint64_t The packed key.
+     */
+    static std::uint64_t makeKey(std::uint8_t layer, const void* texture, std::uint8_t blend = 0)
+    {
+        return (static_cast<std::uint64_t>(layer) << 56)
+            | (static_cast<std::uint64_t>(blend) << 48)
+            | ((reinterpret_cast<std::uintptr_t>(texture) >> 4) & 0xFFFFFFFFFFFFull);
+    }
+
+    /**
+     * @brief Queues one item; it must outlive the next flush.
+     *
+     * Accepts anything drawable: an sf::Drawable, or any object with
+     * a draw(sf::RenderTarget&) method (the bake, the batch).
+     *
+     * @param key The sort key from makeKey.
+     * @param item The item to draw.
+     */
+    template <typename T>
+    void push(std::uint64_t key, const T& item)
+    {
+        if (count >= capacity)
+            return;  // A dropped item is a visible bug, not a crash
+        items[count].key = key;
+        items[count].object = &item;
+        items[count].submit = [](const void* object, sf::RenderTarget& target) {
+            if constexpr (std::is_base_of<sf::Drawable, T>::value)
+                target.draw(*static_cast<const T*>(object));
+            else
+                static_cast<const T*>(object)->draw(target);
+        };
+        ++count;
+    }
+
+    /**
+     * @brief Sorts the queued items and draws them in key order.
+     *
+     * Clears the queue afterwards; each pass (world view, HUD view)
+     * flushes what it pushed.
+     *
+     * @param target The render target.
+     */
+    void flush(sf::RenderTarget& target)
+    {
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            const Item moving = items[i];
+            std::size_t slot = i;
+            while (slot > 0 && items[slot - 1].key > moving.key)
+            {
+                items[slot] = items[slot - 1];
+                --slot;
+            }
+            items[slot] = moving;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+            items[i].submit(items[i].object, target);
+        count = 0;
+    }
+
+private:
+    /**
+     * @brief One queued draw: its key and a type-erased submit.
+     */
+    struct Item {
+        std::uint64_t key = 0; ///< Sort key; layer, blend, texture.
+        const void* object = nullptr; ///< The item to draw.
+        void (*submit)(const void*, sf::RenderTarget&) = nullptr; ///< Draws it.
+    };
+
+    static const std::size_t capacity = 64; ///< Far above any frame's item count.
+
+    Item items[capacity]; ///< The queued items.
+    std::size_t count = 0; ///< Items queued since the last flush.
+};
@@ -0,0 +1,128 @@
+#pragma once
+#include "alive_mask.h"
+#include "geometry.h"
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+struct LevelData;
+
+/**
+ * @brief One published frame of simulation state for the render thread.
+ *
+ * Everything drawing needs — and nothing else — copied out of the
+ * simulation at the end of a tick. Previous-tick positions ride along so
+ * the render thread can interpolate moving entities on its own clock;
+ * static geometry is not included because the render thread owns its
+ * GPU-resident bake.
+ */
+struct RenderSnapshot {
+    std::uint64_t sequence = 0; ///< Publish order; stamped by the channel.
+
+    float playerPrevX = 0.0f; ///< Player left edge at the previous tick.
+    float playerPrevY = 0.0f; ///< Player top edge at the previous tick.
+    float playerX = 0.0f; ///< Player left edge at this tick.
+    float playerY = 0.0f; ///< Player top edge at this tick.
+    float cameraX = 0.0f; ///< Camera center x.
+    float cameraY = 0.0f; ///< Camera center y.
+    Aabb<float> cameraRect; ///< The camera's visible world rect; culling reads this.
+    int coinCount = 0; ///< Coins collected.
+    std::uint32_t bounceCount = 0; ///< Platform bounces so far; effects trigger off increases.
+    float bounceX = 0.0f; ///< Bottom-center x of the most recent bounce.
+    float bounceY = 0.0f; ///< Contact y of the most recent bounce.
+    std::uint32_t deathCount = 0; ///< Deaths since launch; telemetry reads it here.
+    std::uint32_t resetCount = 0; ///< Full resets since launch.
+    std::uint64_t tickIndex = 0; ///< The simulation tick this snapshot was taken at.
+    bool levelCompleted = false; ///< True once the goal is reached.
+
+    /**
+     * The level being played. A campaign transition bumps the
+     * generation, telling the render thread to rebuild its draw records
+     * and static bake from the new level's records. The pointer targets
+     * the campaign's cache, whose entries are address-stable and whose
+     * eviction spares the two most recent levels, so the previous
+     * level's data outlives any snapshot still in flight.
+     */
+    const LevelData* level = nullptr; ///< The decoded level this state plays in.
+    std::uint32_t levelGeneration = 0; ///< Bumped once per level transition.
+
+    std::uint32_t lateChunks = 0; ///< Restreams the chunk prefetch failed to warm; target zero.
+    std::vector<float> obstaclePrevX; ///< Obstacle left edges at the previous tick.
+    std::vector<float> obstacleX; ///< Obstacle left edges at this tick.
+    std::vector<float> ballPrevX; ///< Ball left edges at the previous tick.
+    std::vector<float> ballPrevY; ///< Ball top edges at the previous tick.
+    std::vector<float> ballX; ///< Ball left edges at this tick.
+    std::vector<float> ballY; ///< Ball top edges at this tick.
+    std::vector<float> ghostPrevX; ///< Ghost player x at the previous tick.
+    std::vector<float> ghostPrevY; ///< Ghost player y at the previous tick.
+    std::vector<float> ghostX; ///< Ghost player x at this tick.
+    std::vector<float> ghostY; ///< Ghost player y at this tick.
+    AliveMask coinAlive; ///< Live bit per coin.
+    std::vector<float> coinX; ///< Coin left edges when the magnet has drifted them; empty while coins sit home.
+    std::vector<float> coinY; ///< Coin top edges, paired with coinX.
+
+    std::chrono::steady_clock::time_point tickTime; ///< When this tick was published.
+    float tickDt = 0.0f; ///< Tick duration in seconds, for interpolation.
+};
+
+/**
+ * @brief Wait-free triple-buffered channel from the tick loop to the render thread.
+ *
+ * The writer fills its private slot and publishes it with one atomic
+ * exchange; the reader takes the newest published slot the same way.
+ * With three slots the writer always owns a free buffer — neither thread
+ * ever blocks or tears, so a slow GPU frame cannot stall physics and a
+ * long tick cannot stall presentation. Single writer, single reader.
+ */
+class SnapshotChannel {
+public:
+    /**
+     * @brief Returns the writer's current slot to fill in.
+     *
+     * @return RenderSnapshot& The slot; publish() submits it.
+     */
+    RenderSnapshot& beginWrite() { return slots[writeIndex]; }
+
+    /**
+     * @brief Publishes the filled slot as the newest snapshot.
+     *
+     * The slot previously held as newest becomes the writer's next
+     * scratch slot.
+     */
+    void publish()
+    {
+        slots[writeIndex].sequence = ++writeSequence;
+        writeIndex = latest.exchange(writeIndex, std::memory_order_acq_rel);
+        published.store(writeSequence, std::memory_order_release);
+    }
+
+    /**
+     * @brief Takes the newest published snapshot, if any.
+     *
+     * Only swaps slots when something newer than the held snapshot has
+     * been published; between publishes the reader keeps (and re-gets)
+     * its current slot, so the writer's free-slot invariant holds.
+     *
+     * @return const RenderSnapshot* The newest snapshot, or nullptr
+     * before the first publish.
+     */
+    const RenderSnapshot* acquire()
+    {
+        if (published.load(std::memory_order_acquire) == readSequence)
+            return readSequence != 0 ? &slots[readIndex] : nullptr;
+
+        readIndex = latest.exchange(readIndex, std::memory_order_acq_rel);
+        readSequence = slots[readIndex].sequence;
+        return &slots[readIndex];
+    }
+
+private:
+    RenderSnapshot slots[3]; ///< One writer slot, one newest, one reader slot.
+    std::atomic<int> latest{ 1 }; ///< Slot index holding the newest published snapshot.
+    std::atomic<std::uint64_t> published{ 0 }; ///< Sequence of the newest publish.
+    int writeIndex = 0; ///< Writer-owned slot; writer thread only.
+    std::uint64_t writeSequence = 0; ///< Publishes so far; writer thread only.
+    int readIndex = 2; ///< Reader-owned slot; reader thread only.
+    std::uint64_t readSequence = 0; ///< Sequence of the held snapshot; reader thread only.
+};
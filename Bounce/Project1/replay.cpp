@@ -0,0 +1,263 @@
+#include "replay.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief Packs an InputState into its four key bits.
+ *
+ * @param input The input to pack.
+ * @return std::uint8_t Bits 0..3 as left, right, up, down.
+ */
+std::uint8_t packBits(const InputState& input)
+{
+    return static_cast<std::uint8_t>((input.left ? 1 : 0) | (input.right ? 2 : 0) | (input.up ? 4 : 0) | (input.down ? 8 : 0));
+}
+
+/**
+ * @brief Unpacks four key bits into an InputState.
+ *
+ * @param bits Bits 0..3 as left, right, up, down.
+ * @return InputState The unpacked input.
+ */
+InputState unpackBits(std::uint8_t bits)
+{
+    InputState input;
+    input.left = (bits & 1) != 0;
+    input.right = (bits & 2) != 0;
+    input.up = (bits & 4) != 0;
+    input.down = (bits & 8) != 0;
+    return input;
+}
+
+} // namespace
+
+/**
+ * @brief Starts a new recording, discarding any previous one.
+ *
+ * @param keyframeInterval Ticks between embedded state keyframes.
+ */
+void ReplayRecorder::start(std::uint32_t keyframeInterval)
+{
+    stream.clear();
+    keyframes.clear();
+    keyframeStates.clear();
+    tickCount = 0;
+    stateBytes = 0;
+    interval = keyframeInterval > 0 ? keyframeInterval : 600;
+    bitCursor = 0;
+    lastBits = 0;
+    active = true;
+}
+
+/**
+ * @brief Appends one bit to the stream.
+ *
+ * @param bit The bit value.
+ */
+void ReplayRecorder::pushBit(bool bit)
+{
+    if (bitCursor == 0)
+        stream.push_back(0);
+    if (bit)
+        stream.back() |= static_cast<std::uint8_t>(1u << bitCursor);
+    bitCursor = (bitCursor + 1) % 8;
+}
+
+/**
+ * @brief Appends one tick of input to the stream.
+ *
+ * @param input The input held during this tick.
+ * @param sim The simulation about to consume @p input.
+ */
+void ReplayRecorder::record(const InputState& input, const Simulation& sim)
+{
+    if (!active)
+        return;
+
+    if (tickCount % interval == 0)
+    {
+        // Pre-tick state plus the decoder position entering this tick:
+        // everything a seek needs to resume the stream exactly here
+        stateBytes = sim.stateSize();
+        replay::KeyframeRecord keyframe = {};
+        keyframe.tick = tickCount;
+        keyframe.bitPos = static_cast<std::uint64_t>(stream.size()) * 8
+            - (bitCursor == 0 ? 0 : 8 - bitCursor);
+        keyframe.inputBits = lastBits;
+        keyframes.push_back(keyframe);
+        keyframeStates.resize(keyframeStates.size() + stateBytes);
+        sim.captureState(keyframeStates.data() + keyframeStates.size() - stateBytes);
+    }
+
+    const std::uint8_t bits = packBits(input);
+    if (bits == lastBits)
+    {
+        pushBit(false);  // Unchanged: one bit for the whole tick
+    }
+    else
+    {
+        pushBit(true);
+        pushBit((bits & 1) != 0);
+        pushBit((bits & 2) != 0);
+        pushBit((bits & 4) != 0);
+        pushBit((bits & 8) != 0);
+        lastBits = bits;
+    }
+    tickCount++;
+}
+
+/**
+ * @brief Stops recording and writes the replay file.
+ *
+ * @param path Path of the replay file to write.
+ * @return true If the file was written successfully.
+ * @return false If the file could not be written.
+ */
+bool ReplayRecorder::stop(const std::string& path)
+{
+    active = false;
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+
+    replay::Header header = {};
+    std::memcpy(header.magic, "BRPL", 4);
+    header.version = replay::replayVersion;
+    header.tickCount = tickCount;
+    header.streamBytes = stream.size();
+    header.stateSize = stateBytes;
+    header.keyframeInterval = interval;
+    header.keyframeCount = static_cast<std::uint32_t>(keyframes.size());
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && (stream.empty() || std::fwrite(stream.data(), 1, stream.size(), file) == stream.size());
+    ok = ok && (keyframes.empty() || std::fwrite(keyframes.data(), sizeof(replay::KeyframeRecord), keyframes.size(), file) == keyframes.size());
+    ok = ok && (keyframeStates.empty() || std::fwrite(keyframeStates.data(), 1, keyframeStates.size(), file) == keyframeStates.size());
+
+    std::fclose(file);
+    return ok;
+}
+
+/**
+ * @brief Loads a replay file and rewinds to its first tick.
+ *
+ * @param path Path of the replay file.
+ * @return true If the file was loaded and its header is valid.
+ * @return false If the file is missing, unreadable or malformed.
+ */
+bool ReplayPlayer::load(const std::string& path)
+{
+    tickCount = 0;
+    stateBytes = 0;
+    tick = 0;
+    bitPos = 0;
+    currentBits = 0;
+    stream.clear();
+    keyframes.clear();
+    keyframeStates.clear();
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    replay::Header header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+        && std::memcmp(header.magic, "BRPL", 4) == 0
+        && header.version == replay::replayVersion;
+
+    if (ok)
+    {
+        stream.resize(static_cast<std::size_t>(header.streamBytes));
+        keyframes.resize(header.keyframeCount);
+        keyframeStates.resize(static_cast<std::size_t>(header.stateSize) * header.keyframeCount);
+
+        ok = (stream.empty() || std::fread(stream.data(), 1, stream.size(), file) == stream.size())
+            && (keyframes.empty() || std::fread(keyframes.data(), sizeof(replay::KeyframeRecord), keyframes.size(), file) == keyframes.size())
+            && (keyframeStates.empty() || std::fread(keyframeStates.data(), 1, keyframeStates.size(), file) == keyframeStates.size());
+        if (ok)
+        {
+            tickCount = header.tickCount;
+            stateBytes = header.stateSize;
+        }
+    }
+
+    std::fclose(file);
+    return ok;
+}
+
+/**
+ * @brief Seeks playback to @p targetTick at interactive speed.
+ *
+ * @param targetTick The tick to land on.
+ * @param sim The simulation to restore and replay into.
+ * @param dt Fixed tick duration in seconds.
+ * @return true If the seek landed on the target.
+ * @return false If the target is out of range or the keyframe state
+ * size does not match this simulation.
+ */
+bool ReplayPlayer::seek(std::uint64_t targetTick, Simulation& sim, float dt)
+{
+    if (targetTick > tickCount || keyframes.empty() || stateBytes != sim.stateSize())
+        return false;
+
+    // Latest keyframe at or before the target
+    const auto after = std::upper_bound(keyframes.begin(), keyframes.end(), targetTick,
+                                        [](std::uint64_t t, const replay::KeyframeRecord& k) { return t < k.tick; });
+    const replay::KeyframeRecord& keyframe = *(after - 1);
+    const std::size_t index = static_cast<std::size_t>(&keyframe - keyframes.data());
+
+    sim.restoreState(keyframeStates.data() + index * stateBytes, dt);
+    tick = keyframe.tick;
+    bitPos = keyframe.bitPos;
+    currentBits = keyframe.inputBits;
+
+    // At most one interval of ticks to land exactly on the target
+    InputState input;
+    while (tick < targetTick && next(input))
+        sim.tick(dt, input);
+    return tick == targetTick;
+}
+
+/**
+ * @brief Reads one bit from the stream.
+ *
+ * @return bool The bit value.
+ */
+bool ReplayPlayer::pullBit()
+{
+    const std::uint8_t byte = stream[static_cast<std::size_t>(bitPos / 8)];
+    const bool bit = (byte >> (bitPos % 8)) & 1;
+    bitPos++;
+    return bit;
+}
+
+/**
+ * @brief Decodes the next tick of input.
+ *
+ * @param out Receives the input for this tick.
+ * @return true If a tick was decoded.
+ * @return false If the stream is exhausted; @p out is untouched.
+ */
+bool ReplayPlayer::next(InputState& out)
+{
+    if (tick >= tickCount)
+        return false;
+
+    if (pullBit())  // Input changed this tick
+    {
+        std::uint8_t bits = 0;
+        if (pullBit()) bits |= 1;
+        if (pullBit()) bits |= 2;
+        if (pullBit()) bits |= 4;
+        if (pullBit()) bits |= 8;
+        currentBits = bits;
+    }
+
+    out = unpackBits(currentBits);
+    tick++;
+    return true;
+}
@@ -0,0 +1,190 @@
+#pragma once
+#include "simulation.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief On-disk layout of the binary replay format.
+ *
+ * A replay is a header followed by a delta-encoded bit stream of the
+ * per-tick input: one bit per tick that says "unchanged", or a one bit
+ * followed by the four key bits (left, right, up, down) when the input
+ * changed. Held keys therefore cost one bit per tick and a full minute
+ * of 120Hz input is under a kilobyte. Combined with the fixed timestep
+ * and the deterministic Simulation, playing a stream back from reset
+ * reproduces a run exactly.
+ */
+namespace replay {
+
+constexpr std::uint32_t replayVersion = 3; ///< Bumped on any layout change.
+
+/**
+ * @brief Fixed header at the start of every replay file.
+ */
+struct Header {
+    char magic[4]; ///< "BRPL".
+    std::uint32_t version; ///< Must equal replayVersion.
+    std::uint64_t tickCount; ///< Number of ticks encoded in the stream.
+    std::uint64_t streamBytes; ///< Size of the input bit stream in bytes.
+    std::uint64_t stateSize; ///< Bytes per keyframe state block.
+    std::uint32_t keyframeInterval; ///< Ticks between keyframes.
+    std::uint32_t keyframeCount; ///< Keyframes following the stream.
+};
+
+/**
+ * @brief One seek point: where tick N starts in the stream, and the
+ * full state to restore before replaying from it.
+ *
+ * The state blob (stateSize bytes from Simulation::captureState)
+ * follows each record directly. Seeking is a binary search over the
+ * table, one restore, and a replay of at most keyframeInterval ticks.
+ */
+struct KeyframeRecord {
+    std::uint64_t tick; ///< The tick this keyframe precedes.
+    std::uint64_t bitPos; ///< Bit offset of this tick's input encoding.
+    std::uint8_t inputBits; ///< Decoder key-bit state entering this tick.
+    std::uint8_t reserved[7]; ///< Padding; keeps the blob 8-aligned.
+};
+
+} // namespace replay
+
+/**
+ * @brief Records per-tick input into a delta-encoded bit stream.
+ *
+ * Recording appends a bit or five per tick to an in-memory buffer; the
+ * file is written once when recording stops, so the tick path never
+ * touches the filesystem.
+ */
+class ReplayRecorder {
+public:
+    /**
+     * @brief Starts a new recording, discarding any previous one.
+     *
+     * The caller resets the simulation alongside this so the stream
+     * always starts from the initial state.
+     *
+     * @param keyframeInterval Ticks between embedded state keyframes;
+     * 600 is five seconds at the 120Hz tick.
+     */
+    void start(std::uint32_t keyframeInterval = 600);
+
+    /**
+     * @brief Whether a recording is in progress.
+     *
+     * @return true If record() calls are being captured.
+     * @return false Otherwise.
+     */
+    bool recording() const { return active; }
+
+    /**
+     * @brief Appends one tick of input to the stream.
+     *
+     * Call before the tick runs: at the keyframe interval the
+     * simulation's pre-tick state is captured as a seek point, so it
+     * must not have consumed this tick's input yet.
+     *
+     * @param input The input held during this tick.
+     * @param sim The simulation about to consume @p input.
+     */
+    void record(const InputState& input, const Simulation& sim);
+
+    /**
+     * @brief Stops recording and writes the replay file.
+     *
+     * @param path Path of the replay file to write.
+     * @return true If the file was written successfully.
+     * @return false If the file could not be written.
+     */
+    bool stop(const std::string& path);
+
+private:
+    /**
+     * @brief Appends one bit to the stream.
+     *
+     * @param bit The bit value.
+     */
+    void pushBit(bool bit);
+
+    std::vector<std::uint8_t> stream; ///< The packed bit stream.
+    std::vector<replay::KeyframeRecord> keyframes; ///< Seek points captured so far.
+    std::vector<unsigned char> keyframeStates; ///< Their state blobs, stateSize bytes each.
+    std::uint64_t tickCount = 0; ///< Ticks recorded so far.
+    std::uint64_t stateBytes = 0; ///< Bytes per keyframe state block.
+    std::uint32_t interval = 600; ///< Ticks between keyframes.
+    std::uint32_t bitCursor = 0; ///< Next free bit within the last byte.
+    std::uint8_t lastBits = 0; ///< The previous tick's four key bits.
+    bool active = false; ///< True while recording.
+};
+
+/**
+ * @brief Plays a recorded input stream back into the simulation.
+ *
+ * The stream is loaded whole; next() decodes one tick per call and is a
+ * handful of bit operations, so playback can also drive headless runs
+ * at full speed.
+ */
+class ReplayPlayer {
+public:
+    /**
+     * @brief Loads a replay file and rewinds to its first tick.
+     *
+     * @param path Path of the replay file.
+     * @return true If the file was loaded and its header is valid.
+     * @return false If the file is missing, unreadable or malformed.
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Whether playback still has ticks left.
+     *
+     * @return true If next() will produce another tick.
+     * @return false If the stream is exhausted or nothing is loaded.
+     */
+    bool active() const { return tick < tickCount; }
+
+    /**
+     * @brief Decodes the next tick of input.
+     *
+     * @param out Receives the input for this tick.
+     * @return true If a tick was decoded.
+     * @return false If the stream is exhausted; @p out is untouched.
+     */
+    bool next(InputState& out);
+
+    /**
+     * @brief Seeks playback to @p targetTick at interactive speed.
+     *
+     * Binary-searches the keyframe table for the latest seek point at
+     * or before the target, restores its state block into @p sim, and
+     * replays at most keyframeInterval ticks of input to land exactly
+     * on the target — O(log n) in seek points instead of re-simulating
+     * from tick zero. The simulation must be init()ed on the same
+     * level the replay was recorded against.
+     *
+     * @param targetTick The tick to land on.
+     * @param sim The simulation to restore and replay into.
+     * @param dt Fixed tick duration in seconds.
+     * @return true If the seek landed on the target.
+     * @return false If the target is out of range or the keyframe
+     * state size does not match this simulation.
+     */
+    bool seek(std::uint64_t targetTick, Simulation& sim, float dt);
+
+private:
+    /**
+     * @brief Reads one bit from the stream.
+     *
+     * @return bool The bit value.
+     */
+    bool pullBit();
+
+    std::vector<std::uint8_t> stream; ///< The packed bit stream.
+    std::vector<replay::KeyframeRecord> keyframes; ///< The seek-point table, ascending by tick.
+    std::vector<unsigned char> keyframeStates; ///< State blobs, stateSize bytes each.
+    std::uint64_t tickCount = 0; ///< Total ticks in the stream.
+    std::uint64_t stateBytes = 0; ///< Bytes per keyframe state block.
+    std::uint64_t tick = 0; ///< Next tick to decode.
+    std::uint64_t bitPos = 0; ///< Read position in bits.
+    std::uint8_t currentBits = 0; ///< The decoded key bits carried between ticks.
+};
@@ -0,0 +1,171 @@
+#include "replay_pack.h"
+#include "replay.h"
+#include <cstdio>
+
+namespace {
+
+/**
+ * @brief The replay bit stream loaded without its keyframes.
+ *
+ * Keyframes sit after the stream in the file and only matter for
+ * seeking; the packer stops reading at the stream's end.
+ */
+struct ReplayStream {
+    std::vector<std::uint8_t> bits; ///< The packed input bit stream.
+    std::uint64_t tickCount = 0; ///< Ticks encoded in the stream.
+};
+
+/**
+ * @brief Reads a replay file's header and input bit stream.
+ *
+ * @param path Path of the .brpl file.
+ * @param out Receives the stream and tick count.
+ * @return true If the header is valid and the stream read completely.
+ * @return false Otherwise.
+ */
+bool loadReplayStream(const std::string& path, ReplayStream& out)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    replay::Header header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+        && std::memcmp(header.magic, "BRPL", 4) == 0
+        && header.version == replay::replayVersion;
+
+    if (ok)
+    {
+        out.bits.resize(static_cast<std::size_t>(header.streamBytes));
+        out.tickCount = header.tickCount;
+        ok = out.bits.empty() || std::fread(out.bits.data(), 1, out.bits.size(), file) == out.bits.size();
+    }
+
+    std::fclose(file);
+    return ok;
+}
+
+/**
+ * @brief Walks a replay bit stream one tick at a time.
+ *
+ * Mirrors the ReplayPlayer's decode of the wire format: one clear bit
+ * means the keys are unchanged, a set bit is followed by the four key
+ * bits, and the keys start all released.
+ */
+struct StreamWalker {
+    const std::uint8_t* stream; ///< The packed bit stream.
+    std::uint64_t bitPos = 0; ///< Read position in bits.
+    std::uint8_t bits = 0; ///< The key bits in effect.
+
+    /**
+     * @brief Reads one bit from the stream.
+     *
+     * @return bool The bit value.
+     */
+    bool pullBit()
+    {
+        const bool bit = (stream[static_cast<std::size_t>(bitPos / 8)] >> (bitPos % 8)) & 1;
+        bitPos++;
+        return bit;
+    }
+
+    /**
+     * @brief Advances one tick, updating the key bits.
+     */
+    void next()
+    {
+        if (pullBit())
+        {
+            std::uint8_t decoded = 0;
+            if (pullBit()) decoded |= 1;
+            if (pullBit()) decoded |= 2;
+            if (pullBit()) decoded |= 4;
+            if (pullBit()) decoded |= 8;
+            bits = decoded;
+        }
+    }
+};
+
+} // namespace
+
+/**
+ * @brief Packs a replay file's input timeline.
+ *
+ * @param replayPath Path of the .brpl file to pack.
+ * @param out Receives the pack bytes; replaced, not appended to.
+ * @return true If the replay was read and packed.
+ * @return false If the file is missing, malformed or truncated.
+ */
+bool packReplayFile(const std::string& replayPath, std::vector<std::uint8_t>& out)
+{
+    ReplayStream replayStream;
+    if (!loadReplayStream(replayPath, replayStream))
+        return false;
+
+    out.clear();
+    out.resize(sizeof(replaypack::Header));
+
+    // Walk the stream and emit one varint per effective transition.
+    // The stream can carry a change marker that re-states the same
+    // keys; those collapse away here, so a pack only ever spends
+    // bytes on ticks where the held keys actually differ
+    StreamWalker walker{ replayStream.bits.data() };
+    std::uint8_t lastBits = 0;
+    std::uint64_t lastTick = 0;
+    std::uint64_t eventCount = 0;
+    for (std::uint64_t tick = 0; tick < replayStream.tickCount; ++tick)
+    {
+        walker.next();
+        if (walker.bits == lastBits)
+            continue;
+        net::putVarint(out, ((tick - lastTick) << 4) | walker.bits);
+        lastBits = walker.bits;
+        lastTick = tick;
+        eventCount++;
+    }
+
+    replaypack::Header header = {};
+    std::memcpy(header.magic, "BRPK", 4);
+    header.version = replaypack::packVersion;
+    header.tickCount = replayStream.tickCount;
+    header.eventCount = eventCount;
+    std::memcpy(out.data(), &header, sizeof(header));
+    return true;
+}
+
+/**
+ * @brief Checks a pack against the replay it was made from.
+ *
+ * @param replayPath Path of the original .brpl file.
+ * @param pack The pack bytes.
+ * @param size Size of the pack in bytes.
+ * @return true If every tick's input matches.
+ * @return false On any mismatch or if either input is malformed.
+ */
+bool verifyPackAgainstReplay(const std::string& replayPath, const std::uint8_t* pack, std::size_t size)
+{
+    ReplayStream replayStream;
+    if (!loadReplayStream(replayPath, replayStream))
+        return false;
+
+    PackReader reader;
+    if (!reader.open(pack, size) || reader.tickCount() != replayStream.tickCount)
+        return false;
+
+    StreamWalker walker{ replayStream.bits.data() };
+    replaypack::Event event;
+    bool pending = reader.next(event);
+    std::uint8_t packBits = 0;
+    for (std::uint64_t tick = 0; tick < replayStream.tickCount; ++tick)
+    {
+        walker.next();
+        if (pending && event.tick == tick)
+        {
+            packBits = event.bits;
+            pending = reader.next(event);
+        }
+        if (packBits != walker.bits)
+            return false;
+    }
+    return !pending;  // Leftover events would name ticks past the end
+}
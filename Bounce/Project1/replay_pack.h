@@ -0,0 +1,151 @@
+#pragma once
+#include "net_varint.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Second-stage offline compression of replay files for analytics.
+ *
+ * A replay file already delta-encodes input to about a bit per tick,
+ * but it also embeds a state keyframe every five seconds for seeking —
+ * weight the analytics pipeline never uses, and at fleet scale every
+ * byte shipped off a cabinet is backhaul cost. A pack keeps only the
+ * input timeline, re-encoded as key transitions: one varint per change
+ * of the held keys, bit-packing the four key bits into the low bits
+ * and the tick delta since the previous transition above them. Players
+ * change input a few times a second, so a minute of 120Hz play packs
+ * to a few hundred bytes. The stream is exact — expanding a pack
+ * reproduces the replay's per-tick input bit for bit — so death
+ * positions and hesitation times computed from it match the session.
+ */
+namespace replaypack {
+
+constexpr std::uint32_t packVersion = 2; ///< Bumped on any layout change.
+
+/**
+ * @brief Fixed header at the start of every pack.
+ *
+ * eventCount varints follow directly; each decodes to
+ * (tickDelta << 4) | keyBits, where the delta counts ticks since the
+ * previous transition (since tick zero for the first) and the key bits
+ * use the replay stream's left/right/up/down order. Keys before the first
+ * transition are all released, as in the replay decoder.
+ */
+struct Header {
+    char magic[4]; ///< "BRPK".
+    std::uint32_t version; ///< Must equal packVersion.
+    std::uint64_t tickCount; ///< Ticks of play the timeline covers.
+    std::uint64_t eventCount; ///< Transitions encoded after the header.
+};
+
+/**
+ * @brief One decoded key transition.
+ */
+struct Event {
+    std::uint64_t tick; ///< The tick the keys changed on.
+    std::uint8_t bits; ///< The key bits held from this tick on.
+};
+
+} // namespace replaypack
+
+/**
+ * @brief Packs a replay file's input timeline.
+ *
+ * Reads the replay header and bit stream (keyframes are skipped, not
+ * loaded) and writes a complete pack — header plus transition varints —
+ * into @p out.
+ *
+ * @param replayPath Path of the .brpl file to pack.
+ * @param out Receives the pack bytes; replaced, not appended to.
+ * @return true If the replay was read and packed.
+ * @return false If the file is missing, malformed or truncated.
+ */
+bool packReplayFile(const std::string& replayPath, std::vector<std::uint8_t>& out);
+
+/**
+ * @brief Checks a pack against the replay it was made from.
+ *
+ * Expands the pack tick by tick alongside a fresh decode of the
+ * replay's bit stream and compares the key bits at every tick.
+ *
+ * @param replayPath Path of the original .brpl file.
+ * @param pack The pack bytes.
+ * @param size Size of the pack in bytes.
+ * @return true If every tick's input matches.
+ * @return false On any mismatch or if either input is malformed.
+ */
+bool verifyPackAgainstReplay(const std::string& replayPath, const std::uint8_t* pack, std::size_t size);
+
+/**
+ * @brief Sequential decoder over one pack held in memory.
+ *
+ * Built for the batch side of the pipeline: open() is a header check,
+ * next() is one varint and two adds, and nothing allocates, so a
+ * thread can churn through thousands of session files per second by
+ * pointing one reader at each in turn.
+ */
+class PackReader {
+public:
+    /**
+     * @brief Points the reader at a pack and validates its header.
+     *
+     * @param data Start of the pack bytes.
+     * @param size Size of the pack in bytes.
+     * @return true If the header is valid; the reader is rewound.
+     * @return false If the pack is not a BRPK of the current version.
+     */
+    bool open(const std::uint8_t* data, std::size_t size)
+    {
+        remaining = 0;
+        if (size < sizeof(replaypack::Header))
+            return false;
+        replaypack::Header header;
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, "BRPK", 4) != 0 || header.version != replaypack::packVersion)
+            return false;
+        cursor = data + sizeof(header);
+        end = data + size;
+        ticks = header.tickCount;
+        remaining = header.eventCount;
+        tick = 0;
+        return true;
+    }
+
+    /**
+     * @brief Decodes the next transition.
+     *
+     * @param out Receives the transition.
+     * @return true If a transition was decoded.
+     * @return false If the pack is exhausted or truncated.
+     */
+    bool next(replaypack::Event& out)
+    {
+        if (remaining == 0)
+            return false;
+        std::uint64_t word;
+        if (!net::getVarint(cursor, end, word))
+            return false;
+        remaining--;
+        tick += word >> 4;
+        out.tick = tick;
+        out.bits = static_cast<std::uint8_t>(word & 15);
+        return true;
+    }
+
+    /**
+     * @brief Ticks of play the open pack covers.
+     *
+     * @return std::uint64_t The header's tick count.
+     */
+    std::uint64_t tickCount() const { return ticks; }
+
+private:
+    const std::uint8_t* cursor = nullptr; ///< Read position in the event varints.
+    const std::uint8_t* end = nullptr; ///< One past the last pack byte.
+    std::uint64_t ticks = 0; ///< Ticks covered, from the header.
+    std::uint64_t remaining = 0; ///< Events not yet decoded.
+    std::uint64_t tick = 0; ///< Absolute tick of the last transition.
+};
@@ -0,0 +1,110 @@
+#include "savegame.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+constexpr std::uint32_t savegameVersion = 1; ///< Bumped on any state layout change.
+
+/**
+ * @brief Fixed header at the start of every savegame file.
+ */
+struct SaveHeader {
+    char magic[4]; ///< "BSAV".
+    std::uint32_t version; ///< Must equal savegameVersion.
+    std::uint32_t stateBytes; ///< Size of the state block that follows.
+};
+
+} // namespace
+
+/**
+ * @brief Joins any in-flight writer thread.
+ */
+SavegameWriter::~SavegameWriter()
+{
+    if (worker.joinable())
+        worker.join();
+}
+
+/**
+ * @brief Captures the simulation and writes the save in the background.
+ *
+ * @param sim The simulation to save.
+ * @param path Path of the savegame file.
+ */
+void SavegameWriter::save(const Simulation& sim, const std::string& path)
+{
+    if (writing.load(std::memory_order_acquire))
+        return;  // Previous save still writing; the next autosave catches up
+
+    if (worker.joinable())
+        worker.join();
+
+    block.resize(sim.stateSize());
+    sim.captureState(block.data());
+    writing.store(true, std::memory_order_release);
+
+    worker = std::thread([this, path]() {
+        // Write the whole file under a temporary name, then rename it
+        // into place so the real path only ever holds a complete save
+        const std::string tmpPath = path + ".tmp";
+        std::FILE* file = std::fopen(tmpPath.c_str(), "wb");
+        if (file)
+        {
+            SaveHeader header;
+            std::memcpy(header.magic, "BSAV", 4);
+            header.version = savegameVersion;
+            header.stateBytes = static_cast<std::uint32_t>(block.size());
+
+            bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1
+                && std::fwrite(block.data(), 1, block.size(), file) == block.size();
+            ok = std::fclose(file) == 0 && ok;
+
+            if (ok)
+            {
+                std::remove(path.c_str());  // rename won't replace on Windows
+                std::rename(tmpPath.c_str(), path.c_str());
+            }
+            else
+            {
+                std::remove(tmpPath.c_str());
+            }
+        }
+        writing.store(false, std::memory_order_release);
+    });
+}
+
+/**
+ * @brief Restores a savegame written by SavegameWriter.
+ *
+ * @param path Path of the savegame file.
+ * @param sim The initialized simulation to restore into.
+ * @param dt Fixed tick duration in seconds.
+ * @return true If the save was restored.
+ * @return false If there was no valid save to restore.
+ */
+bool loadSavegame(const std::string& path, Simulation& sim, float dt)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    SaveHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1
+        || std::memcmp(header.magic, "BSAV", 4) != 0
+        || header.version != savegameVersion
+        || header.stateBytes != sim.stateSize())
+    {
+        std::fclose(file);
+        return false;
+    }
+
+    std::vector<unsigned char> block(header.stateBytes);
+    const bool ok = std::fread(block.data(), 1, block.size(), file) == block.size();
+    std::fclose(file);
+    if (!ok)
+        return false;
+
+    sim.restoreState(block.data(), dt);
+    return true;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "simulation.h"
+#include <string>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Versioned binary savegame built on the savestate block.
+ *
+ * A savegame is a small header followed by one captureState block, so
+ * saving costs a memcpy on the game thread and restoring at startup is
+ * a single read plus an O(1) restoreState. The file is written to a
+ * temporary name and renamed into place on a background thread, so a
+ * crash or power cut mid-write can never leave a truncated save behind
+ * and the tick loop never waits on the disk.
+ */
+class SavegameWriter {
+public:
+    /**
+     * @brief Joins any in-flight writer thread.
+     */
+    ~SavegameWriter();
+
+    /**
+     * @brief Captures the simulation and writes the save in the background.
+     *
+     * The state block is captured synchronously (plain memcpys), then a
+     * background thread writes header plus block to "<path>.tmp" and
+     * renames it over @p path. Ignored if a previous save is still
+     * being written — the next autosave picks the state up instead.
+     *
+     * @param sim The simulation to save.
+     * @param path Path of the savegame file.
+     */
+    void save(const Simulation& sim, const std::string& path);
+
+    /**
+     * @brief Whether a save is currently being written.
+     *
+     * @return true If the background writer is still running.
+     * @return false If the writer is idle.
+     */
+    bool busy() const { return writing.load(std::memory_order_acquire); }
+
+private:
+    std::vector<unsigned char> block; ///< The captured state; owned by the writer while busy.
+    std::thread worker; ///< Background writer thread.
+    std::atomic<bool> writing{ false }; ///< Set while the writer owns the block.
+};
+
+/**
+ * @brief Restores a savegame written by SavegameWriter.
+ *
+ * One bulk read; rejects a missing file, a bad magic or version, or a
+ * state size that does not match the current level, so a save from a
+ * different build or level can never restore garbage.
+ *
+ * @param path Path of the savegame file.
+ * @param sim The initialized simulation to restore into.
+ * @param dt Fixed tick duration in seconds.
+ * @return true If the save was restored.
+ * @return false If there was no valid save to restore.
+ */
+bool loadSavegame(const std::string& path, Simulation& sim, float dt);
@@ -0,0 +1,108 @@
+#pragma once
+#include "simulation.h"
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Fixed ring of per-tick savestates for instant rewind.
+ *
+ * Every tick the simulation's full mutable state is memcpy-snapshotted
+ * into the next slot of one block allocated at init — a few hundred
+ * bytes per tick with the SoA store — and rewinding is a single O(1)
+ * restore from a slot. The ring never allocates after init, so
+ * recording can stay on permanently for practice mode; 241 slots hold
+ * the current state plus two seconds of history at the 120 Hz tick.
+ */
+class SavestateRing {
+public:
+    /**
+     * @brief Sizes the ring for a simulation; the only allocation.
+     *
+     * Must be re-run if the simulation is re-initialized with a
+     * different level, since the slot size follows the entity counts.
+     *
+     * @param sim The simulation whose states the ring will hold.
+     * @param slots Number of ticks of history to keep.
+     */
+    void init(const Simulation& sim, std::size_t slots)
+    {
+        slotBytes = sim.stateSize();
+        capacity = slots;
+        block.reset(new unsigned char[slotBytes * capacity]);
+        head = 0;
+        count = 0;
+    }
+
+    /**
+     * @brief Snapshots the simulation into the next slot.
+     *
+     * Call once per tick, after the tick has run. Overwrites the oldest
+     * slot once the ring is full.
+     *
+     * @param sim The simulation to capture.
+     */
+    void record(const Simulation& sim)
+    {
+        sim.captureState(block.get() + head * slotBytes);
+        head = (head + 1) % capacity;
+        if (count < capacity)
+            ++count;
+    }
+
+    /**
+     * @brief Restores the state from a number of ticks ago.
+     *
+     * Rewinding also discards the history after the restored point, so
+     * a second rewind steps further back instead of replaying the part
+     * just undone.
+     *
+     * @param ticksBack How far back to rewind, in ticks; clamped to the
+     * recorded history. Zero or an empty ring restores nothing.
+     * @param sim The simulation to restore into.
+     * @param dt Fixed tick duration in seconds.
+     * @return true If a state was restored.
+     * @return false If the ring holds no history.
+     */
+    bool rewind(std::size_t ticksBack, Simulation& sim, float dt)
+    {
+        // The newest record is the current state, so it never counts as
+        // history to rewind into
+        if (ticksBack >= count)
+            ticksBack = count > 0 ? count - 1 : 0;
+        if (ticksBack == 0)
+            return false;
+
+        const std::size_t slot = (head + 2 * capacity - 1 - ticksBack) % capacity;
+        sim.restoreState(block.get() + slot * slotBytes, dt);
+
+        head = (slot + 1) % capacity;
+        count -= ticksBack;
+        return true;
+    }
+
+    /**
+     * @brief Drops all recorded history.
+     *
+     * Called around full resets so a rewind can never cross back over
+     * one.
+     */
+    void clear()
+    {
+        head = 0;
+        count = 0;
+    }
+
+    /**
+     * @brief Number of ticks of history currently held.
+     *
+     * @return std::size_t Recorded tick count, up to the ring capacity.
+     */
+    std::size_t recorded() const { return count; }
+
+private:
+    std::unique_ptr<unsigned char[]> block; ///< All slots, one allocation.
+    std::size_t slotBytes = 0; ///< Bytes per savestate slot.
+    std::size_t capacity = 0; ///< Number of slots in the ring.
+    std::size_t head = 0; ///< Slot the next record goes into.
+    std::size_t count = 0; ///< Slots currently holding history.
+};
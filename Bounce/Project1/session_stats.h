@@ -0,0 +1,110 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief O(1) session statistics from the monotonic run counters.
+ *
+ * Product wants run stats — deaths, coins per minute, time to goal,
+ * bounce counts — and the naive way (scanning event history) grows
+ * with session length. The simulation already maintains constant-time
+ * counters at the event sites (reset bumps resetCount, a pickup bumps
+ * coinCount, the goal check raises levelCompleted), so this module
+ * just diffs them off each snapshot into session accumulators: a
+ * handful of compares and adds per frame whatever the session length.
+ * The victory screen formats a summary from the accumulators and
+ * telemetry folds them into its periodic record.
+ */
+class SessionStats {
+public:
+    /**
+     * @brief Advances the accumulators from one snapshot's counters.
+     *
+     * @param dt Seconds since the previous update.
+     * @param deathCount Deaths since launch, off the snapshot.
+     * @param resetCount Full resets since launch, off the snapshot.
+     * @param coinCount Coins collected this run, off the snapshot.
+     * @param bounceCount Bounces this run, off the snapshot.
+     * @param levelCompleted Whether the goal has been reached.
+     */
+    void update(float dt, std::uint32_t deathCount, std::uint32_t resetCount,
+                std::uint32_t coinCount, std::uint32_t bounceCount, bool levelCompleted)
+    {
+        playSeconds += dt;
+        if (!levelCompleted)
+            runSeconds += dt;
+        if (resetCount != lastResetCount)
+        {
+            runSeconds = 0.0f;  // A new run's clock, whatever caused the reset
+            lastResetCount = resetCount;
+        }
+
+        // The per-run counters restart at zero each reset, so a drop is
+        // a new run's count, not a negative delta
+        coinsCollected += coinCount >= lastCoinCount ? coinCount - lastCoinCount : coinCount;
+        totalBounces += bounceCount >= lastBounceCount ? bounceCount - lastBounceCount : bounceCount;
+        lastCoinCount = coinCount;
+        lastBounceCount = bounceCount;
+        deaths = deathCount;
+        resets = resetCount;
+
+        if (levelCompleted && !wasCompleted)
+        {
+            ++victories;
+            lastGoalSeconds = runSeconds;
+            bestGoalSeconds = bestGoalSeconds > 0.0f ? std::min(bestGoalSeconds, runSeconds) : runSeconds;
+        }
+        wasCompleted = levelCompleted;
+    }
+
+    /**
+     * @brief Session-wide coin rate.
+     *
+     * @return float Coins collected per minute of play.
+     */
+    float coinsPerMinute() const
+    {
+        return playSeconds > 1.0f ? coinsCollected * 60.0f / playSeconds : 0.0f;
+    }
+
+    /**
+     * @brief Time to goal of the last completed run.
+     *
+     * @return float Seconds, or zero before the first victory.
+     */
+    float goalSeconds() const { return lastGoalSeconds; }
+
+    /**
+     * @brief Formats the victory summary.
+     *
+     * @param buffer Receives the multi-line summary text.
+     * @param capacity Bytes available in @p buffer.
+     */
+    void formatSummary(char* buffer, std::size_t capacity) const
+    {
+        std::snprintf(buffer, capacity,
+                      "Time to goal: %.1fs (best %.1fs)\n"
+                      "Coins: %u (%.1f per minute)\n"
+                      "Bounces: %u   Deaths: %u",
+                      lastGoalSeconds, bestGoalSeconds,
+                      coinsCollected, coinsPerMinute(),
+                      totalBounces, deaths);
+    }
+
+private:
+    float playSeconds = 0.0f; ///< Total session play time.
+    float runSeconds = 0.0f; ///< Time since the current run started.
+    float lastGoalSeconds = 0.0f; ///< Time to goal of the last victory.
+    float bestGoalSeconds = 0.0f; ///< Fastest time to goal; zero before one.
+    std::uint32_t coinsCollected = 0; ///< Coins across every run.
+    std::uint32_t totalBounces = 0; ///< Bounces across every run.
+    std::uint32_t deaths = 0; ///< Mirror of the session death counter.
+    std::uint32_t resets = 0; ///< Mirror of the session reset counter.
+    std::uint32_t victories = 0; ///< Completed runs.
+    std::uint32_t lastCoinCount = 0; ///< Previous snapshot's run coins.
+    std::uint32_t lastBounceCount = 0; ///< Previous snapshot's run bounces.
+    std::uint32_t lastResetCount = 0; ///< Previous snapshot's reset counter.
+    bool wasCompleted = false; ///< Previous snapshot's completion flag.
+};
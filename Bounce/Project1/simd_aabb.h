@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BOUNCE_SIMD_AABB_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define BOUNCE_SIMD_AABB_SSE2 0
+#endif
+
+/**
+ * @brief Tests one query box against a whole structure-of-arrays batch.
+ *
+ * On SSE2-capable targets (every x64 build) the kernel tests four AABBs
+ * per instruction batch and converts the resulting movemask into hit
+ * indices; remaining boxes and non-SSE targets fall back to the scalar
+ * aabbIntersects logic. The indices of all overlapping boxes are
+ * appended to @p outHits in ascending order.
+ *
+ * @param qx Left edge of the query box.
+ * @param qy Top edge of the query box.
+ * @param qw Width of the query box.
+ * @param qh Height of the query box.
+ * @param xs Left edges of the batch boxes.
+ * @param ys Top edges of the batch boxes.
+ * @param ws Widths of the batch boxes.
+ * @param hs Heights of the batch boxes.
+ * @param count Number of boxes in the batch.
+ * @param outHits Receives the indices of overlapping boxes (cleared first).
+ */
+inline void aabbTestBatch(float qx, float qy, float qw, float qh,
+                          const float* xs, const float* ys, const float* ws, const float* hs,
+                          std::size_t count, std::vector<std::size_t>& outHits)
+{
+    outHits.clear();
+    std::size_t i = 0;
+
+#if BOUNCE_SIMD_AABB_SSE2
+    const __m128 queryLeft = _mm_set1_ps(qx);
+    const __m128 queryTop = _mm_set1_ps(qy);
+    const __m128 queryRight = _mm_set1_ps(qx + qw);
+    const __m128 queryBottom = _mm_set1_ps(qy + qh);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 boxLeft = _mm_loadu_ps(xs + i);
+        const __m128 boxTop = _mm_loadu_ps(ys + i);
+        const __m128 boxRight = _mm_add_ps(boxLeft, _mm_loadu_ps(ws + i));
+        const __m128 boxBottom = _mm_add_ps(boxTop, _mm_loadu_ps(hs + i));
+
+        // Overlap on both axes: qx < bx+bw && bx < qx+qw && qy < by+bh && by < qy+qh
+        const __m128 overlapX = _mm_and_ps(_mm_cmplt_ps(queryLeft, boxRight), _mm_cmplt_ps(boxLeft, queryRight));
+        const __m128 overlapY = _mm_and_ps(_mm_cmplt_ps(queryTop, boxBottom), _mm_cmplt_ps(boxTop, queryBottom));
+        int mask = _mm_movemask_ps(_mm_and_ps(overlapX, overlapY));
+
+        for (int bit = 0; bit < 4; ++bit)
+        {
+            if (mask & (1 << bit))
+                outHits.push_back(i + bit);
+        }
+    }
+#endif
+
+    // Scalar tail (and full loop on non-SSE targets)
+    for (; i < count; ++i)
+    {
+        if (qx < xs[i] + ws[i] && xs[i] < qx + qw && qy < ys[i] + hs[i] && ys[i] < qy + qh)
+            outHits.push_back(i);
+    }
+}
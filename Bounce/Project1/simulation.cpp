@@ -0,0 +1,1063 @@
+#include "simulation.h"
+#include "simd_aabb.h"
+#include "swept_aabb.h"
+#include "fixed_point.h"
+#include "physics_profile.h"
+#include "contact_reduce.h"
+#include "collision_kernel.h"
+#include "cpu_dispatch.h"
+#include <cmath>
+#include <atomic>
+#include <cstring>
+
+/**
+ * @brief Initializes the simulation from a loaded level.
+ *
+ * @param level The loaded level.
+ */
+void Simulation::init(const LevelData& level)
+{
+    store = EntityStore();
+    store.obstacleSpeed = tuning->obstacleSpeed;  // Config takes effect for this level's spawns
+    store.reserveObstacles(level.obstacles.size());  // Header count: one allocation per array
+    for (const auto& record : level.obstacles)
+        store.addObstacle(record.x, record.y, record.w, record.h, record.leftLimit, record.rightLimit);
+
+    chunks.build(level);
+    goal = { level.goal.x, level.goal.y, level.goal.w, level.goal.h };
+    floorRect = { level.floor.x, level.floor.y, level.floor.w, level.floor.h };
+
+    coinBounds.clear();
+    coinBounds.reserve(level.coins.size());
+    for (const auto& record : level.coins)
+        coinBounds.push_back({ record.x, record.y, 20.0f, 20.0f });  // Coin radius 10; bounds are 2r by 2r
+    coinHome = coinBounds;
+    coinHash.build({}, {}, {}, {}, 128.0f);  // Coin-dense cells; entries follow
+    for (std::size_t i = 0; i < coinBounds.size(); ++i)
+        coinHash.insert(i, coinBounds[i].x, coinBounds[i].y, coinBounds[i].w, coinBounds[i].h);
+
+    reset();
+    chunks.update(camera.x, store, platformHash, wallHash);
+    platformSweep.build(store.platformX, store.platformY, store.platformW, store.platformH);
+    wallSweep.build(store.wallX, store.wallY, store.wallW, store.wallH);
+    store.buildObstacleWallLists();
+
+    obstacleAwake.assign(store.obstacleX.size(), 0);
+    refreshObstacleSleep(0.0f);  // At tick zero every phase is the spawn phase
+}
+
+/**
+ * @brief Resets the run to its initial state.
+ */
+void Simulation::reset()
+{
+    ++resetCount;
+    playerX = 400.0f;
+    playerY = 300.0f;
+    velocityX = 0.0f;
+    velocityY = 0.0f;
+    isOnGround = false;
+    levelCompleted = false;
+    coinCount = 0;
+    bounceCount = 0;
+    lastBounceX = 0.0f;
+    lastBounceY = 0.0f;
+    camera.snapTo(400.0f, 300.0f);
+    coinAlive.resetAll(coinBounds.size());
+    if (coinsDrifted)
+    {
+        // Drift every coin back to its spawn spot and re-key the index
+        coinBounds = coinHome;
+        coinHash.build({}, {}, {}, {}, 128.0f);
+        for (std::size_t i = 0; i < coinBounds.size(); ++i)
+            coinHash.insert(i, coinBounds[i].x, coinBounds[i].y, coinBounds[i].w, coinBounds[i].h);
+        coinsDrifted = false;
+    }
+    cachedPlatform = invalidContact;
+    cachedWall = invalidContact;
+    store.resetObstacles();
+    obstacleScripts.reset(store);  // After resetObstacles: re-zeroes scripted velocities
+    tickIndex = 0;
+}
+
+/**
+ * @brief Spawns physics balls for party mode.
+ *
+ * @param count Number of balls to add.
+ * @param seed Seed for the placement generator.
+ */
+void Simulation::spawnBalls(std::size_t count, std::uint32_t seed)
+{
+    // xorshift32 over the seed; the sequence (and therefore the whole
+    // field) is a pure function of (count, seed)
+    std::uint32_t state = seed * 2654435761u | 1u;
+    auto next = [&state]() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    };
+
+    const float width = floorRect.w > ballRadius * 4.0f ? floorRect.w - ballRadius * 4.0f : 800.0f;
+    store.reserveBalls(store.ballX.size() + count);
+    for (std::size_t n = 0; n < count; ++n)
+    {
+        const float x = ballRadius * 2.0f + (next() % 1000u) * (width / 1000.0f);
+        const float y = 40.0f + (next() % 260u);
+        float velX = static_cast<float>(static_cast<int>(next() % 400u) - 200);
+        if (velX > -40.0f && velX < 40.0f)
+            velX = velX < 0.0f ? -40.0f : 40.0f;  // Keep every ball drifting
+        store.addBall(x, y, velX, 0.0f);
+    }
+}
+
+/**
+ * @brief Advances every ball by one tick.
+ *
+ * @param dt Fixed tick duration in seconds.
+ */
+void Simulation::tickBalls(float dt)
+{
+    const float gravity = 1800.0f;  // Same fall as the player
+    const float size = ballRadius * 2.0f;
+
+    for (std::size_t b = 0; b < store.ballX.size(); ++b)
+    {
+        float x = store.ballX[b];
+        float y = store.ballY[b];
+        float velX = store.ballVelX[b];
+        float velY = store.ballVelY[b] + gravity * dt;
+        const float dx = velX * dt;
+        const float dy = velY * dt;
+
+        /**
+         * @brief Vertical pass: branch-free landing selection against the
+         * streamed platforms, then the analytic floor — the floor is
+         * solid everywhere, so balls outside the streamed window still
+         * have ground under them. Small candidate sets walk the indexed
+         * kernel; dense sets gather into the candidate arrays and run
+         * the four-wide form.
+         */
+        if (velY > 0.0f)
+        {
+            queryPlatforms(x, y, size, size + dy);
+            const std::size_t candidateCount = candidates.size();
+            std::size_t landing;
+            if (candidateCount < denseKernelThreshold)
+            {
+                landing = earliestLandingIndexed(x, y, size, dy,
+                                                 store.platformX.data(), store.platformY.data(),
+                                                 store.platformW.data(), store.platformH.data(),
+                                                 candidates.data(), candidateCount);
+            }
+            else
+            {
+                candX.resize(candidateCount);
+                candY.resize(candidateCount);
+                candW.resize(candidateCount);
+                candH.resize(candidateCount);
+                for (std::size_t c = 0; c < candidateCount; ++c)
+                {
+                    const std::size_t i = candidates[c];
+                    candX[c] = store.platformX[i];
+                    candY[c] = store.platformY[i];
+                    candW[c] = store.platformW[i];
+                    candH[c] = store.platformH[i];
+                }
+                landing = landingSelectWide(x, y, size, dy,
+                                          candX.data(), candY.data(), candW.data(), candH.data(),
+                                          candidateCount);
+            }
+            if (landing != candidateCount)
+            {
+                y = store.platformY[candidates[landing]] - size;
+                velY = -velY * 0.7f;  // Bounce with 70% energy retained
+            }
+            else if (y + dy + size > floorRect.y)
+            {
+                y = floorRect.y - size;
+                velY = -velY * 0.7f;
+            }
+            else
+            {
+                y += dy;
+            }
+        }
+        else
+        {
+            y += dy;
+        }
+
+        /**
+         * @brief Horizontal pass: the player stops at walls, but a
+         * stopped party-mode ball is a dead one, so balls deflect —
+         * same contact resolution, reflected response.
+         */
+        if (dx != 0.0f)
+        {
+            const float sweptLeft = dx < 0.0f ? x + dx : x;
+            queryWalls(sweptLeft, y, size + std::fabs(dx), size);
+            const std::size_t candidateCount = candidates.size();
+            std::size_t blocking;
+            if (candidateCount < denseKernelThreshold)
+            {
+                blocking = earliestWallHitIndexed(x, y, size, dx,
+                                                  store.wallX.data(), store.wallY.data(),
+                                                  store.wallW.data(), store.wallH.data(),
+                                                  candidates.data(), candidateCount);
+            }
+            else
+            {
+                candX.resize(candidateCount);
+                candY.resize(candidateCount);
+                candW.resize(candidateCount);
+                candH.resize(candidateCount);
+                for (std::size_t c = 0; c < candidateCount; ++c)
+                {
+                    const std::size_t i = candidates[c];
+                    candX[c] = store.wallX[i];
+                    candY[c] = store.wallY[i];
+                    candW[c] = store.wallW[i];
+                    candH[c] = store.wallH[i];
+                }
+                blocking = wallSelectWide(x, y, size, dx,
+                                           candX.data(), candY.data(), candW.data(), candH.data(),
+                                           candidateCount);
+            }
+            if (blocking != candidateCount)
+            {
+                const std::size_t wall = candidates[blocking];
+                // Same depth resolution as the player path for a ball
+                // that starts its tick inside the wall; a crossing
+                // deflects off the face the travel direction meets
+                float pushX, pushY;
+                if (overlapPushOut(x, y, size, size,
+                                   store.wallX[wall], store.wallY[wall],
+                                   store.wallW[wall], store.wallH[wall],
+                                   velX, velY, pushX, pushY))
+                {
+                    x += pushX;
+                    y += pushY;
+                    velX = pushX != 0.0f ? -velX : velX;
+                    velY = pushY != 0.0f ? -velY : velY;
+                }
+                else
+                {
+                    x = dx > 0.0f ? store.wallX[wall] - size : store.wallX[wall] + store.wallW[wall];
+                    velX = -velX;
+                }
+            }
+            else
+            {
+                x += dx;
+            }
+        }
+
+        store.ballX[b] = x;
+        store.ballY[b] = y;
+        store.ballVelX[b] = velX;
+        store.ballVelY[b] = velY;
+    }
+}
+
+/**
+ * @brief Fixed-size scalar part of a captured state block.
+ *
+ * The variable-size parts (obstacle arrays, coin alive words) follow it
+ * in the block; see Simulation::captureState for the layout.
+ */
+struct ScalarState {
+    float playerX;
+    float playerY;
+    float velocityX;
+    float velocityY;
+    float cameraX;
+    float cameraY;
+    int coinCount;
+    std::uint64_t tickIndex;
+    bool isOnGround;
+    bool levelCompleted;
+};
+
+/**
+ * @brief Size in bytes of one captured state block.
+ *
+ * @return std::size_t Bytes captureState writes and restoreState reads.
+ */
+std::size_t Simulation::stateSize() const
+{
+    return sizeof(ScalarState)
+        + store.obstacleX.size() * sizeof(float)
+        + store.obstacleVelX.size() * sizeof(float)
+        + coinAlive.wordCount() * sizeof(std::uint64_t)
+        + obstacleScripts.stateBytes();
+}
+
+/**
+ * @brief Copies the full mutable game state into one POD block.
+ *
+ * @param dst Destination block of at least stateSize() bytes.
+ */
+void Simulation::captureState(unsigned char* dst) const
+{
+    ScalarState scalars;
+    scalars.playerX = playerX;
+    scalars.playerY = playerY;
+    scalars.velocityX = velocityX;
+    scalars.velocityY = velocityY;
+    scalars.cameraX = camera.x;
+    scalars.cameraY = camera.y;
+    scalars.coinCount = coinCount;
+    scalars.tickIndex = tickIndex;
+    scalars.isOnGround = isOnGround;
+    scalars.levelCompleted = levelCompleted;
+
+    std::memcpy(dst, &scalars, sizeof(scalars));
+    dst += sizeof(scalars);
+    std::memcpy(dst, store.obstacleX.data(), store.obstacleX.size() * sizeof(float));
+    dst += store.obstacleX.size() * sizeof(float);
+    std::memcpy(dst, store.obstacleVelX.data(), store.obstacleVelX.size() * sizeof(float));
+    dst += store.obstacleVelX.size() * sizeof(float);
+    std::memcpy(dst, coinAlive.wordData(), coinAlive.wordCount() * sizeof(std::uint64_t));
+    dst += coinAlive.wordCount() * sizeof(std::uint64_t);
+    obstacleScripts.captureState(store, dst);  // Zero bytes when nothing is scripted
+}
+
+/**
+ * @brief Restores a state captured by captureState in O(1).
+ *
+ * @param src Block of stateSize() bytes from captureState.
+ * @param dt Fixed tick duration in seconds (the phase clock unit).
+ */
+void Simulation::restoreState(const unsigned char* src, float dt)
+{
+    ScalarState scalars;
+    std::memcpy(&scalars, src, sizeof(scalars));
+    src += sizeof(scalars);
+    std::memcpy(store.obstacleX.data(), src, store.obstacleX.size() * sizeof(float));
+    src += store.obstacleX.size() * sizeof(float);
+    std::memcpy(store.obstacleVelX.data(), src, store.obstacleVelX.size() * sizeof(float));
+    src += store.obstacleVelX.size() * sizeof(float);
+    std::memcpy(coinAlive.wordData(), src, coinAlive.wordCount() * sizeof(std::uint64_t));
+    src += coinAlive.wordCount() * sizeof(std::uint64_t);
+    obstacleScripts.restoreState(store, src);
+
+    playerX = scalars.playerX;
+    playerY = scalars.playerY;
+    velocityX = scalars.velocityX;
+    velocityY = scalars.velocityY;
+    camera.x = scalars.cameraX;
+    camera.y = scalars.cameraY;
+    coinCount = scalars.coinCount;
+    tickIndex = scalars.tickIndex;
+    isOnGround = scalars.isOnGround;
+    levelCompleted = scalars.levelCompleted;
+
+    // Repair everything derived from the restored state: the restored
+    // camera may sit in a different chunk window, contact indices point
+    // into possibly-restreamed arrays, and the sleep set follows the
+    // restored tick clock
+    if (chunks.update(camera.x, store, platformHash, wallHash))
+    {
+        platformSweep.build(store.platformX, store.platformY, store.platformW, store.platformH);
+        wallSweep.build(store.wallX, store.wallY, store.wallW, store.wallH);
+        store.buildObstacleWallLists();
+    }
+    cachedPlatform = invalidContact;
+    cachedWall = invalidContact;
+
+    // Recompute the awake set for the restored window, but keep the
+    // restored obstacle state as-is: every obstacle awake in this window
+    // was awake when the block was captured, so its restored position is
+    // exact — reconstructing from the clock here would replace it with a
+    // closed-form value that differs in the last float bits
+    refreshObstacleSleep(dt, false);
+}
+
+/**
+ * @brief Runs the wide AABB filter over the gathered candidate arrays.
+ *
+ * @param qx Query box left edge.
+ * @param qy Query box top edge.
+ * @param qw Query box width.
+ * @param qh Query box height.
+ */
+void Simulation::testCandidatesWide(float qx, float qy, float qw, float qh)
+{
+    const std::size_t count = candX.size();
+    const std::size_t sliceGrain = 4096;
+
+    if (jobs && count >= sliceGrain * 2)
+    {
+        // Each slice tests independently into its own hit list; merged below
+        const std::size_t sliceCount = (count + sliceGrain - 1) / sliceGrain;
+        std::vector<std::vector<std::size_t>> sliceHits(sliceCount);
+        jobs->parallelFor(count, sliceGrain, [&, qx, qy, qw, qh](std::size_t begin, std::size_t end) {
+            std::vector<std::size_t>& local = sliceHits[begin / sliceGrain];
+            aabbTestWide(qx, qy, qw, qh,
+                          candX.data() + begin, candY.data() + begin,
+                          candW.data() + begin, candH.data() + begin, end - begin, local);
+            for (std::size_t& h : local)
+                h += begin;
+        });
+
+        hits.clear();
+        for (const std::vector<std::size_t>& slice : sliceHits)
+            hits.insert(hits.end(), slice.begin(), slice.end());
+    }
+    else
+    {
+        aabbTestWide(qx, qy, qw, qh, candX.data(), candY.data(), candW.data(), candH.data(), count, hits);
+    }
+}
+
+/**
+ * @brief Collects platform candidates through the selected broadphase.
+ *
+ * @param x Left edge of the query box.
+ * @param y Top edge of the query box.
+ * @param w Width of the query box.
+ * @param h Height of the query box.
+ */
+void Simulation::queryPlatforms(float x, float y, float w, float h)
+{
+    if (broadphase == Broadphase::SweepAndPrune)
+        platformSweep.query(x, y, w, h, candidates);
+    else
+        platformHash.query(x, y, w, h, candidates);
+}
+
+/**
+ * @brief Collects wall candidates through the selected broadphase.
+ *
+ * @param x Left edge of the query box.
+ * @param y Top edge of the query box.
+ * @param w Width of the query box.
+ * @param h Height of the query box.
+ */
+void Simulation::queryWalls(float x, float y, float w, float h)
+{
+    if (broadphase == Broadphase::SweepAndPrune)
+        wallSweep.query(x, y, w, h, candidates);
+    else
+        wallHash.query(x, y, w, h, candidates);
+}
+
+/**
+ * @brief Recomputes which obstacles are awake for the active window.
+ *
+ * @param dt Fixed tick duration in seconds (the phase clock unit).
+ */
+void Simulation::refreshObstacleSleep(float dt, bool reconstructOnWake)
+{
+    awakeObstacles.clear();
+    const float windowLeft = chunks.windowLeft();
+    const float windowRight = chunks.windowRight();
+
+    for (std::size_t i = 0; i < store.obstacleX.size(); ++i)
+    {
+        // The patrol span is the obstacle's whole reachable area; wall
+        // contacts pin the obstacle awake since their reversals cannot
+        // be replayed from the clock
+        const bool reachable = store.obstacleLeftLimit[i] <= windowRight && store.obstacleRightLimit[i] >= windowLeft;
+        const bool hasWalls = store.obstacleHasWallCandidates(i);
+        const bool awake = reachable || hasWalls;
+
+        if (awake)
+        {
+            if (!obstacleAwake[i] && reconstructOnWake)
+                reconstructPatrolPhase(i, dt);  // Waking: catch up to the clock
+            awakeObstacles.push_back(i);
+        }
+        obstacleAwake[i] = awake ? 1 : 0;
+    }
+}
+
+/**
+ * @brief Jumps the patrol clock and rebuilds every obstacle from it.
+ *
+ * @param tick The tick counter to jump to.
+ * @param dt Fixed tick duration in seconds (the phase clock unit).
+ */
+void Simulation::resyncPatrolPhases(std::uint64_t tick, float dt)
+{
+    tickIndex = tick;
+    for (std::size_t i = 0; i < store.obstacleX.size(); ++i)
+    {
+        if (store.obstacleHasWallCandidates(i))
+            continue;  // Wall reversals are not a function of the clock
+        reconstructPatrolPhase(i, dt);
+    }
+    refreshObstacleSleep(dt, false);  // Phases are already exact for the new clock
+}
+
+/**
+ * @brief Rebuilds one obstacle's patrol state from the tick clock.
+ *
+ * @param i Obstacle index.
+ * @param dt Fixed tick duration in seconds.
+ */
+void Simulation::reconstructPatrolPhase(std::size_t i, float dt)
+{
+    const float span = (store.obstacleRightLimit[i] - store.obstacleW[i]) - store.obstacleLeftLimit[i];
+    const float speed = std::fabs(store.obstacleVelX[i]);
+    if (span <= 0.0f || speed <= 0.0f)
+        return;  // Degenerate patrol; leave the spawn state as-is
+
+    // Triangle wave: distance travelled since spawn folded into one
+    // out-and-back cycle of length 2 * span
+    const float travelled = (store.obstacleSpawnX[i] - store.obstacleLeftLimit[i])
+        + speed * (static_cast<float>(tickIndex) * dt);
+    const float cycle = std::fmod(travelled, 2.0f * span);
+    if (cycle <= span)
+    {
+        store.obstacleX[i] = store.obstacleLeftLimit[i] + cycle;
+        store.obstacleVelX[i] = speed;
+    }
+    else
+    {
+        store.obstacleX[i] = store.obstacleLeftLimit[i] + 2.0f * span - cycle;
+        store.obstacleVelX[i] = -speed;
+    }
+}
+
+/**
+ * @brief Player-box sweep in whichever scalar mode the simulation runs.
+ *
+ * The float mode calls the sweep every caller always used; the
+ * fixed-point mode quantizes the boxes onto the 20.12 grid and runs
+ * the same templated slab test over Fixed, so both modes share one
+ * collision implementation.
+ *
+ * @param fixedMode Whether to sweep over Fixed.
+ * @param ax Player box left edge.
+ * @param ay Player box top edge.
+ * @param size Player box edge length.
+ * @param dx Player displacement along x.
+ * @param dy Player displacement along y.
+ * @param bx Static box left edge.
+ * @param by Static box top edge.
+ * @param bw Static box width.
+ * @param bh Static box height.
+ * @param out Receives the hit.
+ * @return true On a hit within the sweep.
+ */
+static bool sweptPlayerBox(bool fixedMode, float ax, float ay, float size,
+                           float dx, float dy,
+                           float bx, float by, float bw, float bh, SweptHit& out)
+{
+    if (!fixedMode)
+        return sweptAabb(ax, ay, size, size, dx, dy, bx, by, bw, bh, out);
+
+    SweptHitT<Fixed> hit;
+    if (!sweptAabbT<Fixed>(Fixed::fromFloat(ax), Fixed::fromFloat(ay),
+                           Fixed::fromFloat(size), Fixed::fromFloat(size),
+                           Fixed::fromFloat(dx), Fixed::fromFloat(dy),
+                           Fixed::fromFloat(bx), Fixed::fromFloat(by),
+                           Fixed::fromFloat(bw), Fixed::fromFloat(bh), hit))
+        return false;
+    out.t = hit.t.toFloat();
+    out.normalX = hit.normalX.toFloat();
+    out.normalY = hit.normalY.toFloat();
+    return true;
+}
+
+/**
+ * @brief Advances the simulation by one fixed tick.
+ *
+ * Dispatches to the profile instantiation: the classic variant with
+ * the locked constants folded in, or the generic variant reading the
+ * live config (see physics_profile.h).
+ *
+ * @param dt Fixed tick duration in seconds.
+ * @param input The player input held during this tick.
+ */
+void Simulation::tick(float dt, const InputState& input)
+{
+    if (lockedPhysics)
+        tickWith<ClassicPhysicsProfile>(dt, input);
+    else
+        tickWith<RuntimePhysicsProfile>(dt, input);
+}
+
+/**
+ * @brief The tick body; Profile supplies the tuning constants.
+ *
+ * @param dt Fixed tick duration in seconds.
+ * @param input The player input held during this tick.
+ */
+template <typename Profile>
+void Simulation::tickWith(float dt, const InputState& input)
+{
+    if (levelCompleted)
+        return;
+
+    const float gravity = Profile::gravity(tuning);             // Pixels per second squared
+    const float jumpStrength = Profile::jumpStrength(tuning);   // Pixels per second
+    const float moveSpeed = Profile::moveSpeed(tuning);         // Pixels per second
+    const float groundFriction = Profile::groundFriction(tuning);  // Per-60Hz-frame decay, rescaled to dt below
+
+    // Fixed-mode constants: the tick on the 20.12 grid, the bounce
+    // damping 0.7 and the friction decay pow(0.9, dt * 60) for the
+    // 120Hz tick, pre-quantized so the tick path makes no libm call
+    const Fixed fixedDt = Fixed::fromFloat(dt);
+    const Fixed fixedBounce = Fixed::fromRaw(2867);
+    const Fixed fixedFriction = Fixed::fromRaw(3886);
+
+    /**
+     * @brief Warm the chunks a predicted camera will need. The
+     * prediction extrapolates over the worst-case page-in latency, and
+     * the touch runs on a worker, so a mapped level's cold pages fault
+     * off-thread before the restream reads them — never inside a tick.
+     * Pure reads: the streamed window itself stays a function of the
+     * current camera, so replays and lockstep are unaffected.
+     */
+    const float chunkLookaheadSeconds = 0.25f;  // Covers a cold page-in with margin
+    const float predictedCameraX = camera.x + velocityX * chunkLookaheadSeconds;
+    const int wantFirst = chunks.firstChunkFor(predictedCameraX);
+    const int wantLast = chunks.lastChunkFor(predictedCameraX);
+    if (jobs && (wantFirst != prefetchedFirst || wantLast != prefetchedLast))
+    {
+        prefetchedFirst = wantFirst;
+        prefetchedLast = wantLast;
+        jobs->run(prefetchCounter, [this, wantFirst, wantLast]() {
+            chunks.touchChunks(wantFirst, wantLast);
+        });
+    }
+
+    /**
+     * @brief Stream static geometry for the current camera position; a
+     * no-op while the camera stays inside its chunk window. When the
+     * window moves, the sweep-and-prune indices are rebuilt alongside
+     * the hashes so either broadphase can answer the next query.
+     */
+    if (chunks.update(camera.x, store, platformHash, wallHash))
+    {
+        if (jobs && (chunks.activeFirstChunk() < prefetchedFirst || chunks.activeLastChunk() > prefetchedLast))
+            ++lateChunkCount;  // The restream read chunks the prefetch had not warmed
+        platformSweep.build(store.platformX, store.platformY, store.platformW, store.platformH);
+        wallSweep.build(store.wallX, store.wallY, store.wallW, store.wallH);
+        store.buildObstacleWallLists();  // Wall indices changed with the restream
+        cachedPlatform = invalidContact;  // Contact indices died with the old arrays
+        cachedWall = invalidContact;
+        refreshObstacleSleep(dt);  // The active window moved; sleep/wake accordingly
+    }
+
+    /**
+     * @brief Handle player movement input for left and right directions.
+     * Applies friction if no movement key is held.
+     */
+    if (input.left)
+        velocityX = -moveSpeed;
+    else if (input.right)
+        velocityX = moveSpeed;
+    else if (fixedPointPhysics)
+        velocityX = (Fixed::fromFloat(velocityX) * fixedFriction).toFloat();
+    else
+        velocityX *= std::pow(groundFriction, dt * 60.0f);
+
+    /**
+     * @brief Handle jumping if the player is on the ground.
+     */
+    if (input.up && isOnGround)
+    {
+        velocityY = jumpStrength;
+        isOnGround = false;
+    }
+
+    /**
+     * @brief Apply gravity. The position is integrated by the swept
+     * passes below so contacts are found along the motion, not after it.
+     */
+    if (fixedPointPhysics)
+        velocityY = (Fixed::fromFloat(velocityY) + Fixed::fromFloat(gravity) * fixedDt).toFloat();
+    else
+        velocityY += gravity * dt;
+
+    const float playerSize = playerRadius * 2.0f;
+    const float dx = fixedPointPhysics ? (Fixed::fromFloat(velocityX) * fixedDt).toFloat() : velocityX * dt;
+    const float dy = fixedPointPhysics ? (Fixed::fromFloat(velocityY) * fixedDt).toFloat() : velocityY * dt;
+
+    /**
+     * @brief Vertical pass: sweep the player's y motion against the
+     * platforms (including the floor) and resolve exactly once at the
+     * earliest time of impact, so the player cannot tunnel through a
+     * thin platform however far one tick falls. Last tick's platform
+     * underfoot is retested first: in the steady state (resting or
+     * bouncing on the same platform for dozens of ticks) that single
+     * test confirms the contact and the broadphase query and wide
+     * filter are skipped entirely.
+     */
+    bool landed = false;
+    if (velocityY > 0 && (store.playerMask & layers::Platform) != 0)  // Ball is falling
+    {
+        // One-way surfaces as masks: a candidate lands only if its Top
+        // bit is set and none of its bits are in the forbid byte. The
+        // forbid byte is DropThrough while down is held, so dropping
+        // through costs the standard path nothing but the AND
+        const std::uint8_t dropForbid = input.down ? surface::DropThrough : 0;
+        if (cachedPlatform != invalidContact)
+        {
+            SweptHit hit;
+            if (sweptPlayerBox(fixedPointPhysics, playerX, playerY, playerSize, 0.0f, dy,
+                               store.platformX[cachedPlatform], store.platformY[cachedPlatform],
+                               store.platformW[cachedPlatform], store.platformH[cachedPlatform], hit)
+                && hit.normalY < 0.0f && hit.t == 0.0f  // Still resting on it
+                && (store.platformSolid[cachedPlatform] & dropForbid) == 0)
+            {
+                playerY = store.platformY[cachedPlatform] - playerSize;
+                velocityY = fixedPointPhysics
+                    ? (-(Fixed::fromFloat(velocityY) * fixedBounce)).toFloat()
+                    : -velocityY * 0.7f;  // Bounce with 70% energy retained
+                isOnGround = true;
+                landed = true;
+                ++bounceCount;
+                lastBounceX = playerX + playerRadius;
+                lastBounceY = playerY + playerSize;
+            }
+        }
+
+        if (!landed)
+        {
+            const float sweptTop = dy < 0.0f ? playerY + dy : playerY;
+            queryPlatforms(playerX, sweptTop, playerSize, playerSize + std::fabs(dy));
+            candX.clear();
+            candY.clear();
+            candW.clear();
+            candH.clear();
+            for (std::size_t i : candidates)
+            {
+                candX.push_back(store.platformX[i]);
+                candY.push_back(store.platformY[i]);
+                candW.push_back(store.platformW[i]);
+                candH.push_back(store.platformH[i]);
+            }
+            testCandidatesWide(playerX, sweptTop, playerSize, playerSize + std::fabs(dy));
+
+            // Earliest-contact selection; large hit lists reduce in
+            // parallel with the order-defined merge, so the winner is
+            // the same for any thread count. The sentinel must be
+            // invalidContact, not candidates.size(): a store index can
+            // legitimately equal the candidate count
+            std::size_t landingPosition = invalidContact;
+            float landingTime = 2.0f;
+            reduceNearestContact(jobs, hits.size(), [&](std::size_t p, float& t) {
+                const std::size_t i = candidates[hits[p]];
+                SweptHit hit;
+                if (sweptPlayerBox(fixedPointPhysics, playerX, playerY, playerSize, 0.0f, dy,
+                                   store.platformX[i], store.platformY[i], store.platformW[i], store.platformH[i], hit)
+                    && hit.normalY < 0.0f
+                    && (store.platformSolid[i] & surface::Top) != 0
+                    && (store.platformSolid[i] & dropForbid) == 0)
+                {
+                    t = hit.t;
+                    return true;
+                }
+                return false;
+            }, landingPosition, landingTime);
+            const std::size_t landing
+                = landingPosition != invalidContact ? candidates[hits[landingPosition]] : invalidContact;
+            if (landing != invalidContact)
+            {
+                playerY = store.platformY[landing] - playerSize;  // Stop at the contact
+                velocityY = fixedPointPhysics
+                    ? (-(Fixed::fromFloat(velocityY) * fixedBounce)).toFloat()
+                    : -velocityY * 0.7f;  // Bounce with 70% energy retained
+                isOnGround = true;
+                landed = true;
+                cachedPlatform = landing;
+                ++bounceCount;
+                lastBounceX = playerX + playerRadius;
+                lastBounceY = playerY + playerSize;
+            }
+            else
+            {
+                cachedPlatform = invalidContact;
+            }
+        }
+    }
+    if (!landed)
+        playerY += dy;
+
+    /**
+     * @brief Horizontal pass: sweep the player's x motion against the
+     * walls the same way and stop at the earliest time of impact. The
+     * wall touched last tick is retested first, so holding a direction
+     * into a wall costs one test per tick instead of a broadphase query.
+     * With the Wall layer masked off the motion applies untested.
+     */
+    bool wallBlocked = false;
+    if ((store.playerMask & layers::Wall) == 0)
+    {
+        playerX += dx;
+        wallBlocked = true;  // Nothing below may move or stop the player
+    }
+    else if (dx != 0.0f && cachedWall != invalidContact)
+    {
+        SweptHit hit;
+        if (sweptPlayerBox(fixedPointPhysics, playerX, playerY, playerSize, dx, 0.0f,
+                           store.wallX[cachedWall], store.wallY[cachedWall],
+                           store.wallW[cachedWall], store.wallH[cachedWall], hit)
+            && hit.normalX != 0.0f && hit.t == 0.0f)  // Still pressed against it
+        {
+            if (dx > 0)
+                playerX = store.wallX[cachedWall] - playerSize;
+            else
+                playerX = store.wallX[cachedWall] + store.wallW[cachedWall];
+            velocityX = 0;  // Stop horizontal movement
+            wallBlocked = true;
+        }
+    }
+
+    if (!wallBlocked)
+    {
+        const float sweptLeft = dx < 0.0f ? playerX + dx : playerX;
+        queryWalls(sweptLeft, playerY, playerSize + std::fabs(dx), playerSize);
+        candX.clear();
+        candY.clear();
+        candW.clear();
+        candH.clear();
+        for (std::size_t i : candidates)
+        {
+            candX.push_back(store.wallX[i]);
+            candY.push_back(store.wallY[i]);
+            candW.push_back(store.wallW[i]);
+            candH.push_back(store.wallH[i]);
+        }
+        testCandidatesWide(sweptLeft, playerY, playerSize + std::fabs(dx), playerSize);
+
+        // Same order-defined reduction as the landing scan; the
+        // sentinel stays invalidContact (a store index can equal the
+        // candidate count)
+        std::size_t wallPosition = invalidContact;
+        float nearestTime = 2.0f;
+        reduceNearestContact(jobs, hits.size(), [&](std::size_t p, float& t) {
+            const std::size_t i = candidates[hits[p]];
+            SweptHit hit;
+            if (sweptPlayerBox(fixedPointPhysics, playerX, playerY, playerSize, dx, 0.0f,
+                               store.wallX[i], store.wallY[i], store.wallW[i], store.wallH[i], hit)
+                && hit.normalX != 0.0f)
+            {
+                t = hit.t;
+                return true;
+            }
+            return false;
+        }, wallPosition, nearestTime);
+        const std::size_t nearestWall
+            = wallPosition != invalidContact ? candidates[hits[wallPosition]] : invalidContact;
+        if (nearestWall != invalidContact)
+        {
+            // A t = 0 hit can mean the tick started inside the wall
+            // (restream, spawn). Resolving that by travel direction can
+            // snap across a thin wall, so depth resolution takes over:
+            // out the nearest face, whichever axis penetrates least.
+            float pushX, pushY;
+            if (nearestTime == 0.0f
+                && overlapPushOut(playerX, playerY, playerSize, playerSize,
+                                  store.wallX[nearestWall], store.wallY[nearestWall],
+                                  store.wallW[nearestWall], store.wallH[nearestWall],
+                                  velocityX, velocityY, pushX, pushY))
+            {
+                playerX += pushX;
+                playerY += pushY;
+                if (pushX != 0.0f)
+                    velocityX = 0;  // Pushed out sideways: stop into-the-wall motion
+                else
+                    velocityY = 0;  // Pushed out vertically
+            }
+            else if (dx > 0)
+            {
+                playerX = store.wallX[nearestWall] - playerSize;
+                velocityX = 0;  // Stop horizontal movement
+            }
+            else
+            {
+                playerX = store.wallX[nearestWall] + store.wallW[nearestWall];
+                velocityX = 0;  // Stop horizontal movement
+            }
+            cachedWall = nearestWall;
+        }
+        else
+        {
+            playerX += dx;
+            cachedWall = invalidContact;
+        }
+    }
+
+    /**
+     * @brief Move the awake obstacles and check for collisions.
+     * Obstacles sleeping outside the active window are skipped entirely.
+     * Large obstacle counts are split into range jobs across the pool;
+     * obstacles are independent so the split is race-free. If the player
+     * touches any obstacle AABB, the run is reset.
+     */
+    const std::size_t obstacleGrain = 512;
+    // The store's arrays start on a cache line and the grain is a
+    // multiple of 16 floats, so each worker's range covers whole lines:
+    // no line is ever written by two threads (no false sharing).
+    static_assert(512 % (cacheLineSize / sizeof(float)) == 0, "grain must cover whole cache lines");
+    if (awakeObstacles.size() == store.obstacleX.size())
+    {
+        // Everything awake: move the whole arrays, in parallel when large
+        if (jobs && store.obstacleX.size() >= obstacleGrain * 2)
+        {
+            jobs->parallelFor(store.obstacleX.size(), obstacleGrain, [this, dt](std::size_t begin, std::size_t end) {
+                store.moveObstaclesRange(dt, begin, end);
+            });
+        }
+        else
+        {
+            store.moveObstacles(dt);
+        }
+    }
+    else
+    {
+        // Move only the awake obstacles, walking the index list as
+        // contiguous runs so the patrol kernel still sees batches
+        for (std::size_t a = 0; a < awakeObstacles.size(); )
+        {
+            const std::size_t runBegin = awakeObstacles[a];
+            std::size_t runEnd = runBegin + 1;
+            ++a;
+            while (a < awakeObstacles.size() && awakeObstacles[a] == runEnd)
+            {
+                ++runEnd;
+                ++a;
+            }
+            store.moveObstaclesRange(dt, runBegin, runEnd);
+        }
+    }
+    if (!obstacleScripts.empty())
+        obstacleScripts.run(store, dt);  // Scripted obstacles; one interpreter pass
+
+    /**
+     * @brief Obstacle collision pass: detection only. A hit records a
+     * pending death; the reset itself runs at the commit point at the
+     * end of the tick, so no sweep ever mutates coin or player state
+     * while later passes still read it. That keeps every pass below a
+     * pure read of this tick's state — free to become range jobs —
+     * and death latency stays bounded to this same tick.
+     */
+    bool pendingDeath = false;
+    if ((store.playerMask & layers::Obstacle) != 0)
+    {
+        aabbTestWide(playerX, playerY, playerSize, playerSize,
+                      store.obstacleX.data(), store.obstacleY.data(), store.obstacleW.data(), store.obstacleH.data(),
+                      store.obstacleX.size(), hits);
+        pendingDeath = !hits.empty();
+    }
+
+    /**
+     * @brief Coin magnet: live coins within the configured radius
+     * drift toward the player. The proximity query visits only the
+     * index cells the radius overlaps, and a drifted coin is re-keyed
+     * under its new AABB so the index stays exact. With the magnet off
+     * (the default radius of 0) the whole block is one float compare.
+     */
+    const float magnetRadius = Profile::magnetRadius(tuning);
+    if (!pendingDeath && magnetRadius > 0.0f && (store.playerMask & layers::Coin) != 0)
+    {
+        const float centerX = playerX + playerSize * 0.5f;
+        const float centerY = playerY + playerSize * 0.5f;
+        coinHash.forEachInCircle(centerX, centerY, magnetRadius, magnetScratch, [&](std::size_t i) {
+            if (!coinAlive.test(i))
+                return;
+            Aabb<float>& coin = coinBounds[i];
+            const float coinCenterX = coin.x + coin.w * 0.5f;
+            const float coinCenterY = coin.y + coin.h * 0.5f;
+            const float dx = centerX - coinCenterX;
+            const float dy = centerY - coinCenterY;
+            const float distSq = dx * dx + dy * dy;
+            if (distSq > magnetRadius * magnetRadius || distSq == 0.0f)
+                return;  // Exact radius test; the query only pruned cells
+            const float dist = std::sqrt(distSq);
+            const float step = std::min(Profile::magnetPull(tuning) * dt, dist);
+            coinHash.remove(i, coin.x, coin.y, coin.w, coin.h);
+            coin.x += dx / dist * step;
+            coin.y += dy / dist * step;
+            coinHash.insert(i, coin.x, coin.y, coin.w, coin.h);
+            coinsDrifted = true;
+        });
+    }
+
+    /**
+     * @brief Check for coin collection over the live bits only.
+     * A pickup is an O(1) bit clear. Large coin arrays are swept as
+     * range jobs; the grain is a multiple of 64 so each range owns whole
+     * mask words and bit clears never race across workers. Once every
+     * coin is collected (or the Coin layer is masked off) the sweep is
+     * skipped outright.
+     */
+    const Aabb<float> playerBox{ playerX, playerY, playerSize, playerSize };
+    if (!pendingDeath && (store.playerMask & layers::Coin) != 0 && coinCount < static_cast<int>(coinBounds.size()))
+    {
+        const std::size_t coinGrain = 256;
+        if (jobs && coinBounds.size() >= coinGrain * 2)
+        {
+            std::atomic<int> collected{ 0 };
+            jobs->parallelFor(coinBounds.size(), coinGrain, [this, playerBox, &collected](std::size_t begin, std::size_t end) {
+                int local = 0;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    if (coinAlive.test(i)
+                        && playerBox.intersects(coinBounds[i]))
+                    {
+                        coinAlive.clear(i);
+                        local++;
+                    }
+                }
+                collected.fetch_add(local, std::memory_order_relaxed);
+            });
+            coinCount += collected.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            coinAlive.forEachSet([this, playerBox](std::size_t i) {
+                if (playerBox.intersects(coinBounds[i]))
+                {
+                    coinAlive.clear(i);
+                    coinCount++;  // Increase the coin count when a coin is collected
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Check for collision with the goal.
+     * Only allow winning if all coins are collected; the cheap coin
+     * count and layer tests run first so the rect test is short-circuited
+     * on almost every tick.
+     */
+    if (!pendingDeath
+        && coinCount == static_cast<int>(coinBounds.size())
+        && (store.playerMask & layers::Goal) != 0
+        && playerBox.intersects(goal))
+    {
+        levelCompleted = true;  // The player wins the level
+    }
+
+    /**
+     * @brief Advance the camera toward the player if the level is not completed.
+     */
+    if (!pendingDeath && !levelCompleted)
+        camera.follow(playerX, velocityX, dt);  // Damped lead toward the travel direction
+
+    if (!pendingDeath && !store.ballX.empty())
+        tickBalls(dt);
+
+    /**
+     * @brief Death commit point: the one place a death mutates state,
+     * after every sweep has finished. The collect/goal/camera/ball
+     * phases above skip a death tick — a reset discards their results
+     * anyway, so skipping keeps the post-tick state bit-identical to
+     * resolving the death where it was detected.
+     */
+    if (pendingDeath)
+    {
+        ++deathCount;  // Before reset, which this counter deliberately survives
+        reset();
+        return;  // reset() zeroed the phase clock; nothing left to advance
+    }
+
+    tickIndex++;  // Advance the phase clock sleeping entities wake against
+}
@@ -0,0 +1,380 @@
+#pragma once
+#include "level_loader.h"
+#include "entity_store.h"
+#include "obstacle_script.h"
+#include "spatial_hash.h"
+#include "sweep_prune.h"
+#include "chunk_stream.h"
+#include "camera.h"
+#include "config.h"
+#include "alive_mask.h"
+#include "job_system.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief One tick's worth of player input.
+ *
+ * The simulation never touches sf::Keyboard; the window build samples the
+ * keyboard into this struct once per tick and headless runs (CI soak
+ * tests, benchmarks, replays) fill it programmatically.
+ */
+struct InputState {
+    bool left = false; ///< Move left.
+    bool right = false; ///< Move right.
+    bool up = false; ///< Jump.
+    bool down = false; ///< Drop through one-way platforms.
+};
+
+/**
+ * @brief Selects which broadphase structure the player queries go through.
+ *
+ * Both structures are kept built over the streamed-in geometry; the kind
+ * only picks which one answers queries, so a level can choose whichever
+ * profiles faster for its layout. Sweep-and-prune tends to win on the
+ * mostly-static horizontal levels; the hash wins when geometry is dense
+ * and stacked vertically.
+ */
+enum class Broadphase {
+    Hash, ///< Uniform-grid spatial hash (the default).
+    SweepAndPrune, ///< Sorted-by-left-edge sweep-and-prune index.
+};
+
+/**
+ * @brief The complete game simulation, free of any SFML rendering types.
+ *
+ * Holds the player, camera, entity store, broadphase hashes, chunk stream
+ * and coin state as plain data and advances them one fixed tick at a
+ * time. The window build in bounce.cpp wraps this with input sampling and
+ * rendering; headless builds drive it directly at uncapped speed with no
+ * window, no draws and no asset loads. All gameplay rules live here so
+ * the two builds cannot drift apart.
+ */
+class Simulation {
+public:
+    /**
+     * @brief Initializes the simulation from a loaded level.
+     *
+     * Builds the entity store, chunk stream and coin state, then resets
+     * the player to the starting position.
+     *
+     * @param level The loaded level.
+     */
+    void init(const LevelData& level);
+
+    /**
+     * @brief Advances the simulation by one fixed tick.
+     *
+     * Runs input, gravity, platform/wall/obstacle/coin collision, the
+     * goal check and the camera, exactly as one tick of @p dt seconds.
+     * Does nothing once the level is completed.
+     *
+     * @param dt Fixed tick duration in seconds.
+     * @param input The player input held during this tick.
+     */
+    void tick(float dt, const InputState& input);
+
+    /**
+     * @brief Resets the run to its initial state.
+     *
+     * Puts the player and camera back at the start, zeroes the velocity
+     * and coin count and revives every coin. Called on death and from the
+     * restart key.
+     */
+    void reset();
+
+    /**
+     * @brief Attaches a job system for parallel entity updates.
+     *
+     * With a job system attached, the obstacle update and the coin sweep
+     * run as range jobs across the pool once the entity counts are large
+     * enough to pay for the dispatch; small levels stay serial. Pass
+     * nullptr to detach. The parallel paths produce the same end state
+     * as the serial ones, so determinism checksums are unaffected.
+     *
+     * @param jobSystem The pool to use, or nullptr for serial updates.
+     */
+    void setJobSystem(JobSystem* jobSystem) { jobs = jobSystem; }
+
+    /**
+     * @brief Selects the broadphase the player collision queries use.
+     *
+     * Takes effect on the next tick; both structures stay built, so
+     * switching is free and does not disturb determinism — the candidate
+     * sets differ but the resolved contacts are identical.
+     *
+     * @param kind The broadphase to query.
+     */
+    void setBroadphase(Broadphase kind) { broadphase = kind; }
+
+    /**
+     * @brief Spawns physics balls for party mode.
+     *
+     * Balls run the player's physics (gravity, platform bounce, floor
+     * bounce, wall deflection) as one batch kernel over an SoA array
+     * sharing the player's broadphase structures. Spawn positions and
+     * velocities come from a deterministic generator, so two clients
+     * spawning with the same seed stay in lockstep. Spawning is
+     * additive; call clearBalls on the store to empty the field. The
+     * field is cosmetic party dressing and stays outside the savestate
+     * block — rewind and savegames leave it running.
+     *
+     * @param count Number of balls to add.
+     * @param seed Seed for the placement generator.
+     */
+    void spawnBalls(std::size_t count, std::uint32_t seed);
+
+    /**
+     * @brief Size in bytes of one captured state block.
+     *
+     * Fixed once init() has run — the block covers the player, camera,
+     * coin and tick scalars plus the obstacle position/velocity arrays
+     * and the coin alive words. Derived structures (broadphases, contact
+     * cache, sleep sets) are rebuilt on restore, not stored.
+     *
+     * @return std::size_t Bytes captureState writes and restoreState reads.
+     */
+    std::size_t stateSize() const;
+
+    /**
+     * @brief Copies the full mutable game state into one POD block.
+     *
+     * Plain memcpys of plain data — no allocation, no pointers in the
+     * block — so snapshotting every tick is cheap enough for a rewind
+     * ring.
+     *
+     * @param dst Destination block of at least stateSize() bytes.
+     */
+    void captureState(unsigned char* dst) const;
+
+    /**
+     * @brief Restores a state captured by captureState in O(1).
+     *
+     * Copies the block back, then repairs everything derived from it:
+     * restreams chunks if the restored camera is in a different window,
+     * drops the contact cache and recomputes the obstacle sleep set from
+     * the restored tick clock. The block must come from this simulation
+     * after the same init().
+     *
+     * @param src Block of stateSize() bytes from captureState.
+     * @param dt Fixed tick duration in seconds (the phase clock unit).
+     */
+    void restoreState(const unsigned char* src, float dt);
+
+    /**
+     * @brief Jumps the patrol clock to @p tick and rebuilds every
+     * obstacle from it in closed form.
+     *
+     * Patrol position is a triangle wave over the tick counter, so a
+     * mid-session netplay joiner or a coarse replay seek lands on
+     * exact obstacle positions without replaying a single missed tick
+     * — one evaluation per obstacle, O(1) each. Obstacles whose patrol
+     * can reach a wall are skipped: a wall reversal is not a function
+     * of the clock, which is the same reason the sleep system pins
+     * them awake.
+     *
+     * @param tick The tick counter to jump to.
+     * @param dt Fixed tick duration in seconds (the phase clock unit).
+     */
+    void resyncPatrolPhases(std::uint64_t tick, float dt);
+
+    float playerX = 400.0f; ///< Player AABB left edge (matches the shape's position).
+    float playerY = 300.0f; ///< Player AABB top edge.
+    float playerRadius = 20.0f; ///< Player circle radius; the AABB is 2r by 2r.
+    float velocityX = 0.0f; ///< Player horizontal velocity in pixels per second.
+    float velocityY = 0.0f; ///< Player vertical velocity in pixels per second.
+    bool isOnGround = false; ///< True while the player can jump.
+    bool levelCompleted = false; ///< True once the goal is reached with all coins.
+    Camera camera; ///< Smoothed follow camera; its rect feeds culling and streaming.
+
+    /**
+     * @brief The tuning values the tick reads; swapped at tick
+     * boundaries by the config system's live reload. Points at the
+     * built-in defaults until a config file loads, and every read in
+     * the tick is a plain member load through this cached pointer.
+     */
+    const TuningConfig* tuning = &defaultTuning;
+    int coinCount = 0; ///< Coins collected this run.
+    std::uint32_t bounceCount = 0; ///< Platform bounces since reset; render-side effects trigger off changes.
+    /**
+     * @brief Scripted obstacle behaviors. Levels attach programs after
+     * init; with nothing attached the engine is never entered and the
+     * vectorized patrol kernel handles every obstacle as before. Its
+     * dynamic state rides in the savestate block.
+     */
+    ObstacleScriptEngine obstacleScripts;
+
+    std::uint32_t deathCount = 0; ///< Obstacle deaths this session. Survives reset (a death IS a reset) so observers can diff it; not part of the checksum or savestate block.
+    std::uint32_t resetCount = 0; ///< Full resets this session (deaths, R, victory). Survives reset like deathCount; telemetry diffs it.
+    std::uint32_t lateChunkCount = 0; ///< Restreams that needed chunks the prefetch had not warmed; target zero. Session counter like deathCount.
+    float lastBounceX = 0.0f; ///< Bottom-center x of the most recent bounce contact.
+    float lastBounceY = 0.0f; ///< Contact y of the most recent bounce.
+    std::uint64_t tickIndex = 0; ///< Ticks since the last reset; the phase clock for sleeping entities.
+
+    EntityStore store; ///< Structure-of-arrays entity storage.
+    SpatialHash platformHash; ///< Grid broadphase over the streamed-in platforms.
+    SpatialHash wallHash; ///< Grid broadphase over the streamed-in walls.
+    SweepPrune platformSweep; ///< Sweep-and-prune index over the same platforms.
+    SweepPrune wallSweep; ///< Sweep-and-prune index over the same walls.
+    ChunkStream chunks; ///< Streams static geometry around the camera.
+    std::vector<Aabb<float>> coinBounds; ///< Coin AABBs; fixed unless the magnet drifts them.
+    AliveMask coinAlive; ///< Live bit per coin; a pickup clears its bit.
+    SpatialHash coinHash; ///< Proximity index over the coins, maintained as the magnet drifts them.
+    std::vector<Aabb<float>> coinHome; ///< Spawn-position coin AABBs; reset() drifts everything back.
+    bool coinsDrifted = false; ///< Whether any coin has left its home spot this run.
+    Aabb<float> goal; ///< The goal platform's AABB.
+    Aabb<float> floorRect; ///< The floor's AABB; balls bounce on it analytically.
+    float ballRadius = 10.0f; ///< Ball circle radius; the AABB is 2r by 2r.
+
+    /**
+     * @brief Runs the player physics on the 20.12 fixed-point grid.
+     *
+     * Select before init(), like the layer mask: every velocity and
+     * displacement update goes through integer add/shift kernels and
+     * the swept tests run over Fixed, so two builds from different
+     * compilers (or libms — the friction std::pow is replaced by a
+     * precomputed factor) advance the player bit-identically. Positions
+     * still live in floats; every 20.12 value round-trips exactly.
+     * Off by default: the float path is unchanged and replays recorded
+     * in one mode only verify against the same mode.
+     */
+    bool fixedPointPhysics = false;
+
+    /**
+     * @brief Runs the tick with the classic constants compiled in.
+     *
+     * Competition builds lock the tuning, so the tick dispatches to
+     * the instantiation templated on ClassicPhysicsProfile: every
+     * tuning value is a literal the optimizer folds into the
+     * integration instead of a per-tick config load. The constants are
+     * statically asserted equal to the TuningConfig defaults, so with
+     * a default config the two paths advance the simulation
+     * bit-identically. Off by default; the live-reloadable runtime
+     * path is the generic instantiation.
+     */
+    bool lockedPhysics = false;
+
+private:
+    /**
+     * @brief The tick body, templated on the physics constant provider.
+     *
+     * Both instantiations — RuntimePhysicsProfile (config loads) and
+     * ClassicPhysicsProfile (folded literals) — are emitted in
+     * simulation.cpp; tick() picks one off lockedPhysics.
+     *
+     * @param dt Fixed tick duration in seconds.
+     * @param input The player input held during this tick.
+     */
+    template <typename Profile>
+    void tickWith(float dt, const InputState& input);
+
+    /**
+     * @brief Runs the wide AABB filter over the gathered candidate arrays.
+     *
+     * Fills the hit list from candX..candH against the query box. The
+     * tests are pure reads, so huge candidate sets are split into slice
+     * jobs across the pool, each running the SIMD kernel on its slice;
+     * smaller sets take the serial SIMD path. Mutation never happens
+     * here — callers resolve once afterward from the nearest hit.
+     *
+     * @param qx Query box left edge.
+     * @param qy Query box top edge.
+     * @param qw Query box width.
+     * @param qh Query box height.
+     */
+    void testCandidatesWide(float qx, float qy, float qw, float qh);
+
+    /**
+     * @brief Collects platform candidates through the selected broadphase.
+     *
+     * @param x Left edge of the query box.
+     * @param y Top edge of the query box.
+     * @param w Width of the query box.
+     * @param h Height of the query box.
+     */
+    void queryPlatforms(float x, float y, float w, float h);
+
+    /**
+     * @brief Collects wall candidates through the selected broadphase.
+     *
+     * @param x Left edge of the query box.
+     * @param y Top edge of the query box.
+     * @param w Width of the query box.
+     * @param h Height of the query box.
+     */
+    void queryWalls(float x, float y, float w, float h);
+
+    /**
+     * @brief Advances every ball by one tick.
+     *
+     * The player's vertical and horizontal resolution, run per ball
+     * over the SoA arrays: gravity, swept platform test with an
+     * energy-retaining bounce, analytic floor bounce (the floor is
+     * always solid even outside the streamed window), and wall hits
+     * deflecting the ball instead of stopping it so a party-mode field
+     * keeps moving. Balls are independent, so the loop walks them in
+     * index order and stays deterministic.
+     *
+     * @param dt Fixed tick duration in seconds.
+     */
+    void tickBalls(float dt);
+
+    /**
+     * @brief Recomputes which obstacles are awake for the active window.
+     *
+     * An obstacle sleeps while its reachable patrol span lies outside the
+     * chunk stream's active window — no movement, no state updates, so
+     * simulation cost tracks what is near the player instead of level
+     * size. A newly awake obstacle has its patrol phase reconstructed
+     * from the tick clock, which gives the same state every run, so
+     * replays stay byte-identical no matter when the window reached it.
+     * Obstacles with wall contacts in their patrol never sleep; a wall
+     * reversal is not reconstructible from the clock alone.
+     *
+     * @param dt Fixed tick duration in seconds (the phase clock unit).
+     * @param reconstructOnWake Whether newly awake obstacles get their
+     * phase rebuilt from the clock. Savestate restore passes false —
+     * the restored arrays already hold the exact captured state.
+     */
+    void refreshObstacleSleep(float dt, bool reconstructOnWake = true);
+
+    /**
+     * @brief Rebuilds one obstacle's patrol state from the tick clock.
+     *
+     * The patrol is a triangle wave between the limits, so position and
+     * direction at any tick follow from the spawn phase and elapsed
+     * simulated time.
+     *
+     * @param i Obstacle index.
+     * @param dt Fixed tick duration in seconds.
+     */
+    void reconstructPatrolPhase(std::size_t i, float dt);
+
+    /// Sentinel for "no cached contact".
+    static constexpr std::size_t invalidContact = static_cast<std::size_t>(-1);
+
+    JobSystem* jobs = nullptr; ///< Optional pool for parallel entity updates.
+    JobSystem::Counter prefetchCounter; ///< Outstanding chunk prefetch jobs; never waited on mid-run.
+    int prefetchedFirst = -1; ///< First chunk the last prefetch covered.
+    int prefetchedLast = -2; ///< Last chunk the last prefetch covered.
+    Broadphase broadphase = Broadphase::Hash; ///< Which broadphase answers player queries.
+
+    /**
+     * The player touches the same platform and wall for dozens of
+     * consecutive ticks, so each pass remembers last tick's contact and
+     * retests just that box first; the broadphase query and wide filter
+     * only run on a miss. Indices point into the store's streamed
+     * arrays, so both are invalidated whenever the chunk stream
+     * repopulates the geometry (and on reset).
+     */
+    std::size_t cachedPlatform = invalidContact; ///< Last tick's platform underfoot.
+    std::size_t cachedWall = invalidContact; ///< Last tick's wall in contact.
+
+    std::vector<std::uint8_t> obstacleAwake; ///< One flag per obstacle; sleepers are frozen.
+    std::vector<std::size_t> awakeObstacles; ///< Awake obstacle indices, ascending.
+    std::vector<std::size_t> candidates; ///< Scratch for broadphase queries.
+    std::vector<std::size_t> magnetScratch; ///< Scratch for the magnet's proximity query.
+    std::vector<std::size_t> hits; ///< Scratch for SIMD batch test results.
+    std::vector<float> candX, candY, candW, candH; ///< Gathered candidate AABBs.
+};
@@ -0,0 +1,137 @@
+#include "spatial_hash.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Packs a cell coordinate pair into one hashable key.
+ *
+ * @param cellX Cell x index.
+ * @param cellY Cell y index.
+ * @return std::int64_t The packed key.
+ */
+std::int64_t SpatialHash::cellKey(std::int32_t cellX, std::int32_t cellY)
+{
+    return (static_cast<std::int64_t>(cellX) << 32) | static_cast<std::uint32_t>(cellY);
+}
+
+/**
+ * @brief Builds the hash from parallel AABB arrays.
+ *
+ * @param xs Left edges of the boxes.
+ * @param ys Top edges of the boxes.
+ * @param ws Widths of the boxes.
+ * @param hs Heights of the boxes.
+ * @param cellSize Edge length of a grid cell in pixels.
+ */
+void SpatialHash::build(const AlignedVector<float>& xs, const AlignedVector<float>& ys, const AlignedVector<float>& ws, const AlignedVector<float>& hs, float cellSize)
+{
+    this->cellSize = cellSize;
+    cells.clear();
+
+    for (std::size_t i = 0; i < xs.size(); ++i)
+    {
+        const std::int32_t minCellX = static_cast<std::int32_t>(std::floor(xs[i] / cellSize));
+        const std::int32_t maxCellX = static_cast<std::int32_t>(std::floor((xs[i] + ws[i]) / cellSize));
+        const std::int32_t minCellY = static_cast<std::int32_t>(std::floor(ys[i] / cellSize));
+        const std::int32_t maxCellY = static_cast<std::int32_t>(std::floor((ys[i] + hs[i]) / cellSize));
+
+        for (std::int32_t cy = minCellY; cy <= maxCellY; ++cy)
+            for (std::int32_t cx = minCellX; cx <= maxCellX; ++cx)
+                cells[cellKey(cx, cy)].push_back(i);
+    }
+}
+
+/**
+ * @brief Adds one box to the hash.
+ *
+ * @param index The box's index in the caller's arrays.
+ * @param x Left edge of the box.
+ * @param y Top edge of the box.
+ * @param w Width of the box.
+ * @param h Height of the box.
+ */
+void SpatialHash::insert(std::size_t index, float x, float y, float w, float h)
+{
+    const std::int32_t minCellX = static_cast<std::int32_t>(std::floor(x / cellSize));
+    const std::int32_t maxCellX = static_cast<std::int32_t>(std::floor((x + w) / cellSize));
+    const std::int32_t minCellY = static_cast<std::int32_t>(std::floor(y / cellSize));
+    const std::int32_t maxCellY = static_cast<std::int32_t>(std::floor((y + h) / cellSize));
+
+    for (std::int32_t cy = minCellY; cy <= maxCellY; ++cy)
+        for (std::int32_t cx = minCellX; cx <= maxCellX; ++cx)
+            cells[cellKey(cx, cy)].push_back(index);
+}
+
+/**
+ * @brief Removes one box from the hash.
+ *
+ * @param index The box's index in the caller's arrays.
+ * @param x Left edge of the box as inserted.
+ * @param y Top edge of the box as inserted.
+ * @param w Width of the box as inserted.
+ * @param h Height of the box as inserted.
+ */
+void SpatialHash::remove(std::size_t index, float x, float y, float w, float h)
+{
+    const std::int32_t minCellX = static_cast<std::int32_t>(std::floor(x / cellSize));
+    const std::int32_t maxCellX = static_cast<std::int32_t>(std::floor((x + w) / cellSize));
+    const std::int32_t minCellY = static_cast<std::int32_t>(std::floor(y / cellSize));
+    const std::int32_t maxCellY = static_cast<std::int32_t>(std::floor((y + h) / cellSize));
+
+    for (std::int32_t cy = minCellY; cy <= maxCellY; ++cy)
+    {
+        for (std::int32_t cx = minCellX; cx <= maxCellX; ++cx)
+        {
+            const auto it = cells.find(cellKey(cx, cy));
+            if (it == cells.end())
+                continue;
+            std::vector<std::size_t>& bucket = it->second;
+            for (std::size_t slot = 0; slot < bucket.size(); ++slot)
+            {
+                if (bucket[slot] == index)
+                {
+                    // Order within a cell never mattered (queries sort),
+                    // so swap-remove keeps this O(bucket)
+                    bucket[slot] = bucket.back();
+                    bucket.pop_back();
+                    break;
+                }
+            }
+            if (bucket.empty())
+                cells.erase(it);
+        }
+    }
+}
+
+/**
+ * @brief Collects the indices of boxes that may overlap a query box.
+ *
+ * @param x Left edge of the query box.
+ * @param y Top edge of the query box.
+ * @param w Width of the query box.
+ * @param h Height of the query box.
+ * @param outCandidates Receives the candidate indices (cleared first).
+ */
+void SpatialHash::query(float x, float y, float w, float h, std::vector<std::size_t>& outCandidates) const
+{
+    outCandidates.clear();
+
+    const std::int32_t minCellX = static_cast<std::int32_t>(std::floor(x / cellSize));
+    const std::int32_t maxCellX = static_cast<std::int32_t>(std::floor((x + w) / cellSize));
+    const std::int32_t minCellY = static_cast<std::int32_t>(std::floor(y / cellSize));
+    const std::int32_t maxCellY = static_cast<std::int32_t>(std::floor((y + h) / cellSize));
+
+    for (std::int32_t cy = minCellY; cy <= maxCellY; ++cy)
+    {
+        for (std::int32_t cx = minCellX; cx <= maxCellX; ++cx)
+        {
+            const auto it = cells.find(cellKey(cx, cy));
+            if (it != cells.end())
+                outCandidates.insert(outCandidates.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    // A box spanning several cells appears once per cell; deduplicate
+    std::sort(outCandidates.begin(), outCandidates.end());
+    outCandidates.erase(std::unique(outCandidates.begin(), outCandidates.end()), outCandidates.end());
+}
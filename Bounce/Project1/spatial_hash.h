@@ -0,0 +1,140 @@
+#pragma once
+#include "cache_aligned.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Uniform-grid spatial hash over a set of static AABBs.
+ *
+ * Built once at level load from the entity store's parallel arrays, the
+ * hash maps grid cells to the indices of the boxes overlapping them.
+ * Collision queries then only test the boxes in the 2-3 cells the query
+ * box overlaps instead of scanning every platform and wall in the level.
+ */
+class SpatialHash {
+public:
+    /**
+     * @brief Builds the hash from parallel AABB arrays.
+     *
+     * @param xs Left edges of the boxes.
+     * @param ys Top edges of the boxes.
+     * @param ws Widths of the boxes.
+     * @param hs Heights of the boxes.
+     * @param cellSize Edge length of a grid cell in pixels (default 256).
+     */
+    void build(const AlignedVector<float>& xs, const AlignedVector<float>& ys, const AlignedVector<float>& ws, const AlignedVector<float>& hs, float cellSize = 256.0f);
+
+    /**
+     * @brief Collects the indices of boxes that may overlap a query box.
+     *
+     * The result is deduplicated and sorted; callers still run the exact
+     * AABB test on each candidate.
+     *
+     * @param x Left edge of the query box.
+     * @param y Top edge of the query box.
+     * @param w Width of the query box.
+     * @param h Height of the query box.
+     * @param outCandidates Receives the candidate indices (cleared first).
+     */
+    void query(float x, float y, float w, float h, std::vector<std::size_t>& outCandidates) const;
+
+    /**
+     * @brief Visits the indices of boxes near a circle, once each.
+     *
+     * The proximity form of query: cells beyond the radius are pruned
+     * before their buckets are touched, the survivors are deduplicated,
+     * and @p fn runs once per candidate. As with query, this is the
+     * broadphase half — callers run the exact distance or containment
+     * test on each candidate. One index serves every proximity consumer
+     * (coin magnet, aggro checks, editor picking) instead of each
+     * feature growing its own per-frame scan.
+     *
+     * @param centerX Circle center x.
+     * @param centerY Circle center y.
+     * @param radius Circle radius in pixels.
+     * @param scratch Caller-owned candidate buffer, reused across calls.
+     * @param fn Callable taking one std::size_t box index.
+     */
+    template <typename Fn>
+    void forEachInCircle(float centerX, float centerY, float radius, std::vector<std::size_t>& scratch, Fn&& fn) const
+    {
+        scratch.clear();
+
+        const std::int32_t minCellX = static_cast<std::int32_t>(std::floor((centerX - radius) / cellSize));
+        const std::int32_t maxCellX = static_cast<std::int32_t>(std::floor((centerX + radius) / cellSize));
+        const std::int32_t minCellY = static_cast<std::int32_t>(std::floor((centerY - radius) / cellSize));
+        const std::int32_t maxCellY = static_cast<std::int32_t>(std::floor((centerY + radius) / cellSize));
+
+        for (std::int32_t cy = minCellY; cy <= maxCellY; ++cy)
+        {
+            for (std::int32_t cx = minCellX; cx <= maxCellX; ++cx)
+            {
+                // Prune cells the circle's bounding box clips but the
+                // circle itself misses: clamp the center to the cell
+                // rect and test the nearest point against the radius
+                const float nearestX = std::max(cx * cellSize, std::min(centerX, (cx + 1) * cellSize));
+                const float nearestY = std::max(cy * cellSize, std::min(centerY, (cy + 1) * cellSize));
+                const float dx = centerX - nearestX;
+                const float dy = centerY - nearestY;
+                if (dx * dx + dy * dy > radius * radius)
+                    continue;
+
+                const auto it = cells.find(cellKey(cx, cy));
+                if (it == cells.end())
+                    continue;
+                scratch.insert(scratch.end(), it->second.begin(), it->second.end());
+            }
+        }
+
+        std::sort(scratch.begin(), scratch.end());
+        scratch.erase(std::unique(scratch.begin(), scratch.end()), scratch.end());
+        for (std::size_t index : scratch)
+            fn(index);
+    }
+
+    /**
+     * @brief Adds one box to the hash.
+     *
+     * Touches only the cells the box overlaps, so the editor can
+     * maintain the hash entity by entity instead of rebuilding it.
+     *
+     * @param index The box's index in the caller's arrays.
+     * @param x Left edge of the box.
+     * @param y Top edge of the box.
+     * @param w Width of the box.
+     * @param h Height of the box.
+     */
+    void insert(std::size_t index, float x, float y, float w, float h);
+
+    /**
+     * @brief Removes one box from the hash.
+     *
+     * Must be called with the same AABB the index was inserted with;
+     * moving a box is a remove with the old AABB and an insert with
+     * the new one, again touching only the overlapped cells.
+     *
+     * @param index The box's index in the caller's arrays.
+     * @param x Left edge of the box as inserted.
+     * @param y Top edge of the box as inserted.
+     * @param w Width of the box as inserted.
+     * @param h Height of the box as inserted.
+     */
+    void remove(std::size_t index, float x, float y, float w, float h);
+
+private:
+    /**
+     * @brief Packs a cell coordinate pair into one hashable key.
+     *
+     * @param cellX Cell x index.
+     * @param cellY Cell y index.
+     * @return std::int64_t The packed key.
+     */
+    static std::int64_t cellKey(std::int32_t cellX, std::int32_t cellY);
+
+    std::unordered_map<std::int64_t, std::vector<std::size_t>> cells; ///< Cell key to overlapping box indices.
+    float cellSize = 256.0f; ///< Edge length of a grid cell in pixels.
+};
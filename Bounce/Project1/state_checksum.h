@@ -0,0 +1,89 @@
+#pragma once
+#include "simulation.h"
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+/**
+ * @brief FNV-1a checksums over the simulation state.
+ *
+ * Hashes the raw bytes of the player, obstacle and coin state so any
+ * behavioral difference between two builds — a reordered loop, a SIMD
+ * kernel that rounds differently, a changed constant — shows up as a
+ * diverging checksum at the exact tick it first occurs. Used by the
+ * headless determinism harness; the functions are header-only and
+ * allocation-free so they can run inside a per-tick loop at full speed.
+ */
+
+constexpr std::uint64_t fnvOffsetBasis = 14695981039346656037ull; ///< FNV-1a 64-bit offset basis.
+constexpr std::uint64_t fnvPrime = 1099511628211ull; ///< FNV-1a 64-bit prime.
+
+/**
+ * @brief Folds a byte range into a running FNV-1a hash.
+ *
+ * @param hash The running hash.
+ * @param data Pointer to the bytes to fold in.
+ * @param size Number of bytes.
+ * @return std::uint64_t The updated hash.
+ */
+inline std::uint64_t fnv1aAppend(std::uint64_t hash, const void* data, std::size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= fnvPrime;
+    }
+    return hash;
+}
+
+/**
+ * @brief Folds one float's raw bytes into a running FNV-1a hash.
+ *
+ * @param hash The running hash.
+ * @param value The float to fold in.
+ * @return std::uint64_t The updated hash.
+ */
+inline std::uint64_t fnv1aAppend(std::uint64_t hash, float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return fnv1aAppend(hash, &bits, sizeof(bits));
+}
+
+/**
+ * @brief Checksums the gameplay-relevant simulation state.
+ *
+ * Covers the player position and velocity, the ground/completion flags,
+ * the coin count, every obstacle's position and velocity and the set of
+ * live coins. Chunk-resident static geometry is derived state and is
+ * deliberately excluded.
+ *
+ * @param sim The simulation to checksum.
+ * @param hash The running hash to continue from (default: fresh).
+ * @return std::uint64_t The updated hash.
+ */
+inline std::uint64_t checksumSimulation(const Simulation& sim, std::uint64_t hash = fnvOffsetBasis)
+{
+    hash = fnv1aAppend(hash, sim.playerX);
+    hash = fnv1aAppend(hash, sim.playerY);
+    hash = fnv1aAppend(hash, sim.velocityX);
+    hash = fnv1aAppend(hash, sim.velocityY);
+
+    const unsigned char flags = static_cast<unsigned char>((sim.isOnGround ? 1 : 0) | (sim.levelCompleted ? 2 : 0));
+    hash = fnv1aAppend(hash, &flags, sizeof(flags));
+    hash = fnv1aAppend(hash, &sim.coinCount, sizeof(sim.coinCount));
+
+    for (std::size_t i = 0; i < sim.store.obstacleX.size(); ++i)
+    {
+        hash = fnv1aAppend(hash, sim.store.obstacleX[i]);
+        hash = fnv1aAppend(hash, sim.store.obstacleVelX[i]);
+    }
+
+    sim.coinAlive.forEachSet([&hash](std::size_t i) {
+        const std::uint32_t index = static_cast<std::uint32_t>(i);
+        hash = fnv1aAppend(hash, &index, sizeof(index));
+    });
+
+    return hash;
+}
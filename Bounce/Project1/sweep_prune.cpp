@@ -0,0 +1,95 @@
+#include "sweep_prune.h"
+#include <algorithm>
+
+/**
+ * @brief Builds the index from parallel AABB arrays.
+ *
+ * @param xs Left edges of the boxes.
+ * @param ys Top edges of the boxes.
+ * @param ws Widths of the boxes.
+ * @param hs Heights of the boxes.
+ */
+void SweepPrune::build(const AlignedVector<float>& xs, const AlignedVector<float>& ys, const AlignedVector<float>& ws, const AlignedVector<float>& hs)
+{
+    sortedIndex.resize(xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i)
+        sortedIndex[i] = i;
+    std::sort(sortedIndex.begin(), sortedIndex.end(), [&xs](std::size_t a, std::size_t b) { return xs[a] < xs[b]; });
+
+    sortedLeft.resize(xs.size());
+    sortedRight.resize(xs.size());
+    sortedTop.resize(xs.size());
+    sortedBottom.resize(xs.size());
+    maxWidth = 0.0f;
+    for (std::size_t i = 0; i < sortedIndex.size(); ++i)
+    {
+        const std::size_t original = sortedIndex[i];
+        sortedLeft[i] = xs[original];
+        sortedRight[i] = xs[original] + ws[original];
+        sortedTop[i] = ys[original];
+        sortedBottom[i] = ys[original] + hs[original];
+        maxWidth = std::max(maxWidth, ws[original]);
+    }
+}
+
+/**
+ * @brief Re-sorts the index after some boxes have moved.
+ *
+ * @param xs Left edges of the boxes.
+ * @param ys Top edges of the boxes.
+ * @param ws Widths of the boxes.
+ * @param hs Heights of the boxes.
+ */
+void SweepPrune::refresh(const AlignedVector<float>& xs, const AlignedVector<float>& ys, const AlignedVector<float>& ws, const AlignedVector<float>& hs)
+{
+    maxWidth = 0.0f;
+    for (std::size_t i = 0; i < sortedIndex.size(); ++i)
+    {
+        const std::size_t original = sortedIndex[i];
+        sortedLeft[i] = xs[original];
+        sortedRight[i] = xs[original] + ws[original];
+        sortedTop[i] = ys[original];
+        sortedBottom[i] = ys[original] + hs[original];
+        maxWidth = std::max(maxWidth, ws[original]);
+    }
+
+    // Insertion sort: the arrays are already nearly sorted, so this is a
+    // single pass plus one neighbour swap per position a box crossed.
+    for (std::size_t i = 1; i < sortedLeft.size(); ++i)
+    {
+        for (std::size_t j = i; j > 0 && sortedLeft[j] < sortedLeft[j - 1]; --j)
+        {
+            std::swap(sortedLeft[j], sortedLeft[j - 1]);
+            std::swap(sortedRight[j], sortedRight[j - 1]);
+            std::swap(sortedTop[j], sortedTop[j - 1]);
+            std::swap(sortedBottom[j], sortedBottom[j - 1]);
+            std::swap(sortedIndex[j], sortedIndex[j - 1]);
+        }
+    }
+}
+
+/**
+ * @brief Collects the indices of boxes that may overlap a query box.
+ *
+ * @param x Left edge of the query box.
+ * @param y Top edge of the query box.
+ * @param w Width of the query box.
+ * @param h Height of the query box.
+ * @param outCandidates Receives the candidate indices (cleared first).
+ */
+void SweepPrune::query(float x, float y, float w, float h, std::vector<std::size_t>& outCandidates) const
+{
+    outCandidates.clear();
+
+    // A box starting up to maxWidth before the query can still reach into it,
+    // so the binary search begins that far back.
+    const auto first = std::lower_bound(sortedLeft.begin(), sortedLeft.end(), x - maxWidth);
+
+    for (std::size_t i = static_cast<std::size_t>(first - sortedLeft.begin()); i < sortedLeft.size() && sortedLeft[i] <= x + w; ++i)
+    {
+        if (sortedRight[i] >= x && sortedTop[i] <= y + h && sortedBottom[i] >= y)
+            outCandidates.push_back(sortedIndex[i]);
+    }
+
+    std::sort(outCandidates.begin(), outCandidates.end());
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "cache_aligned.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Sweep-and-prune broadphase over a set of AABBs sorted by left edge.
+ *
+ * The levels are horizontal scrollers, so boxes near a query box cluster
+ * along the x axis. Keeping the boxes sorted by left edge turns a query
+ * into a binary search plus a short walk over the overlap span — no grid,
+ * no hashing, and far less memory traffic than the spatial hash for a
+ * mostly-static level. The simulation can select either broadphase; see
+ * Simulation::setBroadphase.
+ */
+class SweepPrune {
+public:
+    /**
+     * @brief Builds the index from parallel AABB arrays.
+     *
+     * @param xs Left edges of the boxes.
+     * @param ys Top edges of the boxes.
+     * @param ws Widths of the boxes.
+     * @param hs Heights of the boxes.
+     */
+    void build(const AlignedVector<float>& xs, const AlignedVector<float>& ys, const AlignedVector<float>& ws, const AlignedVector<float>& hs);
+
+    /**
+     * @brief Re-sorts the index after some boxes have moved.
+     *
+     * Re-reads the source arrays and restores the left-edge order with an
+     * insertion sort, which is O(n) plus one swap per inversion — cheap
+     * when only a few boxes moved a short distance since the last tick,
+     * as patrol movement does. Box count must match the last build.
+     *
+     * @param xs Left edges of the boxes.
+     * @param ys Top edges of the boxes.
+     * @param ws Widths of the boxes.
+     * @param hs Heights of the boxes.
+     */
+    void refresh(const AlignedVector<float>& xs, const AlignedVector<float>& ys, const AlignedVector<float>& ws, const AlignedVector<float>& hs);
+
+    /**
+     * @brief Collects the indices of boxes that may overlap a query box.
+     *
+     * The result is deduplicated and sorted; callers still run the exact
+     * AABB test on each candidate, matching the SpatialHash::query
+     * contract so the two broadphases are interchangeable.
+     *
+     * @param x Left edge of the query box.
+     * @param y Top edge of the query box.
+     * @param w Width of the query box.
+     * @param h Height of the query box.
+     * @param outCandidates Receives the candidate indices (cleared first).
+     */
+    void query(float x, float y, float w, float h, std::vector<std::size_t>& outCandidates) const;
+
+private:
+    std::vector<float> sortedLeft; ///< Box left edges in ascending order.
+    std::vector<float> sortedRight; ///< Matching right edges.
+    std::vector<float> sortedTop; ///< Matching top edges.
+    std::vector<float> sortedBottom; ///< Matching bottom edges.
+    std::vector<std::size_t> sortedIndex; ///< Matching original box indices.
+    float maxWidth = 0.0f; ///< Widest box; bounds the backward search window.
+};
@@ -0,0 +1,207 @@
+#include "telemetry.h"
+#include "thread_control.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+TelemetryExporter::~TelemetryExporter()
+{
+    running.store(false, std::memory_order_release);
+    wakeCv.notify_all();
+    if (flusher.joinable())
+        flusher.join();
+    if (file)
+        std::fclose(file);
+}
+
+/**
+ * @brief Opens (or creates) the ring file and starts the flusher.
+ *
+ * @param path Path of the telemetry ring file.
+ * @param slots Records the ring holds when creating.
+ * @return true If the file is writable.
+ */
+bool TelemetryExporter::openFile(const std::string& path, std::uint32_t slots)
+{
+    filePath = path;
+
+    // Reopen an existing ring so the cursor (and the history) survives
+    // a cabinet restart; anything with a stale layout is recreated
+    file = std::fopen(path.c_str(), "r+b");
+    if (file)
+    {
+        const bool valid = std::fread(&header, sizeof(header), 1, file) == 1
+            && std::memcmp(header.magic, "BTLM", 4) == 0
+            && header.version == telemetry::telemetryVersion
+            && header.slotCount > 0;
+        if (!valid)
+        {
+            std::fclose(file);
+            file = nullptr;
+        }
+    }
+    if (!file)
+    {
+        file = std::fopen(path.c_str(), "wb+");
+        if (!file)
+            return false;
+        std::memcpy(header.magic, "BTLM", 4);
+        header.version = telemetry::telemetryVersion;
+        header.slotCount = slots;
+        header.nextSlot = 0;
+        header.written = 0;
+        std::fwrite(&header, sizeof(header), 1, file);
+    }
+
+    running.store(true, std::memory_order_release);
+    flusher = std::thread(&TelemetryExporter::run, this);
+    return true;
+}
+
+/**
+ * @brief Also ship each record as a UDP datagram.
+ *
+ * @param address The monitoring host.
+ * @param port The monitoring port.
+ */
+void TelemetryExporter::setEndpoint(const sf::IpAddress& address, unsigned short port)
+{
+    endpointAddress = address;
+    endpointPort.store(port, std::memory_order_release);
+}
+
+/**
+ * @brief Queues one sample; render thread, plain stores only.
+ *
+ * @param profiler The frame profiler to window-copy.
+ * @param stats The newest render snapshot, for the gameplay counters.
+ */
+void TelemetryExporter::push(const FrameProfiler& profiler, const RenderSnapshot& stats, const SessionStats& session,
+                             std::uint32_t degradeTier, std::uint32_t degradeShifts)
+{
+    const std::uint32_t writeAt = head.load(std::memory_order_relaxed);
+    if (writeAt - tail.load(std::memory_order_acquire) >= pendingSlots)
+        return;  // Flusher stalled; dropping telemetry beats queueing it
+
+    Pending& slot = pending[writeAt % pendingSlots];
+    profiler.snapshot(slot.window);
+    slot.uptimeMs = static_cast<std::uint64_t>(uptime.getElapsedTime().asMilliseconds());
+    slot.tickIndex = stats.tickIndex;
+    slot.coinCount = static_cast<std::uint32_t>(stats.coinCount);
+    slot.bounceCount = stats.bounceCount;
+    slot.deathCount = stats.deathCount;
+    slot.resetCount = stats.resetCount;
+    slot.coinsPerMinute = session.coinsPerMinute();
+    slot.goalSeconds = session.goalSeconds();
+    slot.degradeTier = degradeTier;
+    slot.degradeShifts = degradeShifts;
+    head.store(writeAt + 1, std::memory_order_release);
+    wakeCv.notify_one();
+}
+
+/**
+ * @brief Turns a pending sample into its on-disk record.
+ *
+ * @param pending The queued sample; its window is sorted in place.
+ * @return telemetry::Record The built record.
+ */
+telemetry::Record TelemetryExporter::buildRecord(Pending& sample)
+{
+    telemetry::Record record = {};
+    record.uptimeMs = sample.uptimeMs;
+    record.tickIndex = sample.tickIndex;
+    record.coinCount = sample.coinCount;
+    record.bounceCount = sample.bounceCount;
+    record.deathCount = sample.deathCount;
+    record.resetCount = sample.resetCount;
+    record.coinsPerMinute = sample.coinsPerMinute;
+    record.goalSeconds = sample.goalSeconds;
+    record.degradeTier = sample.degradeTier;
+    record.degradeShifts = sample.degradeShifts;
+
+    const std::size_t frames = sample.window.frameCount;
+    if (frames == 0)
+        return record;
+
+    // Whole-frame times are the per-phase sums; sorting happens here on
+    // the flush thread, never where the sample was taken
+    sf::Int64 frameUs[ProfilerSnapshot::maxFrames];
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        frameUs[i] = 0;
+        for (int phase = 0; phase < 4; ++phase)
+            frameUs[i] += sample.window.samples[phase][i];
+    }
+    std::sort(frameUs, frameUs + frames);
+    record.frameP50Ms = static_cast<float>(frameUs[frames / 2]) / 1000.0f;
+    record.frameP95Ms = static_cast<float>(frameUs[frames * 95 / 100]) / 1000.0f;
+    record.frameP99Ms = static_cast<float>(frameUs[frames * 99 / 100]) / 1000.0f;
+    record.frameWorstMs = static_cast<float>(frameUs[frames - 1]) / 1000.0f;
+
+    for (int phase = 0; phase < 4; ++phase)
+    {
+        sf::Int64* samples = sample.window.samples[phase];
+        std::sort(samples, samples + frames);
+        record.phaseP95Ms[phase] = static_cast<float>(samples[frames * 95 / 100]) / 1000.0f;
+    }
+    return record;
+}
+
+/**
+ * @brief Writes one record into the ring file and bumps the header.
+ *
+ * @param record The record to store.
+ */
+void TelemetryExporter::writeSlot(const telemetry::Record& record)
+{
+    const long offset = static_cast<long>(sizeof(telemetry::Header))
+        + static_cast<long>(header.nextSlot) * static_cast<long>(sizeof(record));
+    std::fseek(file, offset, SEEK_SET);
+    std::fwrite(&record, sizeof(record), 1, file);
+
+    header.nextSlot = (header.nextSlot + 1) % header.slotCount;
+    header.written++;
+    std::fseek(file, 0, SEEK_SET);
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fflush(file);
+}
+
+/**
+ * @brief Flush thread body: build records, write the ring, ship.
+ */
+void TelemetryExporter::run()
+{
+    threadControl::registerCurrentThread("telemetry");
+    threadControl::lowerCurrentThreadPriority();  // Writer runs on frame leftovers
+    while (running.load(std::memory_order_acquire))
+    {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCv.wait_for(lock, std::chrono::seconds(1), [this] {
+                return tail.load(std::memory_order_relaxed) != head.load(std::memory_order_acquire)
+                    || !running.load(std::memory_order_acquire);
+            });
+        }
+
+        std::uint32_t readAt = tail.load(std::memory_order_relaxed);
+        const std::uint32_t readEnd = head.load(std::memory_order_acquire);
+        while (readAt != readEnd)
+        {
+            const telemetry::Record record = buildRecord(pending[readAt % pendingSlots]);
+            writeSlot(record);
+
+            const unsigned short port = endpointPort.load(std::memory_order_acquire);
+            if (port != 0)
+            {
+                // One datagram per record: magic + version + the record
+                std::uint8_t wire[8 + sizeof(record)];
+                std::memcpy(wire, "BTLM", 4);
+                std::memcpy(wire + 4, &telemetry::telemetryVersion, 4);
+                std::memcpy(wire + 8, &record, sizeof(record));
+                socket.send(wire, sizeof(wire), endpointAddress, port);
+            }
+            ++readAt;
+            tail.store(readAt, std::memory_order_release);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "telemetry_format.h"
+#include "frame_profiler.h"
+#include "render_snapshot.h"
+#include "session_stats.h"
+#include <SFML/Network.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Periodic cabinet-health export for fleet monitoring.
+ *
+ * Every few hundred frames the render thread hands over a profiler
+ * window copy plus the gameplay counters off the newest snapshot —
+ * plain stores into a preallocated slot, no sorting, no I/O — and a
+ * background flush thread turns each sample into a telemetry::Record:
+ * it computes the frame-time percentiles there, overwrites the oldest
+ * slot of the local ring file, and optionally ships the same record as
+ * one UDP datagram to the monitoring host. The game loop's cost is
+ * bounded by the window memcpy; a full sample ring (flush thread
+ * stalled on disk) just drops samples.
+ *
+ * The ring file never grows: a cabinet that runs for a month holds
+ * exactly the configured number of recent records. The TelemetryDump
+ * tool prints a file offline.
+ */
+class TelemetryExporter {
+public:
+    ~TelemetryExporter();
+
+    /**
+     * @brief Opens (or creates) the ring file and starts the flusher.
+     *
+     * An existing file keeps its cursor so history survives restarts;
+     * a file with a stale layout is recreated.
+     *
+     * @param path Path of the telemetry ring file.
+     * @param slots Records the ring holds when creating.
+     * @return true If the file is writable.
+     */
+    bool openFile(const std::string& path, std::uint32_t slots = 2048);
+
+    /**
+     * @brief Also ship each record as a UDP datagram.
+     *
+     * Call before openFile(); the flusher reads the endpoint unlocked.
+     *
+     * @param address The monitoring host.
+     * @param port The monitoring port.
+     */
+    void setEndpoint(const sf::IpAddress& address, unsigned short port);
+
+    /**
+     * @brief Queues one sample; render thread, plain stores only.
+     *
+     * @param profiler The frame profiler to window-copy.
+     * @param stats The newest render snapshot, for the gameplay counters.
+     * @param session The session accumulators to fold into the record.
+     * @param degradeTier The frame governor's active shedding tier.
+     * @param degradeShifts The governor's lifetime tier transitions.
+     */
+    void push(const FrameProfiler& profiler, const RenderSnapshot& stats, const SessionStats& session,
+              std::uint32_t degradeTier, std::uint32_t degradeShifts);
+
+private:
+    /**
+     * @brief One queued sample awaiting the flush thread.
+     */
+    struct Pending {
+        ProfilerSnapshot window; ///< The profiler's sample window.
+        std::uint64_t uptimeMs = 0; ///< Exporter uptime at push time.
+        std::uint64_t tickIndex = 0; ///< Simulation tick at push time.
+        std::uint32_t coinCount = 0; ///< Off the render snapshot.
+        std::uint32_t bounceCount = 0; ///< Off the render snapshot.
+        std::uint32_t deathCount = 0; ///< Off the render snapshot.
+        std::uint32_t resetCount = 0; ///< Off the render snapshot.
+        float coinsPerMinute = 0.0f; ///< Off the session accumulators.
+        float goalSeconds = 0.0f; ///< Off the session accumulators.
+        std::uint32_t degradeTier = 0; ///< Governor tier at push time.
+        std::uint32_t degradeShifts = 0; ///< Governor transitions at push time.
+    };
+
+    /**
+     * @brief Flush thread body: build records, write the ring, ship.
+     */
+    void run();
+
+    /**
+     * @brief Turns a pending sample into its on-disk record.
+     *
+     * Sorts the window copy for percentiles; flush thread only.
+     */
+    telemetry::Record buildRecord(Pending& pending);
+
+    /**
+     * @brief Writes one record into the ring file and bumps the header.
+     */
+    void writeSlot(const telemetry::Record& record);
+
+    static constexpr std::size_t pendingSlots = 4; ///< Samples queued at once.
+
+    Pending pending[pendingSlots]; ///< The preallocated sample ring.
+    std::atomic<std::uint32_t> head{ 0 }; ///< Next slot to write; producer-owned.
+    std::atomic<std::uint32_t> tail{ 0 }; ///< Next slot to read; flusher-owned.
+
+    std::string filePath; ///< The ring file.
+    std::FILE* file = nullptr; ///< The open ring file; flusher-owned after open.
+    telemetry::Header header = {}; ///< The file's cursor state; flusher-owned after open.
+    sf::UdpSocket socket; ///< The shipper; unbound until an endpoint is set.
+    sf::IpAddress endpointAddress = sf::IpAddress::None; ///< Monitoring host, or None.
+    std::atomic<unsigned short> endpointPort{ 0 }; ///< Monitoring port; 0 disables shipping.
+    sf::Clock uptime; ///< Started at construction; stamps samples.
+
+    std::thread flusher; ///< The background writer.
+    std::mutex wakeMutex; ///< Pairs with wakeCv.
+    std::condition_variable wakeCv; ///< Wakes the flusher on push and shutdown.
+    std::atomic<bool> running{ false }; ///< Cleared by the destructor.
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief On-disk and on-wire layout of the telemetry records.
+ *
+ * A telemetry file is a fixed header followed by a ring of fixed-size
+ * records: the writer overwrites the oldest slot and bumps the header
+ * cursor, so a cabinet that runs for a month still holds exactly
+ * slotCount records of recent history in a file whose size never
+ * grows. The same Record, prefixed with the magic and version, is what
+ * the UDP shipper sends. SFML-free so the offline decoder tool builds
+ * without the engine.
+ */
+namespace telemetry {
+
+constexpr std::uint32_t telemetryVersion = 3; ///< Bumped on any layout change.
+
+/**
+ * @brief Fixed header at the start of every telemetry file.
+ */
+struct Header {
+    char magic[4]; ///< "BTLM".
+    std::uint32_t version; ///< Must equal telemetryVersion.
+    std::uint32_t slotCount; ///< Records the ring holds.
+    std::uint32_t nextSlot; ///< Slot the next record overwrites.
+    std::uint64_t written; ///< Records written over the file's lifetime.
+};
+
+/**
+ * @brief One periodic sample of a cabinet's health.
+ */
+struct Record {
+    std::uint64_t uptimeMs; ///< Milliseconds since the exporter started.
+    std::uint64_t tickIndex; ///< The simulation tick at sample time.
+    std::uint32_t coinCount; ///< Coins collected this run.
+    std::uint32_t bounceCount; ///< Bounces this run.
+    std::uint32_t deathCount; ///< Deaths since launch.
+    std::uint32_t resetCount; ///< Full resets since launch.
+    float frameP50Ms; ///< Median whole-frame time over the sample window.
+    float frameP95Ms; ///< 95th percentile whole-frame time.
+    float frameP99Ms; ///< 99th percentile whole-frame time.
+    float frameWorstMs; ///< Worst whole-frame time in the window.
+    float phaseP95Ms[4]; ///< Per-phase 95th percentiles, profiler phase order.
+    float coinsPerMinute; ///< Session coin rate, from the stats accumulators.
+    float goalSeconds; ///< Time to goal of the last victory; zero before one.
+    std::uint32_t degradeTier; ///< Frame governor tier at sample time (0 = full quality).
+    std::uint32_t degradeShifts; ///< Governor tier transitions since launch.
+};
+
+} // namespace telemetry
@@ -0,0 +1,159 @@
+#include "thread_control.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <time.h>
+    #if defined(__linux__)
+        #include <sys/resource.h>
+        #include <sys/syscall.h>
+        #include <unistd.h>
+    #endif
+#endif
+
+namespace threadControl {
+
+namespace {
+
+    /// One registered thread in the CPU usage gauge.
+    struct ThreadSlot {
+        char name[16] = {}; ///< Short name shown on the gauge.
+#if defined(_WIN32)
+        HANDLE handle = nullptr; ///< Duplicated real handle; GetCurrentThread() is a pseudo-handle.
+#else
+        clockid_t cpuClock = 0; ///< The thread's CPU-time clock.
+#endif
+        double lastCpuSeconds = 0.0; ///< CPU time at the previous sample.
+        float usagePercent = 0.0f; ///< Last computed usage, percent of one core.
+    };
+
+    constexpr std::size_t maxThreads = 16; ///< More than the engine ever starts.
+    ThreadSlot g_slots[maxThreads];
+    std::size_t g_slotCount = 0;
+    std::mutex g_registryMutex;
+    std::chrono::steady_clock::time_point g_lastSample; ///< Wall clock at the previous sample.
+    bool g_sampled = false; ///< Whether a first sample baseline exists.
+
+    /**
+     * @brief Reads one registered thread's total CPU time.
+     *
+     * @param slot The thread's registry slot.
+     * @return double CPU seconds consumed so far; 0 on failure.
+     */
+    double readCpuSeconds(const ThreadSlot& slot)
+    {
+#if defined(_WIN32)
+        FILETIME creation, exit, kernel, user;
+        if (!GetThreadTimes(slot.handle, &creation, &exit, &kernel, &user))
+            return 0.0;
+        const ULONGLONG kernel100ns = (static_cast<ULONGLONG>(kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime;
+        const ULONGLONG user100ns = (static_cast<ULONGLONG>(user.dwHighDateTime) << 32) | user.dwLowDateTime;
+        return static_cast<double>(kernel100ns + user100ns) * 1e-7;
+#else
+        timespec cpu;
+        if (clock_gettime(slot.cpuClock, &cpu) != 0)
+            return 0.0;
+        return static_cast<double>(cpu.tv_sec) + static_cast<double>(cpu.tv_nsec) * 1e-9;
+#endif
+    }
+
+} // namespace
+
+void setCurrentThreadName(const char* name)
+{
+#if defined(_WIN32)
+    wchar_t wide[32];
+    std::size_t i = 0;
+    for (; i + 1 < sizeof(wide) / sizeof(wide[0]) && name[i]; ++i)
+        wide[i] = static_cast<wchar_t>(name[i]);
+    wide[i] = L'\0';
+    SetThreadDescription(GetCurrentThread(), wide);
+#else
+    char truncated[16];  // pthread names cap at 15 chars plus the terminator
+    std::snprintf(truncated, sizeof(truncated), "%s", name);
+    pthread_setname_np(pthread_self(), truncated);
+#endif
+}
+
+bool pinCurrentThread(unsigned core)
+{
+#if defined(_WIN32)
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)core;
+    return false;
+#endif
+}
+
+void lowerCurrentThreadPriority()
+{
+#if defined(_WIN32)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#elif defined(__linux__)
+    // On Linux the nice value is per task, so this lowers just this thread
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+}
+
+void registerCurrentThread(const char* name)
+{
+    setCurrentThreadName(name);
+
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    if (g_slotCount >= maxThreads)
+        return;
+
+    ThreadSlot& slot = g_slots[g_slotCount];
+    std::snprintf(slot.name, sizeof(slot.name), "%s", name);
+#if defined(_WIN32)
+    DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(),
+                    &slot.handle, 0, FALSE, DUPLICATE_SAME_ACCESS);
+    if (!slot.handle)
+        return;
+#else
+    if (pthread_getcpuclockid(pthread_self(), &slot.cpuClock) != 0)
+        return;
+#endif
+    slot.lastCpuSeconds = readCpuSeconds(slot);
+    ++g_slotCount;
+}
+
+std::size_t formatCpuUsage(char* out, std::size_t cap)
+{
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (g_sampled)
+    {
+        const double wallSeconds = std::chrono::duration<double>(now - g_lastSample).count();
+        if (wallSeconds > 0.0)
+        {
+            for (std::size_t i = 0; i < g_slotCount; ++i)
+            {
+                const double cpuSeconds = readCpuSeconds(g_slots[i]);
+                g_slots[i].usagePercent = static_cast<float>((cpuSeconds - g_slots[i].lastCpuSeconds) / wallSeconds * 100.0);
+                g_slots[i].lastCpuSeconds = cpuSeconds;
+            }
+        }
+    }
+    g_lastSample = now;
+    g_sampled = true;
+
+    std::size_t used = static_cast<std::size_t>(std::snprintf(out, cap, "threads:"));
+    for (std::size_t i = 0; i < g_slotCount && used < cap; ++i)
+        used += std::snprintf(out + used, cap - used, " %s %.0f%%", g_slots[i].name, g_slots[i].usagePercent);
+    return used;
+}
+
+} // namespace threadControl
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * @brief Naming, pinning and priority control for the engine threads.
+ *
+ * The engine runs a fixed cast of threads — the simulation loop, the
+ * render loop, the job workers, and a handful of background writers
+ * (telemetry, asset watcher, savegame). Left alone, the OS scheduler
+ * migrates the two frame-critical threads across cores and lets a PNG
+ * decode preempt a tick; on the 4-core kiosks that jitter is a
+ * measurable slice of p99 frame time. Each thread calls into this
+ * module once at startup to name itself (for debuggers and the HUD),
+ * optionally pin to a core, and optionally drop to below-normal
+ * priority. Registered threads also expose their CPU time so the
+ * profiler HUD can print a per-thread usage gauge.
+ *
+ * Everything here is best-effort: a failed pin or rename is ignored —
+ * the game must behave identically on boxes where the calls are
+ * refused, so nothing downstream may depend on them succeeding.
+ */
+namespace threadControl {
+
+    /**
+     * @brief Names the calling thread for debuggers and the HUD gauge.
+     *
+     * @param name Short thread name; truncated to the platform limit.
+     */
+    void setCurrentThreadName(const char* name);
+
+    /**
+     * @brief Pins the calling thread to one core.
+     *
+     * Callers should only pin when enough cores exist for every pinned
+     * thread to own one — pinning two threads to the same core of a
+     * dual-core box is worse than letting the scheduler place them.
+     *
+     * @param core Zero-based core index.
+     * @return true If the affinity call was accepted.
+     * @return false If the platform refused it; the thread floats.
+     */
+    bool pinCurrentThread(unsigned core);
+
+    /**
+     * @brief Drops the calling thread to below-normal priority.
+     *
+     * For the background writers and watchers: they get the cycles the
+     * frame-critical threads leave over, never the other way round.
+     */
+    void lowerCurrentThreadPriority();
+
+    /**
+     * @brief Adds the calling thread to the CPU usage gauge.
+     *
+     * Also names the thread (every registered thread is a named one).
+     * The registry is fixed-capacity; past it, registration is a no-op.
+     *
+     * @param name Short thread name shown on the HUD gauge.
+     */
+    void registerCurrentThread(const char* name);
+
+    /**
+     * @brief Formats per-thread CPU usage since the previous call.
+     *
+     * Usage is each registered thread's CPU time delta over the wall
+     * time delta, in percent of one core; sampled on the profiler's
+     * report cadence the deltas are long enough to be stable.
+     *
+     * @param out Destination buffer.
+     * @param cap Buffer capacity in bytes.
+     * @return std::size_t Characters written (snprintf convention).
+     */
+    std::size_t formatCpuUsage(char* out, std::size_t cap);
+
+} // namespace threadControl
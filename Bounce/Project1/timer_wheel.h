@@ -0,0 +1,125 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Timer wheel for deferred game events, keyed on the fixed tick.
+ *
+ * Timed behavior (victory auto-reset, respawn delays, pause phases)
+ * has nowhere cheap to live as per-frame condition polling. The wheel
+ * gives scheduling its own home: a power-of-two ring of slots, each an
+ * intrusive list threaded through a preallocated node pool. Scheduling
+ * links one node into the slot of its fire tick — O(1), no allocation —
+ * and advancing a tick walks exactly one slot, so pending timers cost
+ * nothing until the tick they live in comes around. Events that out-
+ * range one wheel revolution simply stay in their slot for the next
+ * lap.
+ *
+ * Events are plain ids; the caller's advance() functor interprets
+ * them. Handlers must re-validate their conditions when fired — the
+ * simulation's tick counter rewinds on reset, rewind and savegame
+ * restore, so a pending event can fire on a later run than the one
+ * that scheduled it.
+ */
+class TimerWheel {
+public:
+    /**
+     * @brief Allocates the node pool; the only allocation the wheel makes.
+     *
+     * @param capacity Maximum simultaneously pending events.
+     */
+    void init(std::size_t capacity)
+    {
+        nodes.resize(capacity);
+        slots.assign(slotCount, invalidNode);
+        freeHead = 0;
+        for (std::size_t i = 0; i < capacity; ++i)
+            nodes[i].next = i + 1 < capacity ? static_cast<std::uint32_t>(i + 1) : invalidNode;
+        pendingCount = 0;
+    }
+
+    /**
+     * @brief Schedules an event; O(1), never allocates.
+     *
+     * @param fireTick Absolute tick to fire at (schedule from the tick
+     * loop as tickIndex + delay).
+     * @param event Caller-defined event id handed back by advance().
+     * @return true If the event was scheduled.
+     * @return false If the node pool is exhausted.
+     */
+    bool schedule(std::uint64_t fireTick, std::uint32_t event)
+    {
+        if (freeHead == invalidNode)
+            return false;  // Pool is the budget; the caller sized it
+        const std::uint32_t node = freeHead;
+        freeHead = nodes[node].next;
+
+        const std::size_t slot = static_cast<std::size_t>(fireTick) & (slotCount - 1);
+        nodes[node].fireTick = fireTick;
+        nodes[node].event = event;
+        nodes[node].next = slots[slot];
+        slots[slot] = node;
+        ++pendingCount;
+        return true;
+    }
+
+    /**
+     * @brief Fires every event due at a tick; call once per fixed tick.
+     *
+     * Walks only the tick's slot. Entries further laps out stay linked
+     * untouched.
+     *
+     * @param tick The tick that just ran.
+     * @param fire Functor invoked as fire(event) for each due event.
+     */
+    template <typename Fn>
+    void advance(std::uint64_t tick, Fn&& fire)
+    {
+        const std::size_t slot = static_cast<std::size_t>(tick) & (slotCount - 1);
+        std::uint32_t* link = &slots[slot];
+        while (*link != invalidNode)
+        {
+            const std::uint32_t node = *link;
+            if (nodes[node].fireTick <= tick)
+            {
+                *link = nodes[node].next;  // Unlink, fire, recycle
+                const std::uint32_t event = nodes[node].event;
+                nodes[node].next = freeHead;
+                freeHead = node;
+                --pendingCount;
+                fire(event);
+            }
+            else
+            {
+                link = &nodes[node].next;  // A later lap; leave it
+            }
+        }
+    }
+
+    /**
+     * @brief Number of scheduled events not yet fired.
+     *
+     * @return std::size_t The pending count.
+     */
+    std::size_t pending() const { return pendingCount; }
+
+private:
+    /**
+     * @brief One pooled timer node.
+     */
+    struct Node {
+        std::uint64_t fireTick = 0; ///< Absolute tick this node fires at.
+        std::uint32_t event = 0; ///< Caller-defined event id.
+        std::uint32_t next = 0; ///< Next node in the slot list or free list.
+    };
+
+    static constexpr std::size_t slotCount = 256; ///< Wheel size; power of two, so the slot index is a mask.
+    static constexpr std::uint32_t invalidNode = static_cast<std::uint32_t>(-1); ///< List terminator.
+
+    std::vector<Node> nodes; ///< The preallocated node pool.
+    std::vector<std::uint32_t> slots; ///< Head node per slot, or invalidNode.
+    std::uint32_t freeHead = invalidNode; ///< Head of the free list.
+    std::size_t pendingCount = 0; ///< Scheduled, not yet fired.
+};
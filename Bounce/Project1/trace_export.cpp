@@ -0,0 +1,56 @@
+#include "trace_export.h"
+#include <cstdio>
+
+/**
+ * @brief Joins any in-flight writer thread.
+ */
+TraceExporter::~TraceExporter()
+{
+    if (worker.joinable())
+        worker.join();
+}
+
+/**
+ * @brief Captures the profiler's window and writes it in the background.
+ *
+ * @param profiler The frame profiler to snapshot.
+ * @param path Path of the JSON file to write.
+ */
+void TraceExporter::capture(const FrameProfiler& profiler, const std::string& path)
+{
+    if (writing.load(std::memory_order_acquire))
+        return;  // Previous capture still writing; drop this one
+
+    if (worker.joinable())
+        worker.join();
+
+    profiler.snapshot(snap);
+    writing.store(true, std::memory_order_release);
+
+    worker = std::thread([this, path]() {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (file)
+        {
+            // Complete events ("ph":"X") with microsecond timestamps, one per phase per frame
+            std::fputs("{\"traceEvents\":[", file);
+            bool first = true;
+            for (std::size_t f = 0; f < snap.frameCount; ++f)
+            {
+                sf::Int64 ts = snap.frameStart[f];
+                for (int phase = 0; phase < FrameProfiler::PhaseCount; ++phase)
+                {
+                    std::fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":0,\"tid\":0}",
+                                 first ? "" : ",",
+                                 FrameProfiler::phaseName(static_cast<FrameProfiler::Phase>(phase)),
+                                 static_cast<long long>(ts),
+                                 static_cast<long long>(snap.samples[phase][f]));
+                    ts += snap.samples[phase][f];
+                    first = false;
+                }
+            }
+            std::fputs("]}", file);
+            std::fclose(file);
+        }
+        writing.store(false, std::memory_order_release);
+    });
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "frame_profiler.h"
+#include <string>
+#include <thread>
+#include <atomic>
+
+/**
+ * @brief Writes profiler captures as chrome://tracing / Perfetto JSON.
+ *
+ * A capture snapshots the profiler's sample window on the game thread
+ * (a few kilobytes of plain stores) and hands it to a background thread
+ * that reconstructs per-phase begin/end events and writes the JSON, so
+ * triggering a capture never hitches the loop. The resulting file opens
+ * directly in chrome://tracing or ui.perfetto.dev, which is how we
+ * inspect stall reports from machines we cannot attach a profiler to.
+ */
+class TraceExporter {
+public:
+    /**
+     * @brief Joins any in-flight writer thread.
+     */
+    ~TraceExporter();
+
+    /**
+     * @brief Captures the profiler's window and writes it in the background.
+     *
+     * Ignored if a previous capture is still being written.
+     *
+     * @param profiler The frame profiler to snapshot.
+     * @param path Path of the JSON file to write.
+     */
+    void capture(const FrameProfiler& profiler, const std::string& path);
+
+    /**
+     * @brief Whether a capture is currently being written.
+     *
+     * @return true If the background writer is still running.
+     * @return false If the exporter is idle.
+     */
+    bool busy() const { return writing.load(std::memory_order_acquire); }
+
+private:
+    ProfilerSnapshot snap; ///< The captured window; owned by the writer while busy.
+    std::thread worker; ///< Background writer thread.
+    std::atomic<bool> writing{ false }; ///< Set while the writer owns the snapshot.
+};
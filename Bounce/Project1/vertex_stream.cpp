@@ -0,0 +1,77 @@
+#include "vertex_stream.h"
+
+/**
+ * @brief Starts a frame: regrows the ring if the last frame overflowed
+ * it and resets the per-frame accounting.
+ */
+void DynamicVertexStream::beginFrame()
+{
+    uploadAvg = uploadAvg * 0.95f + frameUploadMs * 0.05f;
+    frameUploadMs = 0.0f;
+
+    if (frameVertices > peakFrameVertices)
+        peakFrameVertices = frameVertices;
+    frameVertices = 0;
+
+    // Regrow only at a frame boundary: the old buffer's in-flight draws
+    // finish against the old object (GL defers its deletion), and every
+    // upload inside one frame stays in one allocation
+    const std::size_t wanted = peakFrameVertices * framesInFlight;
+    if (useBuffer && wanted > capacity)
+    {
+        if (buffer.create(wanted))
+        {
+            capacity = wanted;
+            cursor = 0;
+            ++regrows;
+        }
+    }
+}
+
+/**
+ * @brief Uploads an array into the ring and draws the sub-range.
+ *
+ * @param target The render target.
+ * @param vertices The frame-built vertices to stream.
+ * @param states Render states for the draw (texture, blend).
+ */
+void DynamicVertexStream::draw(sf::RenderTarget& target, const sf::VertexArray& vertices,
+                               const sf::RenderStates& states)
+{
+    const std::size_t count = vertices.getVertexCount();
+    if (count == 0)
+        return;
+
+    if (!checked)
+    {
+        checked = true;
+        useBuffer = sf::VertexBuffer::isAvailable();
+        if (useBuffer)
+        {
+            buffer.setPrimitiveType(sf::Triangles);
+            buffer.setUsage(sf::VertexBuffer::Stream);
+        }
+    }
+
+    frameVertices += count;
+    if (!useBuffer || count * framesInFlight > capacity)
+    {
+        // No support, or a burst the ring cannot hold yet: draw the
+        // client array directly and let beginFrame size the ring up
+        target.draw(vertices, states);
+        return;
+    }
+
+    if (cursor + count > capacity)
+        cursor = 0;  // Wrap; framesInFlight sizing keeps the landing zone retired
+
+    const float before = uploadClock.getElapsedTime().asSeconds();
+    buffer.update(&vertices[0], count, static_cast<unsigned int>(cursor));
+    const float uploadMs = (uploadClock.getElapsedTime().asSeconds() - before) * 1000.0f;
+    frameUploadMs += uploadMs;
+    if (uploadMs > stallThresholdMs)
+        ++stalls;
+
+    target.draw(buffer, cursor, count, states);
+    cursor += count;
+}
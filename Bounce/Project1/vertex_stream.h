@@ -0,0 +1,75 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Multi-buffered GPU ring for the per-frame dynamic vertices.
+ *
+ * The dynamic batch (player, obstacles, coins, balls) rewrites its
+ * vertices every frame. Uploading them over ONE buffer region each
+ * frame makes the driver synchronize: the GPU is still reading last
+ * frame's vertices when the CPU rewrites them, and the update call
+ * blocks until it isn't. The stream instead allocates one Stream-usage
+ * sf::VertexBuffer sized for several frames and walks it as a ring:
+ * every upload lands at the cursor and is drawn as a sub-range, so a
+ * region is only rewritten after the frames reading it have long
+ * retired — orphan-free round-robin without touching raw GL.
+ *
+ * The ring sizes itself to framesInFlight times the biggest frame seen
+ * and regrows at a frame boundary when gameplay outgrows it. Uploads
+ * are wall-clock timed: a driver forced to sync anyway (exotic driver,
+ * undersized ring) shows as upload time past the stall threshold, and
+ * the stall/regrow counters sit on the profiler HUD next to the GPU
+ * phase times. Targets without vertex buffer support keep the plain
+ * client-array draw.
+ */
+class DynamicVertexStream {
+public:
+    /**
+     * @brief Starts a frame: regrows the ring if the last frame
+     * overflowed it and resets the per-frame accounting.
+     */
+    void beginFrame();
+
+    /**
+     * @brief Uploads an array into the ring and draws the sub-range.
+     *
+     * Creates the buffer on first use (render thread only — needs the
+     * live GL context). Draws the array directly when vertex buffers
+     * are unavailable. The array must use the triangles primitive.
+     *
+     * @param target The render target.
+     * @param vertices The frame-built vertices to stream.
+     * @param states Render states for the draw (texture, blend).
+     */
+    void draw(sf::RenderTarget& target, const sf::VertexArray& vertices,
+              const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /// Uploads whose wall time crossed the stall threshold, total.
+    std::uint32_t stallCount() const { return stalls; }
+
+    /// Ring reallocations since startup; steady state is zero.
+    std::uint32_t regrowCount() const { return regrows; }
+
+    /// Smoothed milliseconds spent in buffer updates per frame.
+    float uploadMsAvg() const { return uploadAvg; }
+
+private:
+    static constexpr std::size_t framesInFlight = 3; ///< Frames a region must survive before reuse.
+    static constexpr float stallThresholdMs = 0.5f; ///< Upload wall time that counts as a driver sync.
+
+    sf::VertexBuffer buffer; ///< The ring; Stream usage, triangles.
+    std::size_t capacity = 0; ///< Ring size in vertices.
+    std::size_t cursor = 0; ///< Next vertex slot to write.
+    std::size_t frameVertices = 0; ///< Vertices streamed this frame.
+    std::size_t peakFrameVertices = 0; ///< Biggest frame seen; sizes the ring.
+    bool checked = false; ///< Whether vertex buffer support was probed.
+    bool useBuffer = false; ///< Streaming through the ring vs client arrays.
+
+    sf::Clock uploadClock; ///< Times each update call.
+    float frameUploadMs = 0.0f; ///< Upload time accumulated this frame.
+    float uploadAvg = 0.0f; ///< Smoothed per-frame upload milliseconds.
+    std::uint32_t stalls = 0; ///< Uploads past the stall threshold.
+    std::uint32_t regrows = 0; ///< Ring reallocations.
+};
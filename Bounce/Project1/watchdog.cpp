@@ -0,0 +1,122 @@
+#include "watchdog.h"
+#include "trace_export.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief Stops the polling thread.
+ */
+Watchdog::~Watchdog()
+{
+    running.store(false, std::memory_order_release);
+    if (worker.joinable())
+        worker.join();
+}
+
+/**
+ * @brief Starts the polling thread.
+ *
+ * @param profiler Profiler whose window goes into a stall report.
+ * @param timeoutSeconds Quiet time on any channel that counts as a stall.
+ * @param exitOnStall Whether to exit (code 3) after the report.
+ */
+void Watchdog::start(const FrameProfiler* profilerSource, float timeoutSeconds, bool exitOnStall)
+{
+    if (running.load(std::memory_order_relaxed))
+        return;
+    profiler = profilerSource;
+    timeout = timeoutSeconds > 0.5f ? timeoutSeconds : 0.5f;
+    exitAfterReport = exitOnStall;
+    running.store(true, std::memory_order_release);
+    worker = std::thread(&Watchdog::run, this);
+}
+
+/**
+ * @brief The polling loop; runs until the destructor.
+ */
+void Watchdog::run()
+{
+    const auto pollInterval = std::chrono::milliseconds(static_cast<int>(timeout * 250.0f));
+    std::uint64_t lastSeen[ChannelCount] = {};
+    std::chrono::steady_clock::time_point lastChange[ChannelCount];
+    bool reported[ChannelCount] = {};
+    for (int c = 0; c < ChannelCount; ++c)
+        lastChange[c] = std::chrono::steady_clock::now();
+
+    while (running.load(std::memory_order_acquire))
+    {
+        std::this_thread::sleep_for(pollInterval);
+        const auto now = std::chrono::steady_clock::now();
+
+        for (int c = 0; c < ChannelCount; ++c)
+        {
+            const std::uint64_t beat = heartbeats[c].load(std::memory_order_relaxed);
+            if (beat != lastSeen[c])
+            {
+                lastSeen[c] = beat;
+                lastChange[c] = now;
+                reported[c] = false;
+                continue;
+            }
+            if (beat == 0 || reported[c])
+                continue;  // Never started, or this stall is already on disk
+            const float quiet = std::chrono::duration<float>(now - lastChange[c]).count();
+            if (quiet < timeout)
+                continue;
+            reported[c] = true;  // One report per stall; re-arms if the loop revives
+            report(c, quiet);
+            if (exitAfterReport)
+            {
+                // The frozen threads cannot be joined; _Exit skips
+                // destructors and hands the distinct code to the
+                // launcher, which restarts the session
+                std::_Exit(3);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Writes the stall report and the profiler trace.
+ *
+ * @param stalledChannel The channel that went quiet.
+ * @param quietSeconds How long it has been quiet.
+ */
+void Watchdog::report(int stalledChannel, float quietSeconds)
+{
+    static const char* channelNames[ChannelCount] = { "tick", "render" };
+    static int reportIndex = 0;
+
+    char path[64];
+    std::snprintf(path, sizeof(path), "watchdog_stall_%d.txt", reportIndex);
+
+    std::FILE* file = std::fopen(path, "w");
+    if (file)
+    {
+        std::fprintf(file, "stalled: %s loop, quiet %.1fs (timeout %.1fs)\n",
+                     channelNames[stalledChannel], quietSeconds, timeout);
+        for (int c = 0; c < ChannelCount; ++c)
+        {
+            const std::uint64_t beat = heartbeats[c].load(std::memory_order_relaxed);
+            std::fprintf(file, "%s: beats %llu, last phase marker %u%s\n",
+                         channelNames[c],
+                         static_cast<unsigned long long>(beat >> 8),
+                         static_cast<unsigned>(beat & 0xFF),
+                         c == stalledChannel ? " (stalled)" : "");
+        }
+        std::fclose(file);
+    }
+
+    if (profiler)
+    {
+        // The snapshot reads race the render thread's stores when that
+        // loop is the one still alive; for a diagnosis dump a torn
+        // sample beats no sample. The exporter writes on its own
+        // thread and is joined by its destructor.
+        static TraceExporter exporter;
+        std::snprintf(path, sizeof(path), "watchdog_stall_%d.json", reportIndex);
+        exporter.capture(*profiler, path);
+    }
+    ++reportIndex;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "frame_profiler.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Stall watchdog for the cabinet hard-freeze.
+ *
+ * A driver stall inside window.display() or a deadlock between the
+ * tick and render threads leaves a black screen and zero data. The
+ * watchdog runs a low-priority polling thread that both loops feed
+ * with heartbeats — a single atomic store per iteration, the packed
+ * beat counter and current phase marker — and when a heartbeat goes
+ * quiet past the timeout it writes a stall report to disk: which
+ * thread stopped, how long ago, the phase it was in, and the
+ * profiler's last two seconds of per-phase timings as a tracing JSON
+ * next to the report. Optionally the process then exits with a
+ * distinct code so the kiosk launcher restarts the session; exiting is
+ * the only restart a frozen process can still perform.
+ */
+class Watchdog {
+public:
+    /**
+     * @brief The heartbeat channels, one per monitored loop.
+     */
+    enum Channel {
+        TickLoop = 0, ///< The fixed-timestep loop in main().
+        RenderLoop, ///< The render thread's frame loop.
+        ChannelCount ///< Number of channels.
+    };
+
+    ~Watchdog();
+
+    /**
+     * @brief Starts the polling thread.
+     *
+     * @param profiler Profiler whose window goes into a stall report;
+     * may be null to skip the trace.
+     * @param timeoutSeconds Quiet time on any channel that counts as a
+     * stall.
+     * @param exitOnStall Whether to exit (code 3) after the report so
+     * the launcher restarts the session.
+     */
+    void start(const FrameProfiler* profiler, float timeoutSeconds = 5.0f, bool exitOnStall = false);
+
+    /**
+     * @brief One heartbeat; call every loop iteration.
+     *
+     * One atomic store: the caller-side beat counter packed with the
+     * phase marker, so the report can say where a loop stopped.
+     *
+     * @param channel The calling loop's channel.
+     * @param phase Small phase marker identifying the loop's position.
+     */
+    void beat(Channel channel, std::uint32_t phase)
+    {
+        // counters[] is only touched by the owning loop; the packed
+        // store is the single point the watchdog thread reads
+        heartbeats[channel].store((++counters[channel] << 8) | (phase & 0xFF), std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @brief The polling loop; runs until the destructor.
+     */
+    void run();
+
+    /**
+     * @brief Writes the stall report and the profiler trace.
+     *
+     * @param stalledChannel The channel that went quiet.
+     * @param quietSeconds How long it has been quiet.
+     */
+    void report(int stalledChannel, float quietSeconds);
+
+    std::atomic<std::uint64_t> heartbeats[ChannelCount] = {}; ///< Packed beat counter and phase per channel.
+    std::uint64_t counters[ChannelCount] = {}; ///< Caller-side beat counters; one owner each.
+    const FrameProfiler* profiler = nullptr; ///< Source of the trace in a report; may be null.
+    float timeout = 5.0f; ///< Quiet seconds that count as a stall.
+    bool exitAfterReport = false; ///< Whether a stall exits for the launcher to restart.
+    std::thread worker; ///< The polling thread.
+    std::atomic<bool> running{ false }; ///< Cleared by the destructor to stop the poll.
+};
@@ -0,0 +1,112 @@
+#include "../Project1/replay_pack.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Offline replay compressor for the analytics pipeline.
+ *
+ * Packs recorded sessions (.brpl) into transition-timeline packs
+ * (.brpk, see replay_pack.h), verifies each pack reproduces its
+ * replay's per-tick input exactly, and reports the sizes, so the
+ * fleet's backhaul cost per session is a column in the output. After
+ * packing, every pack is decoded repeatedly in memory and the batch
+ * decode rate is printed — the figure that bounds how many cabinet
+ * sessions per second the analytics side can churn through.
+ *
+ * Usage: ReplayPack <session.brpl> [more.brpl ...]
+ *
+ * Each pack is written next to its input with the extension replaced
+ * by .brpk.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: ReplayPack <session.brpl> [more.brpl ...]\n");
+        return 2;
+    }
+
+    std::vector<std::vector<std::uint8_t>> packs;
+    long long bytesIn = 0;
+    long long bytesOut = 0;
+    double minutes = 0.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::vector<std::uint8_t> pack;
+        if (!packReplayFile(argv[i], pack))
+        {
+            std::fprintf(stderr, "cannot pack %s\n", argv[i]);
+            return 1;
+        }
+        if (!verifyPackAgainstReplay(argv[i], pack.data(), pack.size()))
+        {
+            std::fprintf(stderr, "verification failed for %s\n", argv[i]);
+            return 1;
+        }
+
+        std::string outPath = argv[i];
+        const std::size_t dot = outPath.rfind('.');
+        outPath = (dot == std::string::npos ? outPath : outPath.substr(0, dot)) + ".brpk";
+        std::FILE* file = std::fopen(outPath.c_str(), "wb");
+        if (!file || std::fwrite(pack.data(), 1, pack.size(), file) != pack.size())
+        {
+            std::fprintf(stderr, "cannot write %s\n", outPath.c_str());
+            if (file)
+                std::fclose(file);
+            return 1;
+        }
+        std::fclose(file);
+
+        long long inSize = 0;
+        if (std::FILE* in = std::fopen(argv[i], "rb"))
+        {
+            std::fseek(in, 0, SEEK_END);
+            inSize = std::ftell(in);
+            std::fclose(in);
+        }
+
+        PackReader reader;
+        reader.open(pack.data(), pack.size());
+        const double fileMinutes = reader.tickCount() / (120.0 * 60.0);
+        std::printf("%s: ticks=%llu bytes_in=%lld bytes_out=%zu bytes_per_min=%.0f -> %s\n",
+                    argv[i], (unsigned long long)reader.tickCount(), inSize, pack.size(),
+                    fileMinutes > 0.0 ? pack.size() / fileMinutes : 0.0, outPath.c_str());
+
+        bytesIn += inSize;
+        bytesOut += static_cast<long long>(pack.size());
+        minutes += fileMinutes;
+        packs.push_back(std::move(pack));
+    }
+
+    // Batch decode rate: every pack decoded in a loop for a second or
+    // so, the shape of the analytics pipeline's inner loop
+    long long decoded = 0;
+    long long events = 0;
+    const auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (const std::vector<std::uint8_t>& pack : packs)
+        {
+            PackReader reader;
+            reader.open(pack.data(), pack.size());
+            replaypack::Event event;
+            while (reader.next(event))
+                events += event.bits != 0;  // Keeps the loop observable
+            decoded++;
+        }
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < 1.0);
+
+    std::printf("total: files=%d bytes_in=%lld bytes_out=%lld ratio=%.1f bytes_per_min=%.0f "
+                "decode_files_per_sec=%.0f\n",
+                argc - 1, bytesIn, bytesOut,
+                bytesOut > 0 ? static_cast<double>(bytesIn) / bytesOut : 0.0,
+                minutes > 0.0 ? bytesOut / minutes : 0.0,
+                decoded / elapsed);
+    return events == -1 ? 3 : 0;
+}
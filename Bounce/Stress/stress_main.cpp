@@ -0,0 +1,242 @@
+#include "../Project1/simulation.h"
+#include "../Project1/simd_aabb.h"
+#include "../Project1/level_loader.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * @brief Stress-scenario generator for finding scaling cliffs.
+ *
+ * The shipped level has a few dozen entities, so scaling problems only
+ * ever showed up in the field. This tool procedurally builds headless
+ * levels up to a million entities, runs the real tick loop over them,
+ * and reports throughput, peak memory and a per-phase breakdown as one
+ * key=value line per scenario, so before/after numbers for any
+ * broadphase, SIMD or job-system change are a diff of two outputs.
+ *
+ * Usage: Stress [--entities n] [--ticks n] [--density perChunk]
+ *               [--obstacleRatio r]
+ *
+ * Without --entities the tool sweeps 1k/10k/100k/1M. Density is
+ * entities per 1024px chunk (default 16, roughly the shipped level);
+ * obstacleRatio is the fraction of entities that patrol (default 0.25),
+ * with the remainder split between platforms, walls and coins.
+ */
+
+namespace {
+
+volatile float g_sink = 0.0f; ///< Keeps results observable so loops are not optimized away.
+
+/**
+ * @brief Peak resident set size of this process in kilobytes.
+ *
+ * @return long long Peak RSS, or 0 if the platform query fails.
+ */
+long long peakRssKb()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return static_cast<long long>(usage.ru_maxrss);  // Already kilobytes on Linux
+#endif
+}
+
+/**
+ * @brief Builds a stress level of @p entityCount entities.
+ *
+ * Entities are laid out in a strip along x whose pitch comes from the
+ * density, so the broadphase sees the requested occupancy per chunk
+ * regardless of total count. The obstacle ratio carves patrollers out
+ * of the total; the rest is split 2:1:1 between platforms, walls and
+ * coins, matching the shipped level's proportions.
+ *
+ * @param entityCount Total entity count.
+ * @param density Entities per 1024px chunk.
+ * @param obstacleRatio Fraction of entities that are obstacles.
+ * @return LevelData The stress level.
+ */
+LevelData makeStressLevel(long long entityCount, float density, float obstacleRatio)
+{
+    LevelData level;
+    const long long obstacleCount = static_cast<long long>(entityCount * obstacleRatio);
+    const long long rest = entityCount - obstacleCount;
+    const long long platformCount = rest / 2;
+    const long long wallCount = rest / 4;
+    const long long coinCount = rest - platformCount - wallCount;
+
+    level.platforms.reserve(platformCount);
+    level.walls.reserve(wallCount);
+    level.obstacles.reserve(obstacleCount);
+    level.coins.reserve(coinCount);
+
+    // One entity every pitch pixels gives exactly density per chunk
+    const float pitch = 1024.0f / density;
+    float x = 100.0f;
+    long long placed[4] = { 0, 0, 0, 0 };
+    const long long wanted[4] = { platformCount, wallCount, obstacleCount, coinCount };
+    for (long long i = 0; i < entityCount; ++i, x += pitch)
+    {
+        // Round-robin over the archetypes that still have quota, so
+        // the mix is uniform along the strip rather than segregated
+        int kind = static_cast<int>(i % 4);
+        while (placed[kind] >= wanted[kind])
+            kind = (kind + 1) % 4;
+        ++placed[kind];
+
+        const float y = 380.0f + static_cast<float>(i % 3) * 60.0f;
+        switch (kind)
+        {
+        case 0: level.platforms.push_back({ x, y, pitch * 0.5f, 20.0f }); break;
+        case 1: level.walls.push_back({ x, 400.0f, 20.0f, 160.0f }); break;
+        case 2: level.obstacles.push_back({ x, 530.0f, 50.0f, 50.0f, x - pitch, x + pitch }); break;
+        default: level.coins.push_back({ x, 340.0f }); break;
+        }
+    }
+
+    level.floor = { 0.0f, 580.0f, x + 500.0f, 20.0f };
+    level.goal = { x, 250.0f, 100.0f, 20.0f };
+    return level;
+}
+
+/**
+ * @brief Times @p fn over @p iterations and returns nanoseconds per call.
+ *
+ * @param iterations Number of timed calls (one warm-up runs first).
+ * @param fn The operation under test.
+ * @return double Nanoseconds per call.
+ */
+template <typename Fn>
+double timeNs(long long iterations, Fn fn)
+{
+    fn();  // Warm-up
+    const auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i)
+        fn();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+/**
+ * @brief Runs one stress scenario and prints its report line.
+ *
+ * @param entityCount Total entity count of the scenario.
+ * @param tickCount Ticks to run for the throughput measurement.
+ * @param density Entities per 1024px chunk.
+ * @param obstacleRatio Fraction of entities that are obstacles.
+ */
+void runScenario(long long entityCount, long long tickCount, float density, float obstacleRatio)
+{
+    LevelData level = makeStressLevel(entityCount, density, obstacleRatio);
+
+    Simulation sim;
+    sim.init(level);
+    JobSystem jobSystem;
+    sim.setJobSystem(&jobSystem);
+
+    const float dt = 1.0f / 120.0f;
+    InputState input;
+    input.right = true;
+
+    // Throughput: the real tick loop with the scripted runner, resets
+    // included, exactly like a headless soak
+    const auto start = std::chrono::steady_clock::now();
+    for (long long t = 0; t < tickCount; ++t)
+    {
+        input.up = (t % 60) == 0;  // Hop every half second of simulated time
+        sim.tick(dt, input);
+        if (sim.playerY > 10000.0f || sim.levelCompleted)
+            sim.reset();
+        g_sink += sim.playerX;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+
+    // Per-phase breakdown: the tick's constituent passes timed in
+    // isolation, so a regression names its phase instead of hiding in
+    // the total
+    const long long phaseIters = std::max<long long>(10, tickCount / 10);
+    const double obstaclesNs = timeNs(phaseIters, [&] {
+        sim.store.moveObstacles(dt);
+        g_sink += sim.store.obstacleX.empty() ? 0.0f : sim.store.obstacleX[0];
+    });
+    std::vector<std::size_t> candidates;
+    const double broadphaseNs = timeNs(phaseIters, [&] {
+        sim.platformHash.query(sim.playerX, sim.playerY, 40.0f, 40.0f, candidates);
+        sim.wallHash.query(sim.playerX, sim.playerY, 40.0f, 40.0f, candidates);
+        g_sink += static_cast<float>(candidates.size());
+    });
+    const double coinsNs = timeNs(phaseIters, [&] {
+        int touched = 0;
+        sim.coinAlive.forEachSet([&](std::size_t i) {
+            if (aabbIntersects(sim.playerX, sim.playerY, 40.0f, 40.0f,
+                               sim.coinBounds[i].x, sim.coinBounds[i].y, sim.coinBounds[i].w, sim.coinBounds[i].h))
+                touched++;
+        });
+        g_sink += static_cast<float>(touched);
+    });
+
+    std::printf("entities=%lld density=%.1f obstacleRatio=%.2f ticks=%lld "
+                "ticks_per_sec=%.0f peak_rss_kb=%lld "
+                "obstacles_ns=%.0f broadphase_ns=%.0f coins_ns=%.0f\n",
+                entityCount, density, obstacleRatio, tickCount,
+                tickCount / seconds, peakRssKb(),
+                obstaclesNs, broadphaseNs, coinsNs);
+    std::fflush(stdout);
+}
+
+} // namespace
+
+/**
+ * @brief Runs the requested scenario, or the default sweep.
+ *
+ * @param argc Argument count.
+ * @param argv Scenario flags; see the file header.
+ * @return int Always 0.
+ */
+int main(int argc, char* argv[])
+{
+    long long entityCount = 0;  // 0: sweep the default sizes
+    long long tickCount = 2000;
+    float density = 16.0f;
+    float obstacleRatio = 0.25f;
+
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--entities") == 0)
+            entityCount = std::atoll(argv[++i]);
+        else if (std::strcmp(argv[i], "--ticks") == 0)
+            tickCount = std::atoll(argv[++i]);
+        else if (std::strcmp(argv[i], "--density") == 0)
+            density = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--obstacleRatio") == 0)
+            obstacleRatio = static_cast<float>(std::atof(argv[++i]));
+    }
+
+    if (entityCount > 0)
+    {
+        runScenario(entityCount, tickCount, density, obstacleRatio);
+        return 0;
+    }
+
+    const long long sweep[] = { 1000, 10000, 100000, 1000000 };
+    for (long long size : sweep)
+        runScenario(size, tickCount, density, obstacleRatio);
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include "../Project1/telemetry_format.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Offline decoder for telemetry ring files.
+ *
+ * Prints a cabinet's telemetry records oldest first, one line each, so
+ * a file pulled off a machine (or collected by the fleet monitor) can
+ * be read without the engine. Shares only telemetry_format.h with the
+ * game.
+ *
+ * Usage: TelemetryDump <file.btl>
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: TelemetryDump <file.btl>\n");
+        return 2;
+    }
+
+    std::FILE* file = std::fopen(argv[1], "rb");
+    if (!file)
+    {
+        std::fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    telemetry::Header header;
+    const bool valid = std::fread(&header, sizeof(header), 1, file) == 1
+        && std::memcmp(header.magic, "BTLM", 4) == 0
+        && header.version == telemetry::telemetryVersion
+        && header.slotCount > 0;
+    if (!valid)
+    {
+        std::fprintf(stderr, "%s is not a telemetry ring file\n", argv[1]);
+        std::fclose(file);
+        return 1;
+    }
+
+    std::vector<telemetry::Record> slots(header.slotCount);
+    const std::size_t read = std::fread(slots.data(), sizeof(telemetry::Record), slots.size(), file);
+    std::fclose(file);
+
+    // The ring's oldest record sits at the write cursor once the file
+    // has wrapped; before that the valid records start at slot zero
+    const std::uint64_t count = header.written < header.slotCount ? header.written : header.slotCount;
+    const std::uint32_t first = header.written < header.slotCount ? 0 : header.nextSlot;
+    std::printf("%s: %llu records (%llu written, %u slots)\n", argv[1],
+                (unsigned long long)count, (unsigned long long)header.written, header.slotCount);
+    std::printf("%10s %12s %6s %7s %6s %6s %8s %8s %8s %8s %8s %8s %4s %6s\n",
+                "uptime_s", "tick", "coins", "bounces", "deaths", "resets",
+                "p50_ms", "p95_ms", "p99_ms", "worst_ms", "cpm", "goal_s",
+                "tier", "shifts");
+
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        const std::uint32_t slot = (first + i) % header.slotCount;
+        if (slot >= read)
+            continue;  // Truncated file; print what exists
+        const telemetry::Record& r = slots[slot];
+        std::printf("%10.1f %12llu %6u %7u %6u %6u %8.2f %8.2f %8.2f %8.2f %8.1f %8.1f %4u %6u\n",
+                    r.uptimeMs / 1000.0, (unsigned long long)r.tickIndex,
+                    r.coinCount, r.bounceCount, r.deathCount, r.resetCount,
+                    r.frameP50Ms, r.frameP95Ms, r.frameP99Ms, r.frameWorstMs,
+                    r.coinsPerMinute, r.goalSeconds, r.degradeTier, r.degradeShifts);
+    }
+    return 0;
+}